@@ -129,8 +129,12 @@ function initAlertsPage() {
     // Initial data fetch
     fetchAlertData();
     
-    // Auto-refresh data every 30 seconds
-    setInterval(fetchAlertData, 30000);
+    // Alerts are pushed by the station as soon as a sensor changes category;
+    // polling is only a fallback
+    subscribeToEvents();
+    setInterval(() => {
+        if (!eventsConnected) fetchAlertData();
+    }, 30000);
     
     // Add event listeners for alert acknowledge/dismiss buttons
     document.addEventListener('click', function(e) {
@@ -154,6 +158,36 @@ function initAlertsPage() {
     });
 }
 
+// Subscribe to /api/events (Server-Sent Events)
+let eventsConnected = false;
+const sensorCategories = {};
+function subscribeToEvents() {
+    if (!('EventSource' in window)) return;
+    
+    const events = new EventSource('/api/events');
+    events.addEventListener('open', () => {
+        eventsConnected = true;
+        updateNetworkStatus(true);
+    });
+    events.addEventListener('error', () => {
+        // The browser reconnects by itself; poll in the meantime
+        eventsConnected = false;
+    });
+    events.addEventListener('sensor', event => {
+        const sensor = JSON.parse(event.data);
+        const previous = sensorCategories[sensor.mac];
+        sensorCategories[sensor.mac] = sensor.category;
+        
+        // Notify when a known sensor moves up to warning or alert
+        if (previous !== undefined && sensor.category > previous) {
+            const type = sensor.category >= 2 ? 'critical' : 'warning';
+            if (alertSettings.enableSound) playAlertSound(type);
+            notifyUser(`${sensor.status}: ${sensor.name}`, `Water level ${sensor.waterLevel.toFixed(1)} cm`);
+            fetchAlertData();
+        }
+    });
+}
+
 // Update system time display
 function updateTime() {
     const now = new Date();
@@ -78,8 +78,54 @@ function initSensorsPage() {
     // Initial data fetch
     fetchSensorsData();
     
-    // Auto-refresh data every 30 seconds
-    setInterval(fetchSensorsData, 30000);
+    // Live sensor changes pushed by the station; polling is only a fallback
+    subscribeToEvents();
+    setInterval(() => {
+        if (!eventsConnected) fetchSensorsData();
+    }, 30000);
+}
+
+// Subscribe to /api/events (Server-Sent Events)
+let eventsConnected = false;
+function subscribeToEvents() {
+    if (!('EventSource' in window)) return;
+    
+    const events = new EventSource('/api/events');
+    events.addEventListener('open', () => {
+        eventsConnected = true;
+        updateNetworkStatus(true);
+    });
+    events.addEventListener('error', () => {
+        // The browser reconnects by itself; poll in the meantime
+        eventsConnected = false;
+    });
+    events.addEventListener('sensor', event => {
+        const sensor = JSON.parse(event.data);
+        const index = sensorsData.findIndex(s => s.mac === sensor.mac);
+        if (index >= 0) {
+            sensorsData[index] = sensor;
+        } else {
+            sensorsData.push(sensor);
+        }
+        refreshSensors();
+        
+        // Keep the details panel of the selected sensor current
+        if (selectedSensor && selectedSensor.mac === sensor.mac) {
+            showSensorDetails(sensor);
+        }
+    });
+    events.addEventListener('sensor-lost', event => {
+        const lost = JSON.parse(event.data);
+        sensorsData = sensorsData.filter(s => s.mac !== lost.mac);
+        refreshSensors();
+    });
+}
+
+// Re-render the table (keeping the search filter) and map after a pushed change
+function refreshSensors() {
+    filterSensors();
+    updateSensorMap(sensorsData);
+    lastUpdatedEl.textContent = `Last updated: ${new Date().toLocaleTimeString()}`;
 }
 
 // Update system time display
@@ -107,10 +153,23 @@ function formatLastUpdated(timestamp) {
     return `Last updated: ${date.toLocaleTimeString()}`;
 }
 
+// /api/sensors gives absolute lastSeen times (seconds of uptime) so that its
+// body can be cached; the current uptime comes in the X-Uptime header
+function readSensorsResponse(response) {
+    const now = parseInt(response.headers.get('X-Uptime'), 10) || 0;
+    return response.json().then(data => {
+        data.timestamp = now;
+        (data.sensors || []).forEach(sensor => {
+            sensor.lastSeenSeconds = Math.max(0, now - sensor.lastSeen);
+        });
+        return data;
+    });
+}
+
 // Fetch sensor data
 function fetchSensorsData() {
     fetch('/api/sensors')
-        .then(response => response.json())
+        .then(readSensorsResponse)
         .then(data => {
             // Update data store
             sensorsData = data.sensors || [];
@@ -308,12 +367,40 @@ function hideSensorDetails() {
 
 // Update sensor history chart
 function updateSensorHistoryChart(sensor) {
-    const ctx = document.getElementById('sensor-history-chart').getContext('2d');
-    
-    // In a real implementation, we would fetch historical data for this specific sensor
-    // For this demo, we'll use mock data with some randomization based on current values
-    
-    // Generate semi-random history data based on current values
+    // Minute averages kept by the master (last 2 hours)
+    fetch(`/api/history?sensor=${encodeURIComponent(sensor.mac)}&res=1m`)
+        .then(response => {
+            if (!response.ok) {
+                throw new Error('No history for this sensor');
+            }
+            return response.json();
+        })
+        .then(history => {
+            if (history.points.length === 0) {
+                throw new Error('Empty history');
+            }
+            renderSensorHistoryChart(historyFromApi(history));
+        })
+        .catch(error => {
+            console.error('Error fetching sensor history:', error);
+            // If the API fails, show mock data for demo purposes
+            renderSensorHistoryChart(mockSensorHistory(sensor));
+        });
+}
+
+// Convert /api/history points ([time, waterLevel, temperature, category],
+// time in seconds of the station clock given by "now") to chart data
+function historyFromApi(history) {
+    const receivedAt = Date.now();
+    return {
+        timestamps: history.points.map(p => receivedAt - (history.now - p[0]) * 1000),
+        waterLevels: history.points.map(p => p[1]),
+        temperatures: history.points.map(p => p[2])
+    };
+}
+
+// Semi-random history trending toward the current values (demo only)
+function mockSensorHistory(sensor) {
     const historyData = {
         timestamps: [...mockHistoryData.timestamps],
         waterLevels: [],
@@ -346,6 +433,14 @@ function updateSensorHistoryChart(sensor) {
     // Add current temperature
     historyData.temperatures.push(currentTemp);
     
+    return historyData;
+}
+
+// Draw the history chart
+function renderSensorHistoryChart(historyData) {
+    const ctx = document.getElementById('sensor-history-chart').getContext('2d');
+    const lowestWaterLevel = Math.min(...historyData.waterLevels);
+    
     // Format timestamps
     const labels = historyData.timestamps.map(ts => {
         const date = new Date(ts);
@@ -357,6 +452,7 @@ function updateSensorHistoryChart(sensor) {
         historyChart.data.labels = labels;
         historyChart.data.datasets[0].data = historyData.waterLevels;
         historyChart.data.datasets[1].data = historyData.temperatures;
+        historyChart.options.scales.y.min = Math.max(0, Math.floor(lowestWaterLevel * 0.8));
         historyChart.update();
     } else {
         historyChart = new Chart(ctx, {
@@ -416,7 +512,7 @@ function updateSensorHistoryChart(sensor) {
                             display: true,
                             text: 'Water Level (cm)'
                         },
-                        min: Math.max(0, Math.floor(startingWaterLevel * 0.8)),
+                        min: Math.max(0, Math.floor(lowestWaterLevel * 0.8)),
                     },
                     y1: {
                         type: 'linear',
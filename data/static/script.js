@@ -48,8 +48,48 @@ function initDashboard() {
     // Initial data fetch
     fetchAllData();
     
-    // Auto-refresh data every 30 seconds
-    setInterval(fetchAllData, 30000);
+    // Live sensor changes pushed by the station; polling is only a fallback
+    subscribeToEvents();
+    setInterval(() => {
+        if (!eventsConnected) fetchAllData();
+    }, 30000);
+}
+
+// Subscribe to /api/events (Server-Sent Events)
+let eventsConnected = false;
+function subscribeToEvents() {
+    if (!('EventSource' in window)) return;
+    
+    const events = new EventSource('/api/events');
+    events.addEventListener('open', () => {
+        eventsConnected = true;
+        updateNetworkStatus(true);
+    });
+    events.addEventListener('error', () => {
+        // The browser reconnects by itself; poll in the meantime
+        eventsConnected = false;
+    });
+    events.addEventListener('sensor', event => {
+        const sensor = JSON.parse(event.data);
+        const index = sensorsData.findIndex(s => s.mac === sensor.mac);
+        if (index >= 0) {
+            sensorsData[index] = sensor;
+        } else {
+            sensorsData.push(sensor);
+        }
+        refreshSensors();
+    });
+    events.addEventListener('sensor-lost', event => {
+        const lost = JSON.parse(event.data);
+        sensorsData = sensorsData.filter(s => s.mac !== lost.mac);
+        refreshSensors();
+    });
+}
+
+// Re-render the sensor panels from sensorsData after a pushed change
+function refreshSensors() {
+    updateDashboard({ sensors: sensorsData }, systemStatus);
+    lastUpdatedEl.textContent = `Last updated: ${new Date().toLocaleTimeString()}`;
 }
 
 // Update system time display
@@ -95,10 +135,23 @@ function formatUptime(seconds) {
     return result;
 }
 
+// /api/sensors gives absolute lastSeen times (seconds of uptime) so that its
+// body can be cached; the current uptime comes in the X-Uptime header
+function readSensorsResponse(response) {
+    const now = parseInt(response.headers.get('X-Uptime'), 10) || 0;
+    return response.json().then(data => {
+        data.timestamp = now;
+        (data.sensors || []).forEach(sensor => {
+            sensor.lastSeenSeconds = Math.max(0, now - sensor.lastSeen);
+        });
+        return data;
+    });
+}
+
 // Fetch all data (sensors and system status)
 function fetchAllData() {
     Promise.all([
-        fetch('/api/sensors').then(response => response.json()),
+        fetch('/api/sensors').then(readSensorsResponse),
         fetch('/api/status').then(response => response.json())
     ])
     .then(([sensorsResponse, statusResponse]) => {
@@ -6,6 +6,9 @@
 // E_INK_DC_PIN    17  // Data/Command
 // E_INK_RST_PIN   16  // Reset
 // E_INK_BUSY_PIN  4   // Busy status
+#define EINK_TASK_CORE 0             // Rendu E-Ink sur le cœur 0 (la boucle Arduino tourne sur le cœur 1)
+#define EINK_TASK_PRIORITY 1         // Sur le cœur 0, sous les tâches WiFi/ESP-NOW (même priorité que la boucle, qui est sur le cœur 1)
+#define EINK_TASK_STACK_SIZE 4096
 
 // Mode de fonctionnement - changer cette valeur pour compiler soit le master, soit le slave
 #define MODE_MASTER true  // true pour master, false pour slave
@@ -15,10 +18,31 @@
 #define SLAVE_NAME "WaterSensor"    // Nom pour le slave
 #define MIN_PEERS 1                 // Nombre minimum de pairs à connecter
 #define WIFI_CHANNEL 1              // Canal WiFi pour ESP-NOW
+#define WIRE_FORMAT_LEGACY_TX 0     // 1 = émettre l'ancienne structure brute (réseau mixte en cours de mise à jour)
 
 // Configuration WiFi (uniquement pour le master)
 #define AP_SSID "FloodAlertSystem"   // Nom du point d'accès
 #define AP_PASSWORD "floodalert123"  // Mot de passe du point d'accès
+#ifdef NATIVE_SIM
+#define HTTP_PORT 0                  // Port choisi par le système (plusieurs masters simulés)
+#else
+#define HTTP_PORT 80
+#endif
+#define HTTP_MAX_CONNECTIONS 8       // Connexions HTTP simultanées (tampons alloués au démarrage)
+#define HTTP_REQUEST_BUFFER 1024     // Requête complète : ligne, en-têtes et corps
+#define HTTP_OUTPUT_BUFFER 1436      // Tampon de sortie par connexion (un segment TCP)
+#define HTTP_MAX_ARGS 8              // Paramètres de requête retenus
+#define HTTP_MAX_ROUTES 16           // Routes enregistrées (toutes tables confondues)
+#define HTTP_ROUTE_SLOTS 32          // Index des chemins exacts (puissance de 2, > HTTP_MAX_ROUTES)
+#define HTTP_IDLE_TIMEOUT_MS 10000   // Connexion fermée sans progrès pendant ce délai
+#define HTTP_SEND_TIMEOUT_MS 200     // Attente maximale d'un handler sur un client qui ne lit pas
+#define ASSET_MANIFEST_PATH "/assets.idx"  // Index produit par tools/build_assets.py
+#define ASSET_MAX_AGE_S 31536000     // Cache navigateur des URL versionnées (?v=<etag>)
+#define JSON_STREAM_CHUNK_SIZE 512   // Tampon des réponses JSON envoyées par morceaux
+#define RESPONSE_CACHE_MAX_SENSORS 32  // Au-delà, /api/sensors est écrit en flux sans cache (~150 octets par capteur)
+#define EVENT_STREAM_MAX_CLIENTS 4   // Tableaux de bord abonnés à /api/events
+#define EVENT_STREAM_KEEPALIVE_MS 15000  // Commentaire envoyé aux abonnés inactifs
+#define EVENT_PUSH_DELAY_MS 250      // Regroupement des changements de valeur (une alerte part tout de suite)
 
 // Seuils d'alerte pour le niveau d'eau
 #define WATER_WARNING_THRESHOLD 10   // Seuil d'avertissement (en cm)
@@ -26,15 +50,27 @@
 
 // Configuration du capteur de niveau d'eau (pour slave)
 #define WATER_LEVEL_SENSOR_PIN 34    // GPIO pour le capteur de niveau d'eau
+#define SENSOR_SAMPLE_INTERVAL_MS 500  // Échantillonnage du niveau d'eau
+#define WATER_ADC_SAMPLE_RATE 20000  // Échantillonnage continu de l'ADC par DMA (Hz)
+#define WATER_ADC_BLOCK 256          // Échantillons combinés en une mesure
+#define WATER_LEVEL_IIR_ALPHA 0.5f   // Lissage entre deux mesures (1 = aucun)
+#define SENSOR_BATCH_MAX 32          // Mesures gardées entre deux envois au master
 
 // Configuration du capteur DHT11 (pour master)
 #define DHT11_PIN 2                  // GPIO pour le capteur DHT11
 #define TEMP_WARNING_THRESHOLD 35    // Seuil d'avertissement de température
+#define DHT_MIN_INTERVAL_MS 2000     // Intervalle minimal entre deux lectures du DHT11
+#define DHT_MAX_BACKOFF_MS 60000     // Attente maximale après des lectures ratées
+#define DHT_TASK_CORE 1              // Cœur de la boucle (APP_CPU_NUM) : la lecture masque les interruptions de son cœur, le WiFi/ESP-NOW (cœur 0) n'est pas touché
+#define DHT_TASK_PRIORITY 0          // Sous la boucle : la lecture passe quand elle attend un événement
+#define DHT_TASK_STACK_SIZE 2048
 
 // Configuration des LEDs pour les alertes visuelles
 #define LED_GREEN_PIN 23             // GPIO pour la LED verte
 #define LED_RED_PIN 22              // GPIO pour la LED rouge
 #define LED_YELLOW_PIN 4            // GPIO pour la LED jaune
+#define LED_PWM_FIRST_CHANNEL 2     // Canaux LEDC des LEDs (0 et 1 partagent le timer de tone())
+#define LED_PWM_FREQUENCY 5000      // Fréquence PWM des LEDs (Hz)
 
 // Configuration toogle swtich + led
 #define TOGGLE_SWITCH_PIN 32     // GPIO pin for toggle switch input
@@ -53,7 +89,35 @@
 // Configuration de l'alerte visuelle
 #define WATER_ALERT_DELAY_MS 60000  // Délai en milliseconds (1 minute) avant activation de l'alerte
 
-// Nombre maximum de capteurs distants
+// Nombre de capteurs distants suivis par défaut (taille du registre, choisie au démarrage)
 #define MAX_SENSORS 10
+#define SENSOR_TIMEOUT_MS 30000      // Capteur retiré après ce délai sans nouvelles
+
+// Limite haute du registre de capteurs (dimensionne l'index par MAC)
+#define SENSOR_REGISTRY_MAX 256
+
+// Historique des capteurs (master)
+#define HISTORY_RAW_BLOCKS 6            // Blocs compressés de mesures brutes par capteur
+#define HISTORY_RAW_BLOCK_BYTES 192     // Environ 60 mesures par bloc
+#define HISTORY_MINUTE_POINTS 120       // 2 heures à la minute
+#define HISTORY_HOUR_POINTS 72          // 3 jours à l'heure
+#define HISTORY_MEMORY_BUDGET 49152     // Octets de RAM pour toutes les séries
+#define HISTORY_FLUSH_INTERVAL_MS 900000  // Sauvegarde en flash toutes les 15 minutes
+#define HISTORY_FILE "/history.bin"
+
+// Journal série : les lignes sont mises en tampon, une tâche de fond les écrit
+#define LOG_BUFFER_LINES 64             // Puissance de 2 ; une ligne de plus est perdue (et comptée)
+#define LOG_LINE_LENGTH 120             // Caractères par ligne, la suite est tronquée
+#define LOG_DRAIN_INTERVAL_MS 20
+#define LOG_TASK_PRIORITY 0             // Ne passe que quand la boucle principale attend
+#define LOG_TASK_STACK_SIZE 2048
+
+// Stockage des singletons utilisés par les callbacks statiques : global sur
+// l'ESP32, un par thread dans la simulation native (un thread = une carte)
+#ifdef NATIVE_SIM
+#define NODE_LOCAL thread_local
+#else
+#define NODE_LOCAL
+#endif
 
 #endif // CONFIG_H
\ No newline at end of file
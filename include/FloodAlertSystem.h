@@ -2,25 +2,21 @@
 #define FLOOD_ALERT_SYSTEM_H
 
 #include "Config.h"
+#include "SystemState.h"
 #include "network/FloodAlertNetwork.h"
 #include "FloodAlertWebServer.h"
+#include "network/ResponseCache.h"
 #include "sensors/SensorBase.h"
+#include "sensors/SensorRegistry.h"
+#include "sensors/TimeSeriesStore.h"
 #include "indicators/LEDAlertIndicator.h"
 #include "indicators/BuzzerAlertIndicator.h"
 #include "indicators/ToggleSwitchIndicator.h" // Include toggle switch header
 #include "indicators/EInkDisplay.h" // Add E-Ink display header
+#include "utils/Scheduler.h"
 #include <vector>
 
-// Structure pour stocker les données des capteurs
-struct SensorData {
-    uint8_t mac[6];    // Adresse MAC
-    char name[16];     // Nom du périphérique
-    float waterLevel;  // Niveau d'eau actuel
-    float temperature; // Température actuelle
-    uint8_t category;  // Catégorie d'alerte
-    uint32_t lastSeen; // Dernière fois où les données ont été reçues
-    bool active;       // Ce capteur est-il actif
-};
+class JsonStreamWriter;
 
 // Classe principale du système
 class FloodAlertSystem {
@@ -29,6 +25,11 @@ public:
     ~FloodAlertSystem();
     
     bool begin(bool isMaster);
+    
+    // Nombre de capteurs distants suivis par le master (à appeler avant begin)
+    void setSensorCapacity(uint16_t capacity) { _sensorCapacity = capacity; }
+    
+    // Exécuter les tâches prêtes (dort jusqu'à la prochaine échéance ou un signal)
     void update();
     
     // Gestion des capteurs
@@ -59,48 +60,106 @@ public:
     // Accès aux composants principaux
     FloodAlertNetwork& getNetwork() { return _network; }
     FloodAlertWebServer& getWebServer() { return _webServer; }
+    Scheduler& getScheduler() { return _scheduler; }
     
     // Accès aux données des capteurs (pour l'affichage)
     SensorData* getSensorData(int index);
     int getSensorCount();
+    SensorRegistry& getSensors() { return _remoteSensors; }
+    TimeSeriesStore& getHistory() { return _history; }
+    const ResponseCache& getSensorsCache() const { return _sensorsCache; }
+    const ResponseCache& getStatusCache() const { return _statusCache; }
     float getHighestWaterLevel();
     float getAverageTemperature();
     uint8_t getHighestAlertCategory();
+
+    // État observable : les abonnés sont appelés (dans la boucle) quand un
+    // champ change, avec le masque des champs concernés
+    const SystemState& getSystemState() const { return _state; }
+    bool addStateListener(SystemStateListener listener, void* context);
     
 private:
     bool _isMaster;
     bool _isRunning = false;
     FloodAlertNetwork _network;
     FloodAlertWebServer _webServer;
+    Scheduler _scheduler;
+    uint8_t _indicatorTask = Scheduler::INVALID_TASK;
+    uint8_t _radioTask = Scheduler::INVALID_TASK;
+    uint8_t _eventsTask = Scheduler::INVALID_TASK;
+    unsigned long _lastToggleBuzzerTime = 0;
     std::vector<SensorBase*> _sensors;
+
+    // Mesures échantillonnées par l'esclave en attente d'envoi au master
+    sensor_batch_t _batch;
+    uint32_t _batchTimes[SENSOR_BATCH_MAX];  // millis() de chaque mesure du lot
+    uint8_t _lastSampleCategory = 0;
     LEDAlertIndicator* _ledIndicator = nullptr;
     BuzzerAlertIndicator* _buzzerIndicator = nullptr;
     ToggleSwitchIndicator* _toggleSwitchIndicator = nullptr;
     EInkDisplay* _einkDisplay = nullptr; // Add E-Ink display pointer
-    unsigned long _lastStatusUpdate = 0;
-    unsigned long _lastEInkUpdate = 0; // Track last E-Ink update time
+
+    // État observable et ses abonnés
+    static const uint8_t MAX_STATE_LISTENERS = 4;
+    struct StateListener {
+        SystemStateListener callback;
+        void* context;
+    };
+    SystemState _state = {};
+    StateListener _stateListeners[MAX_STATE_LISTENERS];
+    uint8_t _stateListenerCount = 0;
+    uint8_t _stateTask = Scheduler::INVALID_TASK;
+    uint32_t _networkGeneration = 0;
 
     // Liste des capteurs distants
-    SensorData _remoteSensors[MAX_SENSORS];
-    uint8_t _remoteSensorCount = 0;
+    SensorRegistry _remoteSensors;
+    uint16_t _sensorCapacity = MAX_SENSORS;
+    TimeSeriesStore _history;
+
+    // Réponses partagées par les tableaux de bord tant que l'état ne change pas
+    ResponseCache _sensorsCache;
+    ResponseCache _statusCache;
 
     // Gestion du réseau et des capteurs
     void setupWebServer();
+    void setupTasks();
     void processLocalSensors();
     void updateInactiveSensors();
+    void sampleSensorData();
     void sendSensorData();
-    void handleSensorData(const float* data, uint8_t count, const uint8_t* mac, const char* sensorName);
+    // ageMs : âge de la mesure à la réception (0 pour une trame SENSOR_DATA, sans horodatage)
+    void handleSensorData(const float* data, uint8_t count, const uint8_t* mac, const char* sensorName, uint32_t ageMs = 0);
+    void handleSensorBatch(const sensor_batch_t& batch, const uint8_t* mac);
+    SensorData* storeSensorData(const float* data, uint8_t count, const uint8_t* mac, const char* sensorName, uint32_t ageMs);
     void updateIndicators(float waterLevel, uint8_t category);
+    void pushSensorEvents();
+    void updateToggleSwitch();
+    void tickIndicators();
+    void sendPeriodicStatus();
+    void updateSystemState();
+    
+    // Handlers HTTP, enregistrés par la table ROUTES
+    static const HttpRoute ROUTES[];
+    void handleSensorsApi();
+    void writeSensorsJson(JsonStreamWriter& json);
+    void handleHistoryApi();
+    void handleEventsApi();
+    void handleStatusApi();
+    void handleRoot();
+    void handleStaticFile();
+    void handleSilenceApi();
     
     // Traitement des commandes série
     void processSerialCommands();
     
     // Instance singleton pour les callbacks
-    static FloodAlertSystem* _instance;
+    static NODE_LOCAL FloodAlertSystem* _instance;
     
     // Callbacks statiques pour FloodAlertNetwork
     static void onMessageReceived(const network_message_t& msg, const uint8_t* mac);
     static void onDataReady(float* data, uint8_t count);
+    static void onFrameQueued();
+    static void onBatchReceived(const sensor_batch_t& batch, const uint8_t* mac);
     
     // Added: Update E-Ink display with current system state
     void updateEInkDisplay();
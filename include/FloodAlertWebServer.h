@@ -2,14 +2,21 @@
 #define FLOOD_ALERT_WEB_SERVER_H
 
 #include <WiFi.h>
-#include <WebServer.h>
+#include "network/AssetBundle.h"
+#include "network/HttpServer.h"
 #include <SPIFFS.h>
 #include <DNSServer.h>
+#include "Config.h"
+#include "utils/Logger.h"
 
 class FloodAlertWebServer {
 public:
     // Constructor with default port
-    FloodAlertWebServer(int port = 80) : server(port), dnsServer(NULL), captivePortalEnabled(false) {}
+    FloodAlertWebServer(int port = HTTP_PORT) : server(port), dnsServer(NULL), captivePortalEnabled(false), lastEventMs(0) {
+        for (int i = 0; i < EVENT_STREAM_MAX_CLIENTS; i++) {
+            eventStreams[i] = -1;
+        }
+    }
     
     // Destructor
     ~FloodAlertWebServer() {
@@ -21,10 +28,42 @@ public:
     // Initialize SPIFFS for serving files
     bool beginSPIFFS() {
         if (!SPIFFS.begin(true)) {
-            Serial.println("Failed to mount SPIFFS");
+            Logger::error("Failed to mount SPIFFS");
             return false;
         }
-        Serial.println("SPIFFS mounted successfully");
+        Logger::info("SPIFFS mounted successfully");
+        loadAssetManifest();
+        return true;
+    }
+    
+    // Read the asset index written by tools/build_assets.py. Without it,
+    // files are served as they are stored.
+    bool loadAssetManifest(const char* path = ASSET_MANIFEST_PATH) {
+        assets.clear();
+        File manifest = SPIFFS.open(path, "r");
+        if (!manifest) {
+            Logger::info("No asset manifest, serving files uncompressed");
+            return false;
+        }
+        
+        // "<path> <etag> <content type> <gzip|raw>" per line
+        while (manifest.available()) {
+            String line = manifest.readStringUntil('\n');
+            int etagStart = line.indexOf(' ');
+            int typeStart = line.indexOf(' ', etagStart + 1);
+            int encodingStart = line.indexOf(' ', typeStart + 1);
+            if (etagStart <= 0 || typeStart < 0 || encodingStart < 0) continue;
+            
+            StaticAsset asset;
+            asset.path = line.substring(0, etagStart);
+            asset.etag = line.substring(etagStart + 1, typeStart);
+            asset.contentType = line.substring(typeStart + 1, encodingStart);
+            asset.gzip = line.substring(encodingStart + 1).startsWith("gzip");
+            assets.push_back(asset);
+        }
+        manifest.close();
+        
+        Logger::infoF("Asset manifest: %u files", (unsigned)assets.size());
         return true;
     }
     
@@ -33,10 +72,7 @@ public:
         WiFi.softAP(ssid, password, channel);  // Specify channel here
         apIP = WiFi.softAPIP();
         
-        Serial.print("AP started on channel ");
-        Serial.print(channel);
-        Serial.print(" with IP: ");
-        Serial.println(apIP.toString());
+        Logger::infoF("AP started on channel %d with IP: %s", channel, apIP.toString().c_str());
         
         return true;
     }
@@ -44,23 +80,21 @@ public:
     // Setup Station mode (connect to existing WiFi)
     bool beginSTA(const char* ssid, const char* password) {
         WiFi.begin(ssid, password);
-        Serial.print("Connecting to WiFi");
+        Logger::infoF("Connecting to WiFi %s...", ssid);
         
         // Wait for connection (timeout after 20 seconds)
         int timeout = 20;
         while (WiFi.status() != WL_CONNECTED && timeout > 0) {
             delay(1000);
-            Serial.print(".");
             timeout--;
         }
         
         if (WiFi.status() == WL_CONNECTED) {
             staIP = WiFi.localIP();
-            Serial.print("\nConnected to WiFi. IP: ");
-            Serial.println(staIP.toString());
+            Logger::infoF("Connected to WiFi. IP: %s", staIP.toString().c_str());
             return true;
         } else {
-            Serial.println("\nFailed to connect to WiFi");
+            Logger::error("Failed to connect to WiFi");
             return false;
         }
     }
@@ -89,47 +123,37 @@ public:
             captivePortalEnabled = true;
             
             // Add handler for captive portal
-            server.on("/generate_204", [this](){ redirectToRoot(); });  // Android captive portal
-            server.on("/fwlink", [this](){ redirectToRoot(); });  // Microsoft captive portal
+            static const HttpRoute CAPTIVE_ROUTES[] = {
+                HTTP_ROUTE("/generate_204", HTTP_ANY, FloodAlertWebServer, redirectToRoot),  // Android captive portal
+                HTTP_ROUTE("/fwlink", HTTP_ANY, FloodAlertWebServer, redirectToRoot),  // Microsoft captive portal
+            };
+            server.addRoutes(CAPTIVE_ROUTES, HTTP_ROUTE_COUNT(CAPTIVE_ROUTES), this);
             
-            Serial.println("Captive portal enabled");
+            Logger::info("Captive portal enabled");
         }
     }
     
     // Start the web server
     void begin() {
         // Add a default handler for root if none was specified
-        bool hasRootHandler = false;
-        for (const auto& uri : registeredUris) {
-            if (uri == "/") {
-                hasRootHandler = true;
-                break;
-            }
+        if (!server.hasRoute("/")) {
+            Logger::info("Adding default root handler");
+            
+            static const HttpRoute DEFAULT_ROUTES[] = {
+                HTTP_ROUTE("/", HTTP_GET, FloodAlertWebServer, sendDefaultRoot),
+            };
+            server.addRoutes(DEFAULT_ROUTES, HTTP_ROUTE_COUNT(DEFAULT_ROUTES), this);
         }
         
-        if (!hasRootHandler) {
-            Serial.println("Adding default root handler");
-            
-            // Add a default handler
-            on("/", HTTP_GET, [this]() {
-                server.send(200, "text/html", 
-                    "<html><body><h1>Alert Station</h1>"
-                    "<p>The web server is running.</p></body></html>");
-            });
-        }
-        
-        // Add 404 handler if not already added
-        server.onNotFound([this]() {
-            if (captivePortalEnabled) {
-                redirectToRoot();
-            } else {
-                server.send(404, "text/plain", "404: Not found");
-            }
-        });
+        // Add 404 handler
+        server.onNotFound(&httpHandler<FloodAlertWebServer, &FloodAlertWebServer::handleNotFound>, this);
         
         // Start the server
-        server.begin();
-        Serial.println("Web server started");
+        if (!server.begin()) {
+            Logger::error("Web server failed to start");
+            return;
+        }
+        Logger::info("Web server started");
     }
     
     // Process captive portal DNS and web server requests
@@ -138,22 +162,82 @@ public:
             dnsServer->processNextRequest();
         }
         server.handleClient();
+
+        // Keep idle event streams open through proxies and notice closed tabs
+        if (eventClientCount() > 0 && millis() - lastEventMs >= EVENT_STREAM_KEEPALIVE_MS) {
+            sendEventRaw(":\n\n", 3);
+        }
+    }
+    
+    // Handler of the Server-Sent Events route: takes over the current
+    // connection, which then receives every sendEvent() until the browser
+    // closes it
+    void acceptEventClient() {
+        int slot = -1;
+        for (int i = 0; i < EVENT_STREAM_MAX_CLIENTS; i++) {
+            if (!server.isStreamOpen(eventStreams[i])) {
+                slot = i;
+                break;
+            }
+        }
+        if (slot < 0) {
+            server.send(503, "text/plain", "Too many event subscribers");
+            return;
+        }
+        
+        // The response has no length and never ends: the server keeps the connection
+        int stream = server.keepOpen("text/event-stream");
+        if (stream < 0 || !server.streamWrite(stream, "retry: 3000\n\n", 13)) {
+            return;
+        }
+        eventStreams[slot] = stream;
+        Logger::info("Event subscriber connected");
     }
     
-    // Add a handler for a specific URI and HTTP method
-    void on(const String &uri, HTTPMethod method, WebServer::THandlerFunction handler) {
-        server.on(uri, method, handler);
-        registeredUris.push_back(uri);
+    // Push one event ("event: <name>\ndata: <data>\n\n") to every subscriber
+    void sendEvent(const char* event, const char* data) {
+        if (eventClientCount() == 0) return;
+        
+        char header[48];
+        int n = snprintf(header, sizeof(header), "event: %s\ndata: ", event);
+        if (n <= 0 || n >= (int)sizeof(header)) return;
+        
+        sendEventRaw(header, n);
+        sendEventRaw(data, strlen(data));
+        sendEventRaw("\n\n", 2);
     }
     
-    // Add a handler for a specific URI with any HTTP method
-    void on(const String &uri, WebServer::THandlerFunction handler) {
-        server.on(uri, handler);
-        registeredUris.push_back(uri);
+    // Number of connected event subscribers
+    uint8_t eventClientCount() {
+        uint8_t count = 0;
+        for (int i = 0; i < EVENT_STREAM_MAX_CLIENTS; i++) {
+            if (server.isStreamOpen(eventStreams[i])) {
+                count++;
+            } else {
+                eventStreams[i] = -1;
+            }
+        }
+        return count;
     }
     
-    // Serve a file from SPIFFS
+    // Register a constant route table (see network/HttpRoute.h)
+    bool addRoutes(const HttpRoute* routes, size_t count, void* owner) {
+        return server.addRoutes(routes, count, owner);
+    }
+    
+    // Serve a file of the web interface: from the bundle compiled into the
+    // firmware when it has it, otherwise from SPIFFS. The server keeps the
+    // file and sends it as the client reads it, so it must not be closed here.
     bool serveFile(const String &path, const String &contentType = "") {
+        const BundledAsset* bundled = AssetBundle::find(path.c_str());
+        if (bundled != NULL) {
+            serveBundled(*bundled);
+            return true;
+        }
+        const StaticAsset* asset = findAsset(path);
+        if (asset != NULL) {
+            return serveAsset(*asset);
+        }
         if (SPIFFS.exists(path)) {
             File file = SPIFFS.open(path, "r");
             if (contentType.length() > 0) {
@@ -161,14 +245,13 @@ public:
             } else {
                 server.streamFile(file, getContentType(path));
             }
-            file.close();
             return true;
         }
         return false;
     }
     
-    // Get direct access to the WebServer object
-    WebServer& getServer() {
+    // Get direct access to the HTTP server
+    HttpServer& getServer() {
         return server;
     }
     
@@ -182,12 +265,103 @@ public:
     }
 
 private:
-    WebServer server;
+    HttpServer server;
     DNSServer* dnsServer;
     bool captivePortalEnabled;
     IPAddress apIP;
     IPAddress staIP;
-    std::vector<String> registeredUris;  // Keep track of registered URIs
+    
+    // Entry of the asset manifest
+    struct StaticAsset {
+        String path;
+        String etag;          // Quoted, strong
+        String contentType;
+        bool gzip;            // Stored as <path>.gz
+    };
+    std::vector<StaticAsset> assets;
+    int eventStreams[EVENT_STREAM_MAX_CLIENTS];  // Stream ids of open event streams, -1 if free
+    unsigned long lastEventMs;
+    
+    // Write pre-formatted bytes to every subscriber
+    void sendEventRaw(const char* data, size_t length) {
+        for (int i = 0; i < EVENT_STREAM_MAX_CLIENTS; i++) {
+            if (eventStreams[i] >= 0 && !server.streamWrite(eventStreams[i], data, length)) {
+                // Closed, or the browser stopped reading and its buffer is full
+                server.closeStream(eventStreams[i]);
+                eventStreams[i] = -1;
+            }
+        }
+        lastEventMs = millis();
+    }
+    
+    const StaticAsset* findAsset(const String &path) {
+        for (const auto& asset : assets) {
+            if (asset.path == path) {
+                return &asset;
+            }
+        }
+        return NULL;
+    }
+    
+    // Pages are revalidated on every visit (304 when unchanged); files
+    // requested with ?v=<etag> never change and are cached for a year.
+    // Returns true if the browser's copy is current and 304 was sent.
+    bool sendCacheHeaders(const String &etag) {
+        server.sendHeader("ETag", etag);
+        if (server.hasArg("v")) {
+            server.sendHeader("Cache-Control", "public, max-age=" + String(ASSET_MAX_AGE_S) + ", immutable");
+        } else {
+            server.sendHeader("Cache-Control", "no-cache");
+        }
+        
+        if (server.header("If-None-Match").indexOf(etag) >= 0) {
+            server.send(304);
+            return true;
+        }
+        return false;
+    }
+    
+    // Written from flash as the client reads it
+    void serveBundled(const BundledAsset &asset) {
+        if (sendCacheHeaders(asset.etag)) {
+            return;
+        }
+        if (asset.gzip) {
+            server.sendHeader("Content-Encoding", "gzip");
+        }
+        server.send_P(200, asset.contentType, (const char*)asset.data, asset.length);
+    }
+    
+    bool serveAsset(const StaticAsset &asset) {
+        if (sendCacheHeaders(asset.etag)) {
+            return true;
+        }
+        
+        File file = SPIFFS.open(asset.gzip ? asset.path + ".gz" : asset.path, "r");
+        if (!file) {
+            return false;
+        }
+        // Every browser accepts gzip: there is no uncompressed copy on the flash
+        if (asset.gzip) {
+            server.sendHeader("Content-Encoding", "gzip");
+        }
+        server.streamFile(file, asset.contentType);
+        return true;
+    }
+    
+    void sendDefaultRoot() {
+        server.send(200, "text/html", 
+            "<html><body><h1>Alert Station</h1>"
+            "<p>The web server is running.</p></body></html>");
+    }
+    
+    void handleNotFound() {
+        if (captivePortalEnabled) {
+            redirectToRoot();
+        } else {
+            server.send(404, "text/plain", "404: Not found");
+        }
+    }
     
     // Redirect to root page (for captive portal)
     void redirectToRoot() {
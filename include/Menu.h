@@ -267,9 +267,8 @@ void Menu::createMenus() {
         uint8_t mac[6];
         if (_floodSystem) {
             _floodSystem->getNetwork().getOwnMac(mac);
-            Logger::ui("Adresse MAC: ");
-            Serial.printf("%02X:%02X:%02X:%02X:%02X:%02X\n", 
-                         mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+            Logger::uiF("Adresse MAC: %02X:%02X:%02X:%02X:%02X:%02X",
+                        mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
         }
         
         // Afficher le temps de fonctionnement
@@ -0,0 +1,29 @@
+#ifndef SYSTEM_STATE_H
+#define SYSTEM_STATE_H
+
+#include <stdint.h>
+
+// Vue d'ensemble du système, pour l'affichage : recalculée par
+// FloodAlertSystem quand une mesure ou le réseau change
+struct SystemState {
+    uint8_t alertCategory;      // Catégorie la plus haute (0=normal, 1=warning, 2=critical)
+    float waterLevel;           // Niveau d'eau le plus haut (cm)
+    float temperature;          // Température moyenne (°C), 0 si aucune
+    uint16_t sensorCount;       // Capteurs actifs
+    uint8_t peerCount;
+    bool networkReady;
+    bool connectedToMaster;
+};
+
+// Champs de SystemState qui ont changé (masque passé aux abonnés)
+enum SystemStateField : uint8_t {
+    STATE_ALERT = 0x01,
+    STATE_WATER_LEVEL = 0x02,   // Au dixième de cm près
+    STATE_TEMPERATURE = 0x04,   // Au dixième de degré près
+    STATE_SENSORS = 0x08,
+    STATE_NETWORK = 0x10        // Pairs, réseau prêt, master joint
+};
+
+typedef void (*SystemStateListener)(void* context, const SystemState& state, uint8_t changed);
+
+#endif // SYSTEM_STATE_H
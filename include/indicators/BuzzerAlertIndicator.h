@@ -3,12 +3,16 @@
 
 #include <Arduino.h>
 #include "Config.h"
+#include "indicators/ToneSequencer.h"
 
 /**
  * Buzzer Alert Indicator
  * 
  * This class manages a buzzer to provide audio alerts
  * based on water level data and other alert conditions.
+ * Sounds are constant pattern tables played by a ToneSequencer:
+ * an active alert beeps in a loop at alert priority, interrupting
+ * feedback tones, until it clears or is silenced.
  */
 class BuzzerAlertIndicator {
 public:
@@ -28,17 +32,25 @@ public:
     void silenceAlert();
     
     // Play different sound patterns
+    // Non-blocking: the patterns are queued and played by tick()
     void playAlertTone(uint8_t alertType);
     void playWarningTone();
     void playErrorTone();
     void playSuccessTone();
     void playSOSTone();
     
+    // Queue a silence between two patterns (same priority as the previous one)
+    void pause(uint16_t durationMs);
+    
+    // Is a queued pattern still playing?
+    bool isPlaying() const { return _sequencer.isPlaying(); }
+    
     // Direct control of buzzer
     void setBuzzer(bool state);
     
     // Update method to be called in the main loop
-    void tick();
+    // Returns ms until the next call is needed (0 when idle)
+    unsigned long tick();
 
 private:
     uint8_t _buzzerPin;
@@ -50,17 +62,11 @@ private:
     float _lastWaterLevel;
     uint8_t _lastCategory;
     
-    // Timing variables for alert patterns
-    unsigned long _lastToneToggle;
-    bool _toneState;
-    
-    // Timing parameters for different alert patterns
-    unsigned long _getToneInterval(uint8_t alertType);
+    ToneSequencer _sequencer;
+    uint8_t _lastPriority;   // Of the last queued pattern (pause)
     
-    // Alert sound constants
-    static const unsigned long WATER_ALERT_INTERVAL = 1000;    // 1 second on, 1 second off
-    static const unsigned long TEMP_ALERT_INTERVAL = 500;      // 0.5 second on, 0.5 second off
-    static const unsigned long SYSTEM_ALERT_INTERVAL = 250;    // 0.25 second on, 0.25 second off
+    void _play(const TonePattern& pattern, uint8_t priority);
+    static void _output(void* context, uint16_t frequency);
     
     // Thresholds
     static const unsigned long ALERT_DELAY_MS = WATER_ALERT_DELAY_MS; // Same as LED delay
@@ -0,0 +1,64 @@
+#ifndef DIRTY_REGION_TRACKER_H
+#define DIRTY_REGION_TRACKER_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Rectangle in display coordinates (w == 0: empty)
+struct DirtyRect {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+/**
+ * Dirty Region Tracker
+ *
+ * Finds what changed between two frames of a screen. Each draw helper
+ * records the element it draws: its area and a key summing up what it
+ * shows (text, value...). Elements are matched by drawing order, so a frame
+ * of the same screen with the same sequence of elements can be pushed as a
+ * partial window covering only the elements whose key or area changed.
+ * Anything else (another screen, a different layout, too many elements)
+ * needs the whole screen.
+ */
+class DirtyRegionTracker {
+public:
+    static const uint8_t MAX_ELEMENTS = 24;
+
+    DirtyRegionTracker();
+
+    // Start collecting the elements of a frame of `screen`
+    void beginFrame(uint8_t screen);
+    void add(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t key);
+    // False if the whole screen must be redrawn; otherwise `area` covers the
+    // changed elements (empty when nothing changed)
+    bool endFrame(DirtyRect& area);
+
+    // Next frame is redrawn in full
+    void invalidate() { _valid = false; }
+
+    // Keys: FNV-1a over the bytes of what an element shows
+    static uint32_t key(const char* text, uint32_t seed = 2166136261u);
+    static uint32_t key(int32_t value, uint32_t seed = 2166136261u);
+
+private:
+    struct Element {
+        DirtyRect rect;
+        uint32_t key;
+    };
+
+    Element _previous[MAX_ELEMENTS];
+    Element _current[MAX_ELEMENTS];
+    uint8_t _previousCount;
+    uint8_t _currentCount;
+    uint8_t _previousScreen;
+    uint8_t _screen;
+    bool _valid;        // _previous describes what the panel shows
+    bool _overflow;     // The frame had more than MAX_ELEMENTS elements
+
+    static void _merge(DirtyRect& area, const DirtyRect& rect);
+};
+
+#endif // DIRTY_REGION_TRACKER_H
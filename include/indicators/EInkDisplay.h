@@ -5,7 +5,10 @@
 #include <GxEPD2_BW.h>
 #include <SPI.h>
 #include "Config.h"
+#include "SystemState.h"
+#include "indicators/DirtyRegionTracker.h"
 #include "utils/Logger.h"
+#include "utils/SnapshotMailbox.h"
 
 // Forward declaration
 class FloodAlertSystem;
@@ -20,14 +23,56 @@ enum ScreenType {
     SCREEN_WELCOME = 5
 };
 
+// Everything a frame shows, captured by the loop and drawn by the render task
+struct EInkFrame {
+    uint8_t screen;
+    uint8_t alertCategory;
+    uint32_t fullRefreshRequest;   // Bumped by refresh(true)
+    uint8_t hour;
+    uint8_t minute;
+    uint8_t second;
+    uint32_t uptimeSeconds;
+    bool hasSystem;
+    bool networkReady;
+    bool connectedToMaster;
+    uint8_t peerCount;
+    uint16_t sensorCount;
+    float waterLevel;
+    float temperature;
+};
+
 /**
  * E-Ink Display Indicator
  * 
  * This class manages an E-Ink display to provide visual information
  * about system state, water levels, alerts, and a clock when idle.
+ *
+ * The display follows FloodAlertSystem's SystemState: a critical alert
+ * shows the alert screen at once, a warning the water level, a network
+ * not ready the network screen, otherwise the screen set by setScreen().
+ * Each screen is bound to the state fields it shows and is only redrawn
+ * when one of them changes (at most once per DATA_UPDATE_INTERVAL for
+ * plain values), or when the clock's minute changes.
+ *
+ * Each screen is drawn twice per frame: a layout pass where the draw
+ * helpers only record their element in a DirtyRegionTracker, then the
+ * real pass. On the clock and water level screens, whose changing content
+ * all goes through the helpers, a frame that only differs by a few
+ * elements is pushed through a partial window around them (or not at all
+ * if nothing changed). A full refresh clears the ghosting after
+ * PARTIAL_REFRESH_BUDGET partial ones, and on every screen change.
+ *
+ * Drawing and the panel update (which waits on BUSY for up to seconds)
+ * happen in a render task pinned to EINK_TASK_CORE, away from the loop.
+ * refresh() only captures an EInkFrame and posts it through a lock-free
+ * SnapshotMailbox; the render task draws the latest one, so frames posted
+ * while the panel is busy collapse into one. In the native simulation the
+ * frame is rendered right away by the caller.
  */
 class EInkDisplay {
 public:
+    typedef GxEPD2_BW<GxEPD2_579_GDEY0579T93, GxEPD2_579_GDEY0579T93::HEIGHT> Panel;
+
     // Constructor with pin configuration (default pins used if not specified)
     EInkDisplay(uint8_t csPin = 5, uint8_t dcPin = 17, uint8_t rstPin = 16, uint8_t busyPin = 4);
     
@@ -40,11 +85,11 @@ public:
     // Set reference to the main system
     void setFloodAlertSystem(FloodAlertSystem* system);
     
-    // Change current screen
+    // Screen shown when no alert or network problem takes over
     void setScreen(ScreenType screenType);
     
-    // Force a refresh of the current screen
-    void refresh();
+    // Redraw the current screen (only what changed, unless fullRefresh)
+    void refresh(bool fullRefresh = false);
     
     // Different screen display methods
     void showClockScreen();
@@ -68,9 +113,18 @@ public:
     // Handle timed updates
     void tick();
 
+    // Panel updates since begin()
+    uint32_t getFullRefreshCount() const { return _fullRefreshes; }
+    uint32_t getPartialRefreshCount() const { return _partialRefreshes; }
+    uint32_t getSkippedRefreshCount() const { return _skippedRefreshes; }   // Frames with no change
+    uint64_t getPartialRefreshPixels() const { return _partialPixels; }
+
+    // Panel driver, null before begin() (a framebuffer in the native build)
+    Panel* getPanel() const { return _display; }
+
 private:
     // Display instance
-    GxEPD2_BW<GxEPD2_579_GDEY0579T93, GxEPD2_579_GDEY0579T93::HEIGHT>* _display;
+    Panel* _display;
     
     // Pin configuration
     uint8_t _csPin;
@@ -83,19 +137,26 @@ private:
     
     // Current screen and state
     ScreenType _currentScreen;
+    ScreenType _homeScreen;
     bool _needsRefresh;
-    bool _partialRefreshEnabled;
+    SystemState _state;
+    bool _dataChanged;                  // A value bound to the current screen changed
+
+    // State fields shown by each screen, indexed by ScreenType
+    static const uint8_t SCREEN_BINDINGS[];
+    static void _onStateChanged(void* context, const SystemState& state, uint8_t changed);
+    ScreenType _targetScreen() const;
+    // Switch to _targetScreen() if it is not the current one
+    void _followState();
     
     // Screen rotation/orientation 
     uint8_t _rotation;
     
     // Update timing
-    unsigned long _lastFullRefresh;
     unsigned long _lastClockUpdate;
     unsigned long _lastDataUpdate;
-    static const unsigned long FULL_REFRESH_INTERVAL = 3600000;  // 1 hour full refresh to prevent ghosting
     static const unsigned long CLOCK_UPDATE_INTERVAL = 60000;    // 1 minute for clock updates
-    static const unsigned long DATA_UPDATE_INTERVAL = 300000;    // 5 minutes for sensor data updates
+    static const unsigned long DATA_UPDATE_INTERVAL = 30000;     // Minimum between redraws for changed values
     
     // Time tracking
     int _hour;
@@ -109,6 +170,45 @@ private:
     
     // Screen state
     bool _isInitialized;
+
+    // Frames handed from the loop to the render task
+    SnapshotMailbox<EInkFrame> _mailbox;
+    uint8_t _alertCategory;
+    uint32_t _fullRefreshRequests;
+    void* _renderTask;                  // TaskHandle_t (ESP32 only)
+
+    // Capture the current state and hand it to the render task
+    void _post(bool fullRefresh);
+    static void _renderLoop(void* arg);
+
+    // Render side, only touched by the render task
+    typedef void (EInkDisplay::*DrawFn)();
+    static const uint8_t PARTIAL_REFRESH_BUDGET = 15;  // Partial refreshes between two full ones
+    EInkFrame _frame;                   // Frame being drawn
+    uint32_t _renderedFullRequest;
+    DirtyRegionTracker _tracker;
+    bool _layoutPass;
+    uint8_t _partialBudget;
+    uint32_t _fullRefreshes;
+    uint32_t _partialRefreshes;
+    uint32_t _skippedRefreshes;
+    uint64_t _partialPixels;
+
+    // Draw the latest posted frame, if any
+    void _renderPending();
+    // Draw _frame, through a partial window if possible
+    void _present(DrawFn draw, bool partialCapable);
+    // Record an element of the frame; true during the layout pass, when the
+    // caller must not draw it
+    bool _trackRegion(int x, int y, int w, int h, uint32_t key);
+
+    // Frame contents, drawn by _present()
+    void _drawClockScreen();
+    void _drawWaterLevelScreen();
+    void _drawSystemInfoScreen();
+    void _drawAlertScreen();
+    void _drawNetworkScreen();
+    void _drawWelcomeScreen();
     
     // Get current time
     void _updateTime();
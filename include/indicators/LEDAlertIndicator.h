@@ -3,12 +3,16 @@
 
 #include <Arduino.h>
 #include "Config.h"
+#include "indicators/LedEffects.h"
 
 /**
  * LED Alert Indicator
  * 
  * This class manages a set of 3 LEDs (red, yellow, green) to provide visual alerts
  * based on water level data from sensors.
+ * Blinks and other effects are played by a LedEffects engine over each
+ * LED's steady state; on the ESP32 the LEDs are driven by LEDC PWM
+ * channels, which perform the fades in hardware.
  */
 class LEDAlertIndicator {
 public:
@@ -25,7 +29,19 @@ public:
     void showAlert(bool isAlert);
     
     // Blink a specific LED (useful for notifications)
-    void blinkLED(uint8_t pin, int times, int delayMs = 200);
+    // Non-blocking: the blink is played by tick() over the LED's other effects,
+    // after startDelayMs (a multiple of BLINK_MS chains blinks across LEDs)
+    static const uint16_t BLINK_MS = 400;   // One blink: on, then off
+    void blinkLED(uint8_t pin, int times, uint16_t startDelayMs = 0);
+    
+    // Long-running effects (until stopEffect): slow breathing, or a short
+    // flash that fades out every second
+    void breatheLED(uint8_t pin);
+    void pulseLED(uint8_t pin);
+    void stopEffect(uint8_t pin);
+    
+    // Advance the effects; returns ms until the next call is needed (0 when idle)
+    unsigned long tick();
     
     // Direct control of LEDs
     void setRed(bool state);
@@ -45,6 +61,12 @@ private:
     float _lastWaterLevel;
     uint8_t _lastCategory;
     
+    LedEffects _effects;
+    
+    // Effects channel of a pin (LedEffects::MAX_CHANNELS if unknown)
+    uint8_t _channel(uint8_t pin) const;
+    static void _output(void* context, uint8_t channel, uint8_t level, uint16_t fadeMs);
+    
     // Thresholds (can be set from Config.h)
     static const unsigned long ALERT_DELAY_MS = 5000; // 1 minute threshold
 };
@@ -0,0 +1,105 @@
+#ifndef LED_EFFECTS_H
+#define LED_EFFECTS_H
+
+#include <stdint.h>
+
+// One segment of an effect: go to `level` (0-255) with a linear fade of
+// fadeMs (0 = at once), then hold it for holdMs
+struct LedStep {
+    uint8_t level;
+    uint16_t fadeMs;
+    uint16_t holdMs;
+};
+
+// Constant table of segments, played `repeat` times (0 = until cancelled)
+struct LedPattern {
+    const LedStep* steps;
+    uint8_t count;
+    uint8_t repeat;
+};
+
+#define LED_PATTERN(steps, repeat) { steps, sizeof(steps) / sizeof((steps)[0]), repeat }
+
+// Effect layers of each LED, the highest active one is shown; with none,
+// the LED shows its steady level
+enum LedLayer : uint8_t {
+    LED_LAYER_STATUS = 0,    // Long-running state (breathing...)
+    LED_LAYER_NOTIFY = 1,    // Short notifications (blinks) over it
+    LED_LAYER_COUNT
+};
+
+/**
+ * LED Effects
+ *
+ * Plays blink, breathe and pulse patterns (constant segment tables) on a
+ * few LEDs. Each LED has a steady level and LED_LAYER_COUNT effect layers:
+ * every layer keeps its own timing, even when hidden by a higher one, so a
+ * notification over a breathing LED gives it back in phase.
+ *
+ * The engine never drives the pins nor reads the clock: tick(now) emits
+ * "go to this level over this fade" through the output callback and
+ * returns the delay until the next segment. On the ESP32 the fades are
+ * done by the LEDC peripheral, so a breathing LED costs a wakeup per
+ * segment rather than one per brightness step. A fade is never
+ * interrupted (the LEDC driver would wait for it): a change that comes
+ * during a fade is emitted when the fade ends.
+ */
+class LedEffects {
+public:
+    static const uint8_t MAX_CHANNELS = 3;
+
+    typedef void (*Output)(void* context, uint8_t channel, uint8_t level, uint16_t fadeMs);
+
+    LedEffects(Output output, void* context);
+
+    // Level shown when no effect runs on the channel (emitted at once if so)
+    void setSteady(uint8_t channel, uint8_t level, uint32_t now);
+    uint8_t steady(uint8_t channel) const { return _channels[channel].steady; }
+
+    // Start `pattern` on a layer, replacing what it was playing (play and
+    // cancel take effect at the next tick). With delayMs, the pattern starts
+    // that long after the next tick; until then the layer shows nothing and
+    // leaves the ones under it visible (sequences across LEDs).
+    bool play(uint8_t channel, const LedPattern& pattern, uint8_t layer, uint16_t delayMs = 0);
+    void cancel(uint8_t channel, uint8_t layer);
+    bool isActive(uint8_t channel, uint8_t layer) const;
+
+    // Advance to `now` (ms); returns ms until the next change, 0 when idle
+    uint32_t tick(uint32_t now);
+
+private:
+    static const uint8_t NONE = 0xFF;
+
+    struct Layer {
+        LedPattern pattern;
+        bool active;
+        bool started;           // `step` has begun
+        bool waiting;           // Delayed start: begins at stepEnd
+        uint16_t delayMs;       // Delay not yet turned into stepEnd
+        uint8_t step;
+        uint8_t cycle;          // Completed repetitions
+        uint8_t serial;         // Bumped at each segment start
+        uint32_t stepStart;
+        uint32_t stepEnd;       // Fade and hold
+    };
+
+    struct Channel {
+        Layer layers[LED_LAYER_COUNT];
+        uint8_t steady;
+        uint8_t shownLayer;     // Layer on the output, NONE = steady level
+        uint8_t shownSerial;
+        bool dirty;             // Output must be refreshed
+        uint32_t fadeEnd;       // Output busy until then
+    };
+
+    Output _output;
+    void* _context;
+    Channel _channels[MAX_CHANNELS];
+
+    // Move the layer to `now`, false once its pattern is over
+    bool _advance(Layer& layer, uint32_t now);
+    uint8_t _topLayer(const Channel& channel) const;
+    void _refresh(uint8_t index, uint32_t now);
+};
+
+#endif // LED_EFFECTS_H
@@ -0,0 +1,91 @@
+#ifndef TONE_SEQUENCER_H
+#define TONE_SEQUENCER_H
+
+#include <stdint.h>
+
+// One note of a pattern (frequency 0 = silence)
+struct ToneStep {
+    uint16_t frequency;
+    uint16_t durationMs;
+};
+
+// Constant table of notes, played `repeat` times (0 = until stopped)
+struct TonePattern {
+    const ToneStep* steps;
+    uint8_t count;
+    uint8_t repeat;
+};
+
+#define TONE_PATTERN(steps, repeat) { steps, sizeof(steps) / sizeof((steps)[0]), repeat }
+
+// A pattern interrupts anything of lower priority, and waits behind the rest
+enum TonePriority : uint8_t {
+    TONE_PRIORITY_FEEDBACK = 0,   // Startup, serial test...
+    TONE_PRIORITY_WARNING = 1,
+    TONE_PRIORITY_ALERT = 2
+};
+
+/**
+ * Tone Sequencer
+ *
+ * Plays constant pattern tables without ever waiting: tick(now) starts the
+ * note that is due and returns the delay until the next change, which the
+ * caller uses to schedule the next tick. Nothing reads the clock or drives
+ * the buzzer directly (time comes from the caller, notes go to the output
+ * callback), so the timing can be checked against a fake clock.
+ *
+ * Patterns wait in a small queue ordered by priority. Playing a pattern of
+ * higher priority than the current one interrupts it (the interrupted
+ * pattern is dropped, not resumed). A looping pattern lets a waiting
+ * pattern of the same priority play at the end of a cycle, then resumes;
+ * lower ones wait until it is cancelled.
+ */
+class ToneSequencer {
+public:
+    typedef void (*Output)(void* context, uint16_t frequency);
+
+    ToneSequencer(Output output, void* context);
+
+    // False if the queue is full of patterns of the same or higher priority
+    bool play(const TonePattern& pattern, uint8_t priority);
+    // Drop the current and queued patterns of this priority
+    void cancel(uint8_t priority);
+    // Drop everything and silence the output
+    void stop();
+    // Drop everything and hold the output at `frequency` (0 = silence)
+    // until the next pattern, cancel() or stop()
+    void force(uint16_t frequency);
+
+    // Advance to `now` (ms); returns ms until the next change, 0 when idle
+    uint32_t tick(uint32_t now);
+
+    bool isPlaying() const { return _count > 0; }
+    // Priority of the pattern being played (only meaningful while playing)
+    uint8_t currentPriority() const { return _queue[0].priority; }
+
+private:
+    static const uint8_t MAX_QUEUED = 6;
+
+    struct Entry {
+        TonePattern pattern;
+        uint8_t priority;
+        uint8_t cycle;           // Completed repetitions
+    };
+
+    Output _output;
+    void* _context;
+    Entry _queue[MAX_QUEUED];    // [0] is playing, the rest sorted by priority
+    uint8_t _count;
+    uint8_t _step;               // Note of _queue[0]
+    bool _started;               // _step has been sent to the output
+    uint16_t _frequency;         // Last frequency sent
+    uint32_t _stepEnd;
+
+    bool _insert(const Entry& entry);
+    void _remove(uint8_t index);
+    void _emit(uint16_t frequency);
+    // Move past the current note, false when the pattern is over
+    bool _advance();
+};
+
+#endif // TONE_SEQUENCER_H
@@ -0,0 +1,46 @@
+#ifndef ASSET_BUNDLE_H
+#define ASSET_BUNDLE_H
+
+#include <Arduino.h>
+
+// One file of the web interface compiled into the firmware
+struct BundledAsset {
+    const char* path;          // "/static/css/styles.css", nullptr for an empty slot
+    const uint8_t* data;       // Bytes as sent (gzip when `gzip` is set)
+    uint32_t length;
+    const char* etag;          // Quoted, strong
+    const char* contentType;
+    bool gzip;
+};
+
+// Written by tools/build_assets.py (src/generated/AssetBundleData.cpp)
+extern const BundledAsset ASSET_BUNDLE[];
+extern const uint16_t ASSET_BUNDLE_SEEDS[];
+extern const uint16_t ASSET_BUNDLE_COUNT;
+extern const uint16_t ASSET_BUNDLE_BUCKETS;
+extern const uint16_t ASSET_BUNDLE_SLOTS;
+
+/**
+ * Asset Bundle
+ *
+ * Read-only copy of the web interface (minified, gzipped, same ETags as the
+ * SPIFFS image) stored as constant arrays. On the ESP32 these stay in flash
+ * and are read through the cache-mapped data bus, so a response is sent
+ * straight from them: no file system lookup, no open file, no copy into
+ * an intermediate buffer.
+ *
+ * Paths are found with a perfect hash built at compile time: one hash picks
+ * the seed of the path's bucket, a second hash with that seed gives the slot,
+ * and a single string compare confirms it.
+ */
+class AssetBundle {
+public:
+    // nullptr if the path is not bundled
+    static const BundledAsset* find(const char* path);
+    static size_t count() { return ASSET_BUNDLE_COUNT; }
+
+    // FNV-1a, starting from the offset basis xor seed
+    static uint32_t hash(const char* text, uint32_t seed);
+};
+
+#endif // ASSET_BUNDLE_H
@@ -4,9 +4,19 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include <esp_now.h>
+#include "Config.h"
+#include "utils/SpscQueue.h"
+#include "utils/MacTable.h"
 
-// Maximum number of peers this device can connect to
-#define MAX_PEERS 20
+// Maximum number of peers this device can connect to. The ESP-NOW driver
+// registers at most ESP_NOW_MAX_TOTAL_PEER_NUM, and one of those slots must
+// stay free for the broadcast address used by discovery.
+#ifndef MAX_PEERS
+#define MAX_PEERS (ESP_NOW_MAX_TOTAL_PEER_NUM - 1)
+#endif
+
+// Frames buffered between the ESP-NOW callbacks and update() (power of 2)
+#define RX_QUEUE_LENGTH 32
 
 // Message types for different communication purposes
 enum MessageType {
@@ -15,7 +25,8 @@ enum MessageType {
     ALERT = 3,         // Alert message from master to slaves
     STATUS_UPDATE = 4, // Regular status update from master to slaves
     PING = 5,          // Keepalive message to verify connection
-    COMMAND = 6        // Command from master to specific slave
+    COMMAND = 6,       // Command from master to specific slave
+    SENSOR_BATCH = 7   // Several timestamped readings from slave to master
 };
 
 // Structure for messages transmitted over ESP-NOW
@@ -32,6 +43,20 @@ typedef struct {
     bool ready;               // Flag to indicate device is ready
 } network_message_t;
 
+// One timestamped reading of a batch
+struct SensorReading {
+    uint32_t age_ms;          // Time between the reading and the frame (sender clock)
+    float values[5];          // Same layout as network_message_t.data
+};
+
+// Readings sampled by a slave and sent together in one SENSOR_BATCH frame
+typedef struct {
+    char name[16];            // Sensor/device name
+    uint8_t value_count;      // Valid values per reading
+    uint8_t count;            // Readings, oldest first
+    SensorReading readings[SENSOR_BATCH_MAX];
+} sensor_batch_t;
+
 // Peer information structure
 struct PeerInfo {
     esp_now_peer_info_t peer_info;
@@ -46,12 +71,27 @@ struct PeerInfo {
     }
 };
 
+// Raw frame copied by the receive callback, decoded later in update()
+struct RawFrame {
+    uint8_t mac[6];
+    uint8_t len;
+    uint8_t data[ESP_NOW_MAX_DATA_LEN];
+};
+
+// Delivery result copied by the send callback
+struct SendResult {
+    uint8_t mac[6];
+    bool success;
+};
+
 class FloodAlertNetwork {
 public:
     // Function pointer types for callbacks
     typedef void (*MessageCallback)(const network_message_t&, const uint8_t*);
     typedef void (*DeliveryCallback)(bool, const uint8_t*);
     typedef void (*DataReadyCallback)(float*, uint8_t);
+    typedef void (*FrameQueuedCallback)();
+    typedef void (*BatchCallback)(const sensor_batch_t&, const uint8_t*);
 
     // Constructor
     FloodAlertNetwork();
@@ -67,8 +107,16 @@ public:
     void onDeliveryResult(DeliveryCallback callback);
     void onDataReady(DataReadyCallback callback);
     
+    // Called from the WiFi task each time a frame is queued (must stay short,
+    // typically to wake the loop)
+    void onFrameQueued(FrameQueuedCallback callback);
+    
+    // Called on the master for each SENSOR_BATCH frame
+    void onBatchReceived(BatchCallback callback);
+    
     // Send messages
     bool sendToMaster(const float* data, uint8_t data_count, const char* text = nullptr);
+    bool sendBatchToMaster(const sensor_batch_t& batch);
     bool sendToAllSlaves(const float* data, uint8_t data_count, uint8_t alert_level = 0, const char* text = nullptr);
     bool sendToSlave(const uint8_t* mac_addr, const float* data, uint8_t data_count, const char* text = nullptr);
     
@@ -80,10 +128,21 @@ public:
     uint8_t getPeerCount();
     uint8_t getMinPeers();
     void setMinPeers(uint8_t min_peers);
+    // Incremented whenever the peer list or the readiness threshold changes
+    uint32_t getStateGeneration() { return _state_generation; }
     
     // Process network tasks (call this in loop())
     void update();
     
+    // Decode the queued frames and delivery results, returns how many were handled
+    uint16_t processReceived();
+    
+    // Receive queue statistics
+    uint32_t getReceivedFrames() { return _rx_processed; }
+    uint32_t getDroppedFrames() { return _rx_dropped; }
+    uint32_t getInvalidFrames() { return _rx_invalid; }
+    uint8_t getRxQueueHighWater() { return _rx_high_water; }
+    
     // Debug
     void printNetworkStatus();
     void printPeers();
@@ -109,7 +168,9 @@ private:
     
     // Network status
     PeerInfo _peers[MAX_PEERS];
-    uint8_t _peer_count;
+    MacTable<uint16_t, macTableSize(MAX_PEERS)> _peer_index;  // MAC -> slot in _peers
+    uint16_t _peer_count;
+    uint32_t _state_generation;
     uint32_t _last_discovery;
     uint32_t _last_status_send;
     uint32_t _network_ready_time;
@@ -121,12 +182,26 @@ private:
     MessageCallback _message_callback;
     DeliveryCallback _delivery_callback;
     DataReadyCallback _data_ready_callback;
+    FrameQueuedCallback _frame_queued_callback;
+    BatchCallback _batch_callback;
+    
+    // Filled by the ESP-NOW callbacks (WiFi task), drained by processReceived()
+    SpscQueue<RawFrame, RX_QUEUE_LENGTH> _rx_queue;
+    SpscQueue<SendResult, RX_QUEUE_LENGTH> _send_queue;
+    volatile uint32_t _rx_dropped;      // Written by the WiFi task only
+    uint32_t _rx_processed;
+    uint32_t _rx_invalid;               // Bad CRC, truncated or unknown layout
+    uint8_t _rx_high_water;
+    sensor_batch_t _rx_batch;           // Decoding buffer for SENSOR_BATCH frames
     
     // Internal methods
     void _processPeerDiscovery(const network_message_t& msg, const uint8_t* mac_addr);
     bool _addPeer(const uint8_t* mac_addr, bool is_master);
     bool _removePeer(const uint8_t* mac_addr);
     bool _sendMessage(const uint8_t* mac_addr, network_message_t& msg);
+    void _handleFrame(const RawFrame& frame);
+    void _updatePeer(const network_message_t& msg, const uint8_t* mac_addr);
+    void _handleSendResult(const uint8_t* mac_addr, bool success);
     
     // Helper methods
     int _findPeerIndex(const uint8_t* mac_addr);
@@ -138,7 +213,7 @@ private:
     static void _onSendHandler(const uint8_t* mac_addr, esp_now_send_status_t status);
     
     // Static instance pointer for callbacks
-    static FloodAlertNetwork* _instance;
+    static NODE_LOCAL FloodAlertNetwork* _instance;
 };
 
 #endif // FLOOD_ALERT_NETWORK_H
\ No newline at end of file
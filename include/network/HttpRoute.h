@@ -0,0 +1,59 @@
+#ifndef HTTP_ROUTE_H
+#define HTTP_ROUTE_H
+
+#include <Arduino.h>
+#include <WebServer.h>  // HTTPMethod
+
+// FNV-1a of a path, evaluated by the compiler for literal paths
+constexpr uint32_t httpPathHash(const char* path, uint32_t hash = 2166136261u) {
+    return *path ? httpPathHash(path + 1, (hash ^ (uint8_t)*path) * 16777619u) : hash;
+}
+
+// Same hash for request paths (no recursion on untrusted input)
+inline uint32_t httpRequestHash(const char* path) {
+    uint32_t hash = 2166136261u;
+    for (; *path; path++) {
+        hash = (hash ^ (uint8_t)*path) * 16777619u;
+    }
+    return hash;
+}
+
+typedef void (*HttpHandler)(void* owner);
+
+// Calls owner->Method(): a plain function pointer per route instead of a
+// heap-allocated std::function closure
+template <typename Owner, void (Owner::*Method)()>
+void httpHandler(void* owner) {
+    (static_cast<Owner*>(owner)->*Method)();
+}
+
+/**
+ * One entry of a constant route table
+ *
+ * Tables are arrays of HTTP_ROUTE / HTTP_PREFIX_ROUTE entries whose hashes
+ * are computed at compile time, so they are placed in flash and cost no
+ * heap. HttpServer::addRoutes() indexes the exact paths by hash.
+ *
+ *   const HttpRoute Owner::ROUTES[] = {
+ *       HTTP_ROUTE("/api/status", HTTP_GET, Owner, handleStatus),
+ *       HTTP_PREFIX_ROUTE("/static/", HTTP_GET, Owner, handleStatic),
+ *   };
+ */
+struct HttpRoute {
+    uint32_t hash;         // httpPathHash(uri)
+    const char* uri;
+    uint16_t length;       // strlen(uri)
+    HTTPMethod method;
+    bool prefix;           // Matches every path starting with uri
+    HttpHandler handler;
+};
+
+#define HTTP_ROUTE(uri, method, Owner, member) \
+    { httpPathHash(uri), uri, sizeof(uri) - 1, method, false, &httpHandler<Owner, &Owner::member> }
+
+#define HTTP_PREFIX_ROUTE(uri, method, Owner, member) \
+    { httpPathHash(uri), uri, sizeof(uri) - 1, method, true, &httpHandler<Owner, &Owner::member> }
+
+#define HTTP_ROUTE_COUNT(table) (sizeof(table) / sizeof((table)[0]))
+
+#endif // HTTP_ROUTE_H
@@ -0,0 +1,196 @@
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include <WebServer.h>  // HTTPMethod, CONTENT_LENGTH_UNKNOWN
+#include "Config.h"
+#include "network/HttpRoute.h"
+#include <memory>
+
+// Counters exposed through /api/status
+struct HttpStats {
+    uint32_t accepted;         // Connections accepted
+    uint32_t requests;         // Requests dispatched to a handler
+    uint32_t rejected;         // Malformed or oversized requests
+    uint32_t timeouts;         // Connections closed because the client went quiet
+    uint32_t aborted;          // Responses dropped because the client stopped reading
+    uint8_t peakConnections;   // Most connections open at once
+    uint32_t maxHandlerUs;     // Slowest handler
+};
+
+// Per-route counters
+struct HttpRouteStats {
+    const char* uri;
+    uint32_t hits;
+    uint32_t maxUs;
+    int64_t heapPeak;          // Bytes allocated by the handler (native build only)
+};
+
+/**
+ * Non-blocking HTTP server
+ *
+ * Replaces the synchronous Arduino WebServer, which serves one client at a
+ * time and blocks the main loop until the whole response is written: a
+ * phone slowly downloading a stylesheet would stall sensor processing and
+ * the buzzer. This server keeps a pool of connections allocated once in
+ * begin(), each with a fixed request buffer and output buffer, and moves
+ * every connection through a small state machine on each handleClient():
+ *
+ *   READING   -> non-blocking recv() until the headers (and body) are in
+ *   WRITING   -> the handler has run; the output buffer and any file
+ *                passed to streamFile() are sent as the socket accepts them
+ *   STREAMING -> long-lived response (event stream) fed by streamWrite()
+ *
+ * Handlers use the same API as WebServer (arg(), send(), sendContent(),
+ * streamFile(), send_P()...). They are registered as constant route tables
+ * (see HttpRoute.h) rather than one std::function per on() call: exact
+ * paths are found through a fixed open-addressing index on their hash. Responses are sent with
+ * "Connection: close", so a response of unknown length simply ends when
+ * the connection closes. A handler only waits on the socket when it writes
+ * more than the output buffer and the TCP send window can hold, and then
+ * for at most HTTP_SEND_TIMEOUT_MS.
+ *
+ * Plain BSD sockets: lwIP on the ESP32, the host stack in the native build
+ * (which makes the server load-testable with real TCP clients).
+ */
+class HttpServer {
+public:
+    explicit HttpServer(int port = 80);
+    ~HttpServer();
+
+    // Open the listening socket and allocate the connection pool
+    bool begin();
+    void stop();
+
+    // Accept, read, dispatch and send without ever blocking
+    void handleClient();
+
+    // Routing: handlers of `routes` are called with `owner`. The table must
+    // outlive the server (a constant array). False if a path is registered
+    // twice or HTTP_MAX_ROUTES is exceeded.
+    bool addRoutes(const HttpRoute* routes, size_t count, void* owner);
+    void onNotFound(HttpHandler handler, void* owner) {
+        _notFound = handler;
+        _notFoundOwner = owner;
+    }
+    bool hasRoute(const char* uri) const;
+
+    // Request context (valid inside a handler)
+    String uri() const;
+    HTTPMethod method() const { return _request.method; }
+    String arg(const String& name) const;
+    bool hasArg(const String& name) const;
+    int args() const { return _request.argCount; }
+    String header(const String& name) const;
+    bool hasHeader(const String& name) const { return header(name).length() > 0; }
+
+    // Response API
+    void send(int code, const char* contentType = nullptr, const String& content = String());
+    void send(int code, const String& contentType, const String& content) { send(code, contentType.c_str(), content); }
+    void sendHeader(const String& name, const String& value, bool first = false);
+    void setContentLength(size_t contentLength) { _contentLength = contentLength; }
+    void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+    void sendContent(const char* content, size_t size);
+    // The file is sent as the client reads it, after the handler returns
+    size_t streamFile(File& file, const String& contentType, int code = 200);
+    // Body sent straight from constant memory (flash), without copying it
+    // into the output buffer: it must outlive the response and ends it
+    void send_P(int code, const char* contentType, const char* content, size_t contentLength);
+    // Same for a body shared with other responses (ResponseCache): the
+    // connection holds a reference until the body is sent
+    void send(int code, const char* contentType, const std::shared_ptr<const String>& body);
+
+    // Keep the current connection open after the handler (event stream).
+    // Returns a stream id for streamWrite(), or -1 outside a handler.
+    int keepOpen(const char* contentType);
+    // Queue bytes on a stream, sent by the next handleClient(). False if the
+    // stream is closed, or its buffer is full and it gets closed.
+    bool streamWrite(int stream, const char* data, size_t length);
+    bool isStreamOpen(int stream) const;
+    void closeStream(int stream);
+
+    uint16_t port() const { return _port; }
+    uint8_t activeConnections() const;
+    const HttpStats& getStats() const { return _stats; }
+    size_t routeCount() const { return _routeCount; }
+    HttpRouteStats routeStats(size_t index) const;
+
+private:
+    enum ConnectionState : uint8_t {
+        CONN_FREE,
+        CONN_READING,
+        CONN_WRITING,
+        CONN_STREAMING
+    };
+
+    struct Connection {
+        int fd;
+        ConnectionState state;
+        uint8_t generation;       // Bumped on every accept: stale stream ids stop matching
+        bool aborted;             // Output dropped, close as soon as possible
+        uint32_t lastActivity;    // millis() of the last byte in or out
+        char* request;            // HTTP_REQUEST_BUFFER bytes from the pool
+        uint16_t requestLength;
+        char* out;                // HTTP_OUTPUT_BUFFER bytes from the pool
+        uint16_t outLength;
+        uint16_t outSent;
+        File file;                // Rest of the body (streamFile)
+        const char* constBody;    // Rest of the body (send_P)
+        size_t constLength;
+        std::shared_ptr<const String> sharedBody;  // Keeps constBody alive
+    };
+
+    struct Route {
+        const HttpRoute* route;
+        void* owner;
+        uint32_t hits;
+        uint32_t maxUs;
+        int64_t heapPeak;
+    };
+
+    // Parsed request, pointing into the connection's request buffer
+    struct Request {
+        HTTPMethod method;
+        const char* path;
+        const char* headers;      // Raw header lines
+        const char* argNames[HTTP_MAX_ARGS];
+        const char* argValues[HTTP_MAX_ARGS];
+        uint8_t argCount;
+    };
+
+    uint16_t _port;
+    int _listenFd;
+    Connection* _connections;
+    char* _pool;
+    Route _routes[HTTP_MAX_ROUTES];
+    uint8_t _routeCount;
+    uint8_t _routeSlots[HTTP_ROUTE_SLOTS];   // Exact paths by hash: index in _routes + 1, 0 if free
+    HttpHandler _notFound;
+    void* _notFoundOwner;
+    HttpStats _stats;
+
+    // State of the request being dispatched
+    Connection* _current;
+    Request _request;
+    size_t _contentLength;
+    String _extraHeaders;
+    bool _headersSent;
+
+    void _accept();
+    void _read(Connection& c);
+    void _dispatch(Connection& c, size_t headerEnd, size_t bodyLength);
+    bool _parse(Connection& c, size_t headerEnd, size_t bodyLength);
+    void _parseArgs(char* text);
+    void _writeHeaders(int code, const char* contentType, const char* connection);
+    void _write(Connection& c, const char* data, size_t length);
+    bool _pump(Connection& c);
+    void _compact(Connection& c);
+    void _waitWritable(Connection& c, uint32_t timeoutMs);
+    void _close(Connection& c);
+    void _fail(Connection& c, int code, const char* message);
+    Connection* _stream(int stream) const;
+    Route* _findRoute(const char* path, HTTPMethod method);
+};
+
+#endif // HTTP_SERVER_H
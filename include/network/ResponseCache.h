@@ -0,0 +1,41 @@
+#ifndef RESPONSE_CACHE_H
+#define RESPONSE_CACHE_H
+
+#include <Arduino.h>
+#include <memory>
+
+/**
+ * Cached response body
+ *
+ * Keeps the last serialized body of an endpoint together with the version
+ * of the state it was built from. While the version does not change, every
+ * request gets the same body: HttpServer::send() sends it straight from the
+ * shared buffer, so concurrent clients neither rebuild nor copy it. A
+ * rebuild replaces the buffer; connections still sending the previous one
+ * keep it alive until they are done.
+ *
+ * The version is chosen by the caller, typically a sum of counters that
+ * only ever increase (SensorRegistry::generation(), ...): the sum changes
+ * as soon as one of them does.
+ */
+class ResponseCache {
+public:
+    ResponseCache() : _version(0), _hits(0), _misses(0) {}
+
+    // Body built for this version, nullptr (counted as a miss) otherwise
+    std::shared_ptr<const String> lookup(uint32_t version);
+    // Keep `body` as the response of this version and return it
+    std::shared_ptr<const String> store(uint32_t version, String&& body);
+
+    uint32_t hits() const { return _hits; }
+    uint32_t misses() const { return _misses; }
+    size_t size() const { return _body ? _body->length() : 0; }
+
+private:
+    std::shared_ptr<const String> _body;
+    uint32_t _version;
+    uint32_t _hits;
+    uint32_t _misses;
+};
+
+#endif // RESPONSE_CACHE_H
@@ -0,0 +1,128 @@
+#ifndef WIRE_FORMAT_H
+#define WIRE_FORMAT_H
+
+#include <Arduino.h>
+#include "network/FloodAlertNetwork.h"
+
+// First byte of every encoded frame. A legacy raw network_message_t starts
+// with its type (1..6), so both formats can be told apart on reception.
+#define WIRE_MAGIC 0xFA
+
+// Schema version carried in each frame (high nibble of the second byte)
+#define WIRE_VERSION 1
+
+// Fixed-point scale for data values (centimetres / centidegrees)
+#define WIRE_FIXED_SCALE 100.0f
+
+// Header flags
+#define WIRE_FLAG_MASTER   0x01
+#define WIRE_FLAG_READY    0x02
+#define WIRE_FLAG_BATTERY  0x04
+
+// Sequential writer of varints, zigzag and fixed-point values into a buffer
+class WireWriter {
+public:
+    WireWriter(uint8_t* buffer, size_t capacity) : _buf(buffer), _cap(capacity), _len(0), _overflow(false) {}
+
+    void u8(uint8_t value);
+    void u16(uint16_t value);
+    void varint(uint32_t value);
+    void svarint(int32_t value);       // Zigzag, small negative values stay small
+    void fixed(float value);           // Float as zigzag varint of value * WIRE_FIXED_SCALE
+    void text(const char* value, size_t maxLen);  // Length-prefixed, no terminator
+    void bytes(const uint8_t* data, size_t len);
+
+    // Fixed-point conversion shared with the delta encoding of batches
+    static int32_t toFixed(float value);
+
+    size_t length() const { return _len; }
+    bool overflow() const { return _overflow; }
+    uint8_t* data() { return _buf; }
+
+private:
+    uint8_t* _buf;
+    size_t _cap;
+    size_t _len;
+    bool _overflow;
+};
+
+// Sequential reader matching WireWriter; any read past the end sets error()
+class WireReader {
+public:
+    WireReader(const uint8_t* buffer, size_t length) : _buf(buffer), _len(length), _pos(0), _error(false) {}
+
+    uint8_t u8();
+    uint16_t u16();
+    uint32_t varint();
+    int32_t svarint();
+    float fixed();
+    void text(char* out, size_t outSize);
+    void skip(size_t len);
+
+    static float fromFixed(int32_t value);
+
+    size_t remaining() const { return _error ? 0 : _len - _pos; }
+    bool error() const { return _error; }
+
+private:
+    const uint8_t* _buf;
+    size_t _len;
+    size_t _pos;
+    bool _error;
+};
+
+/**
+ * Wire Format
+ *
+ * Compact encoding of network_message_t for ESP-NOW:
+ *
+ *   magic | version<<4 | type | flags | varint message_id | [battery]
+ *   | type-specific payload | CRC16 (CCITT, little endian)
+ *
+ * The sender MAC is not transmitted (ESP-NOW already provides it) and
+ * floats are sent as fixed-point varints. A decoder ignores bytes it does
+ * not know at the end of a payload, so later versions may append fields
+ * without breaking older nodes. Raw sizeof(network_message_t) frames from
+ * nodes that predate this format are still accepted.
+ */
+class WireFormat {
+public:
+    // Encode msg into buffer, returns the frame length (0 if it does not fit)
+    static size_t encode(const network_message_t& msg, uint8_t* buffer, size_t capacity);
+
+    // Decode a received frame (current or legacy format). mac is the ESP-NOW
+    // source address and fills msg.sender_id. False if the frame is invalid.
+    static bool decode(const uint8_t* data, size_t len, const uint8_t* mac, network_message_t& msg);
+
+    // Is this frame in the compact format (as opposed to a legacy struct)?
+    static bool isCompact(const uint8_t* data, size_t len);
+
+    // Message type of a compact frame (0 if not compact)
+    static uint8_t peekType(const uint8_t* data, size_t len);
+
+    // SENSOR_BATCH frames: readings are sent oldest first, each with the
+    // time elapsed since the previous one and its values as deltas of the
+    // previous reading. Oldest readings are left out if the batch does not
+    // fit in capacity; readingsSent tells how many made it.
+    static size_t encodeBatch(const network_message_t& header, const sensor_batch_t& batch,
+                              uint8_t* buffer, size_t capacity, uint8_t* readingsSent = nullptr);
+
+    // Decode a SENSOR_BATCH frame: header fields go to msg (name in msg.text).
+    // Of a longer batch than SENSOR_BATCH_MAX, the newest readings are kept.
+    static bool decodeBatch(const uint8_t* data, size_t len, const uint8_t* mac,
+                            network_message_t& msg, sensor_batch_t& batch);
+
+    static uint16_t crc16(const uint8_t* data, size_t len);
+
+private:
+    static void _encodeHeader(const network_message_t& msg, WireWriter& out);
+    static bool _decodeHeader(const uint8_t* data, size_t len, const uint8_t* mac,
+                              network_message_t& msg, WireReader& in);
+    static bool _encodeReadings(const sensor_batch_t& batch, uint8_t first, WireWriter& out);
+    static void _encodePayload(const network_message_t& msg, WireWriter& out);
+    static void _decodePayload(uint8_t type, WireReader& in, network_message_t& msg);
+    static void _encodeValues(const network_message_t& msg, WireWriter& out);
+    static void _decodeValues(WireReader& in, network_message_t& msg);
+};
+
+#endif // WIRE_FORMAT_H
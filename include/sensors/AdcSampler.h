@@ -0,0 +1,37 @@
+#ifndef ADC_SAMPLER_H
+#define ADC_SAMPLER_H
+
+#include <Arduino.h>
+
+/**
+ * Acquisition ADC continue
+ *
+ * Sur l'ESP32, une broche de l'ADC1 est échantillonnée en continu par le
+ * périphérique I2S (mode ADC intégré), qui écrit dans des tampons DMA :
+ * read() ne fait que copier les échantillons accumulés depuis l'appel
+ * précédent, sans conversion ni attente sur le cœur. Un seul
+ * échantillonneur DMA peut exister (seul l'I2S0 a ce mode).
+ *
+ * Pour une broche de l'ADC2 (réservé au Wi-Fi) ou en simulation, read()
+ * retombe sur quelques analogRead() successifs.
+ */
+class AdcSampler {
+public:
+    explicit AdcSampler(uint8_t pin);
+    ~AdcSampler();
+
+    bool begin();
+
+    // Copie au plus `max` échantillons récents (12 bits), renvoie leur nombre
+    uint16_t read(uint16_t* samples, uint16_t max);
+
+    bool usesDma() const { return _dma; }
+
+private:
+    static const uint16_t POLLED_SAMPLES = 64;   // Sans DMA : lectures par appel
+
+    uint8_t _pin;
+    bool _dma = false;
+};
+
+#endif // ADC_SAMPLER_H
@@ -3,34 +3,74 @@
 
 #include "sensors/SensorBase.h"
 #include "Config.h"
+#include <mutex>
 
 // Forward declaration pour éviter d'inclure DHT.h dans le header
 class DHT;
 
+/**
+ * Capteur DHT11
+ *
+ * La lecture du DHT11 est un protocole bit à bit qui coupe les interruptions
+ * pendant plusieurs millisecondes, alors que le capteur ne produit une
+ * nouvelle valeur que toutes les 1 à 2 s. Les lectures se font donc à part,
+ * au plus une par DHT_MIN_INTERVAL_MS, dans une tâche de plus basse priorité
+ * que la boucle, sur son cœur (DHT_TASK_CORE, le cœur 1 de l'ESP32) : les
+ * interruptions masquées pendant la lecture sont celles de ce cœur, pas
+ * celles du WiFi et d'ESP-NOW sur le cœur 0. update() ne fait que reprendre
+ * la dernière mesure en cache.
+ * Après une lecture ratée (NaN), l'intervalle double à chaque échec, jusqu'à
+ * DHT_MAX_BACKOFF_MS.
+ *
+ * En simulation (pas de tâche par nœud), la même cadence est appliquée
+ * depuis update().
+ */
 class DHT11Sensor : public SensorBase {
 public:
     DHT11Sensor(uint8_t pin);
     ~DHT11Sensor();
-    
+
     // Implémentation des méthodes de SensorBase
     bool begin() override;
     void update() override;
     const char* getName() override;
     void getData(float* data, uint8_t& count) override;
-    
+
     // Méthodes spécifiques à DHT11
     float getTemperature();
     float getHumidity();
     uint8_t getTemperatureCategory();  // 0=normal, 1=warning, 2=critical
-    
+    uint8_t getConsecutiveFailures() const { return _failures; }
+
 private:
     DHT* _dht = nullptr;
     uint8_t _pin;
     float _temperature = 0;
     float _humidity = 0;
     uint8_t _tempCategory = 0;
-    
+
+    // Dernière mesure réussie, écrite par la lecture et reprise par update()
+    struct Reading {
+        float temperature;
+        float humidity;
+        unsigned long time;
+    };
+    std::mutex _cacheLock;
+    Reading _cached = {0, 0, 0};
+    bool _fresh = false;                 // _cached pas encore repris par update()
+    volatile uint8_t _failures = 0;      // Lectures ratées d'affilée
+
+#ifdef NATIVE_SIM
+    unsigned long _nextSampleTime = 0;
+#else
+    void* volatile _task = nullptr;      // TaskHandle_t de la tâche de lecture, nullptr une fois sortie
+    volatile bool _stopping = false;     // Demande de sortie à la tâche (destructeur)
+    static void _samplingTask(void* arg);
+#endif
+
+    // Une lecture du capteur ; renvoie le délai avant la suivante (ms)
+    uint32_t _sample();
     void _calculateCategory();
 };
 
-#endif // DHT11_SENSOR_H
\ No newline at end of file
+#endif // DHT11_SENSOR_H
@@ -0,0 +1,109 @@
+// include/sensors/SensorRegistry.h
+#ifndef SENSOR_REGISTRY_H
+#define SENSOR_REGISTRY_H
+
+#include <Arduino.h>
+#include "Config.h"
+#include "utils/MacTable.h"
+
+// Structure pour stocker les données des capteurs
+struct SensorData {
+    uint8_t mac[6];    // Adresse MAC
+    char name[16];     // Nom du périphérique
+    float waterLevel;  // Niveau d'eau actuel
+    float temperature; // Température actuelle
+    uint8_t category;  // Catégorie d'alerte
+    uint32_t lastSeen; // Dernière fois où les données ont été reçues
+    bool active;       // Ce capteur est-il actif
+    bool pushPending;  // Changement pas encore poussé aux tableaux de bord (/api/events)
+};
+
+/**
+ * Registre des capteurs distants
+ *
+ * Les entrées sont prises dans un pool alloué une seule fois au démarrage
+ * (begin), dont la taille est choisie à l'exécution sans dépasser
+ * SENSOR_REGISTRY_MAX. Quand le pool est plein, un nouveau capteur remplace
+ * celui qui n'a pas donné de nouvelles depuis le plus longtemps (LRU) au
+ * lieu d'être ignoré. Recherche par MAC en O(1) via une MacTable.
+ *
+ * generation() change à chaque modification (acquire, remove, expire) :
+ * les réponses construites à partir du registre restent valides tant
+ * qu'elle ne bouge pas.
+ */
+class SensorRegistry {
+public:
+    // Parcours des capteurs actifs, dans l'ordre du pool (stable entre deux mises à jour)
+    class Iterator {
+    public:
+        Iterator(SensorRegistry* registry, uint16_t slot) : _registry(registry), _slot(slot) { _skip(); }
+        SensorData& operator*() const { return _registry->_slots[_slot].data; }
+        SensorData* operator->() const { return &_registry->_slots[_slot].data; }
+        Iterator& operator++() { _slot++; _skip(); return *this; }
+        bool operator!=(const Iterator& other) const { return _slot != other._slot; }
+
+    private:
+        SensorRegistry* _registry;
+        uint16_t _slot;
+        void _skip() {
+            while (_slot < _registry->_capacity && !_registry->_slots[_slot].data.active) _slot++;
+        }
+    };
+
+    SensorRegistry();
+    ~SensorRegistry();
+
+    // Allouer le pool (une seule fois) ; capacity est bornée par SENSOR_REGISTRY_MAX
+    bool begin(uint16_t capacity);
+
+    // Capteur associé à cette MAC, nullptr s'il est inconnu
+    SensorData* find(const uint8_t* mac);
+
+    // Capteur associé à cette MAC, créé s'il est nouveau (en évinçant le
+    // moins récemment mis à jour si le pool est plein) et marqué comme le
+    // plus récent. nullptr seulement si le pool n'est pas alloué.
+    SensorData* acquire(const uint8_t* mac);
+
+    void remove(SensorData* sensor);
+
+    // Retirer les capteurs muets depuis plus de timeoutMs ; onExpired est
+    // appelé pour chacun avant son retrait. Renvoie le nombre de capteurs retirés.
+    uint16_t expire(uint32_t now, uint32_t timeoutMs, void (*onExpired)(const SensorData&) = nullptr);
+
+    // n-ième capteur actif (ordre du parcours), nullptr au-delà
+    SensorData* at(uint16_t index);
+
+    Iterator begin() { return Iterator(this, 0); }
+    Iterator end() { return Iterator(this, _capacity); }
+
+    uint16_t size() const { return _size; }
+    uint16_t capacity() const { return _capacity; }
+    uint32_t evictions() const { return _evictions; }
+    uint32_t generation() const { return _generation; }
+    size_t memoryUsage() const;
+
+private:
+    static const uint16_t NONE = 0xFFFF;
+
+    struct Slot {
+        SensorData data;
+        uint16_t prev;   // Liste LRU : vers le plus récent
+        uint16_t next;   // Liste LRU : vers le plus ancien (ou liste libre)
+    };
+
+    Slot* _slots;
+    uint16_t _capacity;
+    uint16_t _size;
+    uint16_t _newest;    // Tête de la liste LRU
+    uint16_t _oldest;    // Queue de la liste LRU (prochaine éviction)
+    uint16_t _free;      // Cases libres, chaînées par next
+    uint32_t _evictions;
+    uint32_t _generation;
+    MacTable<uint16_t, macTableSize(SENSOR_REGISTRY_MAX)> _index;
+
+    void _unlink(uint16_t slot);
+    void _pushNewest(uint16_t slot);
+    void _release(uint16_t slot);
+};
+
+#endif // SENSOR_REGISTRY_H
@@ -0,0 +1,138 @@
+// include/sensors/TimeSeriesStore.h
+#ifndef TIME_SERIES_STORE_H
+#define TIME_SERIES_STORE_H
+
+#include <Arduino.h>
+#include <functional>
+#include "Config.h"
+#include "utils/MacTable.h"
+#include "utils/Gorilla.h"
+
+// Résolutions disponibles pour l'historique
+enum HistoryResolution {
+    HISTORY_RAW = 0,      // Mesures telles que reçues
+    HISTORY_MINUTE = 1,   // Moyenne par minute
+    HISTORY_HOUR = 2      // Moyenne par heure
+};
+
+// Point d'historique rendu par query() (time en secondes de l'horloge de l'historique)
+struct HistoryPoint {
+    uint32_t time;
+    float waterLevel;
+    float temperature;
+    uint8_t category;
+};
+
+typedef std::function<void(const HistoryPoint&)> HistoryVisitor;
+
+/**
+ * Historique des capteurs distants
+ *
+ * Une série par capteur, avec trois anneaux : mesures brutes, moyennes par
+ * minute et moyennes par heure (catégorie maximale sur l'intervalle). Les
+ * mesures brutes sont compressées (voir Gorilla) dans un anneau de blocs :
+ * quand le bloc courant est plein, le plus ancien est recyclé. Les
+ * séries sont allouées une fois au démarrage dans la limite de
+ * HISTORY_MEMORY_BUDGET ; un capteur de plus récupère la série restée
+ * muette le plus longtemps. Les anneaux sont sauvegardés périodiquement
+ * dans HISTORY_FILE (flush) et relus au démarrage (load).
+ *
+ * Les temps sont en secondes d'une horloge propre à l'historique, qui
+ * reprend au démarrage là où la dernière sauvegarde s'était arrêtée (pas de
+ * RTC) : now() permet au client de les convertir en heure locale.
+ */
+class TimeSeriesStore {
+public:
+    TimeSeriesStore();
+    ~TimeSeriesStore();
+
+    // Allouer au plus maxSeries séries (bornées par le budget mémoire)
+    bool begin(uint16_t maxSeries);
+
+    // Ajouter une mesure prise ageMs avant maintenant
+    void record(const uint8_t* mac, uint32_t ageMs, float waterLevel, float temperature, uint8_t category);
+
+    // Parcourir les points d'un capteur depuis from (inclus), du plus ancien au plus récent.
+    // Renvoie le nombre de points, ou -1 si le capteur n'a pas d'historique.
+    int query(const uint8_t* mac, HistoryResolution res, uint32_t from, const HistoryVisitor& visitor);
+
+    // Ce capteur a-t-il un historique ?
+    bool contains(const uint8_t* mac) { return _find(mac) != nullptr; }
+
+    // Sauvegarder (si de nouvelles mesures sont arrivées) / relire l'historique en flash
+    bool flush();
+    bool load();
+
+    uint32_t now() const;
+    uint16_t seriesCount() const { return _count; }
+    uint16_t capacity() const { return _capacity; }
+    size_t memoryUsage() const;
+
+    static bool parseResolution(const String& text, HistoryResolution& res);
+
+private:
+    // Valeur compacte : niveau en mm, température en dixièmes de degré
+    struct Sample {
+        uint16_t waterLevel;
+        int16_t temperature;
+        uint8_t category;
+        uint8_t count;        // Mesures moyennées (0 = intervalle sans donnée)
+    };
+
+    // Colonnes des blocs bruts : niveau (mm), température (dixièmes de degré), catégorie
+    static const uint8_t RAW_COLUMNS = 3;
+    typedef GorillaBlock<HISTORY_RAW_BLOCK_BYTES> RawBlock;
+
+    // Moyenne en cours pour l'intervalle courant d'un niveau agrégé
+    struct Bucket {
+        uint32_t index;       // time / durée de l'intervalle
+        float waterSum;
+        float temperatureSum;
+        uint8_t category;
+        uint16_t count;
+    };
+
+    // Anneau d'intervalles consécutifs : le temps de chaque case se déduit de l'intervalle courant
+    template <size_t N>
+    struct Tier {
+        Sample samples[N];
+        uint16_t head;        // Prochaine case à écrire
+        uint16_t size;
+        Bucket current;
+    };
+
+    struct Series {
+        uint8_t mac[6];
+        bool inUse;
+        uint32_t lastUpdate;
+        RawBlock raw[HISTORY_RAW_BLOCKS];
+        uint8_t rawHead;      // Bloc en cours d'écriture
+        uint8_t rawBlocks;    // Blocs utilisés, bloc courant compris
+        Tier<HISTORY_MINUTE_POINTS> minutes;
+        Tier<HISTORY_HOUR_POINTS> hours;
+    };
+
+    // Nombre de séries que le budget mémoire permet (dimensionne l'index)
+    static const size_t MAX_SERIES = HISTORY_MEMORY_BUDGET / sizeof(Series);
+
+    Series* _series;
+    MacTable<uint16_t, macTableSize(MAX_SERIES)> _index;   // MAC -> série
+    uint16_t _capacity;
+    uint16_t _count;
+    uint32_t _clockBase;      // Horloge de l'historique au démarrage (secondes)
+    bool _dirty;              // Mesures reçues depuis la dernière sauvegarde
+
+    Series* _find(const uint8_t* mac);
+    Series* _acquire(const uint8_t* mac);
+
+    template <size_t N>
+    static void _addToTier(Tier<N>& tier, uint32_t time, uint32_t period, float waterLevel, float temperature, uint8_t category);
+    template <size_t N>
+    static int _visitTier(const Tier<N>& tier, uint32_t period, uint32_t from, const HistoryVisitor& visitor);
+
+    static Sample _makeSample(float waterLevel, float temperature, uint8_t category, uint8_t count);
+    static Sample _bucketSample(const Bucket& bucket);
+    static HistoryPoint _toPoint(uint32_t time, const Sample& sample);
+};
+
+#endif // TIME_SERIES_STORE_H
@@ -2,34 +2,57 @@
 #define WATER_LEVEL_SENSOR_H
 
 #include "sensors/SensorBase.h"
+#include "sensors/AdcSampler.h"
 #include "Config.h"
 
+// Point de la courbe d'étalonnage : valeur ADC (12 bits) -> niveau d'eau
+struct WaterCalibrationPoint {
+    float raw;
+    float levelCm;
+};
+
+/**
+ * Capteur de niveau d'eau
+ *
+ * Chaque mesure combine un bloc d'échantillons de l'ADC (continu par DMA
+ * sur l'ESP32, voir AdcSampler) : moyenne interquartile du bloc, qui écarte
+ * les pics comme une médiane tout en gagnant en résolution, puis filtre
+ * IIR entre deux mesures. Le niveau vient ensuite d'une courbe
+ * d'étalonnage linéaire par morceaux.
+ */
 class WaterLevelSensor : public SensorBase {
 public:
     WaterLevelSensor(uint8_t pin);
     ~WaterLevelSensor();
-    
+
     // Implémentation des méthodes de SensorBase
     bool begin() override;
     void update() override;
     const char* getName() override;
     void getData(float* data, uint8_t& count) override;
-    
+
     // Méthodes spécifiques au capteur de niveau d'eau
     float getWaterLevel();
     uint8_t getCategory();  // 0=normal, 1=warning, 2=critical
-    
+    float getFilteredRaw() const { return _filteredRaw; }
+
+    // Remplace la courbe par défaut (points triés par valeur ADC croissante)
+    void setCalibration(const WaterCalibrationPoint* points, uint8_t count);
+
 private:
     uint8_t _pin;
+    AdcSampler _adc;
     float _waterLevel = 0;
     uint8_t _category = 0;
-    uint16_t _rawValue = 0;
-    
-    // Paramètres de conversion
-    static const int MAX_RAW_VALUE = 4095;  // Valeur max de l'ADC (12 bits pour ESP32)
-    static const int MAX_WATER_LEVEL = 100; // Niveau d'eau maximum en cm
-    
+    float _filteredRaw = 0;
+    bool _hasReading = false;
+    const WaterCalibrationPoint* _calibration;
+    uint8_t _calibrationCount;
+    uint16_t _samples[WATER_ADC_BLOCK];
+
+    static float _interquartileMean(uint16_t* samples, uint16_t count);
+    float _toLevel(float raw) const;
     void _calculateCategory();
 };
 
-#endif // WATER_LEVEL_SENSOR_H
\ No newline at end of file
+#endif // WATER_LEVEL_SENSOR_H
@@ -0,0 +1,24 @@
+#ifndef EINK_BENCHMARK_H
+#define EINK_BENCHMARK_H
+
+#ifdef NATIVE_SIM
+
+#include <stdint.h>
+
+/**
+ * E-ink screen benchmark (native build only)
+ *
+ * Draws each EInkDisplay screen into the host framebuffer and compares
+ * what the panel would show with the golden frames in `goldenDir`
+ * (<screen>.pbm, committed under test/golden/eink). A missing or
+ * different frame fails the run, a different one is also written next to
+ * it as <screen>.new.pbm; with `updateGolden` both are (re)written instead.
+ * Then times `iterations` full redraws of each screen: layout pass,
+ * drawing and the push to the framebuffer, which is the draw path minus
+ * the panel wait.
+ */
+int runEInkBenchmark(const char* goldenDir, uint32_t iterations, bool updateGolden = false);
+
+#endif // NATIVE_SIM
+
+#endif // EINK_BENCHMARK_H
@@ -0,0 +1,59 @@
+#ifndef FLEET_SIMULATOR_H
+#define FLEET_SIMULATOR_H
+
+#ifdef NATIVE_SIM
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Simulation parameters (command line of the native program)
+struct FleetOptions {
+    int slaves = 20;                  // Slave stations alongside the master
+    uint32_t durationSec = 60;        // Simulated run time
+    double speed = 10.0;              // Simulated seconds per wall second
+    double lossRate = 0.0;            // Fraction of frames lost on the air
+    size_t rxQueueDepth = 32;         // Frames buffered per receiver
+    int sensorCapacity = 0;           // Master sensor registry size (0 = one per slave + local)
+    int httpClients = 0;              // Dashboard clients polling the master
+    uint32_t httpIntervalMs = 30000;  // Poll period of each client (simulated)
+    int eventClients = 0;             // Dashboards subscribed to /api/events
+    int slowClients = 0;              // Clients downloading the stylesheet over a slow link
+    bool verbose = false;             // Echo the master's serial console
+};
+
+// Loop latency histogram, power-of-two buckets in microseconds (wall time)
+struct LatencyHistogram {
+    static const int BUCKETS = 24;
+    uint64_t buckets[BUCKETS] = {0};
+    uint64_t count = 0;
+    uint64_t totalUs = 0;
+    uint64_t maxUs = 0;
+
+    void record(uint64_t us);
+    void merge(const LatencyHistogram& other);
+    uint64_t percentile(double p) const;
+    uint64_t averageUs() const { return count ? totalUs / count : 0; }
+};
+
+/**
+ * Fleet Simulator
+ *
+ * Runs one master and N slaves of the real firmware (FloodAlertSystem and
+ * its indicators) as threads connected by the simulated ESP-NOW medium of
+ * the NativeHAL library, then reports radio throughput, loop latency and
+ * heap usage for that fleet size.
+ */
+class FleetSimulator {
+public:
+    explicit FleetSimulator(const FleetOptions& options);
+
+    // Run the fleet for the configured duration and print the report
+    int run();
+
+private:
+    FleetOptions _options;
+};
+
+#endif // NATIVE_SIM
+
+#endif // FLEET_SIMULATOR_H
@@ -0,0 +1,20 @@
+#ifndef HISTORY_BENCHMARK_H
+#define HISTORY_BENCHMARK_H
+
+#ifdef NATIVE_SIM
+
+#include <stdint.h>
+
+/**
+ * History codec benchmark (native build only)
+ *
+ * Encodes synthetic sensor series with the same Gorilla blocks as
+ * TimeSeriesStore's raw tier, checks that every point decodes back
+ * exactly, and reports the compression ratio against uncompressed samples
+ * and the decoder throughput.
+ */
+int runHistoryBenchmark(uint32_t points);
+
+#endif // NATIVE_SIM
+
+#endif // HISTORY_BENCHMARK_H
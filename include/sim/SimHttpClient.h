@@ -0,0 +1,48 @@
+#ifndef SIM_HTTP_CLIENT_H
+#define SIM_HTTP_CLIENT_H
+
+#ifdef NATIVE_SIM
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+/**
+ * Sim HTTP Client
+ *
+ * Blocking TCP client used by the fleet simulator to load the master's
+ * HttpServer through the host network stack, like a browser on the access
+ * point would. Timeouts are in wall time.
+ */
+class SimHttpClient {
+public:
+    struct Response {
+        int code = 0;           // 0 if no status line was received
+        std::string body;
+        bool complete = false;  // The server closed the connection after the body
+    };
+
+    SimHttpClient() : _fd(-1) {}
+    ~SimHttpClient() { close(); }
+
+    // Connect to 127.0.0.1:port. A small receive buffer makes a slow reader
+    // push back on the server quickly.
+    bool connect(uint16_t port, int receiveBuffer = 0);
+    bool sendGet(const char* path);
+    // Bytes available within timeoutMs (at most maxBytes); empty on timeout or close
+    std::string read(uint32_t timeoutMs, size_t maxBytes = 4096);
+    bool isOpen() const { return _fd >= 0; }
+    void close();
+
+    // One GET. With readChunk > 0 the body is read readChunk bytes at a time
+    // with pauseMs between reads (a client on a poor link).
+    static Response get(uint16_t port, const char* path, size_t readChunk = 0, uint32_t pauseMs = 0,
+                        uint32_t timeoutMs = 10000);
+
+private:
+    int _fd;
+};
+
+#endif // NATIVE_SIM
+
+#endif // SIM_HTTP_CLIENT_H
@@ -0,0 +1,21 @@
+#ifndef STATIC_BENCHMARK_H
+#define STATIC_BENCHMARK_H
+
+#ifdef NATIVE_SIM
+
+#include <stdint.h>
+
+/**
+ * Static file benchmark (native build only)
+ *
+ * Serves the bundled web interface through HttpServer twice, once from
+ * SPIFFS files (exists + open + streamFile, as before the bundle) and once
+ * from the compiled-in AssetBundle (send_P), and reports requests per second
+ * and heap allocations per request for each, with `clients` concurrent
+ * TCP clients.
+ */
+int runStaticBenchmark(uint32_t seconds, int clients);
+
+#endif // NATIVE_SIM
+
+#endif // STATIC_BENCHMARK_H
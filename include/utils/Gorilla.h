@@ -0,0 +1,84 @@
+// include/utils/Gorilla.h
+#ifndef GORILLA_H
+#define GORILLA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Colonnes de valeurs par point (niveau d'eau, température, catégorie)
+#define GORILLA_MAX_COLUMNS 3
+
+// Dernier point écrit dans un bloc, nécessaire pour y ajouter le suivant
+struct GorillaState {
+    uint32_t lastTime;
+    int32_t lastDelta;
+    uint32_t lastValue[GORILLA_MAX_COLUMNS];   // Bits du float précédent
+    uint8_t leading[GORILLA_MAX_COLUMNS];      // Fenêtre XOR courante
+    uint8_t trailing[GORILLA_MAX_COLUMNS];
+};
+
+/**
+ * Compression "Gorilla" de séries temporelles
+ *
+ * Temps : premier point sur 32 bits, puis delta de delta avec un préfixe
+ * variable ('0' si l'intervalle ne change pas, 7/9/12/32 bits sinon).
+ * Valeurs : XOR avec le float précédent ; '0' si identique, sinon seuls
+ * les bits significatifs, en réutilisant la fenêtre (zéros de tête et de
+ * queue) du point précédent quand elle convient. Les valeurs quantifiées
+ * (niveau en mm, dixièmes de degré) sont des floats entiers dont la mantisse
+ * se termine par des zéros : un capteur stable coûte quelques bits par point.
+ *
+ * Les données sont écrites dans un bloc de taille fixe ; append() refuse
+ * un point qui ne tient plus, sans rien modifier.
+ */
+class Gorilla {
+public:
+    // Ajouter un point au bloc data[capacity] ; bits/count/state décrivent son contenu
+    static bool append(uint8_t* data, size_t capacity, uint16_t& bits, uint16_t& count,
+                       GorillaState& state, uint8_t columns, uint32_t time, const float* values);
+};
+
+// Décodeur au fil de l'eau : un point par appel à next(), sans tampon intermédiaire
+class GorillaReader {
+public:
+    GorillaReader(const uint8_t* data, uint16_t bits, uint16_t count, uint8_t columns);
+
+    bool next(uint32_t& time, float* values);
+
+private:
+    const uint8_t* _data;
+    uint16_t _bits;
+    uint16_t _count;
+    uint8_t _columns;
+    uint16_t _pos;       // Position de lecture en bits
+    uint16_t _read;      // Points déjà décodés
+    GorillaState _state;
+
+    uint32_t _readBits(uint8_t n);
+};
+
+// Bloc compressé autonome (copiable tel quel en flash)
+template <size_t Bytes>
+struct GorillaBlock {
+    static_assert(Bytes * 8 <= 0xFFFF, "Block too large for 16-bit bit counter");
+
+    uint16_t bits;
+    uint16_t count;
+    GorillaState state;
+    uint8_t data[Bytes];
+
+    void clear() {
+        bits = 0;
+        count = 0;
+    }
+
+    bool append(uint32_t time, const float* values, uint8_t columns) {
+        return Gorilla::append(data, Bytes, bits, count, state, columns, time, values);
+    }
+
+    GorillaReader reader(uint8_t columns) const {
+        return GorillaReader(data, bits, count, columns);
+    }
+};
+
+#endif // GORILLA_H
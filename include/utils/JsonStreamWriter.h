@@ -0,0 +1,93 @@
+// include/utils/JsonStreamWriter.h
+#ifndef JSON_STREAM_WRITER_H
+#define JSON_STREAM_WRITER_H
+
+#include <Arduino.h>
+#include "network/HttpServer.h"
+#include "Config.h"
+
+// Profondeur maximale d'imbrication (objets et tableaux)
+#define JSON_STREAM_MAX_DEPTH 8
+
+/**
+ * Écriture JSON en flux vers le client HTTP
+ *
+ * Le texte est produit directement dans un petit tampon fixe qui est passé
+ * au serveur dès qu'il est plein : la mémoire utilisée ne dépend
+ * pas de la taille de la réponse (pas de document ni de String intermédiaire).
+ * Les virgules sont gérées automatiquement :
+ *
+ *   JsonStreamWriter json(server);
+ *   json.begin();
+ *   json.beginObject();
+ *   json.key("sensors"); json.beginArray();
+ *   ...
+ *   json.endArray();
+ *   json.field("timestamp", millis() / 1000);
+ *   json.endObject();
+ *   json.end();
+ *
+ * Construit sur une String, il écrit le même texte dans celle-ci (réponses
+ * mises en cache, voir ResponseCache) : begin() n'envoie alors rien.
+ */
+class JsonStreamWriter {
+public:
+    explicit JsonStreamWriter(HttpServer& server);
+    explicit JsonStreamWriter(String& output);
+
+    // Envoyer les en-têtes (longueur inconnue : fin à la fermeture de la connexion)
+    void begin(int code = 200, const char* contentType = "application/json");
+    // Vider le tampon et terminer la réponse
+    void end();
+
+    void beginObject();
+    void endObject();
+    void beginArray();
+    void endArray();
+
+    // Clé du prochain membre d'un objet
+    void key(const char* name);
+
+    void value(const char* text);
+    void value(const String& text) { value(text.c_str()); }
+    void value(bool flag);
+    void value(int number) { value((long)number); }
+    void value(unsigned int number) { value((unsigned long)number); }
+    void value(long number);
+    void value(unsigned long number);
+    void value(double number);   // NaN/infini => null
+    void null();
+
+    // Membres d'un objet déjà sérialisé (corps en cache) recopiés tels quels
+    // dans l'objet courant : "{\"a\":1}" ajoute "a":1
+    void members(const String& object);
+
+    template <typename T>
+    void field(const char* name, T v) {
+        key(name);
+        value(v);
+    }
+
+    // Octets envoyés depuis begin()
+    size_t bytesWritten() const { return _total + _length; }
+
+private:
+    HttpServer* _server;
+    String* _output;
+    char _buffer[JSON_STREAM_CHUNK_SIZE];
+    size_t _length;
+    size_t _total;
+    uint8_t _depth;
+    uint16_t _first;    // Bit n : aucun élément encore écrit au niveau n
+    bool _afterKey;
+
+    void _separator();
+    void _open(char c);
+    void _close(char c);
+    void _write(char c);
+    void _write(const char* text, size_t length);
+    void _writeString(const char* text);
+    void _flush();
+};
+
+#endif // JSON_STREAM_WRITER_H
@@ -3,6 +3,9 @@
 #define LOGGER_H
 
 #include <Arduino.h>
+#include <atomic>
+#include "Config.h"
+#include "utils/MpscRing.h"
 
 // Niveaux de log
 enum LogLevel {
@@ -13,6 +16,18 @@ enum LogLevel {
     LOG_LEVEL_DEBUG = 4
 };
 
+/**
+ * Journal série
+ *
+ * Les appels ne font que formater la ligne dans un tampon circulaire sans
+ * verrou (MpscRing, LOG_BUFFER_LINES lignes) ; une tâche de basse priorité
+ * créée par begin() l'écrit sur le port série, dont le débit (115200 bauds,
+ * environ 11 octets par milliseconde) ne retarde donc plus l'appelant.
+ * Quand le tampon est plein, la ligne est perdue et comptée ; le nombre de
+ * lignes perdues est écrit avec les suivantes. Sans tâche (avant begin(), ou
+ * en simulation, où chaque nœud a son tampon) la ligne est écrite tout de
+ * suite par l'appelant.
+ */
 class Logger {
 public:
     // Initialiser le logger
@@ -29,6 +44,12 @@ public:
     
     // Obtenir le niveau de log actuel
     static LogLevel getLogLevel();
+
+    // Écrire tout de suite les lignes en attente (avant un redémarrage)
+    static void flush();
+
+    // Lignes perdues faute de place dans le tampon
+    static uint32_t getDroppedCount();
     
     // Logs avec niveau
     static void error(const String& message);
@@ -40,36 +61,28 @@ public:
     template<typename... Args>
     static void errorF(const char* format, Args... args) {
         if (_logsEnabled && _currentLogLevel >= LOG_LEVEL_ERROR) {
-            Serial.print("[ERROR] ");
-            Serial.printf(format, args...);
-            Serial.println();
+            _write(LOG_LEVEL_ERROR, format, args...);
         }
     }
     
     template<typename... Args>
     static void warningF(const char* format, Args... args) {
         if (_logsEnabled && _currentLogLevel >= LOG_LEVEL_WARNING) {
-            Serial.print("[WARNING] ");
-            Serial.printf(format, args...);
-            Serial.println();
+            _write(LOG_LEVEL_WARNING, format, args...);
         }
     }
     
     template<typename... Args>
     static void infoF(const char* format, Args... args) {
         if (_logsEnabled && _currentLogLevel >= LOG_LEVEL_INFO) {
-            Serial.print("[INFO] ");
-            Serial.printf(format, args...);
-            Serial.println();
+            _write(LOG_LEVEL_INFO, format, args...);
         }
     }
     
     template<typename... Args>
     static void debugF(const char* format, Args... args) {
         if (_logsEnabled && _currentLogLevel >= LOG_LEVEL_DEBUG) {
-            Serial.print("[DEBUG] ");
-            Serial.printf(format, args...);
-            Serial.println();
+            _write(LOG_LEVEL_DEBUG, format, args...);
         }
     }
     
@@ -78,14 +91,35 @@ public:
     
     template<typename... Args>
     static void uiF(const char* format, Args... args) {
-        Serial.printf(format, args...);
-        Serial.println();
+        _write(LOG_LEVEL_NONE, format, args...);
     }
     
 private:
     // Déclaration des variables statiques (définies dans Logger.cpp)
     static LogLevel _currentLogLevel;
     static bool _logsEnabled;
+
+    struct Line {
+        uint8_t level;               // LOG_LEVEL_NONE : sans préfixe (ui)
+        uint8_t length;
+        char text[LOG_LINE_LENGTH];
+    };
+
+    // Tampon du journal : global sur l'ESP32, un par nœud en simulation
+    struct Buffer {
+        MpscRing<Line, LOG_BUFFER_LINES> lines;
+        std::atomic<uint32_t> dropped{0};
+        uint32_t reportedDrops = 0;     // Déjà signalées (écrivain uniquement)
+        std::atomic<bool> draining{false};
+    };
+    static NODE_LOCAL Buffer _buffer;
+    static void* _drainTask;            // TaskHandle_t (ESP32 uniquement)
+
+    // Formater une ligne dans le tampon
+    static void _write(LogLevel level, const char* format, ...) __attribute__((format(printf, 2, 3)));
+    // Écrire les lignes en attente ; un seul écrivain à la fois
+    static void _drain();
+    static void _drainLoop(void* arg);
 };
 
 #endif // LOGGER_H
\ No newline at end of file
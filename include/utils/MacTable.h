@@ -0,0 +1,110 @@
+// include/utils/MacTable.h
+#ifndef MAC_TABLE_H
+#define MAC_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Taille de table adaptée à n entrées : puissance de 2, remplie au plus à moitié
+constexpr size_t macTableSize(size_t entries, size_t size = 2) {
+    return size >= entries * 2 ? size : macTableSize(entries, size * 2);
+}
+
+/**
+ * Table de hachage à adressage ouvert indexée par adresse MAC
+ *
+ * La MAC (48 bits) est la clé, sondage linéaire et suppression par
+ * décalage arrière (pas de pierres tombales) : une recherche coûte O(1)
+ * même après de nombreux ajouts/retraits de pairs. Capacity est une
+ * puissance de 2 fixée à la compilation, sans allocation ; la table ne
+ * doit pas être remplie à plus de la moitié (voir macTableSize()).
+ * Pas de verrou : à n'utiliser que depuis la boucle principale.
+ */
+template <typename V, size_t Capacity>
+class MacTable {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    MacTable() { clear(); }
+
+    // Valeur associée à mac, nullptr si absente
+    V* find(const uint8_t* mac) {
+        uint64_t k = key(mac);
+        for (size_t i = _home(k), probes = 0; probes < Capacity; i = (i + 1) & MASK, probes++) {
+            if (_keys[i] == k) return &_values[i];
+            if (_keys[i] == EMPTY) return nullptr;
+        }
+        return nullptr;
+    }
+
+    bool contains(const uint8_t* mac) { return find(mac) != nullptr; }
+
+    // Ajouter ou remplacer ; false si la table est pleine
+    bool insert(const uint8_t* mac, const V& value) {
+        uint64_t k = key(mac);
+        for (size_t i = _home(k), probes = 0; probes < Capacity; i = (i + 1) & MASK, probes++) {
+            if (_keys[i] == k || _keys[i] == EMPTY) {
+                if (_keys[i] == EMPTY) _size++;
+                _keys[i] = k;
+                _values[i] = value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Retirer mac ; false si absente
+    bool erase(const uint8_t* mac) {
+        uint64_t k = key(mac);
+        size_t i = _home(k);
+        for (size_t probes = 0; _keys[i] != k; i = (i + 1) & MASK, probes++) {
+            if (_keys[i] == EMPTY || probes >= Capacity) return false;
+        }
+
+        // Recompacter la séquence de sondage qui suit la case libérée
+        size_t hole = i;
+        for (size_t j = (hole + 1) & MASK; _keys[j] != EMPTY; j = (j + 1) & MASK) {
+            size_t home = _home(_keys[j]);
+            // L'entrée j peut remonter dans le trou si son emplacement
+            // d'origine n'est pas situé entre le trou (exclu) et j
+            if (((j - home) & MASK) >= ((j - hole) & MASK)) {
+                _keys[hole] = _keys[j];
+                _values[hole] = _values[j];
+                hole = j;
+            }
+        }
+        _keys[hole] = EMPTY;
+        _size--;
+        return true;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < Capacity; i++) _keys[i] = EMPTY;
+        _size = 0;
+    }
+
+    size_t size() const { return _size; }
+    static size_t capacity() { return Capacity; }
+
+    // Clé 48 bits ; le bit 48 la distingue d'une case vide (MAC nulle comprise)
+    static uint64_t key(const uint8_t* mac) {
+        return ((uint64_t)mac[0] << 40) | ((uint64_t)mac[1] << 32) | ((uint64_t)mac[2] << 24) |
+               ((uint64_t)mac[3] << 16) | ((uint64_t)mac[4] << 8) | (uint64_t)mac[5] | (1ULL << 48);
+    }
+
+private:
+    static const uint64_t EMPTY = 0;
+    static const size_t MASK = Capacity - 1;
+
+    uint64_t _keys[Capacity];
+    V _values[Capacity];
+    size_t _size;
+
+    // Hachage de Fibonacci : les octets fabricant (OUI) souvent identiques
+    // d'une flotte sont mélangés avec ceux de l'interface
+    static size_t _home(uint64_t k) {
+        return (size_t)((k * 0x9E3779B97F4A7C15ULL) >> 40) & MASK;
+    }
+};
+
+#endif // MAC_TABLE_H
@@ -0,0 +1,81 @@
+// include/utils/MpscRing.h
+#ifndef MPSC_RING_H
+#define MPSC_RING_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * File circulaire sans verrou, plusieurs producteurs / un consommateur
+ *
+ * Chaque case porte un numéro de séquence : un producteur (n'importe quelle
+ * tâche, sur l'un ou l'autre cœur) réserve la case suivante par un
+ * compare-and-swap sur _head, la remplit sur place puis la publie avec
+ * commit() ; le consommateur lit les cases publiées dans l'ordre des
+ * réservations. Une case réservée mais pas encore publiée retient le
+ * consommateur jusqu'à son commit(). Capacity doit être une puissance de 2 ;
+ * pas d'allocation.
+ */
+template <typename T, size_t Capacity>
+class MpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    MpscRing() : _head(0), _tail(0) {
+        for (uint32_t i = 0; i < Capacity; i++) {
+            _sequence[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    // Côté producteurs : réserver une case à remplir, à publier avec
+    // commit(ticket). nullptr si la file est pleine.
+    T* reserve(uint32_t& ticket) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        for (;;) {
+            int32_t lag = (int32_t)(_sequence[head & MASK].load(std::memory_order_acquire) - head);
+            if (lag == 0) {
+                // Case libre : la prendre, sauf si un autre producteur l'a eue avant
+                if (_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) {
+                    ticket = head;
+                    return &_items[head & MASK];
+                }
+            } else if (lag < 0) {
+                // Le consommateur n'a pas encore libéré cette case
+                return nullptr;
+            } else {
+                head = _head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void commit(uint32_t ticket) {
+        _sequence[ticket & MASK].store(ticket + 1, std::memory_order_release);
+    }
+
+    // Côté consommateur : élément publié le plus ancien, nullptr s'il n'y en a pas
+    const T* front() const {
+        if (_sequence[_tail & MASK].load(std::memory_order_acquire) != _tail + 1) {
+            return nullptr;
+        }
+        return &_items[_tail & MASK];
+    }
+
+    // Côté consommateur : libérer l'élément rendu par front()
+    void popFront() {
+        _sequence[_tail & MASK].store(_tail + Capacity, std::memory_order_release);
+        _tail++;
+    }
+
+    static size_t capacity() { return Capacity; }
+
+private:
+    static const uint32_t MASK = Capacity - 1;
+
+    T _items[Capacity];
+    std::atomic<uint32_t> _sequence[Capacity];  // == position : libre ; position + 1 : publiée
+    std::atomic<uint32_t> _head;                // Prochaine case à réserver (producteurs)
+    uint32_t _tail;                             // Prochaine case à lire (consommateur uniquement)
+};
+
+#endif // MPSC_RING_H
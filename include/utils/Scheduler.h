@@ -0,0 +1,106 @@
+// include/utils/Scheduler.h
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+#include <atomic>
+#include <functional>
+
+// Nombre maximum de tâches enregistrées (un bit par tâche dans le masque des tâches prêtes)
+#define SCHEDULER_MAX_TASKS 24
+
+// Attente maximale de la boucle principale quand aucune tâche n'est due (ms)
+#define SCHEDULER_MAX_WAIT_MS 1000
+
+typedef std::function<void()> TaskCallback;
+
+// Statistiques de latence de la boucle (en microsecondes)
+struct SchedulerStats {
+    uint32_t wakeups;          // Réveils de la boucle
+    uint32_t tasksRun;         // Tâches exécutées
+    uint32_t lastLoopUs;       // Durée du dernier passage (toutes les tâches prêtes)
+    uint32_t maxLoopUs;        // Pire durée d'un passage
+    uint32_t maxLatencyUs;     // Pire retard entre l'échéance (ou le signal) et l'exécution
+    uint32_t maxRunUs;         // Pire durée d'une tâche
+    const char* slowestTask;   // Tâche responsable de maxRunUs
+};
+
+/**
+ * Scheduler coopératif
+ *
+ * Remplace la boucle "update() + delay(10)" : chaque sous-système enregistre
+ * des tâches périodiques, ponctuelles ou déclenchées par un événement, et la
+ * boucle principale dort (notification FreeRTOS) jusqu'à la prochaine
+ * échéance ou jusqu'à un signal. Les tâches prêtes s'exécutent dans l'ordre
+ * d'enregistrement ; aucune ne doit bloquer.
+ */
+class Scheduler {
+public:
+    static const uint8_t INVALID_TASK = 0xFF;
+
+    Scheduler();
+
+    // Associer le scheduler à la tâche qui exécute la boucle (à appeler depuis celle-ci)
+    void begin();
+
+    // Tâche exécutée toutes les periodMs millisecondes
+    uint8_t addPeriodic(const char* name, uint32_t periodMs, TaskCallback callback);
+
+    // Même chose, première exécution après firstDelayMs au lieu du prochain passage
+    uint8_t addPeriodic(const char* name, uint32_t periodMs, uint32_t firstDelayMs, TaskCallback callback);
+
+    // Tâche exécutée uniquement quand elle est signalée
+    uint8_t addEvent(const char* name, TaskCallback callback);
+
+    // Tâche exécutée une seule fois après delayMs, puis libérée
+    uint8_t runAfter(const char* name, uint32_t delayMs, TaskCallback callback);
+
+    // Modifier la période d'une tâche périodique
+    void setPeriod(uint8_t id, uint32_t periodMs);
+
+    // Avancer la prochaine exécution d'une tâche (jamais la retarder)
+    void runIn(uint8_t id, uint32_t delayMs);
+
+    // Rendre une tâche prête et réveiller la boucle (depuis une autre tâche ou un callback)
+    void signal(uint8_t id);
+
+    // Même chose depuis une routine d'interruption
+    void signalFromISR(uint8_t id);
+
+    // Attendre du travail (au plus maxWaitMs) puis exécuter les tâches prêtes
+    void runOnce(uint32_t maxWaitMs = SCHEDULER_MAX_WAIT_MS);
+
+    // Statistiques
+    const SchedulerStats& getStats() const { return _stats; }
+    void resetStats();
+    void printStats();
+
+private:
+    struct Task {
+        const char* name;
+        TaskCallback callback;
+        uint32_t periodMs;        // 0 = tâche événementielle ou ponctuelle
+        uint64_t nextRunUs;       // 0 = pas d'échéance
+        // 32 bits bas de l'heure (µs) du premier signal non traité, 0 = aucun :
+        // écrit depuis d'autres tâches ou une interruption, donc atomique
+        // comme _pending (un uint64_t serait lu en deux fois sur l'ESP32)
+        std::atomic<uint32_t> signalledAtUs;
+        bool oneShot;
+        bool inUse;
+    };
+
+    Task _tasks[SCHEDULER_MAX_TASKS];
+    std::atomic<uint32_t> _pending;   // Masque des tâches signalées
+    SchedulerStats _stats;
+    void* _owner;                     // Tâche FreeRTOS (ou nœud simulé) à réveiller
+
+    uint8_t _addTask(const char* name, uint32_t periodMs, uint64_t firstRunUs, bool oneShot, TaskCallback callback);
+    uint64_t _nextDeadlineUs();
+    void _waitForWork(uint32_t waitMs);
+    void _wake();
+
+    static uint64_t _nowUs();
+    void _stampSignal(uint8_t id);
+};
+
+#endif // SCHEDULER_H
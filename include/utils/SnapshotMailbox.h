@@ -0,0 +1,56 @@
+// include/utils/SnapshotMailbox.h
+#ifndef SNAPSHOT_MAILBOX_H
+#define SNAPSHOT_MAILBOX_H
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * Boîte aux lettres sans verrou pour le dernier instantané, un producteur /
+ * un consommateur
+ *
+ * Contrairement à SpscQueue, seul le dernier état compte : le producteur
+ * remplit back() puis publish(), sans jamais attendre ; le consommateur
+ * prend le plus récent avec take() et lit front() aussi longtemps qu'il
+ * veut. Trois cases (la case publiée s'échange atomiquement avec celle de
+ * l'un ou de l'autre côté), donc aucune section critique, y compris entre
+ * les deux cœurs de l'ESP32. Les instantanés intermédiaires que le
+ * consommateur n'a pas eu le temps de prendre sont écrasés.
+ */
+template <typename T>
+class SnapshotMailbox {
+public:
+    SnapshotMailbox() : _back(0), _front(2), _middle(1) {}
+
+    // Côté producteur : case à remplir avant publish()
+    T& back() { return _slots[_back]; }
+
+    void publish() {
+        uint8_t previous = _middle.exchange(_back | FRESH, std::memory_order_acq_rel);
+        _back = previous & INDEX;
+    }
+
+    // Côté consommateur : true si un instantané a été publié depuis le
+    // dernier take(), qui devient front()
+    bool take() {
+        if (!(_middle.load(std::memory_order_relaxed) & FRESH)) {
+            return false;
+        }
+        uint8_t previous = _middle.exchange(_front, std::memory_order_acq_rel);
+        _front = previous & INDEX;
+        return true;
+    }
+
+    const T& front() const { return _slots[_front]; }
+
+private:
+    static const uint8_t INDEX = 0x03;
+    static const uint8_t FRESH = 0x04;     // La case du milieu n'a pas été prise
+
+    T _slots[3];
+    uint8_t _back;                 // Producteur uniquement
+    uint8_t _front;                // Consommateur uniquement
+    std::atomic<uint8_t> _middle;  // Dernière case publiée | FRESH
+};
+
+#endif // SNAPSHOT_MAILBOX_H
@@ -0,0 +1,88 @@
+// include/utils/SpscQueue.h
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * File circulaire sans verrou, un producteur / un consommateur
+ *
+ * Le producteur (callback ESP-NOW dans la tâche WiFi, ou routine
+ * d'interruption) n'écrit que _head, le consommateur (boucle principale)
+ * n'écrit que _tail : aucune section critique n'est nécessaire, y compris
+ * entre les deux cœurs de l'ESP32. Capacity doit être une puissance de 2 ;
+ * les éléments sont copiés dans un tableau fixe, sans allocation.
+ */
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    SpscQueue() : _head(0), _tail(0) {}
+
+    // Côté producteur : false si la file est pleine (l'élément est perdu)
+    bool push(const T& item) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) >= Capacity) {
+            return false;
+        }
+        _items[head & (Capacity - 1)] = item;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Côté producteur : réserver la case suivante pour la remplir sur place,
+    // puis la publier avec commit(). nullptr si la file est pleine.
+    T* reserve() {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) >= Capacity) {
+            return nullptr;
+        }
+        return &_items[head & (Capacity - 1)];
+    }
+
+    void commit() {
+        _head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Côté consommateur : élément le plus ancien, nullptr si la file est vide
+    const T* front() const {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return &_items[tail & (Capacity - 1)];
+    }
+
+    // Côté consommateur : libérer l'élément rendu par front()
+    void popFront() {
+        _tail.store(_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Côté consommateur : copier et retirer l'élément le plus ancien
+    bool pop(T& item) {
+        const T* next = front();
+        if (!next) {
+            return false;
+        }
+        item = *next;
+        popFront();
+        return true;
+    }
+
+    size_t size() const {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+    static size_t capacity() { return Capacity; }
+
+private:
+    T _items[Capacity];
+    std::atomic<uint32_t> _head;   // Prochaine case à écrire (producteur)
+    std::atomic<uint32_t> _tail;   // Prochaine case à lire (consommateur)
+};
+
+#endif // SPSC_QUEUE_H
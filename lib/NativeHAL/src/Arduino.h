@@ -0,0 +1,60 @@
+#ifndef NATIVE_HAL_ARDUINO_H
+#define NATIVE_HAL_ARDUINO_H
+
+// Host implementation of the Arduino core API for the native environment.
+// Pins, timing and the serial console resolve to the SimNode bound to the
+// calling thread (see SimNode.h), so each thread behaves like one board.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "WString.h"
+#include "Print.h"
+#include "HardwareSerial.h"
+
+using std::isnan;
+using std::isinf;
+using std::min;
+using std::max;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT          0x01
+#define OUTPUT         0x03
+#define PULLUP         0x04
+#define INPUT_PULLUP   0x05
+#define PULLDOWN       0x08
+#define INPUT_PULLDOWN 0x09
+
+#define PROGMEM
+#define F(string_literal) (string_literal)
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration = 0);
+void noTone(uint8_t pin);
+
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+#endif // NATIVE_HAL_ARDUINO_H
@@ -0,0 +1,110 @@
+#include "Arduino.h"
+#include "SPI.h"
+#include "SimNode.h"
+#include <chrono>
+#include <thread>
+
+HardwareSerial Serial;
+SPIClass SPI;
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    sim::SimNode* node = sim::SimNode::current();
+    if (node) {
+        node->serialWrite(buffer, size);
+    } else {
+        fwrite(buffer, 1, size, stdout);
+    }
+    return size;
+}
+
+unsigned long millis() {
+    return sim::nowMillis();
+}
+
+unsigned long micros() {
+    return (unsigned long)sim::nowMicros();
+}
+
+// Sleeps in wall time scaled by the clock speed; a bound node keeps
+// receiving its radio callbacks while it waits, as on the chip.
+void delay(uint32_t ms) {
+    uint64_t wallUs = (uint64_t)(ms * 1000.0 / sim::clockSpeed());
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(wallUs);
+
+    sim::SimNode* node = sim::SimNode::current();
+    if (!node) {
+        std::this_thread::sleep_until(deadline);
+        return;
+    }
+
+    node->pump();
+    for (;;) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) break;
+        auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(deadline - now);
+        node->waitForEvents((uint64_t)remaining.count());
+    }
+}
+
+void delayMicroseconds(uint32_t us) {
+    std::this_thread::sleep_for(std::chrono::microseconds((uint64_t)(us / sim::clockSpeed())));
+}
+
+void yield() {
+    sim::SimNode* node = sim::SimNode::current();
+    if (node) {
+        node->pump();
+    }
+    std::this_thread::yield();
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    if (sim::SimNode* node = sim::SimNode::current()) node->pinMode(pin, mode);
+}
+
+void digitalWrite(uint8_t pin, uint8_t val) {
+    if (sim::SimNode* node = sim::SimNode::current()) node->digitalWrite(pin, val);
+}
+
+int digitalRead(uint8_t pin) {
+    sim::SimNode* node = sim::SimNode::current();
+    return node ? node->digitalRead(pin) : LOW;
+}
+
+uint16_t analogRead(uint8_t pin) {
+    sim::SimNode* node = sim::SimNode::current();
+    return node ? node->analogRead(pin) : 0;
+}
+
+void tone(uint8_t pin, unsigned int frequency, unsigned long duration) {
+    (void)duration;
+    if (sim::SimNode* node = sim::SimNode::current()) node->tone(pin, frequency);
+}
+
+void noTone(uint8_t pin) {
+    if (sim::SimNode* node = sim::SimNode::current()) node->noTone(pin);
+}
+
+static thread_local uint32_t t_randomState = 0x9E3779B9;
+
+void randomSeed(unsigned long seed) {
+    t_randomState = seed ? (uint32_t)seed : 0x9E3779B9;
+}
+
+long random(long howbig) {
+    if (howbig <= 0) return 0;
+    t_randomState ^= t_randomState << 13;
+    t_randomState ^= t_randomState >> 17;
+    t_randomState ^= t_randomState << 5;
+    return (long)(t_randomState % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) return howsmall;
+    return random(howbig - howsmall) + howsmall;
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    if (in_max == in_min) return out_min;
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
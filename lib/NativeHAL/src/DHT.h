@@ -0,0 +1,35 @@
+#ifndef NATIVE_HAL_DHT_H
+#define NATIVE_HAL_DHT_H
+
+#include "Arduino.h"
+
+#define DHT11 11
+#define DHT22 22
+
+// Simulated DHT: slow temperature/humidity drift around room conditions, at
+// the sensor resolution (whole degrees and percent on a DHT11, tenths on a DHT22)
+class DHT {
+public:
+    DHT(uint8_t pin, uint8_t type) : _pin(pin), _type(type) {}
+
+    void begin() {}
+
+    float readTemperature(bool fahrenheit = false) {
+        float celsius = _quantize(22.0f + 3.0f * sinf(millis() / 600000.0f * 6.2831853f));
+        return fahrenheit ? celsius * 1.8f + 32.0f : celsius;
+    }
+
+    float readHumidity() {
+        return _quantize(55.0f + 10.0f * cosf(millis() / 900000.0f * 6.2831853f));
+    }
+
+private:
+    uint8_t _pin;
+    uint8_t _type;
+
+    float _quantize(float value) const {
+        return _type == DHT11 ? roundf(value) : roundf(value * 10.0f) / 10.0f;
+    }
+};
+
+#endif // NATIVE_HAL_DHT_H
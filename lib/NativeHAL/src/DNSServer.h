@@ -0,0 +1,18 @@
+#ifndef NATIVE_HAL_DNS_SERVER_H
+#define NATIVE_HAL_DNS_SERVER_H
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+// Captive portal DNS: nothing to answer on the host
+class DNSServer {
+public:
+    bool start(uint16_t port, const String& domainName, const IPAddress& resolvedIP) {
+        (void)port; (void)domainName; (void)resolvedIP;
+        return true;
+    }
+    void stop() {}
+    void processNextRequest() {}
+};
+
+#endif // NATIVE_HAL_DNS_SERVER_H
@@ -0,0 +1,89 @@
+#include "FS.h"
+#include <sys/stat.h>
+
+namespace fs {
+
+File::File(FILE* handle, const String& path)
+    : _handle(handle, [](FILE* f) { if (f) fclose(f); }), _path(path) {
+}
+
+size_t File::write(const uint8_t* buf, size_t size) {
+    if (!_handle) return 0;
+    return fwrite(buf, 1, size, _handle.get());
+}
+
+int File::available() {
+    if (!_handle) return 0;
+    return (int)(size() - position());
+}
+
+int File::read() {
+    if (!_handle) return -1;
+    return fgetc(_handle.get());
+}
+
+size_t File::read(uint8_t* buf, size_t size) {
+    if (!_handle) return 0;
+    return fread(buf, 1, size, _handle.get());
+}
+
+String File::readStringUntil(char terminator) {
+    String text;
+    int c;
+    while ((c = read()) >= 0 && c != terminator) text += (char)c;
+    return text;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+    if (!_handle) return false;
+    int whence = mode == SeekCur ? SEEK_CUR : (mode == SeekEnd ? SEEK_END : SEEK_SET);
+    return fseek(_handle.get(), pos, whence) == 0;
+}
+
+size_t File::position() const {
+    if (!_handle) return 0;
+    long pos = ftell(_handle.get());
+    return pos < 0 ? 0 : (size_t)pos;
+}
+
+size_t File::size() const {
+    if (!_handle) return 0;
+    struct stat st;
+    if (fstat(fileno(_handle.get()), &st) != 0) return 0;
+    return (size_t)st.st_size;
+}
+
+void File::flush() {
+    if (_handle) fflush(_handle.get());
+}
+
+void File::close() {
+    _handle.reset();
+}
+
+File FS::open(const String& path, const char* mode) {
+    String hostPath = _hostPath(path);
+    String fopenMode = String(mode) + "b";
+    FILE* handle = fopen(hostPath.c_str(), fopenMode.c_str());
+    if (!handle) return File();
+    return File(handle, path);
+}
+
+bool FS::exists(const String& path) {
+    struct stat st;
+    return stat(_hostPath(path).c_str(), &st) == 0 && S_ISREG(st.st_mode);
+}
+
+bool FS::remove(const String& path) {
+    return ::remove(_hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const String& from, const String& to) {
+    return ::rename(_hostPath(from).c_str(), _hostPath(to).c_str()) == 0;
+}
+
+bool FS::mkdir(const String& path) {
+    return ::mkdir(_hostPath(path).c_str(), 0755) == 0;
+}
+
+} // namespace fs
@@ -0,0 +1,75 @@
+#ifndef NATIVE_HAL_FS_H
+#define NATIVE_HAL_FS_H
+
+#include <cstdio>
+#include <memory>
+#include "Arduino.h"
+
+namespace fs {
+
+#define FILE_READ   "r"
+#define FILE_WRITE  "w"
+#define FILE_APPEND "a"
+
+enum SeekMode {
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+};
+
+// File handle backed by a host FILE*
+class File : public Print {
+public:
+    File() {}
+    File(FILE* handle, const String& path);
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t size) override;
+    using Print::write;
+
+    int available();
+    int read();
+    size_t read(uint8_t* buf, size_t size);
+    String readStringUntil(char terminator);
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    size_t position() const;
+    size_t size() const;
+    void flush() override;
+    void close();
+    const char* name() const { return _path.c_str(); }
+    const char* path() const { return _path.c_str(); }
+
+    operator bool() const { return _handle != nullptr; }
+
+private:
+    std::shared_ptr<FILE> _handle;
+    String _path;
+};
+
+// File system rooted at a host directory
+class FS {
+public:
+    FS() {}
+    explicit FS(const String& root) : _root(root) {}
+
+    void setRoot(const String& root) { _root = root; }
+    const String& root() const { return _root; }
+
+    File open(const String& path, const char* mode = FILE_READ);
+    bool exists(const String& path);
+    bool remove(const String& path);
+    bool rename(const String& from, const String& to);
+    bool mkdir(const String& path);
+
+protected:
+    String _root;
+
+    String _hostPath(const String& path) const { return _root + path; }
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif // NATIVE_HAL_FS_H
@@ -0,0 +1,269 @@
+#ifndef NATIVE_HAL_GXEPD2_BW_H
+#define NATIVE_HAL_GXEPD2_BW_H
+
+#include "Arduino.h"
+#include <string>
+#include <vector>
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+// GDEY0579T93 5.79" panel geometry; there is no panel on the host
+class GxEPD2_579_GDEY0579T93 {
+public:
+    static const uint16_t WIDTH = 792;
+    static const uint16_t WIDTH_VISIBLE = WIDTH;
+    static const uint16_t HEIGHT = 272;
+    static const bool hasPartialUpdate = true;
+
+    GxEPD2_579_GDEY0579T93(int16_t cs, int16_t dc, int16_t rst, int16_t busy)
+        : _cs(cs), _dc(dc), _rst(rst), _busy(busy) {}
+
+private:
+    int16_t _cs, _dc, _rst, _busy;
+};
+
+namespace sim {
+
+// Classic Adafruit GFX 5x7 glyphs for ASCII 0x20..0x7E, one byte per
+// column, least significant bit at the top
+extern const uint8_t GLCD_FONT[95][5];
+
+// Binary PBM (P4) of a 1-bit image stored row by row, set bits white as in
+// the GxEPD2 buffers; `rowBytes` per row, the first pixel in the top bit
+std::string encodePBM(const uint8_t* pixels, uint16_t width, uint16_t height, uint16_t rowBytes);
+
+} // namespace sim
+
+/**
+ * Host GxEPD2_BW
+ *
+ * Accepts the GxEPD2 paged drawing API and draws into a full-panel 1-bit
+ * framebuffer, with the classic 6x8 GFX font (bytes outside ASCII, such as
+ * UTF-8 accents, come out as a hollow box), rotation and text wrapping as
+ * Adafruit GFX does them. As on the panel, what is drawn only shows once
+ * nextPage() pushes it, and a partial window only updates its own area
+ * (widened to whole bytes of the controller RAM); panelPBM() is what the
+ * panel would show. Refreshes are counted instead of waited for.
+ */
+template<typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_BW : public Print {
+public:
+    GxEPD2_Type epd2;
+
+    GxEPD2_BW(GxEPD2_Type epd2_instance)
+        : epd2(epd2_instance),
+          _panel((uint8_t*)malloc(BUFFER_SIZE)) {
+        memset(_buffer, 0xFF, BUFFER_SIZE);
+        memset(_panel, 0xFF, BUFFER_SIZE);
+    }
+    ~GxEPD2_BW() { free(_panel); }
+
+    GxEPD2_BW(const GxEPD2_BW&) = delete;
+    GxEPD2_BW& operator=(const GxEPD2_BW&) = delete;
+
+    void init(uint32_t serial_diag_bitrate = 0) { (void)serial_diag_bitrate; }
+    void hibernate() {}
+    void powerOff() {}
+
+    int16_t width() const { return (_rotation & 1) ? GxEPD2_Type::HEIGHT : GxEPD2_Type::WIDTH; }
+    int16_t height() const { return (_rotation & 1) ? GxEPD2_Type::WIDTH : GxEPD2_Type::HEIGHT; }
+    void setRotation(uint8_t r) { _rotation = r & 3; }
+    uint8_t getRotation() const { return _rotation; }
+
+    void setFullWindow() {
+        _partial = false;
+        _windowX = 0;
+        _windowY = 0;
+        _windowW = GxEPD2_Type::WIDTH;
+        _windowH = GxEPD2_Type::HEIGHT;
+    }
+    void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+        _partial = true;
+        // Both corners to panel coordinates, x widened to whole bytes
+        int16_t x0 = x, y0 = y, x1 = x + w - 1, y1 = y + h - 1;
+        _rotate(x0, y0);
+        _rotate(x1, y1);
+        if (x0 > x1) std::swap(x0, x1);
+        if (y0 > y1) std::swap(y0, y1);
+        x0 = x0 < 0 ? 0 : x0 & ~7;
+        y0 = y0 < 0 ? 0 : y0;
+        x1 = x1 >= GxEPD2_Type::WIDTH ? GxEPD2_Type::WIDTH - 1 : (x1 | 7);
+        y1 = y1 >= GxEPD2_Type::HEIGHT ? GxEPD2_Type::HEIGHT - 1 : y1;
+        _windowX = x0;
+        _windowY = y0;
+        _windowW = x1 >= x0 ? x1 - x0 + 1 : 0;
+        _windowH = y1 >= y0 ? y1 - y0 + 1 : 0;
+    }
+    void firstPage() { fillScreen(GxEPD_WHITE); }
+    bool nextPage() {
+        _push();
+        return false;
+    }
+    void display(bool partial_update_mode = false) {
+        if (!partial_update_mode) setFullWindow();
+        _push();
+    }
+
+    void fillScreen(uint16_t color) {
+        memset(_buffer, color == GxEPD_WHITE ? 0xFF : 0x00, BUFFER_SIZE);
+    }
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+        if (x < 0 || y < 0 || x >= width() || y >= height()) return;
+        _rotate(x, y);
+        uint8_t& byte = _buffer[(uint32_t)y * ROW_BYTES + x / 8];
+        if (color == GxEPD_WHITE) byte |= 0x80 >> (x & 7);
+        else byte &= ~(0x80 >> (x & 7));
+    }
+    void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+        // Bresenham, every octant
+        int16_t dx = abs(x1 - x0), dy = -abs(y1 - y0);
+        int16_t sx = x0 < x1 ? 1 : -1, sy = y0 < y1 ? 1 : -1;
+        int32_t error = dx + dy;
+        for (;;) {
+            drawPixel(x0, y0, color);
+            if (x0 == x1 && y0 == y1) break;
+            int32_t twice = 2 * error;
+            if (twice >= dy) { error += dy; x0 += sx; }
+            if (twice <= dx) { error += dx; y0 += sy; }
+        }
+    }
+    void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        if (w <= 0 || h <= 0) return;
+        fillRect(x, y, w, 1, color);
+        fillRect(x, y + h - 1, w, 1, color);
+        fillRect(x, y, 1, h, color);
+        fillRect(x + w - 1, y, 1, h, color);
+    }
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        for (int16_t row = y; row < y + h; row++) {
+            for (int16_t column = x; column < x + w; column++) {
+                drawPixel(column, row, color);
+            }
+        }
+    }
+
+    void setTextColor(uint16_t color) { _textColor = color; }
+    void setTextSize(uint8_t size) { _textSize = size ? size : 1; }
+    void setTextWrap(bool wrap) { _wrap = wrap; }
+    void setCursor(int16_t x, int16_t y) { _cursorX = x; _cursorY = y; }
+    int16_t getCursorX() const { return _cursorX; }
+    int16_t getCursorY() const { return _cursorY; }
+
+    void getTextBounds(const char* str, int16_t x, int16_t y,
+                       int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+        *x1 = x;
+        *y1 = y;
+        *w = (uint16_t)(strlen(str) * 6 * _textSize);
+        *h = (uint16_t)(8 * _textSize);
+    }
+    void getTextBounds(const String& str, int16_t x, int16_t y,
+                       int16_t* x1, int16_t* y1, uint16_t* w, uint16_t* h) {
+        getTextBounds(str.c_str(), x, y, x1, y1, w, h);
+    }
+
+    size_t write(uint8_t c) override {
+        if (c == '\n') {
+            _cursorX = 0;
+            _cursorY += 8 * _textSize;
+        } else if (c != '\r') {
+            if (_wrap && _cursorX + 6 * _textSize > width()) {
+                _cursorX = 0;
+                _cursorY += 8 * _textSize;
+            }
+            _drawChar(_cursorX, _cursorY, c);
+            _cursorX += 6 * _textSize;
+        }
+        return 1;
+    }
+    using Print::write;
+
+    uint32_t fullRefreshes() const { return _fullRefreshes; }
+    uint32_t partialRefreshes() const { return _partialRefreshes; }
+
+    // What the panel shows, as a binary PBM in the rotated orientation
+    std::string panelPBM() const {
+        uint16_t w = width(), h = height();
+        uint16_t rowBytes = (w + 7) / 8;
+        std::vector<uint8_t> image((size_t)rowBytes * h, 0xFF);
+        for (int16_t y = 0; y < h; y++) {
+            for (int16_t x = 0; x < w; x++) {
+                int16_t px = x, py = y;
+                _rotate(px, py);
+                if (!(_panel[(uint32_t)py * ROW_BYTES + px / 8] & (0x80 >> (px & 7)))) {
+                    image[(size_t)y * rowBytes + x / 8] &= ~(0x80 >> (x & 7));
+                }
+            }
+        }
+        return sim::encodePBM(image.data(), w, h, rowBytes);
+    }
+
+private:
+    static const uint16_t ROW_BYTES = (GxEPD2_Type::WIDTH + 7) / 8;
+    static const uint32_t BUFFER_SIZE = (uint32_t)ROW_BYTES * GxEPD2_Type::HEIGHT;
+
+    // Being drawn, panel coordinates, set bits white (inside the object, as in GxEPD2)
+    uint8_t _buffer[BUFFER_SIZE];
+    // Last pushed to the panel: the controller RAM, kept off the node heap figures
+    uint8_t* _panel;
+    uint8_t _rotation = 0;
+    uint8_t _textSize = 1;
+    uint16_t _textColor = GxEPD_BLACK;
+    bool _wrap = true;
+    int16_t _cursorX = 0;
+    int16_t _cursorY = 0;
+    bool _partial = false;
+    int16_t _windowX = 0;           // Window to push, panel coordinates
+    int16_t _windowY = 0;
+    int16_t _windowW = GxEPD2_Type::WIDTH;
+    int16_t _windowH = GxEPD2_Type::HEIGHT;
+    uint32_t _fullRefreshes = 0;
+    uint32_t _partialRefreshes = 0;
+
+    // Rotated (drawing) coordinates to panel coordinates, as GxEPD2 does
+    void _rotate(int16_t& x, int16_t& y) const {
+        switch (_rotation) {
+            case 1:
+                std::swap(x, y);
+                x = GxEPD2_Type::WIDTH - x - 1;
+                break;
+            case 2:
+                x = GxEPD2_Type::WIDTH - x - 1;
+                y = GxEPD2_Type::HEIGHT - y - 1;
+                break;
+            case 3:
+                std::swap(x, y);
+                y = GxEPD2_Type::HEIGHT - y - 1;
+                break;
+        }
+    }
+
+    void _push() {
+        // The window is byte aligned: copy whole bytes of each row
+        for (int16_t row = _windowY; row < _windowY + _windowH; row++) {
+            uint32_t offset = (uint32_t)row * ROW_BYTES + _windowX / 8;
+            memcpy(&_panel[offset], &_buffer[offset], (_windowW + 7) / 8);
+        }
+        if (_partial) _partialRefreshes++;
+        else _fullRefreshes++;
+    }
+
+    // Classic GFX glyph: transparent background, each dot a size x size square
+    void _drawChar(int16_t x, int16_t y, uint8_t c) {
+        for (uint8_t column = 0; column < 5; column++) {
+            uint8_t line;
+            if (c >= 0x20 && c < 0x7F) {
+                line = sim::GLCD_FONT[c - 0x20][column];
+            } else {
+                line = (column == 0 || column == 4) ? 0x7F : 0x41;
+            }
+            for (uint8_t row = 0; row < 8; row++, line >>= 1) {
+                if (line & 1) {
+                    fillRect(x + column * _textSize, y + row * _textSize, _textSize, _textSize, _textColor);
+                }
+            }
+        }
+    }
+};
+
+#endif // NATIVE_HAL_GXEPD2_BW_H
@@ -0,0 +1,29 @@
+#ifndef NATIVE_HAL_HARDWARE_SERIAL_H
+#define NATIVE_HAL_HARDWARE_SERIAL_H
+
+#include "Print.h"
+
+// Serial console of the current simulated node. Input is never available on
+// the host; output is counted per node and optionally echoed to stdout.
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    void end() {}
+
+    int available() { return 0; }
+    int read() { return -1; }
+    int peek() { return -1; }
+    String readStringUntil(char terminator) { (void)terminator; return String(); }
+    String readString() { return String(); }
+    void setTimeout(unsigned long timeout) { (void)timeout; }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif // NATIVE_HAL_HARDWARE_SERIAL_H
@@ -0,0 +1,29 @@
+#ifndef NATIVE_HAL_IP_ADDRESS_H
+#define NATIVE_HAL_IP_ADDRESS_H
+
+#include <cstdint>
+#include <cstdio>
+#include "WString.h"
+
+class IPAddress {
+public:
+    IPAddress() : _bytes{0, 0, 0, 0} {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{a, b, c, d} {}
+
+    uint8_t operator[](int index) const { return _bytes[index & 3]; }
+    bool operator==(const IPAddress& rhs) const {
+        return _bytes[0] == rhs._bytes[0] && _bytes[1] == rhs._bytes[1] &&
+               _bytes[2] == rhs._bytes[2] && _bytes[3] == rhs._bytes[3];
+    }
+
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _bytes[0], _bytes[1], _bytes[2], _bytes[3]);
+        return String(buf);
+    }
+
+private:
+    uint8_t _bytes[4];
+};
+
+#endif // NATIVE_HAL_IP_ADDRESS_H
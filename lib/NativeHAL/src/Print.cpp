@@ -0,0 +1,53 @@
+#include "Print.h"
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+        if (write(*buffer++)) n++;
+        else break;
+    }
+    return n;
+}
+
+size_t Print::write(const char* str) {
+    if (str == nullptr) return 0;
+    return write((const uint8_t*)str, strlen(str));
+}
+
+size_t Print::print(long value, int base) {
+    return print(String(value, (unsigned char)base));
+}
+
+size_t Print::print(unsigned long value, int base) {
+    return print(String(value, (unsigned char)base));
+}
+
+size_t Print::print(double value, int digits) {
+    return print(String(value, (unsigned int)digits));
+}
+
+size_t Print::printf(const char* format, ...) {
+    char local[128];
+    va_list args;
+    va_start(args, format);
+    va_list copy;
+    va_copy(copy, args);
+    int len = vsnprintf(local, sizeof(local), format, copy);
+    va_end(copy);
+    if (len < 0) {
+        va_end(args);
+        return 0;
+    }
+    if ((size_t)len < sizeof(local)) {
+        va_end(args);
+        return write((const uint8_t*)local, len);
+    }
+    std::vector<char> big(len + 1);
+    vsnprintf(big.data(), big.size(), format, args);
+    va_end(args);
+    return write((const uint8_t*)big.data(), len);
+}
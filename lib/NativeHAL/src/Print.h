@@ -0,0 +1,43 @@
+#ifndef NATIVE_HAL_PRINT_H
+#define NATIVE_HAL_PRINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include "WString.h"
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+// Arduino Print base class: subclasses only implement write()
+class Print {
+public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size);
+    size_t write(const char* str);
+    size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+    virtual void flush() {}
+
+    size_t print(const char* str) { return write(str); }
+    size_t print(const String& s) { return write(s.c_str(), s.length()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+    size_t print(int value, int base = DEC) { return print((long)value, base); }
+    size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+    size_t print(long value, int base = DEC);
+    size_t print(unsigned long value, int base = DEC);
+    size_t print(double value, int digits = 2);
+
+    size_t println() { return write("\r\n"); }
+    template<typename T>
+    size_t println(const T& value) { size_t n = print(value); return n + println(); }
+    template<typename T>
+    size_t println(const T& value, int modifier) { size_t n = print(value, modifier); return n + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+#endif // NATIVE_HAL_PRINT_H
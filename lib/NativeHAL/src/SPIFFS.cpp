@@ -0,0 +1,24 @@
+#include "SPIFFS.h"
+#include <cstdlib>
+#include <sys/stat.h>
+
+SPIFFSFS SPIFFS;
+
+bool SPIFFSFS::begin(bool formatOnFail, const char* basePath, uint8_t maxOpenFiles) {
+    (void)basePath; (void)maxOpenFiles;
+
+    const char* root = getenv("FLOOD_SIM_FS");
+    setRoot(root ? root : "data");
+
+    struct stat st;
+    if (stat(_root.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+        return true;
+    }
+
+    // Like the chip, formatting on failure leaves an empty file system
+    return formatOnFail && ::mkdir(_root.c_str(), 0755) == 0;
+}
+
+size_t SPIFFSFS::usedBytes() {
+    return 0;
+}
@@ -0,0 +1,19 @@
+#ifndef NATIVE_HAL_SPIFFS_H
+#define NATIVE_HAL_SPIFFS_H
+
+#include "FS.h"
+
+// SPIFFS partition mapped onto a host directory. The root defaults to the
+// project's data/ folder (what `pio run -t uploadfs` flashes) and can be
+// moved with the FLOOD_SIM_FS environment variable.
+class SPIFFSFS : public fs::FS {
+public:
+    bool begin(bool formatOnFail = false, const char* basePath = "/spiffs", uint8_t maxOpenFiles = 10);
+    void end() {}
+    size_t totalBytes() { return 1441792; }
+    size_t usedBytes();
+};
+
+extern SPIFFSFS SPIFFS;
+
+#endif // NATIVE_HAL_SPIFFS_H
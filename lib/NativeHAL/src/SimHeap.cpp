@@ -0,0 +1,111 @@
+#include "SimHeap.h"
+#include <atomic>
+#include <cstdlib>
+#include <malloc.h>
+#include <new>
+
+namespace sim {
+
+static std::atomic<int64_t> s_live(0);
+static std::atomic<int64_t> s_peak(0);
+static std::atomic<uint64_t> s_allocs(0);
+
+static thread_local int64_t t_live = 0;
+static thread_local int64_t t_peak = 0;
+static thread_local uint64_t t_allocs = 0;
+static thread_local int64_t t_scopeBase = 0;
+static thread_local int64_t t_scopePeak = 0;
+
+static void recordAlloc(void* p) {
+    int64_t size = (int64_t)malloc_usable_size(p);
+    int64_t live = s_live.fetch_add(size) + size;
+    int64_t peak = s_peak.load();
+    while (live > peak && !s_peak.compare_exchange_weak(peak, live)) {
+    }
+    s_allocs++;
+
+    t_live += size;
+    if (t_live > t_peak) t_peak = t_live;
+    if (t_live > t_scopePeak) t_scopePeak = t_live;
+    t_allocs++;
+}
+
+static void recordFree(void* p) {
+    int64_t size = (int64_t)malloc_usable_size(p);
+    s_live -= size;
+    t_live -= size;
+}
+
+HeapStats heapStats() {
+    HeapStats stats;
+    stats.liveBytes = s_live.load();
+    stats.peakBytes = s_peak.load();
+    stats.allocations = s_allocs.load();
+    return stats;
+}
+
+HeapStats threadHeapStats() {
+    HeapStats stats;
+    stats.liveBytes = t_live;
+    stats.peakBytes = t_peak;
+    stats.allocations = t_allocs;
+    return stats;
+}
+
+void resetHeapPeak() {
+    s_peak = s_live.load();
+}
+
+void resetThreadHeapPeak() {
+    t_peak = t_live;
+}
+
+void beginThreadHeapScope() {
+    t_scopeBase = t_live;
+    t_scopePeak = t_live;
+}
+
+int64_t threadHeapScopePeak() {
+    return t_scopePeak - t_scopeBase;
+}
+
+} // namespace sim
+
+void* operator new(size_t size) {
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    sim::recordAlloc(p);
+    return p;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    void* p = malloc(size ? size : 1);
+    if (p) sim::recordAlloc(p);
+    return p;
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+void operator delete(void* p) noexcept {
+    if (!p) return;
+    sim::recordFree(p);
+    free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    operator delete(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    operator delete(p);
+}
+
+void operator delete[](void* p, size_t) noexcept {
+    operator delete(p);
+}
@@ -0,0 +1,32 @@
+#ifndef NATIVE_HAL_SIM_HEAP_H
+#define NATIVE_HAL_SIM_HEAP_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace sim {
+
+// Heap accounting for operator new/delete in the native build. Process
+// totals cover every thread; the thread figures only count blocks allocated
+// and freed by the calling thread, which approximates one node's heap.
+struct HeapStats {
+    int64_t liveBytes;
+    int64_t peakBytes;
+    uint64_t allocations;
+};
+
+HeapStats heapStats();
+HeapStats threadHeapStats();
+
+// Restart peak tracking from the current live size
+void resetHeapPeak();
+void resetThreadHeapPeak();
+
+// Peak bytes allocated by the calling thread since beginThreadHeapScope(),
+// without disturbing the thread peak above (e.g. one HTTP handler)
+void beginThreadHeapScope();
+int64_t threadHeapScopePeak();
+
+} // namespace sim
+
+#endif // NATIVE_HAL_SIM_HEAP_H
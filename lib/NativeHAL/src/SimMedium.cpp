@@ -0,0 +1,97 @@
+#include "SimMedium.h"
+#include "SimNode.h"
+#include <algorithm>
+#include <cstring>
+
+namespace sim {
+
+static const uint8_t BROADCAST_MAC[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+SimMedium& SimMedium::instance() {
+    static SimMedium medium;
+    return medium;
+}
+
+SimMedium::SimMedium()
+    : _lossRate(0.0),
+      _rxQueueDepth(32),
+      _rngState(0x2545F491),
+      _framesSent(0),
+      _framesDelivered(0),
+      _framesLost(0),
+      _framesOverflow(0),
+      _bytesSent(0) {
+}
+
+void SimMedium::attach(SimNode* node) {
+    std::lock_guard<std::mutex> guard(_lock);
+    if (std::find(_nodes.begin(), _nodes.end(), node) == _nodes.end()) {
+        _nodes.push_back(node);
+    }
+}
+
+void SimMedium::detach(SimNode* node) {
+    std::lock_guard<std::mutex> guard(_lock);
+    _nodes.erase(std::remove(_nodes.begin(), _nodes.end(), node), _nodes.end());
+}
+
+bool SimMedium::transmit(SimNode& from, const uint8_t* dest, const uint8_t* data, size_t len) {
+    Frame frame;
+    memcpy(frame.src, from.mac(), 6);
+    frame.len = (uint8_t)len;
+    memcpy(frame.data, data, len);
+
+    bool broadcast = memcmp(dest, BROADCAST_MAC, 6) == 0;
+    bool reached = broadcast;
+
+    _framesSent++;
+    _bytesSent += len;
+    from.countTransmit();
+
+    std::lock_guard<std::mutex> guard(_lock);
+    for (SimNode* node : _nodes) {
+        if (node == &from) continue;
+        if (!broadcast && memcmp(node->mac(), dest, 6) != 0) continue;
+
+        if (_lose()) {
+            _framesLost++;
+            continue;
+        }
+        if (node->deliver(frame, _rxQueueDepth)) {
+            _framesDelivered++;
+            reached = true;
+        } else {
+            _framesOverflow++;
+        }
+    }
+    return reached;
+}
+
+MediumStats SimMedium::stats() const {
+    MediumStats s;
+    s.framesSent = _framesSent.load();
+    s.framesDelivered = _framesDelivered.load();
+    s.framesLost = _framesLost.load();
+    s.framesOverflow = _framesOverflow.load();
+    s.bytesSent = _bytesSent.load();
+    return s;
+}
+
+void SimMedium::resetStats() {
+    _framesSent = 0;
+    _framesDelivered = 0;
+    _framesLost = 0;
+    _framesOverflow = 0;
+    _bytesSent = 0;
+}
+
+// xorshift32, called with _lock held
+bool SimMedium::_lose() {
+    if (_lossRate <= 0.0) return false;
+    _rngState ^= _rngState << 13;
+    _rngState ^= _rngState >> 17;
+    _rngState ^= _rngState << 5;
+    return (_rngState / 4294967296.0) < _lossRate;
+}
+
+} // namespace sim
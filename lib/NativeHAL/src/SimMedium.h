@@ -0,0 +1,69 @@
+#ifndef NATIVE_HAL_SIM_MEDIUM_H
+#define NATIVE_HAL_SIM_MEDIUM_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace sim {
+
+class SimNode;
+
+// Counters for everything that went over the air
+struct MediumStats {
+    uint64_t framesSent;       // esp_now_send calls accepted by the medium
+    uint64_t framesDelivered;  // frame copies handed to a receiver
+    uint64_t framesLost;       // copies dropped by the simulated loss rate
+    uint64_t framesOverflow;   // copies dropped because the receiver RX queue was full
+    uint64_t bytesSent;        // payload bytes accepted (airtime proxy)
+};
+
+/**
+ * Simulated ESP-NOW medium
+ *
+ * Process-wide broadcast domain connecting every registered SimNode.
+ * Unicast frames reach the node owning the destination MAC, broadcast
+ * frames (FF:FF:FF:FF:FF:FF) reach every other node. Each receiver has a
+ * bounded RX queue like the WiFi driver buffers on the chip.
+ */
+class SimMedium {
+public:
+    static SimMedium& instance();
+
+    void attach(SimNode* node);
+    void detach(SimNode* node);
+
+    // Returns false when the destination is unknown (unicast)
+    bool transmit(SimNode& from, const uint8_t* dest, const uint8_t* data, size_t len);
+
+    // Fraction of frame copies silently lost, 0.0 - 1.0
+    void setLossRate(double rate) { _lossRate = rate; }
+    // Frames a receiver may hold before new ones are dropped
+    void setRxQueueDepth(size_t depth) { _rxQueueDepth = depth; }
+
+    MediumStats stats() const;
+    void resetStats();
+
+private:
+    SimMedium();
+
+    mutable std::mutex _lock;
+    std::vector<SimNode*> _nodes;
+    double _lossRate;
+    size_t _rxQueueDepth;
+    uint32_t _rngState;
+
+    std::atomic<uint64_t> _framesSent;
+    std::atomic<uint64_t> _framesDelivered;
+    std::atomic<uint64_t> _framesLost;
+    std::atomic<uint64_t> _framesOverflow;
+    std::atomic<uint64_t> _bytesSent;
+
+    bool _lose();
+};
+
+} // namespace sim
+
+#endif // NATIVE_HAL_SIM_MEDIUM_H
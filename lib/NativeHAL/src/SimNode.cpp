@@ -0,0 +1,227 @@
+#include "SimNode.h"
+#include "SimMedium.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace sim {
+
+// ---------------------------------------------------------------------------
+// Clock
+// ---------------------------------------------------------------------------
+
+static const std::chrono::steady_clock::time_point s_epoch = std::chrono::steady_clock::now();
+static std::atomic<double> s_speed(1.0);
+
+uint64_t nowMicros() {
+    auto elapsed = std::chrono::steady_clock::now() - s_epoch;
+    double us = std::chrono::duration<double, std::micro>(elapsed).count();
+    return (uint64_t)(us * s_speed.load());
+}
+
+uint32_t nowMillis() {
+    return (uint32_t)(nowMicros() / 1000);
+}
+
+void setClockSpeed(double speed) {
+    s_speed = speed > 0 ? speed : 1.0;
+}
+
+double clockSpeed() {
+    return s_speed.load();
+}
+
+// ---------------------------------------------------------------------------
+// Node
+// ---------------------------------------------------------------------------
+
+static thread_local SimNode* t_current = nullptr;
+
+// INPUT_PULLUP as defined by the Arduino.h shim
+static const uint8_t MODE_INPUT_PULLUP = 0x05;
+
+SimNode::SimNode(const std::string& name, const uint8_t mac[6])
+    : _name(name),
+      _echoSerial(false),
+      _serialBytes(0),
+      _espNowInit(false),
+      _notified(false),
+      _rxFrames(0),
+      _txFrames(0) {
+    memcpy(_mac, mac, 6);
+    memset(_pinLevel, 0, sizeof(_pinLevel));
+    memset(_pinMode, 0, sizeof(_pinMode));
+    memset(_toneFreq, 0, sizeof(_toneFreq));
+}
+
+SimNode::~SimNode() {
+    espNowDeinit();
+    if (t_current == this) {
+        t_current = nullptr;
+    }
+}
+
+SimNode* SimNode::current() {
+    return t_current;
+}
+
+void SimNode::bindToCurrentThread() {
+    t_current = this;
+}
+
+void SimNode::pinMode(uint8_t pin, uint8_t mode) {
+    if (pin >= MAX_PINS) return;
+    _pinMode[pin] = mode;
+    if (mode == MODE_INPUT_PULLUP) {
+        _pinLevel[pin] = 1;
+    }
+}
+
+void SimNode::digitalWrite(uint8_t pin, uint8_t level) {
+    if (pin < MAX_PINS) _pinLevel[pin] = level ? 1 : 0;
+}
+
+int SimNode::digitalRead(uint8_t pin) const {
+    return pin < MAX_PINS ? _pinLevel[pin] : 0;
+}
+
+void SimNode::setInputLevel(uint8_t pin, uint8_t level) {
+    if (pin < MAX_PINS) _pinLevel[pin] = level ? 1 : 0;
+}
+
+uint16_t SimNode::analogRead(uint8_t pin) {
+    if (_analogSource) {
+        return _analogSource(pin, nowMillis());
+    }
+    return 0;
+}
+
+void SimNode::setAnalogSource(std::function<uint16_t(uint8_t, uint32_t)> source) {
+    _analogSource = source;
+}
+
+void SimNode::tone(uint8_t pin, unsigned int frequency) {
+    if (pin < MAX_PINS) _toneFreq[pin] = frequency;
+}
+
+void SimNode::noTone(uint8_t pin) {
+    if (pin < MAX_PINS) _toneFreq[pin] = 0;
+}
+
+unsigned int SimNode::toneFrequency(uint8_t pin) const {
+    return pin < MAX_PINS ? _toneFreq[pin] : 0;
+}
+
+void SimNode::serialWrite(const uint8_t* data, size_t len) {
+    _serialBytes += len;
+    if (!_echoSerial) return;
+
+    for (size_t i = 0; i < len; i++) {
+        char c = (char)data[i];
+        if (c == '\r') continue;
+        if (c == '\n') {
+            printf("[%s] %s\n", _name.c_str(), _lineBuffer.c_str());
+            _lineBuffer.clear();
+        } else {
+            _lineBuffer += c;
+        }
+    }
+}
+
+bool SimNode::espNowInit() {
+    if (!_espNowInit) {
+        SimMedium::instance().attach(this);
+        _espNowInit = true;
+    }
+    return true;
+}
+
+void SimNode::espNowDeinit() {
+    if (_espNowInit) {
+        SimMedium::instance().detach(this);
+        _espNowInit = false;
+    }
+    _peers.clear();
+}
+
+bool SimNode::addPeer(const uint8_t mac[6]) {
+    if (hasPeer(mac)) return false;  // ESP_ERR_ESPNOW_EXIST
+    _peers.emplace_back(mac, mac + 6);
+    return true;
+}
+
+bool SimNode::hasPeer(const uint8_t mac[6]) const {
+    for (const auto& peer : _peers) {
+        if (memcmp(peer.data(), mac, 6) == 0) return true;
+    }
+    return false;
+}
+
+bool SimNode::removePeer(const uint8_t mac[6]) {
+    for (auto it = _peers.begin(); it != _peers.end(); ++it) {
+        if (memcmp(it->data(), mac, 6) == 0) {
+            _peers.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SimNode::deliver(const Frame& frame, size_t queueDepth) {
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (_inbox.size() >= queueDepth) {
+            return false;
+        }
+        _inbox.push_back(frame);
+    }
+    _cond.notify_one();
+    return true;
+}
+
+void SimNode::queueSendResult(const uint8_t mac[6], bool success) {
+    std::lock_guard<std::mutex> guard(_lock);
+    SendResult result;
+    memcpy(result.mac, mac, 6);
+    result.success = success;
+    _sendResults.push_back(result);
+}
+
+void SimNode::pump() {
+    std::deque<Frame> frames;
+    std::deque<SendResult> results;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        frames.swap(_inbox);
+        results.swap(_sendResults);
+        _notified = false;
+    }
+
+    for (const auto& result : results) {
+        if (_sendCb) _sendCb(result.mac, result.success);
+    }
+    for (const auto& frame : frames) {
+        _rxFrames++;
+        if (_recvCb) _recvCb(frame.src, frame.data, frame.len);
+    }
+}
+
+void SimNode::waitForEvents(uint64_t timeoutUs) {
+    {
+        std::unique_lock<std::mutex> guard(_lock);
+        _cond.wait_for(guard, std::chrono::microseconds(timeoutUs), [this]() {
+            return !_inbox.empty() || !_sendResults.empty() || _notified;
+        });
+    }
+    pump();
+}
+
+void SimNode::notify() {
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _notified = true;
+    }
+    _cond.notify_one();
+}
+
+} // namespace sim
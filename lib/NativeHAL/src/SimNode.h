@@ -0,0 +1,142 @@
+#ifndef NATIVE_HAL_SIM_NODE_H
+#define NATIVE_HAL_SIM_NODE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sim {
+
+// Largest ESP-NOW payload (ESP_NOW_MAX_DATA_LEN)
+static const size_t MAX_FRAME_LEN = 250;
+static const uint8_t MAX_PINS = 40;
+
+// A frame in flight on the simulated medium
+struct Frame {
+    uint8_t src[6];
+    uint8_t len;
+    uint8_t data[MAX_FRAME_LEN];
+};
+
+// Simulated clock shared by every node. speed > 1 runs the fleet faster
+// than wall time: millis() advances `speed` times faster and delay() sleeps
+// `speed` times shorter.
+uint32_t nowMillis();
+uint64_t nowMicros();
+void setClockSpeed(double speed);
+double clockSpeed();
+
+typedef std::function<void(const uint8_t* mac, const uint8_t* data, int len)> RecvCallback;
+typedef std::function<void(const uint8_t* mac, bool success)> SendCallback;
+
+/**
+ * Simulated board
+ *
+ * One SimNode stands for one ESP32: it owns the GPIO levels, the serial
+ * console and the ESP-NOW endpoint that the Arduino shims resolve through
+ * SimNode::current(). A node is bound to the thread that runs its firmware;
+ * ESP-NOW callbacks are delivered on that thread whenever the firmware
+ * yields (delay(), yield() or an explicit pump()), so the radio callbacks
+ * interleave with the loop the same way they do at task-switch points on
+ * the real chip.
+ */
+class SimNode {
+public:
+    SimNode(const std::string& name, const uint8_t mac[6]);
+    ~SimNode();
+
+    SimNode(const SimNode&) = delete;
+    SimNode& operator=(const SimNode&) = delete;
+
+    // Node bound to the calling thread, nullptr on unbound threads
+    static SimNode* current();
+    void bindToCurrentThread();
+
+    const std::string& name() const { return _name; }
+    const uint8_t* mac() const { return _mac; }
+
+    // GPIO
+    void pinMode(uint8_t pin, uint8_t mode);
+    void digitalWrite(uint8_t pin, uint8_t level);
+    int digitalRead(uint8_t pin) const;
+    void setInputLevel(uint8_t pin, uint8_t level);
+    uint16_t analogRead(uint8_t pin);
+    void setAnalogSource(std::function<uint16_t(uint8_t pin, uint32_t nowMs)> source);
+    void tone(uint8_t pin, unsigned int frequency);
+    void noTone(uint8_t pin);
+    unsigned int toneFrequency(uint8_t pin) const;
+
+    // Serial console: lines are echoed to stdout with the node name when enabled
+    void setEchoSerial(bool echo) { _echoSerial = echo; }
+    void serialWrite(const uint8_t* data, size_t len);
+    uint64_t serialBytes() const { return _serialBytes.load(); }
+
+    // ESP-NOW endpoint (used by the esp_now.h shim)
+    bool espNowInit();
+    void espNowDeinit();
+    bool espNowInitialized() const { return _espNowInit; }
+    void setRecvCallback(RecvCallback cb) { _recvCb = cb; }
+    void setSendCallback(SendCallback cb) { _sendCb = cb; }
+    bool addPeer(const uint8_t mac[6]);
+    bool hasPeer(const uint8_t mac[6]) const;
+    bool removePeer(const uint8_t mac[6]);
+    size_t peerCount() const { return _peers.size(); }
+
+    // Called by the medium from the sender's thread
+    bool deliver(const Frame& frame, size_t queueDepth);
+    // Called on this node's thread after it transmitted
+    void queueSendResult(const uint8_t mac[6], bool success);
+
+    // Deliver pending radio events on the calling (node) thread
+    void pump();
+    // Block up to timeoutUs of wall time or until an event arrives, then pump
+    void waitForEvents(uint64_t timeoutUs);
+    // Wake a waiting node without a frame (used by host-side schedulers)
+    void notify();
+
+    uint64_t framesReceived() const { return _rxFrames.load(); }
+    uint64_t framesTransmitted() const { return _txFrames.load(); }
+    void countTransmit() { _txFrames++; }
+
+private:
+    struct SendResult {
+        uint8_t mac[6];
+        bool success;
+    };
+
+    std::string _name;
+    uint8_t _mac[6];
+
+    uint8_t _pinLevel[MAX_PINS];
+    uint8_t _pinMode[MAX_PINS];
+    unsigned int _toneFreq[MAX_PINS];
+    std::function<uint16_t(uint8_t, uint32_t)> _analogSource;
+
+    bool _echoSerial;
+    std::string _lineBuffer;
+    std::atomic<uint64_t> _serialBytes;
+
+    bool _espNowInit;
+    RecvCallback _recvCb;
+    SendCallback _sendCb;
+    std::vector<std::vector<uint8_t>> _peers;
+
+    mutable std::mutex _lock;
+    std::condition_variable _cond;
+    std::deque<Frame> _inbox;
+    std::deque<SendResult> _sendResults;
+    bool _notified;
+
+    std::atomic<uint64_t> _rxFrames;
+    std::atomic<uint64_t> _txFrames;
+};
+
+} // namespace sim
+
+#endif // NATIVE_HAL_SIM_NODE_H
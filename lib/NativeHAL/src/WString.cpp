@@ -0,0 +1,91 @@
+#include "WString.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+
+static std::string formatInteger(unsigned long long value, bool negative, unsigned char base) {
+    if (base < 2 || base > 36) base = 10;
+    std::string digits;
+    do {
+        unsigned int d = value % base;
+        digits += (char)(d < 10 ? '0' + d : 'A' + d - 10);
+        value /= base;
+    } while (value);
+    if (negative) digits += '-';
+    std::reverse(digits.begin(), digits.end());
+    return digits;
+}
+
+String::String(int value, unsigned char base)
+    : _s(base == 10 ? formatInteger(value < 0 ? -(long long)value : value, value < 0, 10)
+                    : formatInteger((unsigned int)value, false, base)) {}
+
+String::String(unsigned int value, unsigned char base) : _s(formatInteger(value, false, base)) {}
+
+String::String(long value, unsigned char base)
+    : _s(base == 10 ? formatInteger(value < 0 ? -(long long)value : value, value < 0, 10)
+                    : formatInteger((unsigned long)value, false, base)) {}
+
+String::String(unsigned long value, unsigned char base) : _s(formatInteger(value, false, base)) {}
+
+String::String(float value, unsigned int decimalPlaces) : String((double)value, decimalPlaces) {}
+
+String::String(double value, unsigned int decimalPlaces) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%.*f", (int)decimalPlaces, value);
+    _s = buf;
+}
+
+bool String::equalsIgnoreCase(const String& s) const {
+    if (_s.length() != s._s.length()) return false;
+    for (size_t i = 0; i < _s.length(); i++) {
+        if (tolower((unsigned char)_s[i]) != tolower((unsigned char)s._s[i])) return false;
+    }
+    return true;
+}
+
+bool String::endsWith(const String& suffix) const {
+    if (suffix._s.length() > _s.length()) return false;
+    return _s.compare(_s.length() - suffix._s.length(), suffix._s.length(), suffix._s) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+    size_t pos = _s.find(c, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String& s, unsigned int from) const {
+    size_t pos = _s.find(s._s, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    if (from >= _s.length()) return String();
+    return String(_s.substr(from, to - from));
+}
+
+void String::trim() {
+    size_t start = 0;
+    while (start < _s.length() && isspace((unsigned char)_s[start])) start++;
+    size_t end = _s.length();
+    while (end > start && isspace((unsigned char)_s[end - 1])) end--;
+    _s = _s.substr(start, end - start);
+}
+
+void String::toLowerCase() {
+    for (auto& c : _s) c = (char)tolower((unsigned char)c);
+}
+
+void String::toUpperCase() {
+    for (auto& c : _s) c = (char)toupper((unsigned char)c);
+}
+
+long String::toInt() const {
+    return strtol(_s.c_str(), nullptr, 10);
+}
+
+float String::toFloat() const {
+    return strtof(_s.c_str(), nullptr);
+}
@@ -0,0 +1,85 @@
+#ifndef NATIVE_HAL_WSTRING_H
+#define NATIVE_HAL_WSTRING_H
+
+#include <string>
+#include <cstddef>
+
+/**
+ * Host String
+ *
+ * Subset of the Arduino String API backed by std::string, enough for the
+ * firmware sources and ArduinoJson's Arduino String adapter.
+ */
+class String {
+public:
+    String() {}
+    String(const char* s) : _s(s ? s : "") {}
+    String(const char* s, size_t len) : _s(s ? std::string(s, len) : std::string()) {}
+    String(const std::string& s) : _s(s) {}
+    String(char c) : _s(1, c) {}
+    String(int value, unsigned char base = 10);
+    String(unsigned int value, unsigned char base = 10);
+    String(long value, unsigned char base = 10);
+    String(unsigned long value, unsigned char base = 10);
+    String(float value, unsigned int decimalPlaces = 2);
+    String(double value, unsigned int decimalPlaces = 2);
+
+    const char* c_str() const { return _s.c_str(); }
+    unsigned int length() const { return (unsigned int)_s.length(); }
+    bool isEmpty() const { return _s.empty(); }
+    bool reserve(unsigned int size) { _s.reserve(size); return true; }
+
+    bool concat(const String& s) { _s += s._s; return true; }
+    bool concat(const char* s) { if (s) _s += s; return true; }
+    bool concat(const char* s, unsigned int len) { if (s) _s.append(s, len); return true; }
+    bool concat(char c) { _s += c; return true; }
+
+    String& operator+=(const String& s) { _s += s._s; return *this; }
+    String& operator+=(const char* s) { if (s) _s += s; return *this; }
+    String& operator+=(char c) { _s += c; return *this; }
+    String& operator+=(int v) { _s += String(v)._s; return *this; }
+    String& operator+=(unsigned int v) { _s += String(v)._s; return *this; }
+    String& operator+=(long v) { _s += String(v)._s; return *this; }
+    String& operator+=(unsigned long v) { _s += String(v)._s; return *this; }
+
+    bool operator==(const String& rhs) const { return _s == rhs._s; }
+    bool operator==(const char* rhs) const { return _s == (rhs ? rhs : ""); }
+    bool operator!=(const String& rhs) const { return _s != rhs._s; }
+    bool operator!=(const char* rhs) const { return !(*this == rhs); }
+    bool operator<(const String& rhs) const { return _s < rhs._s; }
+
+    char operator[](unsigned int index) const { return index < _s.length() ? _s[index] : 0; }
+    char charAt(unsigned int index) const { return (*this)[index]; }
+
+    bool equals(const String& s) const { return _s == s._s; }
+    bool equalsIgnoreCase(const String& s) const;
+    bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.length(), prefix._s) == 0; }
+    bool endsWith(const String& suffix) const;
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String& s, unsigned int from = 0) const;
+    String substring(unsigned int from) const { return from < _s.length() ? String(_s.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const;
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    long toInt() const;
+    float toFloat() const;
+
+    const std::string& str() const { return _s; }
+
+    friend String operator+(const String& lhs, const String& rhs) { return String(lhs._s + rhs._s); }
+    friend String operator+(const String& lhs, const char* rhs) { return String(lhs._s + (rhs ? rhs : "")); }
+    friend String operator+(const char* lhs, const String& rhs) { return String(std::string(lhs ? lhs : "") + rhs._s); }
+    friend String operator+(const String& lhs, char rhs) { return String(lhs._s + rhs); }
+
+private:
+    std::string _s;
+};
+
+// Result type of String concatenations in the Arduino core
+class StringSumHelper : public String {
+public:
+    StringSumHelper(const String& s) : String(s) {}
+};
+
+#endif // NATIVE_HAL_WSTRING_H
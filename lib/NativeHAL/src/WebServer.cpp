@@ -0,0 +1,158 @@
+#include "WebServer.h"
+#include "SimHeap.h"
+
+static void parseQuery(const String& query, std::vector<std::pair<String, String>>& out) {
+    unsigned int start = 0;
+    while (start < query.length()) {
+        int amp = query.indexOf('&', start);
+        unsigned int end = amp < 0 ? query.length() : (unsigned int)amp;
+        String pair = query.substring(start, end);
+        int eq = pair.indexOf('=');
+        if (eq < 0) {
+            out.emplace_back(pair, String());
+        } else {
+            out.emplace_back(pair.substring(0, eq), pair.substring(eq + 1));
+        }
+        start = end + 1;
+    }
+}
+
+void WebServer::on(const String& uri, HTTPMethod method, THandlerFunction handler) {
+    Route route;
+    route.uri = uri;
+    route.method = method;
+    route.handler = handler;
+    _routes.push_back(route);
+}
+
+void WebServer::handleClient() {
+    PendingRequest* request = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        if (!_started || _queue.empty()) return;
+        request = _queue.front();
+        _queue.pop_front();
+    }
+
+    _serve(*request);
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        request->done = true;
+    }
+    _cond.notify_all();
+}
+
+void WebServer::_serve(PendingRequest& request) {
+    _current = &request;
+    _pendingHeaders.clear();
+    _contentLength = CONTENT_LENGTH_NOT_SET;
+    sim::beginThreadHeapScope();
+
+    bool handled = false;
+    for (const auto& route : _routes) {
+        if (route.uri == request.uri && (route.method == HTTP_ANY || route.method == request.method)) {
+            route.handler();
+            handled = true;
+            break;
+        }
+    }
+    if (!handled) {
+        if (_notFound) {
+            _notFound();
+        } else {
+            send(404, "text/plain", "Not found: " + request.uri);
+        }
+    }
+
+    request.response.heapPeak = sim::threadHeapScopePeak();
+
+    // Connection kept by the handler: hand it to the host, otherwise it closes here
+    if (request.connection && request.connection.use_count() > 1) {
+        request.response.connection = request.connection;
+    }
+    request.connection.reset();
+    _current = nullptr;
+    _served++;
+}
+
+WiFiClient WebServer::client() {
+    if (!_current) return WiFiClient();
+    if (!_current->connection) {
+        _current->connection = std::make_shared<WiFiClient::Connection>();
+    }
+    return WiFiClient(_current->connection);
+}
+
+String WebServer::arg(const String& name) const {
+    if (!_current) return String();
+    for (const auto& a : _current->args) {
+        if (a.first == name) return a.second;
+    }
+    return String();
+}
+
+bool WebServer::hasArg(const String& name) const {
+    if (!_current) return false;
+    for (const auto& a : _current->args) {
+        if (a.first == name) return true;
+    }
+    return false;
+}
+
+String WebServer::header(const String& name) const {
+    if (!_current) return String();
+    for (const auto& h : _current->headers) {
+        if (h.first.equalsIgnoreCase(name)) return h.second;
+    }
+    return String();
+}
+
+void WebServer::send(int code, const char* contentType, const String& content) {
+    if (!_current) return;
+    Response& response = _current->response;
+    response.code = code;
+    response.contentType = contentType ? contentType : "text/html";
+    response.headers = _pendingHeaders;
+    _current->wire.append(content.c_str(), content.length());
+}
+
+void WebServer::sendHeader(const String& name, const String& value, bool first) {
+    if (first) {
+        _pendingHeaders.insert(_pendingHeaders.begin(), std::make_pair(name, value));
+    } else {
+        _pendingHeaders.emplace_back(name, value);
+    }
+}
+
+void WebServer::sendContent(const char* content, size_t size) {
+    if (!_current) return;
+    _current->wire.append(content, size);
+}
+
+size_t WebServer::streamFile(File& file, const String& contentType, int code) {
+    send(code, contentType.c_str(), String());
+    uint8_t buf[1436];
+    size_t total = 0;
+    size_t n;
+    while ((n = file.read(buf, sizeof(buf))) > 0) {
+        sendContent((const char*)buf, n);
+        total += n;
+    }
+    return total;
+}
+
+WebServer::Response WebServer::request(HTTPMethod method, const String& uri, const String& query,
+                                       const std::vector<std::pair<String, String>>& headers) {
+    PendingRequest pending;
+    pending.method = method;
+    pending.uri = uri;
+    pending.headers = headers;
+    parseQuery(query, pending.args);
+
+    std::unique_lock<std::mutex> guard(_lock);
+    _queue.push_back(&pending);
+    _cond.wait(guard, [&pending]() { return pending.done; });
+    pending.response.body = String(pending.wire.data(), pending.wire.size());
+    return pending.response;
+}
@@ -0,0 +1,123 @@
+#ifndef NATIVE_HAL_WEB_SERVER_H
+#define NATIVE_HAL_WEB_SERVER_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "Arduino.h"
+#include "FS.h"
+#include "WiFiClient.h"
+
+typedef enum {
+    HTTP_DELETE = 0,
+    HTTP_GET = 1,
+    HTTP_HEAD = 2,
+    HTTP_POST = 3,
+    HTTP_PUT = 4,
+    HTTP_OPTIONS = 6,
+    HTTP_PATCH = 28,
+    HTTP_ANY = 255
+} HTTPMethod;
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t) -1)
+#define CONTENT_LENGTH_NOT_SET ((size_t) -2)
+
+/**
+ * Host WebServer
+ *
+ * Same routing rules as the arduino-esp32 WebServer (a String URI is an
+ * exact match) without sockets: requests are injected from any thread with
+ * request() and served one at a time by handleClient() on the thread that
+ * owns the server, exactly like the synchronous server on the chip.
+ */
+class WebServer {
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    // Captured response of an injected request
+    struct Response {
+        int code = 0;
+        String contentType;
+        std::vector<std::pair<String, String>> headers;
+        String body;
+        int64_t heapPeak = 0;   // Bytes the handler allocated on the server thread
+        // Set when the handler kept the client (e.g. an event stream): read the rest from it
+        std::shared_ptr<WiFiClient::Connection> connection;
+    };
+
+    explicit WebServer(int port = 80) : _port(port) {}
+
+    void begin() { _started = true; }
+    void stop() { _started = false; }
+    void handleClient();
+
+    void on(const String& uri, THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+    void on(const String& uri, HTTPMethod method, THandlerFunction handler);
+    void onNotFound(THandlerFunction handler) { _notFound = handler; }
+
+    // Request context (valid inside a handler)
+    String uri() const { return _current ? _current->uri : String(); }
+    HTTPMethod method() const { return _current ? _current->method : HTTP_GET; }
+    String arg(const String& name) const;
+    bool hasArg(const String& name) const;
+    int args() const { return _current ? (int)_current->args.size() : 0; }
+    String header(const String& name) const;
+    WiFiClient client();
+    bool hasHeader(const String& name) const { return header(name).length() > 0; }
+
+    // Response API
+    void send(int code, const char* contentType = nullptr, const String& content = String());
+    void send(int code, const String& contentType, const String& content) { send(code, contentType.c_str(), content); }
+    void sendHeader(const String& name, const String& value, bool first = false);
+    void setContentLength(size_t contentLength) { _contentLength = contentLength; }
+    void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+    void sendContent(const char* content, size_t size);
+    size_t streamFile(File& file, const String& contentType, int code = 200);
+
+    // Host side: serve a request through handleClient() and wait for the response.
+    // `query` is "a=1&b=2"; `headers` are request headers.
+    Response request(HTTPMethod method, const String& uri, const String& query = String(),
+                     const std::vector<std::pair<String, String>>& headers = {});
+
+    uint64_t requestsServed() const { return _served; }
+
+private:
+    struct Route {
+        String uri;
+        HTTPMethod method;
+        THandlerFunction handler;
+    };
+
+    struct PendingRequest {
+        HTTPMethod method;
+        String uri;
+        std::vector<std::pair<String, String>> args;
+        std::vector<std::pair<String, String>> headers;
+        Response response;
+        WireBuffer wire;                                  // Response sent through send()/sendContent()
+        std::shared_ptr<WiFiClient::Connection> connection;
+        bool done = false;
+    };
+
+    int _port;
+    bool _started = false;
+    std::vector<Route> _routes;
+    THandlerFunction _notFound;
+
+    std::mutex _lock;
+    std::condition_variable _cond;
+    std::deque<PendingRequest*> _queue;
+
+    PendingRequest* _current = nullptr;
+    std::vector<std::pair<String, String>> _pendingHeaders;
+    size_t _contentLength = CONTENT_LENGTH_NOT_SET;
+    uint64_t _served = 0;
+
+    void _serve(PendingRequest& request);
+};
+
+#endif // NATIVE_HAL_WEB_SERVER_H
@@ -0,0 +1,22 @@
+#include "WiFi.h"
+#include "SimNode.h"
+
+WiFiClass WiFi;
+
+void WiFiClass::macAddress(uint8_t* mac) {
+    sim::SimNode* node = sim::SimNode::current();
+    if (node) {
+        memcpy(mac, node->mac(), 6);
+    } else {
+        memset(mac, 0, 6);
+    }
+}
+
+String WiFiClass::macAddress() {
+    uint8_t mac[6];
+    macAddress(mac);
+    char buf[18];
+    snprintf(buf, sizeof(buf), "%02X:%02X:%02X:%02X:%02X:%02X",
+             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    return String(buf);
+}
@@ -0,0 +1,48 @@
+#ifndef NATIVE_HAL_WIFI_H
+#define NATIVE_HAL_WIFI_H
+
+#include "Arduino.h"
+#include "IPAddress.h"
+#include "WiFiClient.h"
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3
+} wifi_mode_t;
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+// WiFi driver of the current simulated node. The MAC address is the node's
+// ESP-NOW address; station mode never connects on the host.
+class WiFiClass {
+public:
+    bool mode(wifi_mode_t mode) { (void)mode; return true; }
+    void macAddress(uint8_t* mac);
+    String macAddress();
+
+    bool softAP(const char* ssid, const char* passphrase = nullptr, int channel = 1) {
+        (void)ssid; (void)passphrase; (void)channel;
+        return true;
+    }
+    IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+
+    wl_status_t begin(const char* ssid, const char* passphrase = nullptr) {
+        (void)ssid; (void)passphrase;
+        return WL_DISCONNECTED;
+    }
+    wl_status_t status() { return WL_DISCONNECTED; }
+    IPAddress localIP() { return IPAddress(); }
+    int8_t RSSI() { return 0; }
+};
+
+extern WiFiClass WiFi;
+
+#endif // NATIVE_HAL_WIFI_H
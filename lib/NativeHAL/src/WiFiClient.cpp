@@ -0,0 +1,43 @@
+#include "WiFiClient.h"
+#include <chrono>
+
+std::string WiFiClient::Connection::read(uint32_t timeoutMs) {
+    std::unique_lock<std::mutex> guard(lock);
+    cond.wait_for(guard, std::chrono::milliseconds(timeoutMs), [this]() { return !pending.empty() || !open; });
+    std::string data(pending.data(), pending.size());
+    pending.clear();
+    return data;
+}
+
+void WiFiClient::Connection::close() {
+    std::lock_guard<std::mutex> guard(lock);
+    open = false;
+    pending.clear();
+}
+
+bool WiFiClient::Connection::isOpen() {
+    std::lock_guard<std::mutex> guard(lock);
+    return open;
+}
+
+size_t WiFiClient::write(const uint8_t* buffer, size_t size) {
+    if (!_connection) return 0;
+    {
+        std::lock_guard<std::mutex> guard(_connection->lock);
+        if (!_connection->open) return 0;
+        _connection->pending.append((const char*)buffer, size);
+    }
+    _connection->cond.notify_all();
+    return size;
+}
+
+uint8_t WiFiClient::connected() {
+    return _connection && _connection->isOpen() ? 1 : 0;
+}
+
+void WiFiClient::stop() {
+    if (!_connection) return;
+    _connection->close();
+    _connection->cond.notify_all();
+    _connection.reset();
+}
@@ -0,0 +1,68 @@
+#ifndef NATIVE_HAL_WIFI_CLIENT_H
+#define NATIVE_HAL_WIFI_CLIENT_H
+
+#include <condition_variable>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "Print.h"
+
+// Bytes on their way to the network use plain malloc so that they do not
+// count against the node heap (on the chip they leave through lwIP)
+template <typename T>
+struct WireAllocator {
+    typedef T value_type;
+    WireAllocator() = default;
+    template <typename U>
+    WireAllocator(const WireAllocator<U>&) {}
+    T* allocate(size_t n) { return static_cast<T*>(std::malloc(n * sizeof(T))); }
+    void deallocate(T* p, size_t) { std::free(p); }
+    bool operator==(const WireAllocator&) const { return true; }
+    bool operator!=(const WireAllocator&) const { return false; }
+};
+typedef std::basic_string<char, std::char_traits<char>, WireAllocator<char>> WireBuffer;
+
+/**
+ * Host WiFiClient
+ *
+ * One TCP connection accepted by the WebServer. Copies share the
+ * connection like on the chip, so a handler can keep the client after it
+ * returns (long-lived responses such as an event stream). Bytes written by
+ * the node are buffered for the host side, which reads them with
+ * Connection::read() and can hang up with Connection::close().
+ */
+class WiFiClient : public Print {
+public:
+    struct Connection {
+        std::mutex lock;
+        std::condition_variable cond;
+        WireBuffer pending;      // Written by the node, not read by the host yet
+        bool open = true;
+
+        // Host side: wait up to timeoutMs (wall time) for data, then take all of it
+        std::string read(uint32_t timeoutMs);
+        void close();
+        bool isOpen();
+    };
+
+    WiFiClient() {}
+    explicit WiFiClient(std::shared_ptr<Connection> connection) : _connection(connection) {}
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) override;
+    using Print::write;
+
+    uint8_t connected();
+    void stop();
+    int available() { return 0; }
+    void setTimeout(uint32_t seconds) { (void)seconds; }
+
+    operator bool() { return connected(); }
+    bool operator==(const WiFiClient& other) const { return _connection == other._connection; }
+
+private:
+    std::shared_ptr<Connection> _connection;
+};
+
+#endif // NATIVE_HAL_WIFI_CLIENT_H
@@ -0,0 +1,78 @@
+#include "esp_now.h"
+#include "SimMedium.h"
+#include "SimNode.h"
+
+using sim::SimNode;
+
+esp_err_t esp_now_init() {
+    SimNode* node = SimNode::current();
+    if (!node) return ESP_FAIL;
+    node->espNowInit();
+    return ESP_OK;
+}
+
+esp_err_t esp_now_deinit() {
+    SimNode* node = SimNode::current();
+    if (!node) return ESP_FAIL;
+    node->espNowDeinit();
+    return ESP_OK;
+}
+
+esp_err_t esp_now_register_recv_cb(esp_now_recv_cb_t cb) {
+    SimNode* node = SimNode::current();
+    if (!node || !node->espNowInitialized()) return ESP_ERR_ESPNOW_NOT_INIT;
+    node->setRecvCallback(cb);
+    return ESP_OK;
+}
+
+esp_err_t esp_now_register_send_cb(esp_now_send_cb_t cb) {
+    SimNode* node = SimNode::current();
+    if (!node || !node->espNowInitialized()) return ESP_ERR_ESPNOW_NOT_INIT;
+    if (cb) {
+        node->setSendCallback([cb](const uint8_t* mac, bool success) {
+            cb(mac, success ? ESP_NOW_SEND_SUCCESS : ESP_NOW_SEND_FAIL);
+        });
+    } else {
+        node->setSendCallback(nullptr);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_now_add_peer(const esp_now_peer_info_t* peer) {
+    SimNode* node = SimNode::current();
+    if (!node || !node->espNowInitialized()) return ESP_ERR_ESPNOW_NOT_INIT;
+    if (!peer) return ESP_ERR_ESPNOW_ARG;
+    if (node->hasPeer(peer->peer_addr)) return ESP_ERR_ESPNOW_EXIST;
+    if (node->peerCount() >= ESP_NOW_MAX_TOTAL_PEER_NUM) return ESP_ERR_ESPNOW_FULL;
+    node->addPeer(peer->peer_addr);
+    return ESP_OK;
+}
+
+esp_err_t esp_now_mod_peer(const esp_now_peer_info_t* peer) {
+    SimNode* node = SimNode::current();
+    if (!node || !node->espNowInitialized()) return ESP_ERR_ESPNOW_NOT_INIT;
+    if (!peer) return ESP_ERR_ESPNOW_ARG;
+    return node->hasPeer(peer->peer_addr) ? ESP_OK : ESP_ERR_ESPNOW_NOT_FOUND;
+}
+
+esp_err_t esp_now_del_peer(const uint8_t* peer_addr) {
+    SimNode* node = SimNode::current();
+    if (!node || !node->espNowInitialized()) return ESP_ERR_ESPNOW_NOT_INIT;
+    return node->removePeer(peer_addr) ? ESP_OK : ESP_ERR_ESPNOW_NOT_FOUND;
+}
+
+bool esp_now_is_peer_exist(const uint8_t* peer_addr) {
+    SimNode* node = SimNode::current();
+    return node && node->hasPeer(peer_addr);
+}
+
+esp_err_t esp_now_send(const uint8_t* peer_addr, const uint8_t* data, size_t len) {
+    SimNode* node = SimNode::current();
+    if (!node || !node->espNowInitialized()) return ESP_ERR_ESPNOW_NOT_INIT;
+    if (!peer_addr || !data || len == 0 || len > ESP_NOW_MAX_DATA_LEN) return ESP_ERR_ESPNOW_ARG;
+    if (!node->hasPeer(peer_addr)) return ESP_ERR_ESPNOW_NOT_FOUND;
+
+    bool acked = sim::SimMedium::instance().transmit(*node, peer_addr, data, len);
+    node->queueSendResult(peer_addr, acked);
+    return ESP_OK;
+}
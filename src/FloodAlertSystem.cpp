@@ -1,8 +1,37 @@
 #include "FloodAlertSystem.h"
+#include "utils/JsonStreamWriter.h"
 #include <ArduinoJson.h>
 
 // Initialisation du pointeur statique
-FloodAlertSystem *FloodAlertSystem::_instance = nullptr;
+NODE_LOCAL FloodAlertSystem *FloodAlertSystem::_instance = nullptr;
+
+// Lire une adresse MAC "AA:BB:CC:DD:EE:FF" (format de /api/sensors)
+static bool parseMac(const char *text, uint8_t *mac)
+{
+    unsigned int bytes[6];
+    if (sscanf(text, "%2x:%2x:%2x:%2x:%2x:%2x", &bytes[0], &bytes[1], &bytes[2],
+               &bytes[3], &bytes[4], &bytes[5]) != 6)
+        return false;
+    for (int i = 0; i < 6; i++)
+        mac[i] = (uint8_t)bytes[i];
+    return true;
+}
+
+// Libellé d'une catégorie d'alerte (champ "status" des API)
+static const char *categoryStatus(uint8_t category)
+{
+    switch (category)
+    {
+    case 0:
+        return "Normal";
+    case 1:
+        return "Warning";
+    case 2:
+        return "Alert";
+    default:
+        return "Unknown";
+    }
+}
 
 FloodAlertSystem::FloodAlertSystem()
 {
@@ -10,12 +39,7 @@ FloodAlertSystem::FloodAlertSystem()
     _ledIndicator = nullptr;
     _buzzerIndicator = nullptr;
 
-    // Initialiser les capteurs distants
-    for (int i = 0; i < MAX_SENSORS; i++)
-    {
-        memset(&_remoteSensors[i], 0, sizeof(SensorData));
-        _remoteSensors[i].active = false;
-    }
+    memset(&_batch, 0, sizeof(_batch));
 }
 
 FloodAlertSystem::~FloodAlertSystem()
@@ -38,23 +62,38 @@ bool FloodAlertSystem::begin(bool isMaster)
     _network.setDeviceName(_isMaster ? DEVICE_NAME : SLAVE_NAME);
     if (!_network.begin(_isMaster, MIN_PEERS, WIFI_CHANNEL))
     {
-        Serial.println("✗ Failed to initialize network!");
+        Logger::error("✗ Failed to initialize network!");
         return false;
     }
 
     // Définir les callbacks
     _network.onMessageReceived(onMessageReceived);
     _network.onDataReady(onDataReady);
+    _network.onFrameQueued(onFrameQueued);
+    _network.onBatchReceived(onBatchReceived);
+
+    // Registre des capteurs distants : alloué une fois, seul le master en a besoin
+    if (!_remoteSensors.begin(_isMaster ? _sensorCapacity : 0))
+    {
+        Logger::error("✗ Failed to allocate sensor registry!");
+        return false;
+    }
 
     // Initialiser le serveur web si c'est le master
     if (_isMaster)
     {
         if (!_webServer.beginSPIFFS())
         {
-            Serial.println("✗ Failed to initialize web server file system!");
+            Logger::error("✗ Failed to initialize web server file system!");
             return false;
         }
 
+        // Historique des capteurs, repris de la dernière sauvegarde
+        if (_history.begin(_sensorCapacity))
+        {
+            _history.load();
+        }
+
         // Configurer le WiFi selon le mode
         _webServer.beginAP(AP_SSID, AP_PASSWORD);
 
@@ -73,129 +112,343 @@ bool FloodAlertSystem::begin(bool isMaster)
     {
         if (!sensor->begin())
         {
-            Serial.print("Failed to initialize sensor: ");
-            Serial.println(sensor->getName());
+            Logger::errorF("Failed to initialize sensor: %s", sensor->getName());
         }
     }
 
+    // Enregistrer les tâches périodiques de tous les sous-systèmes
+    _scheduler.begin();
+    setupTasks();
+
     _isRunning = true;
     return true;
 }
 
+// Tâches du système : chaque sous-système tourne à son propre rythme et
+// la boucle principale dort entre deux échéances
+void FloodAlertSystem::setupTasks()
+{
+    // Trames ESP-NOW : le callback radio ne fait que les mettre en file et
+    // réveiller cette tâche, qui les décode dans la boucle principale
+    _radioTask = _scheduler.addEvent("radio", [this]()
+                                     { _network.processReceived(); });
+
+    // Réseau : découverte, statut vers les esclaves et expiration des pairs
+    _scheduler.addPeriodic("network", 250, [this]()
+                           {
+        _network.update();
+        if (_network.getStateGeneration() != _networkGeneration)
+            _scheduler.signal(_stateTask); });
+
+    // État observable (affichage) : signalée quand une mesure ou le réseau change
+    _stateTask = _scheduler.addEvent("state", [this]()
+                                     { updateSystemState(); });
+
+    if (_isMaster)
+    {
+        // Serveur HTTP non bloquant : chaque passage accepte, lit et envoie ce
+        // que les sockets permettent sans jamais attendre un client lent
+        _scheduler.addPeriodic("web", 10, [this]()
+                               { _webServer.handleClient(); });
+
+        // Tableaux de bord abonnés : signalée par storeSensorData quand une valeur change
+        _eventsTask = _scheduler.addEvent("events", [this]()
+                                          { pushSensorEvents(); });
+
+        // toogle switch only for master (debounce de 50 ms)
+        _scheduler.addPeriodic("toggle", 20, [this]()
+                               { updateToggleSwitch(); });
+    }
+
+    // Les esclaves échantillonnent plus vite qu'ils n'envoient : les mesures
+    // sont groupées dans un seul SENSOR_BATCH toutes les 5 secondes
+    _scheduler.addPeriodic("sensors", _isMaster ? 1000 : SENSOR_SAMPLE_INTERVAL_MS, [this]()
+                           { processLocalSensors(); });
+    _scheduler.addPeriodic("inactive", 1000, [this]()
+                           {
+        updateInactiveSensors();
+        _scheduler.signal(_stateTask); });
+    _scheduler.addPeriodic("serial", 100, [this]()
+                           { processSerialCommands(); });
+
+    // LEDs et buzzer : réveillée par signal quand un motif démarre, puis
+    // replanifiée au prochain changement de note ou de LED
+    _indicatorTask = _scheduler.addPeriodic("indicators", 250, [this]()
+                                            { tickIndicators(); });
+
+    _scheduler.addPeriodic("eink", 1000, [this]()
+                           { updateEInkDisplay(); });
+
+    // Envoyer les données périodiquement (toutes les 5 secondes)
+    _scheduler.addPeriodic("status", 5000, [this]()
+                           { sendPeriodicStatus(); });
+
+    if (_isMaster)
+    {
+        // Historique : sauvegarde espacée pour ménager la flash
+        _scheduler.addPeriodic("history", HISTORY_FLUSH_INTERVAL_MS, HISTORY_FLUSH_INTERVAL_MS, [this]()
+                               { _history.flush(); });
+    }
+
+    // Latence de la boucle
+    _scheduler.addPeriodic("stats", 60000, [this]()
+                           { _scheduler.printStats(); });
+}
+
+// Routes du serveur web : table constante (en flash), dispatch par hachage du chemin
+const HttpRoute FloodAlertSystem::ROUTES[] = {
+    HTTP_ROUTE("/api/sensors", HTTP_GET, FloodAlertSystem, handleSensorsApi),
+    HTTP_ROUTE("/api/history", HTTP_GET, FloodAlertSystem, handleHistoryApi),
+    HTTP_ROUTE("/api/events", HTTP_GET, FloodAlertSystem, handleEventsApi),
+    HTTP_ROUTE("/api/status", HTTP_GET, FloodAlertSystem, handleStatusApi),
+    HTTP_ROUTE("/api/silence", HTTP_POST, FloodAlertSystem, handleSilenceApi),
+    HTTP_ROUTE("/", HTTP_GET, FloodAlertSystem, handleRoot),
+    HTTP_PREFIX_ROUTE("/static/", HTTP_GET, FloodAlertSystem, handleStaticFile),
+};
+
 // Configuration du serveur web
 void FloodAlertSystem::setupWebServer()
 {
-    // API endpoint for sensor data
-    _webServer.on("/api/sensors", HTTP_GET, [this]()
-                  {
-        DynamicJsonDocument doc(2048);
-        JsonArray sensorArray = doc.createNestedArray("sensors");
+    _webServer.addRoutes(ROUTES, HTTP_ROUTE_COUNT(ROUTES), this);
+}
+
+// API endpoint for sensor data
+void FloodAlertSystem::handleSensorsApi()
+{
+    HttpServer &server = _webServer.getServer();
+
+    // Grand registre : écrit au fil du registre, mémoire constante quel que soit le nombre de capteurs
+    if (_remoteSensors.size() > RESPONSE_CACHE_MAX_SENSORS)
+    {
+        JsonStreamWriter json(server);
+        server.sendHeader("X-Uptime", String(millis() / 1000));
+        json.begin();
+        writeSensorsJson(json);
+        json.end();
+        return;
+    }
+
+    // Sinon le corps est partagé : reconstruit seulement quand le registre ou
+    // le réseau change. Il ne contient rien qui dépende de l'heure (lastSeen
+    // est absolu) : l'heure courante part dans l'en-tête X-Uptime.
+    // Somme de compteurs croissants : elle change dès que l'un d'eux change.
+    uint32_t version = _remoteSensors.generation() + _network.getStateGeneration();
+    std::shared_ptr<const String> body = _sensorsCache.lookup(version);
+    if (!body)
+    {
+        String text;
+        text.reserve(_remoteSensors.size() * 150 + 96);
+        JsonStreamWriter json(text);
+        writeSensorsJson(json);
+        json.end();
+        body = _sensorsCache.store(version, std::move(text));
+    }
+    server.sendHeader("X-Uptime", String(millis() / 1000));
+    server.send(200, "application/json", body);
+}
+
+void FloodAlertSystem::writeSensorsJson(JsonStreamWriter &json)
+{
+    json.beginObject();
+    json.key("sensors");
+    json.beginArray();
+    
+    for (SensorData &remote : _remoteSensors) {
+        json.beginObject();
+        json.field("name", remote.name);
         
-        for (int i = 0; i < MAX_SENSORS; i++) {
-            if (_remoteSensors[i].active) {
-                JsonObject sensor = sensorArray.createNestedObject();
-                sensor["name"] = _remoteSensors[i].name;
-                
-                // Format MAC address
-                char macStr[18];
-                snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
-                        _remoteSensors[i].mac[0], _remoteSensors[i].mac[1], _remoteSensors[i].mac[2],
-                        _remoteSensors[i].mac[3], _remoteSensors[i].mac[4], _remoteSensors[i].mac[5]);
-                sensor["mac"] = macStr;
-                
-                sensor["waterLevel"] = _remoteSensors[i].waterLevel;
-                sensor["temperature"] = _remoteSensors[i].temperature;
-                sensor["category"] = _remoteSensors[i].category;
-                
-                // Calculate time since last seen
-                unsigned long secsSinceLastSeen = (millis() - _remoteSensors[i].lastSeen) / 1000;
-                sensor["lastSeenSeconds"] = secsSinceLastSeen;
-                
-                // Category text
-                switch(_remoteSensors[i].category) {
-                    case 0: sensor["status"] = "Normal"; break;
-                    case 1: sensor["status"] = "Warning"; break;
-                    case 2: sensor["status"] = "Alert"; break;
-                    default: sensor["status"] = "Unknown";
-                }
-            }
-        }
+        // Format MAC address
+        char macStr[18];
+        snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
+                remote.mac[0], remote.mac[1], remote.mac[2],
+                remote.mac[3], remote.mac[4], remote.mac[5]);
+        json.field("mac", macStr);
         
-        // Add network status
-        doc["networkReady"] = _network.isNetworkReady();
-        doc["connectedPeers"] = _network.getPeerCount();
-        doc["timestamp"] = millis() / 1000;
+        json.field("waterLevel", remote.waterLevel);
+        json.field("temperature", remote.temperature);
+        json.field("category", remote.category);
         
-        String jsonResponse;
-        serializeJson(doc, jsonResponse);
-        _webServer.getServer().send(200, "application/json", jsonResponse); });
-
-    // System status API
-    _webServer.on("/api/status", HTTP_GET, [this]()
-                  {
-        DynamicJsonDocument doc(512);
+        // Last seen, in seconds of uptime (see the X-Uptime header)
+        json.field("lastSeen", remote.lastSeen / 1000);
         
-        // Device info
+        // Category text
+        json.field("status", categoryStatus(remote.category));
+        json.endObject();
+    }
+    json.endArray();
+    
+    // Add network status
+    json.field("networkReady", _network.isNetworkReady());
+    json.field("connectedPeers", _network.getPeerCount());
+    json.endObject();
+}
+
+// Historique d'un capteur : /api/history?sensor=AA:BB:CC:DD:EE:FF&from=<s>&res=raw|1m|1h
+// (temps en secondes de l'horloge de l'historique, "now" donne sa valeur actuelle)
+void FloodAlertSystem::handleHistoryApi()
+{
+    HttpServer &server = _webServer.getServer();
+    uint8_t mac[6];
+    HistoryResolution res;
+    if (!parseMac(server.arg("sensor").c_str(), mac) || !TimeSeriesStore::parseResolution(server.arg("res"), res)) {
+        server.send(400, "application/json", "{\"error\":\"expected sensor=<MAC>&res=raw|1m|1h\"}");
+        return;
+    }
+    uint32_t from = server.hasArg("from") ? (uint32_t)server.arg("from").toInt() : 0;
+
+    if (!_history.contains(mac)) {
+        server.send(404, "application/json", "{\"error\":\"no history for this sensor\"}");
+        return;
+    }
+
+    JsonStreamWriter json(server);
+    json.begin();
+    json.beginObject();
+    json.field("sensor", server.arg("sensor"));
+    json.field("res", res == HISTORY_RAW ? "raw" : (res == HISTORY_MINUTE ? "1m" : "1h"));
+    json.field("now", _history.now());
+
+    // Points [temps, niveau d'eau, température, catégorie], décodés un à un
+    json.key("points");
+    json.beginArray();
+    _history.query(mac, res, from, [&json](const HistoryPoint &point) {
+        json.beginArray();
+        json.value(point.time);
+        json.value(point.waterLevel);
+        json.value(point.temperature);
+        json.value(point.category);
+        json.endArray();
+    });
+    json.endArray();
+    json.endObject();
+    json.end();
+}
+
+// Changements des capteurs poussés en direct (Server-Sent Events, voir pushSensorEvents)
+void FloodAlertSystem::handleEventsApi()
+{
+    _webServer.acceptEventClient();
+}
+
+// System status API
+void FloodAlertSystem::handleStatusApi()
+{
+    // Partie stable (identité, état du réseau) en cache jusqu'au prochain
+    // changement du réseau ; compteurs et WiFi écrits à chaque requête
+    uint32_t version = _network.getStateGeneration();
+    std::shared_ptr<const String> body = _statusCache.lookup(version);
+    if (!body)
+    {
         uint8_t mac[6];
         _network.getOwnMac(mac);
         char macStr[18];
         snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
                 mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
-        
-        doc["deviceName"] = DEVICE_NAME;
-        doc["deviceMac"] = macStr;
-        doc["uptime"] = millis() / 1000;
-        
-        // Network info
-        doc["networkReady"] = _network.isNetworkReady();
-        doc["connectedPeers"] = _network.getPeerCount();
-        doc["minPeers"] = _network.getMinPeers();
-        
-        // WiFi info
-        JsonObject wifiInfo = doc.createNestedObject("wifi");
-        wifiInfo["apIP"] = _webServer.getAPIP().toString();
-        wifiInfo["apSSID"] = AP_SSID;
-        
-        wifiInfo["staConnected"] = _webServer.isConnectedToWiFi();
-        if (_webServer.isConnectedToWiFi()) {
-            wifiInfo["staIP"] = _webServer.getSTAIP().toString();
-            wifiInfo["rssi"] = WiFi.RSSI();
-        }
-        
-        String jsonResponse;
-        serializeJson(doc, jsonResponse);
-        _webServer.getServer().send(200, "application/json", jsonResponse); });
-
-    // Root URL handler
-    _webServer.on("/", HTTP_GET, [this]()
-                  {
-        if (_webServer.serveFile("/static/index.html")) {
-            Serial.println("Served dashboard page");
-        } else {
-            _webServer.getServer().send(200, "text/html", "<h1>Flood Alert System</h1><p>Dashboard not found. Please upload files to SPIFFS.</p>");
-        } });
-
-    // Simple static file handler
-    _webServer.on("/static/(.*)", HTTP_GET, [this]()
-                  {
-        String requestPath = _webServer.getServer().uri();
-        if (_webServer.serveFile(requestPath)) {
-            Serial.println("Served file: " + requestPath);
-        } else {
-            _webServer.getServer().send(404, "text/plain", "File not found");
-        } });
-
-    // API endpoint for silencing audio alerts
-    _webServer.on("/api/silence", HTTP_POST, [this]()
-                  {
-        silenceAudioAlert();
-        DynamicJsonDocument doc(128);
-        doc["success"] = true;
-        doc["message"] = "Audio alert silenced";
-        
-        String jsonResponse;
-        serializeJson(doc, jsonResponse);
-        _webServer.getServer().send(200, "application/json", jsonResponse); });
+
+        String text;
+        JsonStreamWriter device(text);
+        device.beginObject();
+        device.field("deviceName", DEVICE_NAME);
+        device.field("deviceMac", macStr);
+        device.field("networkReady", _network.isNetworkReady());
+        device.field("connectedPeers", _network.getPeerCount());
+        device.field("minPeers", _network.getMinPeers());
+        device.endObject();
+        device.end();
+        body = _statusCache.store(version, std::move(text));
+    }
+
+    HttpServer &server = _webServer.getServer();
+    JsonStreamWriter json(server);
+    json.begin();
+    json.beginObject();
+    json.members(*body);
+    json.field("uptime", millis() / 1000);
+    json.field("framesReceived", _network.getReceivedFrames());
+    json.field("framesDropped", _network.getDroppedFrames());
+    json.field("framesInvalid", _network.getInvalidFrames());
+    json.field("rxQueueHighWater", _network.getRxQueueHighWater());
+    
+    // WiFi info
+    json.key("wifi");
+    json.beginObject();
+    json.field("apIP", _webServer.getAPIP().toString());
+    json.field("apSSID", AP_SSID);
+    json.field("staConnected", _webServer.isConnectedToWiFi());
+    if (_webServer.isConnectedToWiFi()) {
+        json.field("staIP", _webServer.getSTAIP().toString());
+        json.field("rssi", WiFi.RSSI());
+    }
+    json.endObject();
+    
+    // Scheduler latency
+    const SchedulerStats& stats = _scheduler.getStats();
+    json.key("scheduler");
+    json.beginObject();
+    json.field("wakeups", stats.wakeups);
+    json.field("maxLatencyUs", stats.maxLatencyUs);
+    json.field("maxLoopUs", stats.maxLoopUs);
+    json.field("maxTaskUs", stats.maxRunUs);
+    json.field("slowestTask", stats.slowestTask);
+    json.endObject();
+
+    // Serveur HTTP
+    const HttpStats& http = server.getStats();
+    json.key("http");
+    json.beginObject();
+    json.field("connections", server.activeConnections());
+    json.field("peakConnections", http.peakConnections);
+    json.field("requests", http.requests);
+    json.field("rejected", http.rejected);
+    json.field("timeouts", http.timeouts);
+    json.field("aborted", http.aborted);
+    json.field("maxHandlerUs", http.maxHandlerUs);
+    json.endObject();
+
+    // Cache des réponses
+    json.key("cache");
+    json.beginObject();
+    json.field("sensorsHits", _sensorsCache.hits());
+    json.field("sensorsMisses", _sensorsCache.misses());
+    json.field("statusHits", _statusCache.hits());
+    json.field("statusMisses", _statusCache.misses());
+    json.endObject();
+    json.endObject();
+    json.end();
+}
+
+// Root URL handler
+void FloodAlertSystem::handleRoot()
+{
+    if (_webServer.serveFile("/static/index.html")) {
+        Logger::debug("Served dashboard page");
+    } else {
+        _webServer.getServer().send(200, "text/html", "<h1>Flood Alert System</h1><p>Dashboard not found. Please upload files to SPIFFS.</p>");
+    }
+}
+
+// Simple static file handler
+void FloodAlertSystem::handleStaticFile()
+{
+    String requestPath = _webServer.getServer().uri();
+    if (_webServer.serveFile(requestPath)) {
+        Logger::debugF("Served file: %s", requestPath.c_str());
+    } else {
+        _webServer.getServer().send(404, "text/plain", "File not found");
+    }
+}
+
+// API endpoint for silencing audio alerts
+void FloodAlertSystem::handleSilenceApi()
+{
+    silenceAudioAlert();
+    DynamicJsonDocument doc(128);
+    doc["success"] = true;
+    doc["message"] = "Audio alert silenced";
+    
+    String jsonResponse;
+    serializeJson(doc, jsonResponse);
+    _webServer.getServer().send(200, "application/json", jsonResponse);
 }
 
 // Ajouter un capteur à la liste
@@ -209,99 +462,96 @@ void FloodAlertSystem::addSensor(SensorBase *sensor)
         sensor->begin();
     }
 
-    Serial.print("Added sensor: ");
-    Serial.println(sensor->getName());
+    Logger::infoF("Added sensor: %s", sensor->getName());
 }
 
 void FloodAlertSystem::update()
 {
-    // Mettre à jour le réseau
-    _network.update();
-
-    // Mettre à jour le serveur web si c'est le master
-    if (_isMaster)
-    {
-        _webServer.handleClient();
+    _scheduler.runOnce();
+}
 
-        
+// Gestion de l'interrupteur (master uniquement)
+void FloodAlertSystem::updateToggleSwitch()
+{
+    if (_toggleSwitchIndicator == nullptr)
+        return;
 
-        // toogle switch only for master
-        // Handle toggle switch if available
-        if (_toggleSwitchIndicator != nullptr)
+    if (_toggleSwitchIndicator->update())
+    {
+        // Toggle state changed
+        if (_toggleSwitchIndicator->isToggleOn())
         {
-
-            if (_toggleSwitchIndicator->update())
+            // Toggle switched ON - trigger alert sounds
+            if (_buzzerIndicator != nullptr)
             {
-                // Toggle state changed
-                if (_toggleSwitchIndicator->isToggleOn())
-                {
-                    // Toggle switched ON - trigger alert sounds
-                    if (_buzzerIndicator != nullptr)
-                    {
-                        _buzzerIndicator->playAlertTone(1);
-                    }
-                }
-                else if (_toggleSwitchIndicator->isToggleOff())
-                {
-                    // Toggle switched OFF - silence alerts
-                    if (_buzzerIndicator != nullptr)
-                    {
-                        _buzzerIndicator->silenceAlert();
-                    }
-                }
+                _buzzerIndicator->playAlertTone(1);
+                _scheduler.signal(_indicatorTask);
             }
-
-            // If toggle is ON, periodically play buzzer
-            if (_toggleSwitchIndicator->getSwitchState())
+        }
+        else if (_toggleSwitchIndicator->isToggleOff())
+        {
+            // Toggle switched OFF - silence alerts
+            if (_buzzerIndicator != nullptr)
             {
-                static unsigned long lastBuzzerTime = 0;
-                unsigned long currentTime = millis();
-
-                if (currentTime - lastBuzzerTime > 3000)
-                { // Every 3 seconds
-                    lastBuzzerTime = currentTime;
-                    if (_buzzerIndicator != nullptr)
-                    {
-                        _buzzerIndicator->playAlertTone(1);
-                    }
-                }
+                _buzzerIndicator->silenceAlert();
             }
         }
     }
 
-    // Mettre à jour les capteurs locaux
-    processLocalSensors();
+    // If toggle is ON, periodically play buzzer
+    if (_toggleSwitchIndicator->getSwitchState())
+    {
+        unsigned long currentTime = millis();
 
-    // Vérifier les capteurs inactifs
-    updateInactiveSensors();
+        if (currentTime - _lastToggleBuzzerTime > 3000)
+        { // Every 3 seconds
+            _lastToggleBuzzerTime = currentTime;
+            if (_buzzerIndicator != nullptr)
+            {
+                _buzzerIndicator->playAlertTone(1);
+                _scheduler.signal(_indicatorTask);
+            }
+        }
+    }
+}
 
-    // Vérifier les commandes série
-    processSerialCommands();
+// Faire avancer les motifs du buzzer et des LEDs
+void FloodAlertSystem::tickIndicators()
+{
+    unsigned long next = 0;
 
     // Mettre à jour le buzzer (pour gérer les motifs d'alerte)
     if (_buzzerIndicator != nullptr)
     {
-        _buzzerIndicator->tick();
+        next = _buzzerIndicator->tick();
     }
 
-    updateEInkDisplay();
-
-    // Envoyer les données périodiquement
-    unsigned long now = millis();
-    if (now - _lastStatusUpdate >= 5000)
-    { // Toutes les 5 secondes
-        _lastStatusUpdate = now;
+    if (_ledIndicator != nullptr)
+    {
+        unsigned long ledNext = _ledIndicator->tick();
+        if (ledNext > 0 && (next == 0 || ledNext < next))
+            next = ledNext;
+    }
 
-        // Envoyer les données des capteurs
-        if (!_isMaster)
-        {
-            // Si esclave, envoyer les données au master
-            sendSensorData();
-        }
+    // Revenir exactement au prochain changement plutôt qu'à la période de repos
+    if (next > 0)
+    {
+        _scheduler.runIn(_indicatorTask, next);
+    }
+}
 
-        // Imprimer l'état du réseau
-        _network.printNetworkStatus();
+// Tâche de statut : envoi des mesures (esclave) et état du réseau
+void FloodAlertSystem::sendPeriodicStatus()
+{
+    // Envoyer les données des capteurs
+    if (!_isMaster)
+    {
+        // Si esclave, envoyer les données au master
+        sendSensorData();
     }
+
+    // Imprimer l'état du réseau
+    _network.printNetworkStatus();
 }
 
 // Callbacks statiques
@@ -321,6 +571,23 @@ void FloodAlertSystem::onDataReady(float *data, uint8_t count)
     }
 }
 
+// Appelé depuis la tâche WiFi : uniquement réveiller la boucle
+void FloodAlertSystem::onFrameQueued()
+{
+    if (_instance)
+    {
+        _instance->_scheduler.signal(_instance->_radioTask);
+    }
+}
+
+void FloodAlertSystem::onBatchReceived(const sensor_batch_t &batch, const uint8_t *mac)
+{
+    if (_instance)
+    {
+        _instance->handleSensorBatch(batch, mac);
+    }
+}
+
 // Traitement des messages reçus
 void FloodAlertSystem::processReceivedMessage(const network_message_t &msg, const uint8_t *mac)
 {
@@ -345,10 +612,14 @@ void FloodAlertSystem::processLocalSensors()
     {
         sensor->update();
     }
+    _scheduler.signal(_stateTask);
 
-    // Si c'est un esclave, pas besoin de faire plus
+    // Si c'est un esclave, garder la mesure pour le prochain envoi
     if (!_isMaster)
+    {
+        sampleSensorData();
         return;
+    }
 
     // Si c'est un master, traiter les données des capteurs locaux
     // (comme le DHT11) et les ajouter à la liste des capteurs distants
@@ -363,37 +634,36 @@ void FloodAlertSystem::processLocalSensors()
             uint8_t count = 5;
             sensor->getData(data, count);
 
-            // Créer une entrée "locale" dans le tableau des capteurs distants
-            int idx = -1;
-            for (int i = 0; i < MAX_SENSORS; i++)
+            // Créer une entrée "locale" (notre propre MAC) dans le tableau des capteurs distants
+            uint8_t macAddr[6];
+            _network.getOwnMac(macAddr);
+            float temperature = data[1]; // Température
+            uint8_t category = data[2];  // Catégorie
+
+            // L'entrée n'est réécrite (ce qui change la génération du registre et
+            // invalide /api/sensors en cache) que si la mesure change, ou pour
+            // qu'elle n'expire pas comme un capteur muet
+            SensorData *local = _remoteSensors.find(macAddr);
+            bool unchanged = local != nullptr && local->category == category &&
+                             (local->temperature == temperature || (isnan(local->temperature) && isnan(temperature))) &&
+                             millis() - local->lastSeen < SENSOR_TIMEOUT_MS / 2;
+            if (!unchanged)
             {
-                if (!_remoteSensors[i].active)
-                {
-                    idx = i;
-                    _remoteSensorCount++;
-                    break;
-                }
-                else if (strcmp(_remoteSensors[i].name, "Local-DHT11") == 0)
-                {
-                    idx = i;
-                    break;
-                }
+                local = _remoteSensors.acquire(macAddr);
             }
 
-            if (idx >= 0)
+            if (local != nullptr)
             {
-                // Obtenir notre propre MAC
-                uint8_t macAddr[6];
-                _network.getOwnMac(macAddr);
-
-                // Mettre à jour les données
-                memcpy(_remoteSensors[idx].mac, macAddr, 6);
-                strncpy(_remoteSensors[idx].name, "Local-DHT11", sizeof(_remoteSensors[idx].name) - 1);
-                _remoteSensors[idx].temperature = data[1]; // Température
-                _remoteSensors[idx].waterLevel = 0;        // Pas de niveau d'eau
-                _remoteSensors[idx].category = data[2];    // Catégorie
-                _remoteSensors[idx].lastSeen = millis();
-                _remoteSensors[idx].active = true;
+                if (!unchanged)
+                {
+                    // Mettre à jour les données
+                    strncpy(local->name, "Local-DHT11", sizeof(local->name) - 1);
+                    local->temperature = temperature;
+                    local->waterLevel = 0;        // Pas de niveau d'eau
+                    local->category = category;
+                    local->lastSeen = millis();
+                }
+                _history.record(macAddr, 0, local->waterLevel, local->temperature, local->category);
             }
         }
     }
@@ -402,17 +672,14 @@ void FloodAlertSystem::processLocalSensors()
 // Vérifier et mettre à jour les capteurs inactifs
 void FloodAlertSystem::updateInactiveSensors()
 {
-    unsigned long now = millis();
-    for (int i = 0; i < MAX_SENSORS; i++)
-    {
-        if (_remoteSensors[i].active && (now - _remoteSensors[i].lastSeen > 30000))
-        { // 30 secondes timeout
-            Serial.print("Sensor disconnected: ");
-            Serial.println(_remoteSensors[i].name);
-            _remoteSensors[i].active = false;
-            _remoteSensorCount--;
-        }
-    }
+    _remoteSensors.expire(millis(), SENSOR_TIMEOUT_MS, [](const SensorData &sensor)
+                          {
+        Logger::warningF("Sensor disconnected: %s", sensor.name);
+
+        char data[32];
+        snprintf(data, sizeof(data), "{\"mac\":\"%02X:%02X:%02X:%02X:%02X:%02X\"}",
+                 sensor.mac[0], sensor.mac[1], sensor.mac[2], sensor.mac[3], sensor.mac[4], sensor.mac[5]);
+        _instance->_webServer.sendEvent("sensor-lost", data); });
 }
 
 // Traiter les commandes reçues par le port série
@@ -426,48 +693,42 @@ void FloodAlertSystem::processSerialCommands()
         if (command.equalsIgnoreCase("silence") || command.equalsIgnoreCase("s"))
         {
             silenceAudioAlert();
-            Serial.println("Command received: Silencing audio alert");
+            Logger::ui("Command received: Silencing audio alert");
         }
         else if (command.equalsIgnoreCase("test") || command.equalsIgnoreCase("t"))
         {
             // Test the alerts
+            // Les motifs sont mis en file et joués par la tâche des indicateurs
             if (_ledIndicator != nullptr)
             {
+                // Chaque LED à son tour, après les deux clignotements de la précédente
                 _ledIndicator->blinkLED(LED_RED_PIN, 2);
-                _ledIndicator->blinkLED(LED_YELLOW_PIN, 2);
-                _ledIndicator->blinkLED(LED_GREEN_PIN, 2);
+                _ledIndicator->blinkLED(LED_YELLOW_PIN, 2, 2 * LEDAlertIndicator::BLINK_MS);
+                _ledIndicator->blinkLED(LED_GREEN_PIN, 2, 4 * LEDAlertIndicator::BLINK_MS);
             }
 
             if (_buzzerIndicator != nullptr)
             {
                 _buzzerIndicator->playWarningTone();
-                delay(500);
+                _buzzerIndicator->pause(500);
                 _buzzerIndicator->playAlertTone(0);
-                delay(500);
+                _buzzerIndicator->pause(500);
                 _buzzerIndicator->playSuccessTone();
             }
+            _scheduler.signal(_indicatorTask);
 
-            Serial.println("Command received: Testing alerts");
+            Logger::ui("Command received: Testing alerts");
         }
     }
 }
 
-// Envoyer les données des capteurs (pour les esclaves)
-void FloodAlertSystem::sendSensorData()
+// Ajouter la mesure du capteur de niveau d'eau au lot (pour les esclaves)
+void FloodAlertSystem::sampleSensorData()
 {
-    // Cette méthode n'est utilisée que par les esclaves
-    if (_isMaster)
-        return;
-
     // Préparer un tableau pour stocker les données de tous les capteurs
-    float data[5]; // Maximum 5 valeurs pour la structure network_message_t
+    float data[5] = {0, 0, 0, 0, 0}; // Maximum 5 valeurs pour la structure network_message_t
     uint8_t count = 5;
-
-    // Réinitialiser les données
-    for (int i = 0; i < 5; i++)
-    {
-        data[i] = 0;
-    }
+    bool found = false;
 
     // Si on a un capteur de niveau d'eau, obtenir ses données
     for (auto sensor : _sensors)
@@ -475,156 +736,191 @@ void FloodAlertSystem::sendSensorData()
         if (strcmp(sensor->getName(), "WaterLevel") == 0)
         {
             sensor->getData(data, count);
-
-            // Print sensor data to Serial Monitor
-            Serial.println("\n--- SLAVE SENSOR DATA ---");
-            Serial.print("Water Level: ");
-            Serial.print(data[0]);
-            Serial.println(" cm");
-            Serial.print("Category: ");
-            Serial.println((int)data[2]); // 0=normal, 1=warning, 2=critical
-            Serial.println("------------------------\n");
+            found = true;
             break; // On ne prend que le premier capteur de niveau d'eau
         }
     }
 
-    // Envoyer les données au master
-    if (count > 0)
-    {
-        char deviceName[16];
-        snprintf(deviceName, sizeof(deviceName), "%s", SLAVE_NAME);
+    if (!found)
+        return;
 
-        // Envoyer au master
-        bool result = _network.sendToMaster(data, count, deviceName);
+    // Lot plein : oublier la mesure la plus ancienne
+    if (_batch.count >= SENSOR_BATCH_MAX)
+    {
+        memmove(&_batch.readings[0], &_batch.readings[1], (SENSOR_BATCH_MAX - 1) * sizeof(SensorReading));
+        memmove(&_batchTimes[0], &_batchTimes[1], (SENSOR_BATCH_MAX - 1) * sizeof(uint32_t));
+        _batch.count--;
+    }
 
-        if (result)
-        {
-            Serial.println("Sensor data sent to master successfully");
-        }
-        else
-        {
-            Serial.println("Failed to send sensor data to master");
-        }
+    SensorReading &reading = _batch.readings[_batch.count];
+    memcpy(reading.values, data, sizeof(reading.values));
+    _batchTimes[_batch.count] = millis();
+    _batch.value_count = count;
+    _batch.count++;
+
+    // Une alerte qui monte ne doit pas attendre le prochain envoi
+    uint8_t category = count >= 3 ? (uint8_t)data[2] : 0;
+    bool rising = category > _lastSampleCategory;
+    _lastSampleCategory = category;
+    if (rising)
+    {
+        sendSensorData();
     }
 }
 
-// Traiter les données des capteurs reçues du réseau
-void FloodAlertSystem::handleSensorData(const float *data, uint8_t count, const uint8_t *mac, const char *sensorName)
+// Envoyer les mesures accumulées au master (pour les esclaves)
+void FloodAlertSystem::sendSensorData()
 {
-    // Find an existing slot or create a new one
-    int idx = -1;
+    // Cette méthode n'est utilisée que par les esclaves
+    if (_isMaster || _batch.count == 0)
+        return;
 
-    // Look for the sensor by its MAC address
-    for (int i = 0; i < MAX_SENSORS; i++)
+    snprintf(_batch.name, sizeof(_batch.name), "%s", SLAVE_NAME);
+
+    // L'âge de chaque mesure est calculé au moment de l'envoi
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < _batch.count; i++)
     {
-        if (_remoteSensors[i].active && memcmp(_remoteSensors[i].mac, mac, 6) == 0)
-        {
-            idx = i;
-            break;
-        }
+        _batch.readings[i].age_ms = now - _batchTimes[i];
     }
 
-    // If not found, look for a free slot
-    if (idx < 0)
+    const SensorReading &newest = _batch.readings[_batch.count - 1];
+    Logger::debugF("Sending %u readings: water %.1f cm, category %d",
+                   (unsigned)_batch.count, newest.values[0], (int)newest.values[2]);
+
+    // Envoyer au master ; en cas d'échec le lot est gardé pour le prochain essai
+    if (_network.sendBatchToMaster(_batch))
     {
-        for (int i = 0; i < MAX_SENSORS; i++)
-        {
-            if (!_remoteSensors[i].active)
-            {
-                idx = i;
-                _remoteSensorCount++;
-                break;
-            }
-        }
+        Logger::debug("Sensor data sent to master successfully");
+        _batch.count = 0;
     }
-
-    // If no slot available, quit
-    if (idx < 0)
+    else
     {
-        Serial.println("No free slots for new sensor data");
+        Logger::warning("Failed to send sensor data to master");
+    }
+}
+
+// Traiter un lot de mesures reçu d'un esclave
+void FloodAlertSystem::handleSensorBatch(const sensor_batch_t &batch, const uint8_t *mac)
+{
+    if (batch.count == 0)
         return;
+
+    // Les mesures plus anciennes ne font que mettre à jour la table ;
+    // la plus récente passe par le traitement complet (indicateurs, trace)
+    for (uint8_t i = 0; i + 1 < batch.count; i++)
+    {
+        storeSensorData(batch.readings[i].values, batch.value_count, mac, batch.name, batch.readings[i].age_ms);
     }
 
-    // Initialize or update sensor data
-    memcpy(_remoteSensors[idx].mac, mac, 6);
-    _remoteSensors[idx].active = true;
+    const SensorReading &newest = batch.readings[batch.count - 1];
+    handleSensorData(newest.values, batch.value_count, mac, batch.name, newest.age_ms);
+}
+
+// Enregistrer une mesure dans le registre des capteurs distants
+SensorData *FloodAlertSystem::storeSensorData(const float *data, uint8_t count, const uint8_t *mac, const char *sensorName, uint32_t ageMs)
+{
+    // Find the sensor or create it (the least recently updated one is evicted if the registry is full)
+    SensorData *sensor = _remoteSensors.acquire(mac);
+    if (sensor == nullptr)
+    {
+        Logger::error("No sensor registry for new sensor data");
+        return nullptr;
+    }
+
+    // Valeurs précédentes : seuls les changements sont poussés aux tableaux de bord
+    bool isNew = sensor->name[0] == '\0';
+    SensorData previous = *sensor;
 
     // Update sensor name
-    strncpy(_remoteSensors[idx].name, sensorName, sizeof(_remoteSensors[idx].name) - 1);
+    strncpy(sensor->name, sensorName, sizeof(sensor->name) - 1);
 
     // Update values according to expected format
     if (count >= 1)
-        _remoteSensors[idx].waterLevel = data[0]; // First field = water level
+        sensor->waterLevel = data[0]; // First field = water level
     if (count >= 2)
-        _remoteSensors[idx].temperature = data[1]; // Second field = temperature
+        sensor->temperature = data[1]; // Second field = temperature
     if (count >= 3)
-        _remoteSensors[idx].category = (uint8_t)data[2]; // Third field = category
+        sensor->category = (uint8_t)data[2]; // Third field = category
 
-    _remoteSensors[idx].lastSeen = millis();
-
-    // Update indicators based on water level data
-    updateIndicators(_remoteSensors[idx].waterLevel, _remoteSensors[idx].category);
+    sensor->lastSeen = millis() - ageMs;
+    _history.record(mac, ageMs, sensor->waterLevel, sensor->temperature, sensor->category);
 
-    // Debug output
-    Serial.print("Received from ");
-    Serial.print(_remoteSensors[idx].name);
-    Serial.print(": Water=");
-    Serial.print(_remoteSensors[idx].waterLevel);
-    Serial.print("cm, Temp=");
-    Serial.print(_remoteSensors[idx].temperature);
-    Serial.print("°C, Category=");
-    Serial.println(_remoteSensors[idx].category);
-
-    if (count >= 2)
+    bool alert = isNew || sensor->category != previous.category;
+    if (alert || sensor->waterLevel != previous.waterLevel || sensor->temperature != previous.temperature)
     {
-        Serial.print("Temperature: ");
-        Serial.print(_remoteSensors[idx].temperature);
-        Serial.println("°C");
+        _scheduler.signal(_stateTask);
+        sensor->pushPending = true;
+        if (_webServer.eventClientCount() > 0)
+        {
+            // Un changement de catégorie part tout de suite, les autres sont regroupés
+            if (alert)
+                _scheduler.signal(_eventsTask);
+            else
+                _scheduler.runIn(_eventsTask, EVENT_PUSH_DELAY_MS);
+        }
     }
+    return sensor;
+}
 
-    Serial.print("Category: ");
-    Serial.print(_remoteSensors[idx].category);
-    Serial.print(" (");
-    Logger::infoF("nmmmmm  1073496478: %d", _remoteSensors[idx].name);
-    switch (_remoteSensors[idx].category)
-    {
-    case 0:
-        Serial.print("Normal");
-      
-        break;
-    case 1:
-       
-        Serial.print("Warning");
-        break;
-    case 2:
-        Serial.print("Alert");
-        break;
-    default:
-        Serial.print("Unknown");
-    }
-    Serial.println(")");
+// Envoyer aux abonnés de /api/events les capteurs qui ont changé, au format de /api/sensors
+void FloodAlertSystem::pushSensorEvents()
+{
+    bool subscribers = _webServer.eventClientCount() > 0;
 
-    // Print formatted MAC address
-    Serial.print("MAC Address: ");
-    for (int i = 0; i < 6; i++)
+    for (SensorData &sensor : _remoteSensors)
     {
-        Serial.print(_remoteSensors[idx].mac[i], HEX);
-        if (i < 5)
-            Serial.print(":");
+        if (!sensor.pushPending)
+            continue;
+        sensor.pushPending = false;
+        if (!subscribers)
+            continue;
+
+        // Le nom vient du réseau : ne pas le laisser casser le JSON
+        char name[sizeof(sensor.name)];
+        size_t i = 0;
+        for (; i < sizeof(name) - 1 && sensor.name[i]; i++)
+            name[i] = (sensor.name[i] == '"' || sensor.name[i] == '\\' || (uint8_t)sensor.name[i] < 0x20) ? '_' : sensor.name[i];
+        name[i] = '\0';
+
+        char temperature[16];
+        if (isnan(sensor.temperature))
+            strcpy(temperature, "null");
+        else
+            snprintf(temperature, sizeof(temperature), "%.2f", sensor.temperature);
+
+        char data[256];
+        snprintf(data, sizeof(data),
+                 "{\"name\":\"%s\",\"mac\":\"%02X:%02X:%02X:%02X:%02X:%02X\",\"waterLevel\":%.2f,"
+                 "\"temperature\":%s,\"category\":%u,\"status\":\"%s\",\"lastSeenSeconds\":%lu}",
+                 name, sensor.mac[0], sensor.mac[1], sensor.mac[2], sensor.mac[3], sensor.mac[4], sensor.mac[5],
+                 sensor.waterLevel, temperature, sensor.category, categoryStatus(sensor.category),
+                 (unsigned long)((millis() - sensor.lastSeen) / 1000));
+        _webServer.sendEvent("sensor", data);
     }
-    Serial.println();
+}
 
-    Serial.println("-----------------------------------\n");
+// Traiter les données des capteurs reçues du réseau
+void FloodAlertSystem::handleSensorData(const float *data, uint8_t count, const uint8_t *mac, const char *sensorName, uint32_t ageMs)
+{
+    SensorData *sensor = storeSensorData(data, count, mac, sensorName, ageMs);
+    if (sensor == nullptr)
+        return;
+
+    // Update indicators based on water level data
+    updateIndicators(sensor->waterLevel, sensor->category);
+
+    // Debug output
+    Logger::debugF("Received from %s (%02X:%02X:%02X:%02X:%02X:%02X): water %.1f cm, temp %.1f°C, category %u (%s)",
+                   sensor->name, sensor->mac[0], sensor->mac[1], sensor->mac[2], sensor->mac[3], sensor->mac[4],
+                   sensor->mac[5], sensor->waterLevel, sensor->temperature, sensor->category,
+                   categoryStatus(sensor->category));
 }
 
 // Update both LED and Buzzer indicators with the same data
 void FloodAlertSystem::updateIndicators(float waterLevel, uint8_t category)
 {
-    Serial.println("\n--- Updating Indicators ---");
-    Serial.print("Water Level: ");
-    Serial.print(waterLevel);
-    Serial.print(" cm, Category: ");
-    Serial.println(category);
+    Logger::debugF("Updating indicators: water %.1f cm, category %u", waterLevel, category);
 
     // Update LED indicator if available
     if (_ledIndicator != nullptr)
@@ -653,6 +949,9 @@ void FloodAlertSystem::updateIndicators(float waterLevel, uint8_t category)
             break;
         }
     }
+
+    // Un motif d'alerte a pu démarrer
+    _scheduler.signal(_indicatorTask);
 }
 
 // Set the LED indicator
@@ -695,17 +994,121 @@ void FloodAlertSystem::updateEInkDisplay()
 {
     if (_einkDisplay != nullptr)
     {
-        // Update the display
+        // Update the display (ghosting is handled by its partial refresh budget)
         _einkDisplay->update();
+    }
+}
+
+// Accès aux données des capteurs (pour l'affichage)
+SensorData *FloodAlertSystem::getSensorData(int index)
+{
+    // index parmi les capteurs actifs, dans l'ordre du registre
+    return index >= 0 ? _remoteSensors.at(index) : nullptr;
+}
 
-        // Periodic full refresh to prevent ghosting
-        unsigned long now = millis();
-        if (now - _lastEInkUpdate >= 3600000)
-        { // Every hour
-            _lastEInkUpdate = now;
-            _einkDisplay->refresh(); // Force a full refresh
+int FloodAlertSystem::getSensorCount()
+{
+    return _remoteSensors.size();
+}
+
+float FloodAlertSystem::getHighestWaterLevel()
+{
+    float highest = 0;
+    for (SensorData &sensor : _remoteSensors)
+    {
+        if (sensor.waterLevel > highest)
+            highest = sensor.waterLevel;
+    }
+    return highest;
+}
+
+float FloodAlertSystem::getAverageTemperature()
+{
+    float total = 0;
+    int count = 0;
+    for (SensorData &sensor : _remoteSensors)
+    {
+        // Les capteurs de niveau d'eau envoient 0 comme température
+        if (sensor.temperature != 0)
+        {
+            total += sensor.temperature;
+            count++;
         }
     }
+    return count > 0 ? total / count : 0;
+}
+
+uint8_t FloodAlertSystem::getHighestAlertCategory()
+{
+    uint8_t highest = 0;
+    for (SensorData &sensor : _remoteSensors)
+    {
+        if (sensor.category > highest)
+            highest = sensor.category;
+    }
+    return highest;
+}
+
+bool FloodAlertSystem::addStateListener(SystemStateListener listener, void *context)
+{
+    if (listener == nullptr || _stateListenerCount == MAX_STATE_LISTENERS)
+        return false;
+
+    _stateListeners[_stateListenerCount].callback = listener;
+    _stateListeners[_stateListenerCount].context = context;
+    _stateListenerCount++;
+    return true;
+}
+
+// Recalculer l'état observable et prévenir les abonnés des champs qui ont changé
+void FloodAlertSystem::updateSystemState()
+{
+    SystemState state;
+    state.alertCategory = getHighestAlertCategory();
+    state.waterLevel = getHighestWaterLevel();
+    state.temperature = getAverageTemperature();
+    state.sensorCount = _remoteSensors.size();
+    state.peerCount = _network.getPeerCount();
+    state.networkReady = _network.isNetworkReady();
+    state.connectedToMaster = _network.isConnectedToMaster();
+    _networkGeneration = _network.getStateGeneration();
+
+    // Les capteurs locaux de l'esclave ne passent pas par le registre
+    for (auto sensor : _sensors)
+    {
+        float data[3];
+        uint8_t count = 3;
+        sensor->getData(data, count);
+        if (count < 3)
+            continue;
+        if (data[0] > state.waterLevel)
+            state.waterLevel = data[0];
+        if ((uint8_t)data[2] > state.alertCategory)
+            state.alertCategory = (uint8_t)data[2];
+    }
+
+    // Valeurs comparées à la résolution affichée
+    uint8_t changed = 0;
+    if (state.alertCategory != _state.alertCategory)
+        changed |= STATE_ALERT;
+    if (lroundf(state.waterLevel * 10) != lroundf(_state.waterLevel * 10))
+        changed |= STATE_WATER_LEVEL;
+    if (lroundf(state.temperature * 10) != lroundf(_state.temperature * 10))
+        changed |= STATE_TEMPERATURE;
+    if (state.sensorCount != _state.sensorCount)
+        changed |= STATE_SENSORS;
+    if (state.peerCount != _state.peerCount || state.networkReady != _state.networkReady ||
+        state.connectedToMaster != _state.connectedToMaster)
+        changed |= STATE_NETWORK;
+
+    if (changed == 0)
+        return;
+
+    _state = state;
+    for (uint8_t i = 0; i < _stateListenerCount; i++)
+    {
+        _stateListeners[i].callback(_stateListeners[i].context, _state, changed);
+    }
 }
 
 // Toggle switch management
@@ -0,0 +1,1586 @@
+// Généré par tools/build_assets.py à partir de data/ : ne pas modifier
+#include "network/AssetBundle.h"
+
+// /static/alerts.html (1916 octets)
+static const uint8_t ASSET_0[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x59, 0xeb, 0x6e, 0xe3, 0xb8,
+    0x15, 0xfe, 0xbf, 0x4f, 0xc1, 0xea, 0x57, 0x16, 0x58, 0x59, 0xbe, 0xc4, 0x69, 0x62, 0xd8, 0x2e,
+    0xb2, 0xb9, 0xa0, 0x28, 0xa6, 0xb3, 0xc5, 0x24, 0xed, 0xa2, 0xbf, 0x16, 0xb4, 0x74, 0x6c, 0x73,
+    0x42, 0x89, 0x02, 0x49, 0xd9, 0xc9, 0x5b, 0xf5, 0x19, 0xfa, 0x64, 0x3d, 0x24, 0x45, 0x5d, 0x2c,
+    0x29, 0x93, 0xcc, 0xec, 0x14, 0x28, 0x0a, 0x24, 0x90, 0x78, 0x3b, 0xd7, 0xef, 0x5c, 0x44, 0x2f,
+    0xff, 0x70, 0xfb, 0xcb, 0xcd, 0xe3, 0x3f, 0xff, 0x76, 0x47, 0xf6, 0x3a, 0xe5, 0xeb, 0x1f, 0x96,
+    0xe6, 0x41, 0x38, 0xcd, 0x76, 0xab, 0x00, 0xb2, 0xc0, 0x4c, 0x00, 0x4d, 0xf0, 0x91, 0x82, 0xa6,
+    0x24, 0xde, 0x53, 0xa9, 0x40, 0xaf, 0x82, 0xbf, 0x3f, 0xde, 0x87, 0x97, 0x81, 0x9f, 0xce, 0x68,
+    0x0a, 0xab, 0xe0, 0xc0, 0xe0, 0x98, 0x0b, 0xa9, 0x03, 0x12, 0x8b, 0x4c, 0x43, 0x86, 0xdb, 0x8e,
+    0x2c, 0xd1, 0xfb, 0x55, 0x02, 0x07, 0x16, 0x43, 0x68, 0x07, 0x3f, 0x11, 0x96, 0x31, 0xcd, 0x28,
+    0x0f, 0x55, 0x4c, 0x39, 0xac, 0x26, 0xa3, 0xb1, 0x21, 0xa3, 0x99, 0xe6, 0xb0, 0xbe, 0xe7, 0x42,
+    0x24, 0xe4, 0x9a, 0x83, 0xd4, 0xe4, 0xe1, 0x45, 0x69, 0x48, 0x49, 0xe8, 0x86, 0x6a, 0x19, 0xb9,
+    0x2d, 0x3f, 0x2c, 0x39, 0xcb, 0x9e, 0x88, 0x04, 0xbe, 0x0a, 0x94, 0x7e, 0xe1, 0xa0, 0xf6, 0x00,
+    0xc8, 0x72, 0x2f, 0x61, 0xbb, 0x0a, 0x22, 0xa5, 0xa9, 0x66, 0x71, 0x14, 0x2b, 0x15, 0xb9, 0xd5,
+    0x11, 0xbe, 0xfe, 0xe9, 0xb0, 0xba, 0xba, 0xdc, 0xcc, 0xe2, 0x8b, 0xcb, 0xf3, 0xe0, 0x0b, 0x04,
+    0xf6, 0x5a, 0xe7, 0x6a, 0x11, 0x45, 0x71, 0x92, 0x7d, 0xc6, 0xb3, 0x5c, 0x14, 0xc9, 0x96, 0x53,
+    0x09, 0xa3, 0x58, 0xa4, 0x11, 0xfd, 0x4c, 0x9f, 0x23, 0xce, 0x36, 0x2a, 0xda, 0xa2, 0x82, 0x21,
+    0x3d, 0x82, 0x12, 0x29, 0x44, 0x17, 0xa3, 0xf9, 0x68, 0x62, 0x59, 0x52, 0xce, 0x47, 0x29, 0xcb,
+    0x0c, 0xcf, 0xdf, 0x89, 0x11, 0xcd, 0x58, 0x4a, 0x35, 0x18, 0x8a, 0xd1, 0xf9, 0x68, 0x82, 0x7c,
+    0xfc, 0x4c, 0x83, 0x4f, 0x54, 0xba, 0x68, 0x23, 0x92, 0x17, 0x7c, 0x24, 0xec, 0x40, 0x62, 0x4e,
+    0x95, 0x5a, 0x05, 0x34, 0xcf, 0x43, 0xe3, 0x0c, 0xca, 0x32, 0x90, 0x66, 0x2b, 0x55, 0x2c, 0x01,
+    0xbf, 0x6a, 0xde, 0x37, 0xd4, 0xce, 0x37, 0xce, 0x94, 0xb3, 0xa1, 0x21, 0xea, 0x0e, 0xb1, 0x74,
+    0x47, 0x94, 0x8c, 0x6b, 0xf3, 0xe2, 0x44, 0xc4, 0xc5, 0x4e, 0x8c, 0xd4, 0x61, 0x17, 0x10, 0xca,
+    0xd1, 0xd3, 0x1f, 0x70, 0x18, 0x78, 0x12, 0x66, 0xcd, 0x42, 0x67, 0xda, 0x74, 0x29, 0xca, 0x39,
+    0x35, 0xd2, 0x22, 0x2f, 0x7c, 0x64, 0xb4, 0xc3, 0x11, 0xa7, 0xcc, 0xa9, 0x82, 0x5b, 0xdb, 0x19,
+    0x69, 0x4f, 0xdc, 0xca, 0xb2, 0x04, 0x9e, 0x47, 0x06, 0xa1, 0xc1, 0x7a, 0xc9, 0xfc, 0xf1, 0x2d,
+    0x55, 0x64, 0x4b, 0x43, 0x4d, 0xe3, 0x3d, 0xba, 0x43, 0x83, 0x0c, 0x51, 0x22, 0xdc, 0x10, 0xb1,
+    0x35, 0xb9, 0xa5, 0x6a, 0xbf, 0x11, 0x54, 0x26, 0xcb, 0x88, 0x1a, 0xde, 0x96, 0x6c, 0x2f, 0x6d,
+    0x05, 0x99, 0x12, 0x52, 0x0d, 0x51, 0x3f, 0xa2, 0xcd, 0x65, 0x49, 0xf4, 0xc1, 0x6d, 0x6d, 0x93,
+    0xac, 0x4c, 0x1e, 0x6b, 0x76, 0x80, 0xa0, 0x87, 0x03, 0xb5, 0x40, 0x1e, 0x62, 0xb0, 0x01, 0xce,
+    0x4b, 0xfa, 0x1e, 0xf1, 0x5f, 0x90, 0x98, 0x66, 0x94, 0xbf, 0xe0, 0xcb, 0x20, 0x49, 0x13, 0xad,
+    0x3a, 0x44, 0x14, 0x82, 0x27, 0xec, 0x4f, 0xbc, 0xc1, 0x1a, 0x5a, 0xb3, 0x6c, 0x37, 0x4c, 0x5a,
+    0xec, 0x2a, 0x63, 0xb8, 0x9d, 0x4d, 0x92, 0x91, 0x75, 0x61, 0x84, 0xfe, 0xec, 0x87, 0xd6, 0x56,
+    0x08, 0x0d, 0xa7, 0xb8, 0xcb, 0x40, 0x1f, 0x85, 0x7c, 0x0a, 0x8d, 0x04, 0x85, 0xf2, 0x8b, 0x2c,
+    0xa9, 0x57, 0xd0, 0xfd, 0x2c, 0xa6, 0x5a, 0xc8, 0x0a, 0x68, 0xd5, 0x0c, 0x11, 0x99, 0xd7, 0xd3,
+    0xc1, 0x4b, 0xe5, 0x34, 0x6b, 0x1d, 0xd6, 0xf0, 0x8c, 0xa0, 0xf8, 0xe8, 0x46, 0xe4, 0x17, 0xbb,
+    0x7d, 0x19, 0x99, 0x6d, 0x35, 0x26, 0xfd, 0xc3, 0x46, 0x89, 0x49, 0x6e, 0x18, 0x37, 0x9e, 0x95,
+    0x79, 0x0f, 0xcb, 0xc4, 0xe6, 0xd3, 0x22, 0x48, 0xbf, 0x5a, 0x2e, 0x34, 0x82, 0xa6, 0xa1, 0x99,
+    0x9b, 0x0c, 0x6d, 0x02, 0xb3, 0x47, 0x27, 0x6b, 0xe7, 0x62, 0xf2, 0x57, 0xf4, 0xe1, 0x0e, 0x52,
+    0x3c, 0x89, 0xc1, 0x31, 0xc1, 0xa5, 0xdc, 0xca, 0x8c, 0xc7, 0x74, 0x58, 0xe4, 0x09, 0x62, 0x2e,
+    0x09, 0xd6, 0x1f, 0x70, 0x44, 0xca, 0xd1, 0x82, 0xfc, 0xa5, 0xc0, 0x51, 0x26, 0x8e, 0xcb, 0x28,
+    0xaf, 0x25, 0xee, 0x32, 0x33, 0x30, 0x14, 0x99, 0x35, 0xe3, 0xa6, 0xd0, 0x5a, 0x38, 0x63, 0xa0,
+    0x8f, 0x25, 0xe6, 0xa1, 0x70, 0xa3, 0xb3, 0xca, 0x86, 0xf8, 0x4e, 0xf0, 0x1f, 0x71, 0xb2, 0xdb,
+    0xeb, 0x1e, 0x57, 0xab, 0x97, 0x2c, 0x6e, 0x44, 0xd4, 0x27, 0x47, 0x62, 0x19, 0x39, 0xb2, 0x27,
+    0x0e, 0xb6, 0x49, 0x1b, 0x35, 0x4d, 0x21, 0xb0, 0x0c, 0x9b, 0x13, 0xeb, 0xf1, 0x78, 0x61, 0xff,
+    0x4e, 0xcd, 0xed, 0x44, 0x6e, 0x53, 0x42, 0xbf, 0x00, 0x0f, 0x7a, 0xe6, 0x4a, 0x13, 0x13, 0x1b,
+    0x4d, 0x0d, 0x7b, 0x63, 0x6e, 0xe9, 0x88, 0x0e, 0xcf, 0x38, 0xc6, 0x6c, 0x89, 0x96, 0x08, 0xb5,
+    0x64, 0x58, 0xd4, 0x78, 0x15, 0x0a, 0x36, 0x4c, 0xab, 0x50, 0xb3, 0x99, 0xa9, 0xc3, 0xaa, 0xdf,
+    0x88, 0x1a, 0xd0, 0x3b, 0x8e, 0x7d, 0x9f, 0x1d, 0x8f, 0x54, 0x66, 0x18, 0x10, 0xaf, 0x87, 0xf8,
+    0x23, 0xd2, 0xf0, 0x59, 0xb1, 0x32, 0x64, 0xdb, 0x2c, 0x1d, 0x69, 0x4c, 0x7a, 0x6f, 0x86, 0x85,
+    0xcb, 0x34, 0x4e, 0x12, 0xd5, 0x4e, 0xf3, 0xcd, 0x12, 0x60, 0x05, 0x8d, 0x31, 0x05, 0x92, 0xcd,
+    0x2e, 0x4c, 0xd0, 0x06, 0xc6, 0x78, 0xae, 0x88, 0xfc, 0xf6, 0x5b, 0xf9, 0x92, 0xd4, 0x33, 0x79,
+    0xc1, 0x15, 0xd4, 0x43, 0x96, 0x6d, 0x4d, 0xc1, 0x86, 0x5e, 0xaa, 0x0c, 0x99, 0xda, 0x02, 0x71,
+    0xa2, 0xa8, 0xa4, 0x09, 0xb3, 0x56, 0x77, 0xda, 0xf6, 0xa9, 0x54, 0x8a, 0xd5, 0x88, 0xa7, 0x59,
+    0x7b, 0xa9, 0x8c, 0x96, 0x1b, 0x89, 0xdd, 0x02, 0x76, 0x0a, 0xe4, 0x57, 0x93, 0x80, 0xc9, 0x07,
+    0x38, 0x00, 0x47, 0x77, 0xcd, 0x6c, 0xac, 0xb4, 0x0e, 0x24, 0xa0, 0x62, 0xc9, 0x72, 0xc7, 0xd6,
+    0xa5, 0x68, 0x32, 0x25, 0x7b, 0x94, 0x48, 0x82, 0x69, 0x4b, 0x8c, 0x92, 0x24, 0xf6, 0xe4, 0x6c,
+    0x3e, 0x27, 0xdc, 0x90, 0x23, 0x62, 0x4b, 0x2e, 0xe7, 0xa3, 0x39, 0x89, 0xd3, 0x91, 0x8b, 0xaa,
+    0x8e, 0x9c, 0xa6, 0xcb, 0x09, 0x7c, 0x56, 0x39, 0x11, 0xd3, 0x20, 0x7b, 0x4e, 0xb0, 0x1c, 0x17,
+    0x08, 0x0c, 0x42, 0x77, 0xa2, 0xca, 0x2a, 0xdd, 0xdd, 0x4a, 0x14, 0x32, 0x86, 0x86, 0x78, 0x67,
+    0xd7, 0xd7, 0x8b, 0x9f, 0x7f, 0x5e, 0xdc, 0xdc, 0x2c, 0x6e, 0x6f, 0x17, 0x77, 0x77, 0x8b, 0xfb,
+    0xfb, 0x1f, 0x07, 0x92, 0x52, 0x47, 0xa6, 0x2e, 0x38, 0x4f, 0x80, 0xa8, 0xd2, 0x57, 0xe3, 0x3a,
+    0xde, 0x43, 0xfc, 0x54, 0x45, 0xc3, 0x13, 0xa6, 0x14, 0x0e, 0xc9, 0x0e, 0x1a, 0x78, 0xfc, 0x2a,
+    0xb2, 0xc6, 0x20, 0xca, 0x57, 0x5f, 0xa6, 0x52, 0xa6, 0xd4, 0x5b, 0x20, 0xde, 0x86, 0x69, 0x15,
+    0x43, 0xef, 0x00, 0xdd, 0x70, 0xb0, 0x7f, 0x0b, 0xfe, 0x7e, 0x75, 0x92, 0x2c, 0xc8, 0x27, 0xa6,
+    0xf0, 0xf9, 0x75, 0x30, 0x9c, 0x9d, 0xc2, 0x50, 0x3a, 0x62, 0x0d, 0x10, 0xfe, 0x44, 0xe2, 0x42,
+    0x4a, 0x94, 0x85, 0xbf, 0x10, 0xaa, 0xc9, 0xc5, 0x7c, 0x34, 0xfd, 0x06, 0x3c, 0x4e, 0xbe, 0x12,
+    0x90, 0xb3, 0x0e, 0x20, 0x67, 0xb3, 0xff, 0x37, 0x40, 0xda, 0xa6, 0x41, 0x84, 0xad, 0xec, 0x5a,
+    0x25, 0x79, 0x5c, 0xc0, 0x3a, 0x4c, 0xd1, 0x01, 0x4a, 0x61, 0xe5, 0x26, 0x7b, 0x96, 0x24, 0xd0,
+    0x0b, 0x47, 0xab, 0x4d, 0x18, 0x33, 0x19, 0xd7, 0x30, 0xcc, 0xd7, 0x1f, 0x05, 0x71, 0x84, 0x5d,
+    0xfd, 0x52, 0xc6, 0xd7, 0x7a, 0x0f, 0x24, 0x15, 0xa6, 0x09, 0x18, 0xb5, 0x8a, 0x7a, 0xef, 0xe3,
+    0x1d, 0x25, 0x72, 0xa8, 0x2a, 0xee, 0x99, 0xc2, 0x8e, 0xe9, 0xa5, 0xd9, 0x6c, 0x92, 0x3f, 0xbb,
+    0xb9, 0x37, 0x14, 0xc2, 0xc6, 0xda, 0x96, 0x71, 0xd3, 0x6d, 0x27, 0x52, 0xe4, 0x89, 0x38, 0x5a,
+    0x2b, 0x70, 0x8a, 0x45, 0x8e, 0x6c, 0x85, 0xf4, 0xa0, 0x70, 0x7b, 0x2a, 0xfb, 0x29, 0x19, 0x62,
+    0xa7, 0x86, 0xbc, 0xef, 0xed, 0x7c, 0x55, 0x7f, 0xed, 0x39, 0x83, 0x50, 0xe0, 0x10, 0x6b, 0x57,
+    0xde, 0x9a, 0xe7, 0x71, 0x49, 0xd8, 0x98, 0x22, 0x07, 0xca, 0x0b, 0x30, 0xab, 0xa8, 0xfa, 0x35,
+    0xe7, 0x15, 0x05, 0xb7, 0xdc, 0xd9, 0x57, 0x65, 0x92, 0x32, 0x90, 0x87, 0x77, 0xfa, 0xd2, 0x50,
+    0xd7, 0x9c, 0xc6, 0xd6, 0xc8, 0x09, 0xd6, 0xe3, 0x67, 0x2f, 0x60, 0x2b, 0xd1, 0xbc, 0xa3, 0x92,
+    0x37, 0x43, 0x48, 0xe1, 0x47, 0xcc, 0x86, 0x43, 0xbb, 0x96, 0xdb, 0xa9, 0xbe, 0x6d, 0x76, 0xb1,
+    0xfc, 0xf4, 0xd3, 0xd2, 0x0e, 0xd6, 0x8f, 0x2f, 0x39, 0x06, 0x0c, 0xbe, 0xd8, 0xd1, 0x6d, 0x9d,
+    0x8b, 0xea, 0xc9, 0x07, 0x1b, 0xf2, 0xf5, 0xf8, 0x11, 0xe3, 0xa3, 0x71, 0xa4, 0x90, 0xf4, 0x64,
+    0xbf, 0xed, 0xc7, 0xcb, 0x71, 0x64, 0x19, 0x45, 0x15, 0x5b, 0xa3, 0x49, 0xed, 0x2d, 0xe5, 0xb1,
+    0x55, 0x69, 0xa8, 0x65, 0x3b, 0x47, 0x48, 0x71, 0x24, 0xae, 0x07, 0xb1, 0xab, 0xc9, 0xba, 0x95,
+    0x93, 0x36, 0x14, 0xe3, 0xbd, 0x6e, 0x53, 0x9a, 0x9e, 0xb0, 0x29, 0x08, 0x19, 0x27, 0xee, 0xd8,
+    0x4d, 0x5f, 0x1d, 0x3f, 0x2b, 0xab, 0xf8, 0x8f, 0xf5, 0x3e, 0x5f, 0x68, 0xeb, 0x99, 0xe9, 0x78,
+    0x3a, 0x0f, 0xc7, 0xb3, 0x70, 0x7c, 0x41, 0x26, 0xe3, 0xc5, 0x64, 0xbe, 0x98, 0x8d, 0xeb, 0xc5,
+    0xf3, 0x2a, 0x6f, 0xd6, 0x73, 0xfd, 0x12, 0x2a, 0x40, 0x27, 0x25, 0xd4, 0x84, 0xd1, 0x27, 0x50,
+    0x82, 0x1f, 0x20, 0x69, 0x0b, 0xe9, 0x2c, 0xd5, 0xa7, 0x7f, 0xa3, 0xb8, 0x0d, 0x92, 0x3f, 0x85,
+    0x6d, 0xc7, 0x00, 0x9f, 0x3a, 0x15, 0x84, 0x9c, 0x95, 0x45, 0xa3, 0xab, 0xfe, 0x6c, 0x48, 0xfd,
+    0xf1, 0x7c, 0x31, 0x69, 0xd9, 0xe6, 0x7f, 0x45, 0xfd, 0x47, 0x48, 0x73, 0x40, 0xa4, 0x16, 0x12,
+    0x88, 0xca, 0xd9, 0x13, 0x90, 0xb3, 0xd9, 0xe5, 0x68, 0xfe, 0xef, 0x7f, 0xdd, 0x74, 0xb5, 0x9f,
+    0xf4, 0x6a, 0x3f, 0xbe, 0x5a, 0x9c, 0xcf, 0x17, 0xe3, 0xcb, 0x7a, 0x71, 0xf2, 0xdf, 0x70, 0xfe,
+    0xf7, 0x03, 0xff, 0xd5, 0x78, 0xc0, 0xfb, 0xe7, 0x3d, 0xfa, 0xcf, 0xc9, 0x74, 0x8a, 0xc8, 0x47,
+    0x13, 0xd4, 0x8b, 0xd8, 0xa5, 0x60, 0x6a, 0xf8, 0xbd, 0x94, 0x8f, 0x74, 0x79, 0x1d, 0x15, 0xd9,
+    0x64, 0xf5, 0x1d, 0xeb, 0x99, 0xe2, 0xf8, 0xb5, 0x2e, 0x31, 0xf7, 0xb4, 0x2a, 0xda, 0x8d, 0xc0,
+    0x2f, 0x97, 0x5d, 0x95, 0xcd, 0x9a, 0x57, 0x4f, 0x6f, 0xc9, 0xc7, 0xfe, 0x02, 0x24, 0xdc, 0x49,
+    0x96, 0x0c, 0xad, 0xa1, 0x29, 0x5c, 0x9f, 0x67, 0xda, 0xc7, 0xf5, 0xe3, 0xde, 0x7c, 0x18, 0x0b,
+    0x9e, 0x34, 0xee, 0x44, 0x6c, 0x87, 0xd8, 0x77, 0x14, 0x4b, 0x64, 0x7a, 0x5a, 0x4e, 0x71, 0x0a,
+    0xd9, 0x89, 0x22, 0x3f, 0xa9, 0xa4, 0x65, 0x34, 0x84, 0xda, 0x33, 0xa8, 0xe2, 0x82, 0xd4, 0x3c,
+    0xcf, 0xd0, 0xf5, 0x8b, 0xba, 0x90, 0xb2, 0x2c, 0x2f, 0xb0, 0xb5, 0xc0, 0x72, 0x80, 0x4d, 0x4b,
+    0x91, 0x6e, 0x4c, 0x0d, 0x36, 0x79, 0xba, 0x4b, 0xab, 0xc5, 0xde, 0x54, 0x1e, 0x29, 0x78, 0xe0,
+    0x8b, 0xe2, 0xdc, 0xde, 0xce, 0x76, 0xed, 0x36, 0x28, 0xab, 0xaf, 0xa2, 0x4d, 0x61, 0x2b, 0xbc,
+    0xbe, 0x5b, 0xda, 0x1e, 0x6a, 0xaf, 0x8a, 0xfb, 0xc7, 0xf9, 0x3b, 0xc5, 0xd5, 0x98, 0x47, 0xea,
+    0x6c, 0xd3, 0xcc, 0x2a, 0xde, 0xc2, 0x67, 0x26, 0xa7, 0xbc, 0x41, 0xd4, 0x16, 0xa5, 0x57, 0x85,
+    0x9c, 0x35, 0x85, 0x1c, 0x8c, 0x86, 0x01, 0x90, 0x7d, 0x14, 0x9a, 0x6d, 0xcd, 0x9d, 0x97, 0xe9,
+    0x5c, 0xbe, 0x15, 0x67, 0xc4, 0x36, 0xa9, 0x1b, 0xf1, 0x1c, 0x9c, 0x28, 0x56, 0xcd, 0x5b, 0xd5,
+    0x20, 0xb3, 0x5d, 0x09, 0x7e, 0x2b, 0x64, 0xc6, 0xfe, 0x66, 0x0d, 0x92, 0xb6, 0x1d, 0x5b, 0x5b,
+    0xd6, 0x77, 0x76, 0x44, 0x1e, 0xcc, 0xa8, 0xd3, 0xe2, 0xbd, 0xe6, 0x9d, 0xf7, 0x09, 0x74, 0x60,
+    0xaa, 0xc0, 0x7e, 0xed, 0x55, 0x89, 0xca, 0x3d, 0x5e, 0xa4, 0x7f, 0xd8, 0xe1, 0x77, 0x94, 0x09,
+    0x52, 0xca, 0x78, 0xd0, 0x2b, 0x4a, 0xb9, 0x84, 0x59, 0x39, 0x21, 0x77, 0xe6, 0x9d, 0x34, 0x9d,
+    0xf9, 0x46, 0x69, 0x4e, 0x49, 0x1b, 0x3a, 0x21, 0x4d, 0x12, 0x0c, 0x0f, 0x6c, 0xcf, 0x1d, 0xd9,
+    0x6b, 0x37, 0x1c, 0x00, 0xad, 0x13, 0xc3, 0xc9, 0xdc, 0x3a, 0xdd, 0x0f, 0xda, 0x9c, 0xd3, 0x18,
+    0x4c, 0xe4, 0x01, 0xb2, 0xbb, 0xcb, 0x4c, 0xc1, 0xb1, 0xc7, 0x48, 0xc5, 0xf4, 0xcd, 0x1f, 0x2c,
+    0x15, 0x28, 0xfb, 0xef, 0xd5, 0x14, 0xf5, 0xdf, 0x5b, 0xa1, 0xdf, 0xd9, 0xb9, 0x5c, 0xcb, 0x25,
+    0x4b, 0x6d, 0xe9, 0xe9, 0x56, 0x01, 0x7a, 0xf0, 0x77, 0x7b, 0x0f, 0xf8, 0xda, 0x88, 0x8d, 0xd3,
+    0xcf, 0x47, 0x77, 0x11, 0x8a, 0x2c, 0xbe, 0xc4, 0x6c, 0xe8, 0x8b, 0x12, 0x51, 0x2d, 0xaa, 0xdb,
+    0x50, 0x3c, 0x4d, 0xb4, 0x20, 0xb7, 0xb0, 0xa5, 0x05, 0x1f, 0xbe, 0xcd, 0xf3, 0x0f, 0x73, 0x8d,
+    0x5c, 0x0f, 0x5d, 0x7b, 0xde, 0xfe, 0x71, 0xe5, 0xb3, 0xf2, 0xbf, 0x14, 0x7c, 0x36, 0xbf, 0x5c,
+    0x9d, 0x4f, 0x67, 0x57, 0x17, 0x57, 0x17, 0x13, 0xc3, 0xd0, 0x6d, 0x37, 0xc7, 0x7d, 0x6d, 0xb5,
+    0x3f, 0xda, 0xfd, 0x07, 0x11, 0xd3, 0x31, 0x73, 0xc4, 0x1b, 0x00, 0x00,
+};
+
+// /static/analytics.html (20 octets)
+static const uint8_t ASSET_1[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+
+// /static/css/styles.css (3163 octets)
+static const uint8_t ASSET_2[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x1b, 0x5b, 0x8f, 0xa3, 0xbc,
+    0xf5, 0xaf, 0xb8, 0x5d, 0xad, 0x32, 0x69, 0x03, 0xcb, 0x25, 0xe4, 0x86, 0x46, 0xfa, 0xd4, 0xaa,
+    0xad, 0xbe, 0x87, 0x7d, 0xea, 0x45, 0xea, 0xa3, 0x03, 0x26, 0xd0, 0x21, 0x80, 0x80, 0x64, 0x32,
+    0x83, 0xf2, 0xdf, 0x7b, 0x7c, 0x81, 0x60, 0x63, 0x72, 0x9b, 0xdd, 0x28, 0x13, 0x63, 0x7c, 0x8e,
+    0x8f, 0x8f, 0xcf, 0xdd, 0xde, 0x4d, 0x99, 0xe7, 0x75, 0x63, 0x18, 0x45, 0x99, 0xec, 0x71, 0xf9,
+    0xb1, 0x41, 0xdf, 0xac, 0xf9, 0x62, 0x11, 0xac, 0xfc, 0xae, 0xcb, 0x48, 0x93, 0x5d, 0x5c, 0xd3,
+    0x17, 0xde, 0xca, 0x09, 0x70, 0xef, 0x45, 0x88, 0xcb, 0x37, 0xda, 0xef, 0xce, 0xad, 0x25, 0x05,
+    0xa8, 0x48, 0x90, 0x67, 0xa1, 0xc0, 0x82, 0x6d, 0xdb, 0x91, 0x3a, 0x3b, 0x3c, 0xf6, 0xd2, 0xf1,
+    0xbc, 0x39, 0x7d, 0x75, 0x08, 0x02, 0x52, 0x55, 0xb4, 0xcb, 0xda, 0xae, 0x57, 0x36, 0x74, 0xbd,
+    0xe3, 0x32, 0x4b, 0xb2, 0x1d, 0x74, 0x45, 0xdb, 0x6d, 0xe4, 0xd0, 0x51, 0x21, 0xce, 0x76, 0xa4,
+    0x84, 0x1e, 0x12, 0xcd, 0xe1, 0x1f, 0xf4, 0xb4, 0x88, 0xa2, 0x55, 0x84, 0xa3, 0x80, 0x0d, 0x61,
+    0x84, 0xd8, 0xc4, 0x59, 0xbb, 0x5b, 0x78, 0xde, 0x95, 0x98, 0xd2, 0xb0, 0x9e, 0x63, 0x77, 0xbb,
+    0x12, 0xcf, 0x1d, 0x14, 0x71, 0xc8, 0x2a, 0xb2, 0xda, 0x5e, 0x01, 0x3a, 0x5f, 0x7a, 0xde, 0x62,
+    0x4d, 0x69, 0x4a, 0x42, 0xb2, 0xc5, 0xa5, 0xf1, 0x9e, 0x84, 0x75, 0xbc, 0x41, 0x8e, 0x67, 0x15,
+    0x27, 0xe8, 0x8e, 0x09, 0x0e, 0x49, 0x09, 0x3f, 0x1c, 0xc9, 0x92, 0xf7, 0x6e, 0xf3, 0x92, 0xf6,
+    0x96, 0x38, 0x4c, 0x0e, 0xb0, 0x8c, 0x95, 0xe8, 0x3c, 0x19, 0x55, 0x8c, 0xc3, 0xfc, 0x7d, 0x83,
+    0x2c, 0x34, 0x2f, 0x4e, 0x68, 0x01, 0xdf, 0x72, 0xb7, 0xc5, 0x2f, 0xd6, 0x8c, 0x7d, 0x4c, 0xcb,
+    0x9b, 0xce, 0x2c, 0x64, 0x43, 0xb7, 0xab, 0xbe, 0xb2, 0xa7, 0x80, 0xa2, 0x2e, 0x71, 0x56, 0x25,
+    0x75, 0x92, 0x67, 0x1b, 0x84, 0xd3, 0x14, 0x59, 0xa6, 0x5b, 0x21, 0x82, 0x2b, 0x72, 0xfe, 0x53,
+    0x03, 0x9c, 0xdf, 0x25, 0xd0, 0x6f, 0xf9, 0x05, 0x0e, 0x43, 0xc6, 0x2b, 0xcb, 0x67, 0x73, 0x26,
+    0x9f, 0xec, 0x49, 0x10, 0x05, 0x5d, 0xe7, 0x6d, 0x1e, 0x7e, 0x34, 0x51, 0x9e, 0xd5, 0x46, 0x84,
+    0xf7, 0x49, 0x0a, 0x3c, 0x99, 0xfc, 0x93, 0xec, 0x72, 0x82, 0xfe, 0xfd, 0xfb, 0x64, 0xf6, 0x2f,
+    0x1c, 0xe7, 0x7b, 0x3c, 0xfb, 0x07, 0xc9, 0xc8, 0x11, 0xcf, 0xfe, 0x43, 0x4a, 0x60, 0x34, 0x9e,
+    0x55, 0x30, 0x33, 0xec, 0x59, 0x99, 0x44, 0x3e, 0x03, 0x04, 0xac, 0x64, 0x83, 0x6c, 0x58, 0x82,
+    0x9f, 0x26, 0x19, 0xe9, 0x38, 0x60, 0x9b, 0x9e, 0x1f, 0xe4, 0x69, 0x0e, 0x1b, 0x73, 0xc4, 0xe5,
+    0x0b, 0xdf, 0x83, 0xa9, 0xbf, 0xc5, 0xc1, 0xdb, 0xae, 0xcc, 0x0f, 0x59, 0x68, 0x88, 0xb7, 0xdf,
+    0x22, 0x2b, 0x9a, 0x47, 0x2b, 0x7f, 0x9f, 0x64, 0x17, 0x60, 0xcb, 0x3a, 0xc6, 0x67, 0xdc, 0xd4,
+    0xe4, 0x54, 0x1b, 0x21, 0x08, 0x48, 0x89, 0xf9, 0x62, 0xb3, 0x3c, 0x23, 0x2d, 0xda, 0x24, 0x8b,
+    0x81, 0x8c, 0xfa, 0x7c, 0x48, 0x9b, 0x34, 0xa9, 0x80, 0x92, 0xfa, 0x23, 0x25, 0x7c, 0xc8, 0x39,
+    0xb6, 0x67, 0xb1, 0x33, 0x8b, 0xdd, 0x59, 0x3c, 0x9f, 0xc5, 0xde, 0x2c, 0x5e, 0xf0, 0x55, 0xbe,
+    0x0b, 0xfc, 0x0b, 0xcb, 0x52, 0xa9, 0x75, 0xcf, 0xdb, 0x43, 0x5d, 0xe7, 0xd9, 0x2c, 0xc9, 0x8a,
+    0x43, 0x3d, 0xab, 0x48, 0x4a, 0x82, 0x5a, 0xe6, 0x8d, 0x98, 0xb0, 0xbf, 0xee, 0x96, 0x06, 0x13,
+    0x17, 0x05, 0x2c, 0x28, 0xab, 0x31, 0x60, 0x2d, 0x9b, 0x30, 0xa9, 0x8a, 0x94, 0x8a, 0x58, 0x94,
+    0x92, 0x93, 0x66, 0x65, 0xa6, 0x90, 0xa2, 0x46, 0x48, 0x11, 0xe7, 0x90, 0x24, 0x5a, 0x3a, 0x56,
+    0x89, 0x61, 0xad, 0xc2, 0x4c, 0x5b, 0x4e, 0xbc, 0xc7, 0x49, 0x4d, 0x7c, 0x79, 0x52, 0xfa, 0xc7,
+    0x08, 0x93, 0x12, 0x56, 0xc1, 0x38, 0x07, 0x43, 0x0f, 0xfb, 0xcc, 0x2f, 0xf2, 0x56, 0x6e, 0xa2,
+    0xe4, 0x44, 0x42, 0x5f, 0xa2, 0xcb, 0xff, 0x34, 0x92, 0x2c, 0x24, 0x27, 0xf6, 0x78, 0x36, 0xf7,
+    0xb0, 0x18, 0xb6, 0x28, 0x92, 0x01, 0x27, 0x52, 0xd6, 0xef, 0x73, 0xf1, 0x32, 0x52, 0x12, 0xd5,
+    0x23, 0x74, 0x77, 0x62, 0xe7, 0x50, 0x25, 0x18, 0x5f, 0xbc, 0xd0, 0x19, 0x85, 0x59, 0x18, 0xd4,
+    0x30, 0x33, 0x60, 0x3d, 0x7b, 0x50, 0x98, 0x00, 0x66, 0x26, 0xa5, 0x82, 0xb1, 0x93, 0x5f, 0xd8,
+    0xae, 0xfd, 0x86, 0x69, 0x49, 0x95, 0xa7, 0x49, 0xa8, 0xb2, 0x87, 0x2b, 0xf4, 0xf4, 0x6c, 0xa6,
+    0xf9, 0x2e, 0x6f, 0x39, 0x3d, 0xa7, 0x18, 0x5a, 0x7a, 0xd8, 0x83, 0x58, 0x50, 0x29, 0x48, 0xf4,
+    0x8a, 0x93, 0x4a, 0x21, 0x8a, 0x9d, 0xa6, 0x2f, 0xeb, 0xe6, 0xbc, 0x24, 0x7b, 0x5f, 0x15, 0xa8,
+    0x0b, 0x54, 0x86, 0x8f, 0x1d, 0xbb, 0x24, 0xd2, 0x91, 0x3c, 0x08, 0x1d, 0x52, 0x94, 0x26, 0x42,
+    0x61, 0xbb, 0xf5, 0x48, 0x04, 0x74, 0xa3, 0x10, 0x7e, 0x84, 0x4f, 0xb6, 0x03, 0x93, 0xf5, 0x99,
+    0xd5, 0x5a, 0x20, 0xaf, 0x5b, 0x30, 0xb5, 0x3d, 0x36, 0x1d, 0xd1, 0xb7, 0x25, 0x9c, 0x83, 0x97,
+    0x9e, 0xa9, 0x96, 0x12, 0xd4, 0xd1, 0xdc, 0x32, 0x8d, 0xe2, 0x91, 0x38, 0x64, 0x53, 0x0e, 0xb5,
+    0x26, 0x72, 0x4e, 0x67, 0xa1, 0x9a, 0xcc, 0x68, 0x6e, 0xa9, 0xd5, 0xa2, 0xde, 0xc4, 0xf9, 0x11,
+    0x44, 0xe2, 0xa6, 0xe8, 0x77, 0x7b, 0x3b, 0xc0, 0x61, 0x62, 0x10, 0xf8, 0x23, 0x01, 0x7e, 0x8d,
+    0x21, 0x11, 0xde, 0x49, 0xd6, 0x9e, 0x0b, 0xa6, 0x08, 0xfc, 0x1d, 0x90, 0x70, 0xe1, 0xa5, 0xa7,
+    0xf0, 0xb2, 0xce, 0x8b, 0x7b, 0xa4, 0x2e, 0x23, 0xf5, 0x7b, 0x5e, 0xbe, 0x81, 0x59, 0xc2, 0xf5,
+    0xa1, 0xba, 0xbd, 0x7b, 0x67, 0x13, 0x74, 0x2f, 0x09, 0x70, 0x9d, 0x77, 0x66, 0xc1, 0xee, 0x0b,
+    0xab, 0xad, 0xdb, 0x4e, 0xeb, 0xbb, 0x3f, 0xdc, 0x8a, 0x1e, 0x26, 0x33, 0xcf, 0xa8, 0x9d, 0x1b,
+    0x67, 0x28, 0xf7, 0xb0, 0x53, 0x5f, 0x76, 0x4a, 0x16, 0x15, 0x14, 0x65, 0x88, 0x84, 0x35, 0x8a,
+    0xae, 0xa2, 0xe5, 0x2e, 0xf9, 0x1a, 0x56, 0x31, 0xe2, 0x6c, 0x0a, 0xfb, 0xa2, 0x37, 0x06, 0xff,
+    0x3b, 0x54, 0x75, 0x12, 0x7d, 0xb4, 0x46, 0x68, 0x83, 0xaa, 0x02, 0x07, 0xc4, 0xd8, 0x02, 0x6b,
+    0x09, 0xc9, 0xb4, 0x3a, 0xa0, 0x68, 0x93, 0xc3, 0xf8, 0x21, 0xbc, 0x73, 0x9d, 0xd4, 0x29, 0x41,
+    0xb1, 0x2d, 0x6b, 0xf3, 0x8a, 0xca, 0xea, 0x98, 0x85, 0xd5, 0x28, 0xe7, 0xb7, 0x14, 0x83, 0xb7,
+    0x39, 0x14, 0x21, 0xae, 0x49, 0xd8, 0x48, 0x80, 0x5d, 0xc4, 0x30, 0xed, 0xab, 0x83, 0x65, 0xae,
+    0x61, 0x8a, 0x8e, 0x0a, 0xcc, 0x2c, 0xf2, 0x5d, 0x12, 0x51, 0x7d, 0x54, 0xd0, 0x01, 0x74, 0xef,
+    0x49, 0xf3, 0xa8, 0x3b, 0xe8, 0x04, 0x18, 0xa2, 0x0e, 0x26, 0xc4, 0xaa, 0xf0, 0x70, 0x70, 0xa9,
+    0x73, 0x2a, 0x9b, 0x77, 0x06, 0x35, 0xb4, 0x73, 0xdb, 0x3a, 0x6b, 0x9e, 0xc3, 0xce, 0x1f, 0x5b,
+    0x37, 0x7e, 0x28, 0x2b, 0x4a, 0x6e, 0x91, 0x27, 0x6c, 0xe7, 0x3a, 0x7e, 0x24, 0x4c, 0x66, 0x8d,
+    0x51, 0x33, 0x37, 0x90, 0x0a, 0xd1, 0x7f, 0xd5, 0x92, 0xc9, 0xeb, 0xf0, 0xc4, 0x3a, 0x06, 0xa6,
+    0x6c, 0x45, 0xc5, 0x05, 0x5e, 0x18, 0x09, 0x60, 0x6f, 0xf5, 0xd0, 0x5d, 0xf4, 0xf4, 0x90, 0x3d,
+    0x68, 0xf4, 0xf0, 0xb6, 0x79, 0x1e, 0xa3, 0xfb, 0xb2, 0xb3, 0x1b, 0xc4, 0x28, 0x2e, 0x70, 0x09,
+    0x6f, 0xae, 0x73, 0x6b, 0x4c, 0xee, 0x6e, 0x98, 0xf3, 0x76, 0x69, 0x37, 0x0c, 0xed, 0x25, 0x20,
+    0x9e, 0x8e, 0xa9, 0x06, 0xc7, 0x25, 0x8c, 0xe9, 0xa3, 0xc6, 0xb6, 0x07, 0x7a, 0x83, 0x92, 0x7e,
+    0x2e, 0x21, 0xe6, 0x14, 0x16, 0xe9, 0xb6, 0x51, 0x1b, 0xce, 0xd9, 0x66, 0x14, 0x63, 0x73, 0x7e,
+    0xb3, 0x02, 0xbc, 0x5a, 0x2e, 0xf8, 0x60, 0x91, 0x6b, 0x8c, 0xce, 0x23, 0xde, 0x4f, 0x35, 0x71,
+    0xae, 0x84, 0x60, 0x7c, 0xb6, 0xc8, 0x5b, 0x13, 0x6b, 0xcb, 0x07, 0x73, 0x8b, 0x78, 0xd3, 0xa4,
+    0x0e, 0xd7, 0x24, 0xf2, 0x9f, 0xd1, 0x49, 0xc2, 0xc0, 0x59, 0x38, 0x62, 0x49, 0x6c, 0x4b, 0x35,
+    0x83, 0xb8, 0xc9, 0xd0, 0xc5, 0xeb, 0x42, 0x06, 0x55, 0x7f, 0xd7, 0x13, 0x90, 0x1e, 0xe6, 0xfb,
+    0xa5, 0x4a, 0x6c, 0xc7, 0xfe, 0x62, 0x48, 0xa8, 0x6f, 0x50, 0x03, 0x09, 0xcb, 0x5c, 0x79, 0xcc,
+    0x74, 0x72, 0x27, 0x6a, 0x50, 0xec, 0xc7, 0x84, 0xbc, 0x5f, 0x6c, 0xe7, 0xae, 0x4c, 0x42, 0x9f,
+    0xfe, 0x31, 0x40, 0xd5, 0xa0, 0xab, 0x26, 0x06, 0x8f, 0x74, 0x41, 0xed, 0x4a, 0x52, 0x10, 0x5c,
+    0xbf, 0xe0, 0x43, 0x9d, 0x1b, 0x51, 0x52, 0xcf, 0x20, 0x14, 0xdd, 0xe3, 0xd3, 0x8b, 0x43, 0x7d,
+    0xc2, 0xcc, 0x8e, 0xca, 0xe9, 0xd4, 0xdf, 0xe1, 0xa2, 0x8d, 0x53, 0x75, 0x7e, 0x43, 0x4c, 0x1b,
+    0xe0, 0x32, 0x1c, 0x65, 0xda, 0x3d, 0x76, 0x4f, 0x0d, 0x60, 0x2f, 0x5e, 0xb1, 0x1d, 0xde, 0xf6,
+    0x4c, 0xfd, 0x7b, 0xdc, 0x02, 0x27, 0xab, 0x6f, 0xa2, 0xbc, 0x7e, 0xa8, 0xe0, 0x69, 0x42, 0x05,
+    0xc6, 0xda, 0xe7, 0x6d, 0xd4, 0x30, 0x4a, 0x96, 0x03, 0x3e, 0xaf, 0xe7, 0x44, 0xdb, 0x80, 0x4a,
+    0x50, 0x99, 0x45, 0x39, 0x8a, 0xdd, 0x66, 0xe0, 0x10, 0x47, 0x4d, 0x98, 0x36, 0x20, 0xe6, 0xc8,
+    0x8e, 0x38, 0x3d, 0x10, 0x8d, 0xfb, 0x96, 0x8c, 0xfb, 0x92, 0x19, 0xf7, 0xdd, 0xdd, 0xb6, 0x89,
+    0x0d, 0xbe, 0xd7, 0xa8, 0xb0, 0xc1, 0xf7, 0x5a, 0x06, 0x36, 0xf8, 0x3e, 0xc5, 0x3e, 0x9b, 0x05,
+    0xce, 0x48, 0xfa, 0x25, 0x31, 0xbb, 0x2e, 0x58, 0x1a, 0x09, 0xf7, 0xa9, 0x42, 0x45, 0x29, 0x1d,
+    0x1f, 0x27, 0x61, 0x48, 0x32, 0x41, 0xc5, 0x2f, 0x8b, 0xc6, 0xc6, 0xa3, 0xe8, 0xb1, 0xf4, 0x4d,
+    0xb2, 0x11, 0x7d, 0x62, 0x06, 0x59, 0x98, 0x43, 0x37, 0xfe, 0x0e, 0x6d, 0x51, 0x90, 0xe8, 0xb3,
+    0x97, 0x11, 0xc1, 0xc0, 0x29, 0x29, 0x6b, 0x09, 0x76, 0x64, 0x9f, 0xf9, 0x24, 0x0f, 0x84, 0x76,
+    0x1c, 0x80, 0x15, 0x60, 0x24, 0xeb, 0x70, 0x36, 0x43, 0x5c, 0xc5, 0xdb, 0x1c, 0x4c, 0x8e, 0xc1,
+    0xc6, 0x54, 0x5f, 0x32, 0x76, 0x73, 0xef, 0x5e, 0x63, 0xf7, 0xdb, 0x9e, 0x84, 0x09, 0x46, 0x2f,
+    0x00, 0xd5, 0x16, 0xb7, 0xd6, 0x14, 0x78, 0xda, 0x0c, 0x29, 0x1a, 0xa1, 0x01, 0xa6, 0x39, 0x83,
+    0xaa, 0x92, 0x0c, 0x22, 0x95, 0xca, 0xa0, 0x83, 0x9e, 0xa1, 0x3d, 0x4d, 0x3b, 0x4b, 0xad, 0x12,
+    0x2f, 0xb2, 0x73, 0x36, 0x01, 0xb7, 0xca, 0x92, 0x80, 0x3d, 0x14, 0x83, 0x5e, 0x11, 0xbc, 0x1b,
+    0x91, 0xa4, 0x12, 0x8a, 0x49, 0x04, 0xb5, 0x1e, 0x50, 0x4a, 0x7c, 0x3c, 0x11, 0x23, 0x0f, 0x2a,
+    0x79, 0x0c, 0x6b, 0x94, 0x97, 0x7b, 0x11, 0xf8, 0x51, 0xb6, 0xfc, 0xf7, 0xc5, 0x80, 0xec, 0x7d,
+    0x2a, 0x61, 0xa5, 0xf6, 0x53, 0xd9, 0x33, 0x7d, 0xce, 0x2d, 0x43, 0x15, 0x9a, 0xda, 0x82, 0x92,
+    0x98, 0x78, 0x43, 0xa0, 0x0d, 0xcb, 0x6f, 0x82, 0x38, 0x49, 0x43, 0x15, 0xde, 0xd2, 0x38, 0xe7,
+    0x31, 0x33, 0x2e, 0x61, 0x35, 0x33, 0x58, 0x24, 0x06, 0xeb, 0xc6, 0xf7, 0x82, 0xa7, 0x17, 0x73,
+    0x35, 0x87, 0xee, 0x4c, 0x6c, 0x1f, 0xb2, 0xb3, 0xb5, 0xd7, 0x40, 0x2f, 0x8a, 0xd8, 0x07, 0x65,
+    0xda, 0x7b, 0x1d, 0xf0, 0x92, 0x87, 0xc6, 0x18, 0x34, 0xfd, 0x52, 0xc2, 0xeb, 0xc2, 0x7d, 0x8b,
+    0x32, 0xfa, 0x52, 0x36, 0x2b, 0x09, 0x6c, 0x52, 0x72, 0x24, 0x5d, 0x72, 0x46, 0x3d, 0xd3, 0xd7,
+    0x74, 0xd4, 0xb1, 0xf4, 0x62, 0x0e, 0x88, 0x99, 0xd5, 0x68, 0xee, 0xaa, 0xec, 0x8d, 0xf9, 0x17,
+    0x21, 0xd2, 0x0f, 0x2b, 0x8a, 0x20, 0x20, 0xc5, 0x5b, 0xf0, 0x4a, 0x5f, 0x77, 0xde, 0x7d, 0xd7,
+    0x2d, 0x65, 0x93, 0xfb, 0x3c, 0x04, 0xc1, 0x50, 0xeb, 0x92, 0xac, 0xc8, 0x62, 0xf9, 0x7c, 0xd3,
+    0x2c, 0xbf, 0x2b, 0x88, 0x40, 0xa2, 0xd5, 0xab, 0x26, 0x7e, 0xd7, 0xac, 0x5a, 0xd2, 0x31, 0x6f,
+    0xfa, 0x85, 0x98, 0xa7, 0x5f, 0x0d, 0xb5, 0xfc, 0x1c, 0x9c, 0x5d, 0x52, 0x7f, 0x50, 0x6a, 0x8e,
+    0x49, 0x95, 0x6c, 0x93, 0x94, 0x3d, 0x71, 0xbf, 0x79, 0x2b, 0xed, 0x62, 0x8b, 0x14, 0xa5, 0xa9,
+    0xa6, 0xc3, 0x64, 0x4b, 0x98, 0x58, 0x3b, 0x25, 0x62, 0x70, 0x57, 0x78, 0xfd, 0x4a, 0x40, 0xd0,
+    0xda, 0x71, 0x56, 0x26, 0xea, 0xcc, 0xfa, 0xca, 0xe2, 0x3e, 0xe0, 0xd4, 0x15, 0x66, 0xd7, 0xb4,
+    0xf8, 0xdb, 0xc6, 0x02, 0x06, 0xd0, 0x42, 0x45, 0xd4, 0x1f, 0x1a, 0x31, 0x56, 0xc4, 0x94, 0x18,
+    0xec, 0x4c, 0x7d, 0x9c, 0x81, 0xb7, 0xe4, 0x2b, 0x67, 0x94, 0xff, 0x1d, 0x9c, 0xe5, 0xef, 0xd9,
+    0xe5, 0x4c, 0x02, 0x81, 0x81, 0x03, 0xfd, 0x0c, 0xab, 0x76, 0x65, 0x22, 0xb8, 0xd0, 0xc4, 0x06,
+    0x5f, 0x8e, 0x37, 0x1e, 0x09, 0x2e, 0x38, 0x31, 0x1a, 0x0f, 0xfc, 0xdb, 0x1b, 0xf9, 0x88, 0x4a,
+    0xbc, 0x27, 0x55, 0x7f, 0x41, 0x4d, 0x54, 0xe6, 0xfb, 0x66, 0xcc, 0x62, 0x53, 0x47, 0xd9, 0x13,
+    0x91, 0x73, 0x9d, 0x8f, 0x0c, 0xb5, 0x7a, 0xc3, 0xec, 0x33, 0x2d, 0x4e, 0x63, 0x3a, 0xb5, 0x51,
+    0x15, 0x49, 0x36, 0x3c, 0x3a, 0x18, 0xd1, 0xf5, 0x47, 0xa4, 0xb8, 0x5b, 0x9b, 0x3b, 0x88, 0x73,
+    0xfa, 0xc6, 0x5a, 0xa1, 0x03, 0x22, 0x9d, 0x9e, 0xce, 0xb3, 0x50, 0x4b, 0xe7, 0x80, 0x46, 0xc2,
+    0xa6, 0x3d, 0x2e, 0x1e, 0x30, 0xa5, 0x77, 0xb9, 0xe4, 0x7b, 0xc4, 0x7d, 0x18, 0xcd, 0x52, 0x42,
+    0x80, 0x9d, 0x01, 0x89, 0xf3, 0x34, 0x1c, 0xc9, 0xc1, 0x57, 0xd1, 0x3a, 0xc2, 0xb2, 0x55, 0xd1,
+    0xd1, 0x78, 0x81, 0x84, 0x55, 0xee, 0x80, 0x29, 0x87, 0x32, 0x7d, 0xf9, 0x63, 0x88, 0x6b, 0xbc,
+    0x61, 0x1d, 0x3f, 0xaa, 0xe3, 0xee, 0xcf, 0xa7, 0x7d, 0x3a, 0xfb, 0xee, 0xfe, 0x15, 0x9a, 0x88,
+    0x29, 0xdb, 0xeb, 0x04, 0xf0, 0x4d, 0x10, 0x47, 0x2e, 0x1e, 0x68, 0x02, 0xfb, 0x97, 0xfc, 0xf4,
+    0x3a, 0xb1, 0x58, 0x09, 0x9e, 0x7d, 0x27, 0x08, 0x20, 0xb3, 0xea, 0x75, 0x12, 0xd7, 0x75, 0xb1,
+    0xf9, 0xf1, 0xe3, 0xfd, 0xfd, 0xdd, 0x7c, 0x77, 0xcd, 0xbc, 0xdc, 0xfd, 0x00, 0xef, 0x60, 0x51,
+    0xdc, 0x93, 0xef, 0xee, 0xdf, 0x00, 0x75, 0x81, 0xeb, 0x18, 0x85, 0xaf, 0x93, 0x9f, 0xb6, 0x8d,
+    0xec, 0x55, 0xe0, 0x9a, 0xab, 0xc5, 0x02, 0xf0, 0x2c, 0x0d, 0xd7, 0xb4, 0xdd, 0x39, 0xfc, 0x2e,
+    0x2b, 0xde, 0x34, 0x96, 0xfc, 0x83, 0xc4, 0x13, 0x12, 0x2d, 0x44, 0x5b, 0xcb, 0xcf, 0xfd, 0x7c,
+    0x85, 0x1c, 0xef, 0x0b, 0xf0, 0xc6, 0xdc, 0x35, 0x96, 0x81, 0x6d, 0x2e, 0xbc, 0x25, 0xc0, 0xbb,
+    0x86, 0x6d, 0xba, 0x73, 0x17, 0x7e, 0xdd, 0x8a, 0x37, 0x0d, 0xf1, 0x41, 0xe2, 0x09, 0x89, 0x16,
+    0x62, 0x9f, 0xcf, 0xfd, 0x02, 0xfe, 0xda, 0xcf, 0xc3, 0xff, 0x04, 0x4a, 0xd6, 0xd6, 0x17, 0xe6,
+    0xf7, 0x16, 0xc6, 0x72, 0xf1, 0x85, 0xf9, 0x6d, 0x07, 0xad, 0x16, 0x81, 0x63, 0x3a, 0x36, 0x3d,
+    0xc5, 0x05, 0x98, 0xe5, 0x1a, 0x7e, 0xe6, 0x15, 0x6b, 0x19, 0x73, 0xfe, 0x41, 0xfc, 0x01, 0xf1,
+    0x06, 0xa2, 0x8d, 0xf9, 0xe7, 0xde, 0x59, 0x19, 0x0b, 0xef, 0x49, 0x50, 0x20, 0xd4, 0x06, 0xd0,
+    0x25, 0xdd, 0x34, 0xcf, 0x00, 0x1c, 0x73, 0xf8, 0xf1, 0x2a, 0xd6, 0x32, 0x3c, 0xfe, 0x41, 0xfc,
+    0x01, 0xf1, 0x06, 0xa2, 0x0d, 0x0f, 0x36, 0x6c, 0x01, 0x0e, 0xf7, 0xc9, 0x59, 0xd7, 0xc8, 0x71,
+    0x9e, 0x9a, 0xf5, 0xa7, 0xeb, 0xa0, 0x85, 0xfb, 0x1c, 0xc1, 0xde, 0xd2, 0xb0, 0x9f, 0x04, 0x35,
+    0xd6, 0x86, 0x43, 0x85, 0xcb, 0xb6, 0x3c, 0x80, 0x75, 0x0c, 0x73, 0xb5, 0x86, 0x01, 0x86, 0x53,
+    0xb1, 0x96, 0xe1, 0xf0, 0x0f, 0xe2, 0x0f, 0x88, 0x37, 0x10, 0x6d, 0x38, 0x9f, 0x3f, 0x17, 0x16,
+    0x5a, 0x3f, 0x0b, 0xeb, 0x7a, 0x68, 0xfe, 0x2c, 0x2c, 0x08, 0xd4, 0xc2, 0x7a, 0x0e, 0x76, 0x82,
+    0x68, 0xda, 0xf4, 0x3a, 0xf9, 0xee, 0xb8, 0xfc, 0xf6, 0x02, 0xef, 0x30, 0x84, 0xa7, 0x01, 0x53,
+    0x63, 0xce, 0x45, 0x57, 0x79, 0x48, 0xc9, 0xeb, 0x84, 0x1c, 0x49, 0x96, 0x87, 0xe1, 0xe4, 0x07,
+    0x37, 0x2a, 0xd4, 0xbe, 0x40, 0xeb, 0x8f, 0x97, 0xf8, 0x39, 0xcd, 0x03, 0xe6, 0xd3, 0x7b, 0x81,
+    0x19, 0xde, 0x82, 0x6d, 0x3e, 0xdc, 0x7b, 0xd0, 0xac, 0x73, 0x51, 0x6a, 0x0d, 0xbb, 0x1f, 0x34,
+    0x75, 0xde, 0x12, 0x02, 0x07, 0x47, 0x5c, 0x66, 0x50, 0x89, 0x11, 0xc9, 0x55, 0xcf, 0xb1, 0x56,
+    0x01, 0xc4, 0xf8, 0x2f, 0xc0, 0x33, 0x08, 0xf4, 0x7a, 0xe1, 0x1a, 0x75, 0x67, 0x1c, 0xc4, 0x08,
+    0xf3, 0xba, 0xad, 0x91, 0x39, 0xfd, 0x1a, 0x99, 0x73, 0xfd, 0x38, 0xad, 0x9f, 0x31, 0xb5, 0xee,
+    0xc9, 0xe9, 0xdc, 0x53, 0x1b, 0x81, 0xf5, 0xe3, 0x23, 0xfa, 0xd6, 0x1b, 0x86, 0x47, 0x32, 0x29,
+    0x5d, 0x1e, 0x74, 0xb3, 0xca, 0x24, 0x41, 0xdd, 0x5f, 0x6f, 0x92, 0xc0, 0x44, 0xfe, 0x73, 0xab,
+    0xf0, 0xd4, 0xc1, 0x0c, 0x62, 0x7d, 0x7a, 0x8e, 0x3c, 0x16, 0x62, 0x3b, 0x9e, 0x37, 0x6b, 0xbf,
+    0x90, 0x0a, 0xf6, 0x8b, 0x9c, 0x9c, 0x13, 0x2a, 0x77, 0x5d, 0xe8, 0x62, 0x8c, 0x33, 0x58, 0x1c,
+    0x47, 0xcf, 0x35, 0xde, 0x4b, 0x5c, 0x88, 0x68, 0x01, 0x17, 0x63, 0xe2, 0x26, 0x05, 0x1c, 0xfd,
+    0x9a, 0xcd, 0xc3, 0x84, 0x75, 0x25, 0x66, 0x0d, 0x65, 0xea, 0xaa, 0x6f, 0x64, 0xb5, 0x95, 0x51,
+    0x63, 0x08, 0xd6, 0x2f, 0x51, 0xce, 0x8c, 0x73, 0x7b, 0xd0, 0xdf, 0x74, 0x61, 0xf5, 0x89, 0x87,
+    0xd5, 0x0a, 0x06, 0x19, 0xae, 0xe9, 0x27, 0x3a, 0x82, 0x4a, 0xa0, 0x24, 0xc5, 0x45, 0x45, 0x98,
+    0x6a, 0xb1, 0x96, 0x82, 0x02, 0xd5, 0xb1, 0x8c, 0x05, 0x3a, 0x1a, 0xf9, 0x2e, 0x00, 0x4b, 0xfa,
+    0xfa, 0x67, 0xf0, 0x34, 0xb1, 0xba, 0x95, 0x32, 0x8e, 0x1d, 0x33, 0x0e, 0xae, 0xd2, 0x3c, 0x12,
+    0x75, 0x2b, 0x94, 0x87, 0x2a, 0xe5, 0xa1, 0x8e, 0xf2, 0x2f, 0x4c, 0x20, 0x0e, 0x46, 0xd4, 0x69,
+    0xca, 0x1b, 0x47, 0x15, 0x2d, 0x36, 0xc6, 0x33, 0x6e, 0xbe, 0x1a, 0xed, 0x1d, 0x06, 0x82, 0xcb,
+    0x20, 0xa6, 0x75, 0xd6, 0x46, 0x13, 0x34, 0xde, 0x53, 0xcb, 0xef, 0x10, 0x20, 0x76, 0xf3, 0x48,
+    0x73, 0xb2, 0x2a, 0x7a, 0xda, 0x7a, 0xa5, 0xfb, 0x2b, 0x2b, 0x5d, 0xfd, 0x6b, 0x6c, 0x32, 0x31,
+    0x3a, 0x55, 0x1c, 0xad, 0x98, 0x52, 0x94, 0x17, 0xe7, 0x11, 0x12, 0x90, 0xfd, 0xf4, 0xf9, 0x0a,
+    0x60, 0x57, 0x19, 0x71, 0x2d, 0x4d, 0xf5, 0x92, 0x5e, 0x44, 0x88, 0xf2, 0x07, 0x90, 0x03, 0x3c,
+    0xfd, 0xf6, 0x6b, 0x2b, 0x0c, 0xc3, 0xdd, 0xb5, 0x15, 0x31, 0x5e, 0x53, 0x0a, 0xb9, 0x5a, 0x01,
+    0x53, 0x7d, 0x89, 0x4b, 0x67, 0x2e, 0x09, 0xcb, 0xb3, 0xaa, 0xd1, 0xdb, 0x62, 0x83, 0x2a, 0x2d,
+    0xbf, 0x6f, 0xe2, 0xf5, 0x80, 0x79, 0xe9, 0xb3, 0xbd, 0x62, 0x74, 0x43, 0x8b, 0x1f, 0x3a, 0x9f,
+    0x1a, 0xd8, 0x89, 0x56, 0x4c, 0xdb, 0x99, 0xd9, 0x99, 0xd3, 0xe8, 0xc9, 0x8f, 0x72, 0xe6, 0xab,
+    0xc9, 0x18, 0x2f, 0x98, 0xee, 0x3d, 0xca, 0xd1, 0x56, 0x94, 0x5a, 0x24, 0x8f, 0x6e, 0x49, 0x5b,
+    0xd1, 0x67, 0x0c, 0x54, 0x6e, 0xe9, 0x29, 0xc4, 0xde, 0xab, 0x65, 0x6a, 0xd2, 0x79, 0xfd, 0x14,
+    0xa6, 0x25, 0x80, 0xf1, 0xf1, 0xf9, 0xd2, 0x54, 0x57, 0xc9, 0x51, 0x8b, 0xc0, 0xab, 0xe1, 0x39,
+    0x9c, 0x58, 0xb1, 0x72, 0x8f, 0x4f, 0xa9, 0x07, 0xea, 0x8b, 0x4c, 0x2d, 0x30, 0xbb, 0x38, 0xd3,
+    0x0c, 0x6f, 0x78, 0xe9, 0xb6, 0x86, 0x43, 0x84, 0xa4, 0x0a, 0xca, 0x84, 0xfb, 0x74, 0xad, 0x18,
+    0xf0, 0x61, 0x7b, 0xb0, 0x14, 0x8f, 0x9d, 0x32, 0x3d, 0xbe, 0xd7, 0xfa, 0x43, 0x99, 0x91, 0xb0,
+    0xf5, 0x66, 0x15, 0x65, 0x24, 0xf2, 0x90, 0xd8, 0x25, 0x66, 0x44, 0xfc, 0x46, 0x69, 0x33, 0xce,
+    0x25, 0x79, 0xe0, 0xb5, 0xc2, 0xfb, 0xd9, 0xdc, 0xe2, 0x70, 0x47, 0x1a, 0xf5, 0x92, 0xcc, 0x16,
+    0x82, 0xb7, 0xb7, 0x5e, 0x8d, 0x07, 0x4c, 0xfd, 0x4a, 0x73, 0xf8, 0xeb, 0xa8, 0x85, 0xff, 0xa5,
+    0xa7, 0xbf, 0xc3, 0x48, 0x4f, 0x42, 0x5b, 0x4f, 0xff, 0xf8, 0xed, 0x10, 0x39, 0x4e, 0xaa, 0x6b,
+    0x66, 0xe8, 0x7e, 0xbd, 0x17, 0x70, 0x85, 0xb3, 0x12, 0x13, 0x54, 0x7c, 0x0f, 0x35, 0x87, 0x24,
+    0xcc, 0x8c, 0xb6, 0xee, 0x53, 0x8a, 0x23, 0x1f, 0x89, 0x28, 0x68, 0xaa, 0x61, 0x50, 0x3e, 0x0c,
+    0xce, 0x53, 0xb8, 0x55, 0xbe, 0xbc, 0x47, 0xdc, 0x1e, 0x75, 0x8b, 0xe5, 0xbb, 0x33, 0x76, 0x08,
+    0x23, 0x5d, 0x46, 0x62, 0x48, 0xa8, 0xd4, 0x95, 0x79, 0x2a, 0x45, 0x81, 0x72, 0x3c, 0xe0, 0xfc,
+    0x3a, 0xdf, 0xdf, 0x27, 0xdc, 0x0c, 0x62, 0x12, 0xbc, 0xd1, 0x28, 0xe6, 0x8e, 0x90, 0x45, 0x03,
+    0x26, 0x62, 0x17, 0xdd, 0x5d, 0x44, 0xdd, 0x68, 0xce, 0xa6, 0xa1, 0x8c, 0x77, 0x5b, 0xda, 0xea,
+    0x6c, 0xdf, 0x05, 0xba, 0x77, 0x54, 0x88, 0x99, 0x56, 0x93, 0x2c, 0x14, 0xbe, 0x9e, 0x13, 0x90,
+    0xa4, 0x40, 0xb6, 0x11, 0x96, 0x79, 0x01, 0x16, 0x38, 0x6b, 0x74, 0x67, 0x39, 0xca, 0x18, 0x24,
+    0xae, 0x7f, 0x4b, 0xbc, 0xa7, 0xf3, 0xff, 0xf2, 0x4d, 0xf0, 0x71, 0x01, 0x32, 0x0f, 0x09, 0x6d,
+    0x20, 0xae, 0xae, 0x8f, 0xdb, 0x16, 0x95, 0xc6, 0xab, 0x11, 0x1a, 0x25, 0x91, 0x71, 0x8d, 0xe6,
+    0xb4, 0x23, 0x45, 0x6b, 0x78, 0x05, 0xae, 0x9f, 0xe7, 0xe2, 0x06, 0xad, 0x08, 0xd4, 0x95, 0x7c,
+    0xc3, 0x5e, 0x8a, 0xed, 0xb8, 0x77, 0xbb, 0xc8, 0x07, 0x1d, 0x88, 0xfe, 0x90, 0xec, 0x8b, 0xbc,
+    0xac, 0x71, 0x56, 0x9f, 0x21, 0xb5, 0x35, 0x68, 0x35, 0x14, 0x6c, 0x7a, 0x55, 0x61, 0x30, 0x55,
+    0x72, 0xe1, 0x79, 0x18, 0x54, 0x8c, 0x9b, 0x0e, 0x05, 0x93, 0x52, 0x8b, 0xe6, 0x11, 0x87, 0xce,
+    0x5d, 0x6b, 0xc8, 0xd6, 0x9c, 0x6a, 0x2f, 0x17, 0x2b, 0x7a, 0xaa, 0xbd, 0x11, 0xff, 0xb1, 0x45,
+    0xf9, 0x0f, 0x1d, 0x4b, 0x4b, 0x7b, 0x01, 0x7c, 0xa6, 0xbd, 0x08, 0x0d, 0xae, 0x29, 0x9b, 0x7d,
+    0x6b, 0x6f, 0xfa, 0xd2, 0x25, 0xca, 0xfc, 0x11, 0x77, 0xcf, 0x65, 0xb5, 0xb0, 0x06, 0x37, 0xe0,
+    0x47, 0x9c, 0x8e, 0xfe, 0x1a, 0xf8, 0x6d, 0x0f, 0x35, 0x76, 0x83, 0x7c, 0x70, 0xf3, 0xc1, 0x92,
+    0x63, 0x07, 0x97, 0x9d, 0x05, 0x2b, 0xf7, 0x96, 0x47, 0x69, 0xd3, 0x04, 0xb2, 0x63, 0xd1, 0xb3,
+    0x7a, 0x7b, 0xeb, 0xca, 0xf5, 0x81, 0x87, 0xee, 0x1a, 0xc8, 0x47, 0xb0, 0xd7, 0x06, 0xf6, 0xa2,
+    0xbe, 0x31, 0x22, 0x7b, 0x71, 0x99, 0xee, 0xb4, 0xd1, 0x93, 0x7d, 0x0e, 0x73, 0x6a, 0xd7, 0xae,
+    0x41, 0xfc, 0x1f, 0xde, 0xc9, 0x8f, 0x19, 0x38, 0x35, 0x00, 0x00,
+};
+
+// /static/index.html (1333 octets)
+static const uint8_t ASSET_3[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x58, 0x5b, 0x6f, 0xdb, 0x36,
+    0x14, 0x7e, 0xef, 0xaf, 0xe0, 0xf4, 0x3c, 0x49, 0xb9, 0xb4, 0x5d, 0x1a, 0xd8, 0x1e, 0x82, 0xa4,
+    0x05, 0x36, 0x64, 0x69, 0xb0, 0xb4, 0x08, 0xf6, 0x48, 0x53, 0xc7, 0x36, 0x53, 0x8a, 0x14, 0x48,
+    0xda, 0x4e, 0xfe, 0xfd, 0x0e, 0x6f, 0xb2, 0x22, 0xcb, 0x8b, 0xbd, 0x26, 0x80, 0x0d, 0x89, 0x3c,
+    0xe4, 0xb9, 0x9f, 0x8f, 0x87, 0x1a, 0xfd, 0x72, 0xf5, 0xf5, 0xf2, 0xdb, 0x3f, 0xb7, 0x9f, 0xc9,
+    0xc2, 0xd6, 0x62, 0xf2, 0x6e, 0xe4, 0x1e, 0x44, 0x50, 0x39, 0x1f, 0x67, 0x20, 0x33, 0x37, 0x01,
+    0xb4, 0xc2, 0x47, 0x0d, 0x96, 0x12, 0xb6, 0xa0, 0xda, 0x80, 0x1d, 0x67, 0xdf, 0xbf, 0x7d, 0xc9,
+    0xcf, 0xb2, 0x34, 0x2d, 0x69, 0x0d, 0xe3, 0x6c, 0xc5, 0x61, 0xdd, 0x28, 0x6d, 0x33, 0xc2, 0x94,
+    0xb4, 0x20, 0x71, 0xd9, 0x9a, 0x57, 0x76, 0x31, 0xae, 0x60, 0xc5, 0x19, 0xe4, 0x7e, 0xf0, 0x2b,
+    0xe1, 0x92, 0x5b, 0x4e, 0x45, 0x6e, 0x18, 0x15, 0x30, 0x3e, 0x2e, 0x8e, 0x1c, 0x1b, 0xcb, 0xad,
+    0x80, 0xc9, 0x17, 0xa1, 0x54, 0x45, 0x2e, 0x04, 0x68, 0x4b, 0xee, 0x9e, 0x8c, 0x85, 0x7a, 0x54,
+    0x06, 0xca, 0xbb, 0x91, 0xe0, 0xf2, 0x07, 0xd1, 0x20, 0xc6, 0x99, 0xb1, 0x4f, 0x02, 0xcc, 0x02,
+    0x00, 0x25, 0x2d, 0x34, 0xcc, 0xc6, 0x59, 0x69, 0x2c, 0xb5, 0x9c, 0x95, 0xcc, 0x98, 0x32, 0x50,
+    0x0b, 0x7c, 0xfd, 0x7d, 0x35, 0xfe, 0x74, 0x36, 0x3d, 0x65, 0x1f, 0xcf, 0xde, 0x67, 0x2f, 0x30,
+    0x58, 0x58, 0xdb, 0x98, 0xf3, 0xb2, 0x64, 0x95, 0x7c, 0xc0, 0xbd, 0x42, 0x2d, 0xab, 0x99, 0xa0,
+    0x1a, 0x0a, 0xa6, 0xea, 0x92, 0x3e, 0xd0, 0xc7, 0x52, 0xf0, 0xa9, 0x29, 0x67, 0x68, 0x57, 0x4e,
+    0xd7, 0x60, 0x54, 0x0d, 0xe5, 0xc7, 0xe2, 0x43, 0x71, 0xec, 0x45, 0x52, 0x21, 0x8a, 0x9a, 0x4b,
+    0x27, 0xf3, 0x95, 0x04, 0x51, 0xc9, 0x6b, 0x6a, 0xc1, 0x71, 0x2c, 0xdf, 0x17, 0xc7, 0x28, 0x27,
+    0xcd, 0x74, 0xe4, 0x94, 0x31, 0x32, 0x53, 0x55, 0x3d, 0xe1, 0xa3, 0xe2, 0x2b, 0xc2, 0x04, 0x35,
+    0x66, 0x9c, 0xd1, 0xa6, 0xc9, 0x5d, 0x0c, 0x28, 0x97, 0xa0, 0xdd, 0x52, 0x6a, 0x78, 0x05, 0x89,
+    0xea, 0xde, 0xa7, 0xd4, 0xcf, 0x77, 0xf6, 0xc4, 0xd9, 0xdc, 0x31, 0x0d, 0x9b, 0x78, 0x3d, 0x27,
+    0x46, 0xb3, 0x8d, 0x7b, 0x71, 0xa2, 0x14, 0x6a, 0xae, 0x0a, 0xb3, 0x9a, 0x67, 0x84, 0x0a, 0x0c,
+    0xf0, 0x35, 0x0e, 0xb3, 0xc4, 0xc2, 0xd1, 0x7c, 0xc6, 0x9c, 0x74, 0x23, 0x89, 0x7a, 0x9e, 0x38,
+    0x6d, 0x51, 0x16, 0x3e, 0x24, 0xdd, 0x92, 0x88, 0x53, 0x6e, 0xd7, 0x52, 0x78, 0xdf, 0xb5, 0x36,
+    0x30, 0xcb, 0x57, 0x90, 0x11, 0xa7, 0x7d, 0x2f, 0xcc, 0x5c, 0x56, 0xf0, 0x58, 0xb8, 0x44, 0xcd,
+    0x26, 0xa3, 0x76, 0xc3, 0x8c, 0x1a, 0x32, 0xa3, 0xb9, 0xa5, 0x6c, 0x81, 0xe1, 0xb1, 0xa0, 0x73,
+    0xd4, 0x10, 0x17, 0x94, 0x7c, 0x42, 0xae, 0xa8, 0x59, 0x4c, 0x15, 0xd5, 0xd5, 0xa8, 0xa4, 0x4e,
+    0x17, 0xc1, 0xbd, 0xac, 0x01, 0xde, 0x06, 0xa4, 0x51, 0xda, 0xec, 0xe2, 0xbe, 0xc6, 0x18, 0xe8,
+    0xc8, 0xf4, 0x2e, 0x2c, 0x7d, 0xce, 0x72, 0x48, 0x5f, 0xea, 0xdc, 0x10, 0x58, 0x62, 0x4e, 0x1e,
+    0x53, 0x80, 0xe9, 0x87, 0xa3, 0xf7, 0x03, 0xdc, 0xa7, 0x20, 0x44, 0x64, 0xee, 0x5d, 0x67, 0x5e,
+    0x54, 0x97, 0x4a, 0x2a, 0x9e, 0xf0, 0xa5, 0xe5, 0x3e, 0xfb, 0x78, 0x3c, 0x3b, 0xf9, 0x6d, 0x5a,
+    0x0d, 0x70, 0x77, 0xc5, 0x6b, 0x73, 0xcc, 0x4e, 0x48, 0x32, 0xd2, 0xe6, 0x3d, 0xbc, 0x62, 0x2d,
+    0x97, 0xf3, 0x9d, 0x6e, 0x61, 0x6a, 0xde, 0x3a, 0x25, 0xac, 0xec, 0xb2, 0x2c, 0x7d, 0x68, 0x4b,
+    0x8c, 0xf3, 0x70, 0xca, 0xcd, 0x94, 0xb2, 0xd0, 0xcf, 0x47, 0x09, 0x76, 0xad, 0xf4, 0x8f, 0xdc,
+    0x69, 0xb0, 0x34, 0x89, 0xc8, 0xab, 0x0d, 0x05, 0xd3, 0x80, 0x33, 0x6a, 0x95, 0x6e, 0x13, 0xb0,
+    0x9d, 0x21, 0x4a, 0x26, 0x3b, 0x43, 0xda, 0x99, 0x86, 0xca, 0x67, 0x9b, 0x2d, 0x3c, 0x62, 0x72,
+    0xdc, 0x84, 0x11, 0xf9, 0xea, 0x97, 0x8f, 0x4a, 0xb7, 0x6c, 0x93, 0xab, 0xe9, 0xe1, 0xab, 0xc7,
+    0x61, 0x1d, 0xd6, 0x53, 0x12, 0xe5, 0xde, 0xf3, 0x88, 0x73, 0x09, 0x25, 0x41, 0x27, 0x6a, 0x24,
+    0x74, 0x8a, 0xa9, 0x63, 0x59, 0x98, 0xcc, 0x3d, 0xb0, 0xf9, 0xad, 0xc7, 0x93, 0x4e, 0x7e, 0xe2,
+    0xe8, 0xdd, 0xa8, 0xf1, 0xba, 0xe2, 0x72, 0x9b, 0x2f, 0x9b, 0x0a, 0x73, 0x0e, 0xe3, 0x79, 0x8d,
+    0x23, 0x12, 0x47, 0xe7, 0xe4, 0xcf, 0x25, 0x8e, 0xa4, 0x5a, 0x8f, 0xca, 0x66, 0xa3, 0xe9, 0xb6,
+    0x10, 0x57, 0x45, 0x4a, 0x7a, 0xf7, 0x4d, 0x97, 0xd6, 0xaa, 0xe0, 0x04, 0x8c, 0xad, 0x46, 0x5c,
+    0xca, 0xa7, 0x56, 0xb6, 0xbe, 0xc3, 0x77, 0x82, 0x7f, 0xcc, 0x8f, 0xf9, 0xc2, 0x0e, 0x84, 0xd8,
+    0x3c, 0x49, 0xd6, 0xa9, 0xa8, 0xbf, 0x03, 0x8b, 0x51, 0x19, 0xd8, 0xf6, 0x02, 0xeb, 0xb1, 0x1b,
+    0x2d, 0xac, 0xb1, 0x80, 0x9d, 0xc0, 0xee, 0xc4, 0xe4, 0xe8, 0xe8, 0xdc, 0xff, 0xfa, 0x6e, 0x0e,
+    0x2a, 0xbb, 0x60, 0x81, 0xd7, 0xba, 0xe5, 0xe6, 0x33, 0x20, 0x57, 0x2b, 0xd0, 0xee, 0x88, 0xe9,
+    0xe3, 0x56, 0xa0, 0x32, 0x74, 0xde, 0x30, 0x85, 0x63, 0x30, 0xc8, 0x74, 0x9e, 0x37, 0x1a, 0x11,
+    0x54, 0x3f, 0x79, 0x64, 0xdb, 0x5d, 0xd5, 0x43, 0xbe, 0x4c, 0x8c, 0xe4, 0x2c, 0xc0, 0xdb, 0xe9,
+    0xe4, 0xc2, 0x83, 0xd3, 0x06, 0x01, 0x70, 0x6a, 0x68, 0xc7, 0x8a, 0x8a, 0x65, 0xf4, 0x40, 0x80,
+    0xb3, 0x3c, 0xc2, 0x0b, 0x66, 0xce, 0xd2, 0xe5, 0xcd, 0x96, 0x0f, 0x76, 0xc9, 0x7e, 0xd9, 0x3c,
+    0xb3, 0x64, 0x0c, 0xc2, 0xc1, 0xb0, 0x5d, 0xf8, 0xc0, 0x7e, 0xe4, 0x8c, 0x6b, 0x26, 0xe0, 0x10,
+    0x2b, 0x6f, 0x94, 0xae, 0xa9, 0x20, 0x77, 0x9e, 0xb0, 0x8f, 0x91, 0xd2, 0x6f, 0x78, 0x03, 0xe3,
+    0xd6, 0x54, 0x4b, 0x44, 0x95, 0x21, 0xe3, 0xe0, 0x11, 0xc7, 0x78, 0x34, 0x62, 0xc2, 0xe4, 0x56,
+    0x73, 0x6c, 0x5c, 0x0e, 0x33, 0xf2, 0x3e, 0xb0, 0xde, 0xcb, 0xbe, 0xa8, 0xc6, 0x1b, 0x18, 0x58,
+    0xa1, 0xde, 0xf1, 0xd4, 0xed, 0xd9, 0xa7, 0x69, 0xc5, 0xbd, 0x75, 0x07, 0xe5, 0x67, 0x3c, 0x3d,
+    0xf6, 0xc8, 0x4b, 0xb7, 0xf2, 0x05, 0x83, 0xca, 0x58, 0x90, 0xcf, 0x79, 0x55, 0x09, 0xb3, 0x72,
+    0x04, 0x4d, 0x10, 0xa6, 0x67, 0xa0, 0x9f, 0x1c, 0x9a, 0xeb, 0x80, 0x22, 0x36, 0x06, 0x7b, 0x9c,
+    0xb0, 0x9b, 0x04, 0x3c, 0x19, 0x62, 0xb7, 0x0d, 0x71, 0x1b, 0x44, 0xf3, 0xfe, 0x0d, 0x86, 0xc2,
+    0x23, 0x2e, 0xaf, 0x52, 0x01, 0x66, 0xc4, 0xc3, 0xef, 0x38, 0xfb, 0xec, 0xa7, 0x53, 0x25, 0x0f,
+    0xe0, 0x5e, 0xd8, 0x17, 0x14, 0xea, 0xa0, 0xdd, 0xce, 0x90, 0x07, 0xa5, 0x5c, 0x4f, 0xd6, 0x3d,
+    0xb3, 0x36, 0x75, 0x9f, 0xba, 0xb2, 0x36, 0x24, 0x91, 0x32, 0xd7, 0xbc, 0x9f, 0x23, 0x42, 0x61,
+    0xec, 0x31, 0xdd, 0x4c, 0xc3, 0xa5, 0x1c, 0xce, 0x8e, 0x48, 0x4a, 0xaf, 0x29, 0x47, 0xfc, 0x39,
+    0x76, 0x1d, 0xb6, 0x93, 0xd4, 0xd2, 0x14, 0xc5, 0xae, 0x03, 0xee, 0x3f, 0x6d, 0xf9, 0x1f, 0x31,
+    0x0c, 0x9d, 0x86, 0xef, 0x31, 0x7d, 0x1c, 0xef, 0x5d, 0x4c, 0xc9, 0x35, 0xac, 0x30, 0x4d, 0x5e,
+    0x27, 0x8c, 0x5e, 0x42, 0x3f, 0x88, 0x97, 0x7e, 0xf2, 0x2d, 0x42, 0x98, 0x8e, 0x75, 0x6f, 0xd7,
+    0xb3, 0xce, 0x9a, 0x51, 0xb9, 0x42, 0x29, 0x01, 0x1d, 0x5c, 0xd3, 0x29, 0x9c, 0x95, 0x51, 0x3f,
+    0x94, 0x16, 0xe8, 0x6f, 0xef, 0x72, 0x83, 0x87, 0xe3, 0xa6, 0x6e, 0xfc, 0x71, 0xfb, 0xbc, 0x6e,
+    0x0e, 0x30, 0x33, 0x9e, 0xd6, 0x0e, 0x2c, 0xcc, 0x00, 0x6c, 0xe5, 0x1c, 0xa9, 0x59, 0x6a, 0xaa,
+    0xba, 0x04, 0x41, 0xa7, 0x4e, 0xf9, 0x2b, 0x7f, 0xdf, 0x23, 0x37, 0x78, 0x2b, 0x3c, 0x6f, 0x53,
+    0x6e, 0x6b, 0x71, 0x07, 0x84, 0xe2, 0x05, 0xd1, 0x5d, 0x23, 0xb3, 0x49, 0xde, 0xcf, 0xd2, 0x43,
+    0xc5, 0xff, 0x75, 0x71, 0x49, 0x2e, 0xaa, 0x0a, 0xdb, 0x13, 0x73, 0x90, 0xf8, 0x9a, 0xb2, 0x57,
+    0x90, 0x7e, 0x71, 0x4b, 0xfe, 0xb8, 0x3d, 0x4c, 0x3e, 0x6d, 0x72, 0xde, 0xbc, 0x82, 0xe8, 0x7b,
+    0xfe, 0x85, 0xc7, 0xa0, 0xef, 0x27, 0x78, 0xcd, 0x67, 0xbc, 0x6d, 0xb0, 0x7f, 0x5a, 0xfc, 0xf7,
+    0xc6, 0xf5, 0x77, 0xfb, 0x49, 0x8e, 0x29, 0xb6, 0x6c, 0x42, 0x4b, 0xf8, 0xd3, 0xb2, 0x2f, 0x15,
+    0xc2, 0x20, 0xc3, 0xce, 0x98, 0xdc, 0x02, 0xe8, 0x3d, 0xcd, 0x67, 0x69, 0x53, 0xde, 0xb8, 0x4d,
+    0x03, 0x6a, 0x0c, 0x3f, 0x5c, 0xef, 0xff, 0x5c, 0x55, 0xc7, 0xad, 0x56, 0x95, 0xef, 0x7d, 0xfa,
+    0x00, 0xef, 0xe7, 0x7b, 0x65, 0xb4, 0x59, 0x1b, 0xaf, 0x0f, 0x5b, 0xb4, 0x6e, 0xb5, 0x77, 0xd8,
+    0xc7, 0x4b, 0x43, 0x3c, 0x18, 0xaf, 0x00, 0x65, 0xb5, 0x90, 0xda, 0x69, 0xf0, 0x23, 0x7f, 0xa1,
+    0x0c, 0x64, 0xdb, 0x38, 0x1a, 0x51, 0xf3, 0xd2, 0x93, 0x07, 0x6e, 0xd0, 0x18, 0x12, 0xb3, 0x0b,
+    0x2d, 0xb7, 0x14, 0xf5, 0xf8, 0xd1, 0x11, 0x9a, 0xf0, 0x64, 0xd0, 0x75, 0x86, 0x69, 0xde, 0xd8,
+    0xf0, 0x55, 0x61, 0xcf, 0x4f, 0x21, 0x1e, 0x49, 0x8b, 0x07, 0x53, 0x9e, 0x16, 0x9f, 0xdc, 0xf7,
+    0x16, 0x3f, 0x74, 0x5f, 0x41, 0x1e, 0xbc, 0x8e, 0x81, 0x63, 0x8f, 0x75, 0xba, 0xb6, 0xe2, 0xae,
+    0xb6, 0x4b, 0xe9, 0xaf, 0x2f, 0xe3, 0x67, 0x93, 0xd2, 0x7f, 0xf7, 0xfa, 0x17, 0x80, 0xab, 0x96,
+    0x4f, 0x07, 0x13, 0x00, 0x00,
+};
+
+// /static/js/alerts.js (3402 octets)
+static const uint8_t ASSET_4[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x1a, 0x6b, 0x6f, 0x1b, 0x39,
+    0xee, 0xbb, 0x7f, 0x85, 0x36, 0x28, 0xea, 0xf1, 0xd5, 0x9e, 0xbc, 0x9a, 0x5c, 0xd7, 0x79, 0x2c,
+    0xd2, 0x24, 0xc5, 0xf6, 0xd0, 0x17, 0x9a, 0xec, 0x16, 0x87, 0xa2, 0xd8, 0x28, 0x33, 0xb2, 0x3d,
+    0xd7, 0xf1, 0x8c, 0x6f, 0x46, 0x4e, 0x1a, 0x04, 0xfe, 0x4f, 0xf7, 0x1b, 0xee, 0x97, 0x1d, 0xa9,
+    0xb7, 0xe6, 0x15, 0xa7, 0x5b, 0x1c, 0x76, 0x8b, 0x45, 0x3c, 0x12, 0x49, 0x51, 0x24, 0x45, 0x52,
+    0x14, 0xa3, 0x3c, 0x2b, 0x39, 0x29, 0xd8, 0xa4, 0x60, 0xe5, 0xec, 0x25, 0xcf, 0xc8, 0x11, 0x89,
+    0xf3, 0x68, 0x39, 0x67, 0x19, 0x0f, 0xa7, 0x8c, 0x9f, 0xa7, 0x0c, 0x7f, 0xbe, 0xbc, 0x7b, 0x1d,
+    0x07, 0x7d, 0x05, 0x35, 0xba, 0xe6, 0x59, 0x7f, 0x70, 0xd0, 0x8b, 0x04, 0x6a, 0x4a, 0x4b, 0xfe,
+    0xdb, 0x22, 0xa6, 0x9c, 0xc5, 0xe7, 0x69, 0x17, 0x36, 0x02, 0x8e, 0x96, 0x12, 0xd2, 0xa2, 0x67,
+    0x8c, 0xdf, 0xe6, 0xc5, 0xd7, 0xd7, 0x59, 0x9c, 0x44, 0x94, 0xe7, 0x45, 0x17, 0x05, 0x05, 0x3b,
+    0x4a, 0x34, 0x70, 0x8d, 0xcc, 0x25, 0xfb, 0xc6, 0xd7, 0xa1, 0xc0, 0x01, 0xce, 0x22, 0x97, 0x77,
+    0x25, 0x67, 0xf3, 0xcb, 0x64, 0xce, 0xba, 0x77, 0x20, 0xe1, 0x46, 0x1c, 0x00, 0x2d, 0x32, 0x8d,
+    0x78, 0x72, 0xc3, 0x4e, 0x52, 0x56, 0xf0, 0xf2, 0x34, 0xcf, 0x38, 0x4d, 0x32, 0xd6, 0xb9, 0x0b,
+    0x89, 0x30, 0xa2, 0x02, 0x63, 0x14, 0x69, 0x14, 0x67, 0x2f, 0xf9, 0x89, 0x43, 0xb3, 0x73, 0x3b,
+    0xf9, 0xc8, 0xa3, 0xe6, 0x70, 0x25, 0xbe, 0x7f, 0x4d, 0x4a, 0x90, 0xd2, 0xdd, 0xcb, 0x3c, 0xbe,
+    0xeb, 0xe4, 0x48, 0xb2, 0x32, 0x93, 0xd0, 0xa3, 0x6b, 0x00, 0xaf, 0x50, 0x7a, 0x95, 0xa4, 0xfc,
+    0x81, 0x5d, 0x21, 0xd8, 0x68, 0x22, 0xe0, 0x2c, 0x32, 0x67, 0x25, 0x17, 0xdb, 0x78, 0xc0, 0xb2,
+    0x10, 0x4e, 0xee, 0xc1, 0x37, 0xae, 0x92, 0x2a, 0x31, 0x5c, 0x30, 0xce, 0x93, 0x6c, 0x5a, 0x3e,
+    0x40, 0x07, 0xe1, 0x15, 0x9d, 0x52, 0x61, 0x58, 0x62, 0x60, 0xbb, 0x8c, 0x3f, 0x86, 0x9a, 0x40,
+    0x68, 0x25, 0x77, 0x4b, 0x8b, 0x0c, 0x46, 0x2e, 0x67, 0x78, 0x26, 0xf2, 0x34, 0xee, 0xa2, 0xa4,
+    0x60, 0x47, 0x5c, 0x03, 0x5b, 0x32, 0x51, 0x91, 0x70, 0xb0, 0xe6, 0x74, 0x2d, 0x3a, 0x1a, 0xb8,
+    0x89, 0x10, 0x98, 0xe6, 0xe2, 0x93, 0x5c, 0xa7, 0x5b, 0xd4, 0xf3, 0xc5, 0x48, 0xf1, 0x63, 0x91,
+    0x59, 0x46, 0xaf, 0x53, 0x76, 0x91, 0x2f, 0xb3, 0xce, 0xf5, 0x25, 0xd8, 0xa8, 0x44, 0xb8, 0x2a,
+    0xf2, 0xef, 0x49, 0xb9, 0xa4, 0xe9, 0x1a, 0xd8, 0x37, 0x02, 0xb0, 0x8a, 0x7e, 0x3e, 0xa7, 0xc9,
+    0x3a, 0xd8, 0x0c, 0xe1, 0x1c, 0x64, 0xfc, 0x3c, 0x89, 0x63, 0x10, 0x47, 0xe7, 0x51, 0x11, 0x70,
+    0x23, 0x2a, 0x01, 0x11, 0x3d, 0x65, 0xca, 0xb6, 0xb5, 0x31, 0x00, 0xf6, 0x7d, 0xaf, 0xaa, 0xd4,
+    0x31, 0xd9, 0xdb, 0x1a, 0xf6, 0x6a, 0x3a, 0x1a, 0x93, 0xbf, 0xef, 0x0d, 0x7b, 0x8e, 0xc4, 0xc7,
+    0x64, 0x17, 0x06, 0x1c, 0x29, 0x8e, 0x09, 0x2f, 0x96, 0x4c, 0x0f, 0x49, 0xd9, 0xf8, 0x63, 0x62,
+    0xc3, 0x63, 0x32, 0xa1, 0x69, 0x89, 0x63, 0xce, 0x3e, 0xc6, 0xa4, 0xdf, 0xef, 0xad, 0x14, 0x8b,
+    0xbe, 0x2b, 0xf8, 0xdc, 0xbb, 0xef, 0x25, 0x40, 0x7c, 0x1b, 0x56, 0x4f, 0x78, 0xca, 0x00, 0xf4,
+    0x54, 0x31, 0x47, 0x3e, 0x51, 0x3c, 0xa3, 0x6f, 0xd8, 0x0d, 0x4b, 0xfb, 0xc3, 0x5e, 0xcc, 0x4a,
+    0x60, 0x7b, 0xc1, 0x93, 0x3c, 0x03, 0xa0, 0x0b, 0x96, 0x95, 0xe0, 0x5c, 0x77, 0xc8, 0x8c, 0x96,
+    0x70, 0x10, 0x16, 0x79, 0x01, 0x5e, 0x98, 0x50, 0x63, 0x7d, 0x60, 0xcd, 0x88, 0x9c, 0x22, 0x32,
+    0xc9, 0x27, 0xe4, 0xc5, 0x5e, 0xb8, 0x47, 0xa2, 0x79, 0x08, 0x84, 0xf8, 0xdd, 0x02, 0x97, 0xd1,
+    0x90, 0x30, 0x02, 0xea, 0x2f, 0x22, 0xe6, 0x50, 0x35, 0x63, 0x6f, 0x69, 0x04, 0xc3, 0x27, 0x27,
+    0xe3, 0x97, 0x2f, 0xc7, 0xa7, 0xa7, 0xe3, 0xb3, 0xb3, 0xf1, 0xf9, 0xf9, 0xf8, 0xd5, 0x2b, 0xa4,
+    0x02, 0x4e, 0xb3, 0xe4, 0x74, 0xbe, 0x18, 0x93, 0x33, 0x58, 0x2a, 0xcc, 0xf2, 0xdb, 0x60, 0x40,
+    0x46, 0x64, 0x77, 0x0b, 0xff, 0x1b, 0x92, 0xcd, 0x4d, 0xb2, 0x47, 0xe6, 0x49, 0xb6, 0x04, 0x57,
+    0x40, 0xe8, 0x34, 0xef, 0xdd, 0xd0, 0x74, 0x09, 0x6b, 0x20, 0x23, 0xc3, 0x1e, 0x8d, 0xbe, 0x02,
+    0x42, 0xca, 0xe2, 0x29, 0x8b, 0x95, 0xc8, 0x7a, 0xab, 0xa1, 0x92, 0xc5, 0x8e, 0x95, 0x85, 0xd1,
+    0xc6, 0xc7, 0xa4, 0xc4, 0x73, 0xb0, 0x86, 0x48, 0x76, 0xab, 0x22, 0x29, 0x24, 0xaa, 0x23, 0x90,
+    0x21, 0x89, 0x96, 0x45, 0x01, 0xa6, 0x94, 0xde, 0x11, 0xca, 0xc9, 0xfe, 0x5e, 0xb8, 0xe3, 0xcb,
+    0x46, 0x1f, 0xa7, 0xba, 0x68, 0x76, 0xbb, 0x45, 0xb3, 0xbb, 0xdb, 0x21, 0x9a, 0x9f, 0xad, 0x68,
+    0xb6, 0x1b, 0x65, 0x83, 0x8c, 0xb4, 0xc8, 0xa6, 0xf7, 0xc5, 0xb1, 0x70, 0x15, 0x06, 0x1c, 0xf3,
+    0xd9, 0x7d, 0xa4, 0xf9, 0x9c, 0x36, 0x99, 0x49, 0xa0, 0x8c, 0x64, 0xb0, 0xbe, 0x91, 0x70, 0x5a,
+    0x70, 0x8c, 0xb3, 0x8d, 0x46, 0xa0, 0xac, 0x60, 0xcb, 0xdb, 0x2a, 0xcb, 0xe2, 0x06, 0x84, 0x9d,
+    0x6d, 0x8b, 0xb0, 0xeb, 0xcb, 0x26, 0x5e, 0x16, 0x54, 0x72, 0xdd, 0x28, 0x3f, 0xe4, 0x81, 0x2f,
+    0xf1, 0x88, 0xc1, 0x49, 0xcb, 0xd3, 0x1b, 0xc8, 0x45, 0xac, 0x25, 0x3d, 0xff, 0x3e, 0x4b, 0xfa,
+    0x58, 0xb3, 0x18, 0x12, 0x28, 0x23, 0x19, 0xac, 0x6d, 0x24, 0x2d, 0xa2, 0xd9, 0x79, 0x6e, 0x77,
+    0xf1, 0x7c, 0x1d, 0xd1, 0x6c, 0xef, 0x58, 0x84, 0x9d, 0xad, 0x16, 0xd1, 0x34, 0x03, 0x75, 0xca,
+    0x66, 0xcf, 0xca, 0xe6, 0x12, 0xfc, 0x1e, 0x03, 0x52, 0xcb, 0x82, 0x91, 0x4f, 0x66, 0x57, 0xbe,
+    0x4c, 0x5c, 0x98, 0x72, 0x91, 0x7c, 0x65, 0x24, 0xd8, 0x7d, 0x11, 0xee, 0xfd, 0xf7, 0x3f, 0xa7,
+    0x6b, 0x89, 0x64, 0xbb, 0x43, 0x24, 0xdb, 0x2f, 0x1c, 0xe5, 0xaf, 0x23, 0x92, 0xf6, 0x83, 0xf4,
+    0x67, 0x8c, 0x65, 0xff, 0x87, 0x9c, 0xa1, 0x9f, 0xb7, 0xaa, 0x76, 0xd2, 0x71, 0x86, 0x9e, 0x77,
+    0x48, 0xe5, 0xc5, 0xbe, 0xb4, 0x14, 0x14, 0xd0, 0x96, 0x23, 0xa1, 0x7f, 0x82, 0x6f, 0x61, 0x45,
+    0x4c, 0xef, 0xc8, 0x33, 0xf4, 0x75, 0x40, 0xb1, 0x6c, 0x11, 0x93, 0xa6, 0x20, 0xad, 0xe2, 0xb9,
+    0x84, 0xad, 0x1a, 0x8e, 0x4b, 0x5a, 0x93, 0x6b, 0x92, 0x12, 0x3a, 0xa0, 0xc9, 0x32, 0x8b, 0x10,
+    0x8d, 0x24, 0x59, 0x22, 0x13, 0xaf, 0xf2, 0x03, 0x9d, 0x32, 0x58, 0xec, 0xbe, 0x67, 0x6f, 0x1c,
+    0x21, 0x04, 0xe5, 0xf3, 0x1b, 0xf0, 0xae, 0x6f, 0xc0, 0x4d, 0x31, 0xc8, 0x84, 0x21, 0xcd, 0x49,
+    0x93, 0xe8, 0x6b, 0x7f, 0x48, 0x26, 0x8c, 0x47, 0x33, 0x81, 0x08, 0x8c, 0x52, 0x08, 0xda, 0x4e,
+    0x32, 0xda, 0x84, 0x36, 0xa3, 0xd9, 0x94, 0x21, 0x9e, 0x80, 0x38, 0x71, 0x7c, 0x1f, 0xe0, 0xba,
+    0xb9, 0x68, 0xc7, 0x9a, 0x51, 0xc1, 0x40, 0x28, 0x97, 0x1a, 0x18, 0x10, 0x9b, 0x92, 0xd0, 0x0e,
+    0x02, 0x08, 0xae, 0x21, 0x01, 0xbb, 0x31, 0xeb, 0xec, 0x40, 0x17, 0xf0, 0x0e, 0x3e, 0x7c, 0xbd,
+    0xce, 0x60, 0x37, 0xe0, 0xf3, 0x03, 0x79, 0x7b, 0x42, 0xd5, 0x0d, 0x09, 0x7a, 0x40, 0x4c, 0x63,
+    0x72, 0x1a, 0x6b, 0xe8, 0x00, 0xbe, 0x7d, 0x91, 0xe1, 0x48, 0xb9, 0xbc, 0x46, 0x33, 0xbc, 0x66,
+    0x97, 0xb9, 0x58, 0x52, 0x80, 0xb9, 0x54, 0x41, 0x1f, 0x47, 0xc7, 0xa0, 0x92, 0x64, 0x42, 0x82,
+    0x9f, 0x98, 0x00, 0x81, 0x8b, 0x4c, 0xc6, 0x22, 0x88, 0x87, 0x03, 0x52, 0x27, 0xb8, 0x1a, 0x4a,
+    0x87, 0x0d, 0x3f, 0x4d, 0xba, 0xd5, 0xa1, 0x43, 0x65, 0x04, 0x01, 0x1b, 0xa8, 0x35, 0x58, 0x08,
+    0x26, 0x0c, 0xf9, 0x59, 0x18, 0xa5, 0x79, 0x09, 0x72, 0x0e, 0xfa, 0xa1, 0x48, 0xfa, 0xc9, 0xd3,
+    0xa7, 0xa4, 0x6d, 0x2e, 0x4c, 0x80, 0xa1, 0xe2, 0xd7, 0xcb, 0xb7, 0x6f, 0xe0, 0x57, 0x94, 0x2e,
+    0xe1, 0x68, 0x05, 0xfd, 0x13, 0x1b, 0xf9, 0xfa, 0x03, 0xa4, 0xee, 0xdc, 0x58, 0x4e, 0x69, 0x81,
+    0x99, 0x6c, 0x03, 0x3d, 0x99, 0xcf, 0x47, 0x30, 0x8f, 0x69, 0x20, 0x32, 0x64, 0x10, 0x2a, 0x34,
+    0x5e, 0x23, 0x85, 0x05, 0x2d, 0x4a, 0x06, 0xb2, 0xb2, 0x50, 0x98, 0x5b, 0x9e, 0x70, 0x0e, 0x22,
+    0x05, 0x1f, 0x11, 0xf4, 0x41, 0x25, 0x74, 0x94, 0x00, 0x31, 0xb4, 0x4f, 0xcb, 0x91, 0x10, 0x59,
+    0xa0, 0xe8, 0xa0, 0xd4, 0xe0, 0xdf, 0x0f, 0xdd, 0xfd, 0x59, 0x52, 0xce, 0x13, 0xcc, 0x65, 0xff,
+    0x12, 0x3b, 0x8f, 0x25, 0x37, 0x4d, 0xbb, 0x5e, 0x89, 0xbf, 0x98, 0x8d, 0x54, 0x8c, 0x0b, 0xd6,
+    0x10, 0xe9, 0x8a, 0xb9, 0xed, 0x09, 0x2f, 0x77, 0x0a, 0x26, 0x3e, 0xcd, 0x8b, 0x84, 0x89, 0x8c,
+    0x7c, 0xe5, 0xb8, 0x91, 0x06, 0x4b, 0xd6, 0x66, 0x1b, 0xf4, 0xc5, 0xc8, 0x85, 0x70, 0x98, 0x7d,
+    0x70, 0x38, 0xe4, 0x36, 0xc9, 0xe2, 0xfc, 0x16, 0x84, 0x53, 0x30, 0x08, 0x42, 0x99, 0xb9, 0x2f,
+    0x08, 0x44, 0xa0, 0x9c, 0xb1, 0x5b, 0xe2, 0xe0, 0x04, 0xfd, 0x4d, 0xba, 0x48, 0x36, 0xe5, 0x34,
+    0x8a, 0x47, 0xfe, 0x6a, 0x30, 0xec, 0x7c, 0xc1, 0x32, 0xb0, 0x6b, 0x7d, 0x6a, 0xea, 0x7b, 0xc2,
+    0x24, 0xff, 0xa0, 0x27, 0xcf, 0xea, 0x3b, 0x59, 0x70, 0xb8, 0x10, 0x1e, 0x32, 0xc0, 0x19, 0x14,
+    0x46, 0x17, 0x79, 0x56, 0x14, 0x79, 0xd1, 0x49, 0x5f, 0xc9, 0xac, 0x93, 0x8a, 0x14, 0x25, 0x90,
+    0x11, 0x10, 0x92, 0x92, 0x2b, 0x64, 0x20, 0xf3, 0x8f, 0x8b, 0xf7, 0xef, 0x42, 0xa1, 0xe3, 0x40,
+    0x00, 0x85, 0xb1, 0xf4, 0xb1, 0x12, 0x6c, 0x51, 0xb0, 0x9b, 0x24, 0x5f, 0xa2, 0xa4, 0xaa, 0x6a,
+    0xf9, 0x2c, 0x07, 0xc2, 0x39, 0x8d, 0xbe, 0xa0, 0x27, 0x69, 0x9f, 0x35, 0xc8, 0x61, 0x24, 0xe7,
+    0xef, 0xa4, 0xd9, 0x19, 0xe2, 0x3f, 0x1d, 0x1d, 0x11, 0xb8, 0x2c, 0xb1, 0x49, 0x92, 0xc1, 0xd6,
+    0xe0, 0x04, 0x54, 0xc0, 0xc9, 0xb1, 0x61, 0xc4, 0x5a, 0x28, 0xc6, 0xc9, 0x3a, 0x65, 0x72, 0x7c,
+    0x04, 0xd7, 0x9b, 0x5f, 0x9c, 0xf8, 0x49, 0x9c, 0x0c, 0xc3, 0x31, 0x77, 0xed, 0x2d, 0x43, 0xe7,
+    0xb6, 0x36, 0x20, 0x8b, 0x94, 0xde, 0x49, 0x2f, 0x8d, 0xdf, 0x01, 0xae, 0x01, 0xb2, 0xc8, 0x72,
+    0x9e, 0x4c, 0xee, 0x7e, 0x2b, 0x41, 0xa4, 0x57, 0x4f, 0xee, 0xd5, 0x8a, 0x32, 0xdc, 0xad, 0xc6,
+    0xc4, 0x8c, 0x64, 0x74, 0xce, 0x56, 0x57, 0x43, 0x72, 0xf5, 0xc9, 0x09, 0xed, 0x66, 0x56, 0xc4,
+    0x7b, 0x91, 0x13, 0x84, 0x3c, 0x7f, 0x95, 0x7c, 0x63, 0x71, 0xb0, 0x3d, 0x58, 0x41, 0xd0, 0xbf,
+    0x6a, 0xf4, 0xd7, 0xfa, 0xc0, 0x18, 0xb3, 0xb7, 0x5e, 0x3f, 0xb0, 0x42, 0x00, 0x37, 0xa3, 0x8c,
+    0x18, 0x63, 0xb8, 0x70, 0xe9, 0x4e, 0x15, 0x2b, 0xc4, 0x02, 0x17, 0x56, 0xa3, 0x84, 0xf2, 0x11,
+    0x18, 0x96, 0x7e, 0x93, 0x83, 0x54, 0x04, 0x9d, 0x0b, 0x38, 0xc2, 0xd9, 0x34, 0xf0, 0x97, 0x99,
+    0xe4, 0xc5, 0x9c, 0x8a, 0xcc, 0xe2, 0x02, 0x9c, 0x0c, 0x0b, 0xcc, 0xb5, 0x64, 0xe0, 0xd8, 0x0e,
+    0xfc, 0x8d, 0xd1, 0x26, 0xde, 0x52, 0x3e, 0x0b, 0x27, 0x69, 0x9e, 0x17, 0x41, 0xe0, 0x25, 0x11,
+    0x0e, 0xd6, 0xa6, 0x8e, 0x51, 0x28, 0x7a, 0x8d, 0x7a, 0x48, 0xf6, 0xb7, 0x64, 0xfc, 0xc7, 0x53,
+    0x49, 0x84, 0x54, 0xc5, 0xcc, 0xca, 0x50, 0x87, 0x8c, 0xe3, 0x0a, 0x38, 0x23, 0x0c, 0xcc, 0x9c,
+    0xf8, 0xb8, 0xbb, 0xfb, 0x5b, 0x15, 0x6c, 0x87, 0x11, 0x0d, 0xb6, 0x89, 0x4b, 0xac, 0xdc, 0x3c,
+    0xaf, 0x8d, 0x9c, 0xc8, 0x78, 0xd6, 0xa0, 0x27, 0x96, 0x5d, 0xd9, 0x84, 0xc8, 0xd2, 0x7b, 0x10,
+    0x55, 0x2e, 0xb1, 0x22, 0x90, 0x80, 0x19, 0xd4, 0xba, 0xd4, 0xcf, 0xb4, 0x82, 0x1b, 0x84, 0x8e,
+    0xca, 0x77, 0x55, 0x6d, 0x41, 0x0e, 0xf4, 0xe2, 0x08, 0x62, 0x14, 0xdc, 0xa1, 0xdc, 0x33, 0x95,
+    0xc7, 0x05, 0xf3, 0x24, 0x4d, 0x13, 0xc5, 0xe4, 0x03, 0xea, 0x75, 0x41, 0xbf, 0x57, 0xa5, 0x3f,
+    0x50, 0x9d, 0x3f, 0x52, 0x95, 0xdf, 0xa9, 0xc6, 0x9a, 0x0a, 0x2b, 0x47, 0x18, 0xa8, 0x89, 0x21,
+    0x15, 0x52, 0xa4, 0x17, 0x80, 0x98, 0xd2, 0x0b, 0xf9, 0x8c, 0x65, 0x01, 0x24, 0x78, 0x0b, 0x10,
+    0x37, 0x43, 0xa7, 0xac, 0x7f, 0x87, 0xff, 0x2a, 0x41, 0x2b, 0x03, 0x0d, 0x82, 0x9e, 0x58, 0xfa,
+    0xec, 0xa6, 0x28, 0x82, 0xb3, 0xa1, 0xaa, 0x64, 0x7f, 0x64, 0x34, 0xc6, 0xe4, 0xd6, 0xab, 0xc2,
+    0x57, 0x4e, 0xff, 0xd5, 0x1b, 0x98, 0x54, 0x5e, 0x24, 0x46, 0xaf, 0x65, 0xbd, 0x46, 0xa3, 0x57,
+    0x58, 0x5d, 0xe9, 0xe8, 0xe5, 0xd6, 0xa1, 0xd1, 0xa0, 0xd4, 0xa8, 0x93, 0x57, 0x0b, 0x33, 0x03,
+    0xb6, 0xc1, 0x0b, 0xc3, 0x86, 0x45, 0xec, 0xb2, 0xc1, 0x26, 0x4f, 0x59, 0x28, 0x86, 0x20, 0x3a,
+    0x8b, 0x19, 0x21, 0x16, 0xbc, 0x2a, 0xab, 0x20, 0x84, 0x3b, 0x19, 0x63, 0x90, 0xc2, 0xd9, 0x41,
+    0x73, 0xcc, 0x14, 0xd1, 0x6e, 0xf0, 0x58, 0x8e, 0x1a, 0x1c, 0xa8, 0x4f, 0x36, 0x29, 0xdf, 0x67,
+    0x29, 0x44, 0x1d, 0x9d, 0x41, 0xb8, 0xdf, 0xd5, 0x37, 0x09, 0x48, 0xa1, 0x68, 0x59, 0xbe, 0x03,
+    0x27, 0x0f, 0xd2, 0xec, 0x9b, 0xd7, 0x07, 0x92, 0x0b, 0x0c, 0x88, 0x2d, 0xce, 0xeb, 0x43, 0x45,
+    0xf6, 0x7d, 0xb5, 0x2a, 0x79, 0xaf, 0x61, 0x8d, 0xc5, 0xad, 0xbd, 0xca, 0x64, 0xf2, 0x88, 0x65,
+    0x0c, 0xf0, 0xaa, 0x2e, 0x01, 0x5f, 0x78, 0x6a, 0xe3, 0x6e, 0x81, 0x31, 0x4c, 0x59, 0x36, 0xe5,
+    0x33, 0x72, 0x04, 0x61, 0x59, 0x1c, 0xa6, 0xc6, 0xc7, 0x0d, 0x9b, 0x8d, 0xe2, 0xca, 0xc8, 0x97,
+    0xf7, 0x60, 0x21, 0xf7, 0x81, 0xa9, 0x48, 0x58, 0xb0, 0x79, 0x7e, 0x03, 0xa9, 0xd5, 0x2c, 0x89,
+    0x63, 0x26, 0xca, 0xfa, 0x3a, 0x19, 0x5b, 0xb5, 0x23, 0x41, 0x32, 0xe3, 0x62, 0x60, 0xde, 0x38,
+    0xe3, 0xf3, 0x54, 0xad, 0xe5, 0xb1, 0x0b, 0x5e, 0xed, 0x9c, 0x82, 0xdd, 0x89, 0xb8, 0xee, 0x26,
+    0x39, 0x32, 0x63, 0x45, 0x92, 0x80, 0x26, 0x3e, 0x42, 0x99, 0x35, 0xc0, 0xc6, 0x9c, 0x04, 0x01,
+    0xb2, 0x85, 0xeb, 0xe9, 0x28, 0xc6, 0x5b, 0x63, 0x21, 0xd2, 0x05, 0xf8, 0xb2, 0x19, 0x83, 0x9b,
+    0x0f, 0xc3, 0xef, 0x87, 0x28, 0x4d, 0x68, 0x09, 0xa9, 0xd9, 0xa8, 0xa0, 0x71, 0x22, 0x9c, 0xac,
+    0x20, 0xa8, 0x06, 0xd9, 0x37, 0xd8, 0xdf, 0x5c, 0x0c, 0x8f, 0xe0, 0x94, 0xc1, 0x82, 0x29, 0xb3,
+    0x2b, 0x64, 0x89, 0x9c, 0x5a, 0x8b, 0x61, 0x09, 0xcd, 0xfe, 0xf8, 0x43, 0xfd, 0x88, 0x89, 0x19,
+    0x59, 0x2c, 0xd1, 0xb2, 0xcc, 0x67, 0x92, 0x4d, 0xf0, 0xe2, 0xcd, 0x04, 0x23, 0xb0, 0x9a, 0x90,
+    0xe2, 0x33, 0xf0, 0x07, 0xbd, 0xc3, 0x38, 0xb9, 0x21, 0x42, 0xe2, 0x47, 0x1b, 0xf6, 0x52, 0x00,
+    0x9e, 0xc1, 0xca, 0x6d, 0x85, 0x5f, 0x1e, 0x63, 0xab, 0x0d, 0xa2, 0x12, 0xfe, 0xa3, 0x0d, 0x05,
+    0x19, 0x26, 0xf1, 0x6a, 0xe3, 0xb8, 0x81, 0x5c, 0x02, 0x3b, 0xc3, 0x89, 0x44, 0x0f, 0x2b, 0x04,
+    0x94, 0x23, 0x60, 0x1c, 0x6e, 0x26, 0x30, 0xb9, 0x09, 0x68, 0x4d, 0xc8, 0x91, 0x34, 0x6b, 0xc4,
+    0x9f, 0xed, 0xfa, 0x53, 0xa2, 0xe0, 0xb2, 0x71, 0xac, 0x97, 0x17, 0x9f, 0xab, 0xc3, 0xcd, 0xd9,
+    0x2e, 0xc0, 0x2e, 0x7c, 0x50, 0xa7, 0xf8, 0x62, 0x11, 0x9c, 0x41, 0x40, 0x5b, 0x34, 0xad, 0x3e,
+    0x67, 0x9c, 0xe2, 0xd2, 0xe5, 0x82, 0x66, 0xd5, 0xc5, 0xe7, 0x62, 0xed, 0x6a, 0xa2, 0xa4, 0x79,
+    0xd1, 0x61, 0x19, 0x28, 0x23, 0x72, 0x23, 0x0d, 0x59, 0xd1, 0xb1, 0x0c, 0xc9, 0xef, 0x15, 0x09,
+    0xfc, 0x81, 0xb7, 0x34, 0x5a, 0x0d, 0x0c, 0x19, 0x25, 0xa8, 0x36, 0x79, 0x51, 0x71, 0xc6, 0x4b,
+    0x64, 0x1a, 0xee, 0x65, 0x3c, 0x37, 0x4b, 0xc2, 0xdd, 0x91, 0xc0, 0xff, 0xa3, 0x72, 0x2e, 0xfe,
+    0xa4, 0xc9, 0x74, 0x06, 0x52, 0xb5, 0x4a, 0x51, 0xc6, 0x19, 0xcd, 0x58, 0xf4, 0x55, 0x2a, 0x85,
+    0x38, 0x57, 0xea, 0xc3, 0x4d, 0x49, 0xed, 0x7b, 0xc9, 0x0a, 0x81, 0x28, 0xb2, 0xea, 0xae, 0xea,
+    0x90, 0xf4, 0xf6, 0x74, 0x25, 0x5d, 0xf6, 0xc3, 0xde, 0x06, 0x4d, 0xb8, 0xc1, 0xb5, 0xfb, 0xfe,
+    0xdf, 0x78, 0x01, 0x59, 0x06, 0xfa, 0x1d, 0x8b, 0xe5, 0xfa, 0x54, 0xa9, 0xda, 0x91, 0x28, 0xa0,
+    0x4b, 0xdf, 0x22, 0x81, 0x58, 0xec, 0x14, 0xc9, 0xc3, 0x30, 0x74, 0xeb, 0xe6, 0x5f, 0x64, 0xba,
+    0xe3, 0x51, 0xc3, 0x63, 0x69, 0x1e, 0xd1, 0x30, 0xe0, 0xd7, 0xa8, 0xb8, 0x14, 0x42, 0x39, 0x6d,
+    0xfd, 0x54, 0xf5, 0x84, 0x3b, 0xef, 0x71, 0x4e, 0x76, 0x53, 0x5b, 0xd1, 0x38, 0x82, 0x1f, 0xb0,
+    0xa4, 0xa5, 0x25, 0x04, 0xea, 0x13, 0x03, 0x33, 0x84, 0x6b, 0x7c, 0x40, 0x87, 0xe4, 0x5a, 0x5c,
+    0x43, 0xaf, 0x43, 0x53, 0x76, 0x84, 0x1c, 0x9f, 0xda, 0xaf, 0xba, 0x83, 0xae, 0x52, 0x6a, 0xf5,
+    0xd1, 0xc8, 0xca, 0x5a, 0x1e, 0xcf, 0xf1, 0xcf, 0x55, 0xe7, 0x8c, 0x18, 0xea, 0xcd, 0xbf, 0x93,
+    0xc4, 0xa9, 0x7b, 0x27, 0xfc, 0x64, 0x88, 0x38, 0x1e, 0x91, 0x17, 0xfe, 0xa1, 0x2a, 0xe0, 0x7e,
+    0xf5, 0xe4, 0xde, 0xf0, 0x28, 0xdc, 0x1c, 0x8f, 0x8f, 0xbd, 0x23, 0x7d, 0x4d, 0xe1, 0x98, 0x10,
+    0x88, 0x19, 0x3e, 0xa0, 0xfc, 0x42, 0xb6, 0xb4, 0x27, 0x38, 0xdc, 0x04, 0x54, 0x81, 0xdf, 0xec,
+    0x88, 0xaa, 0xb3, 0xca, 0x2b, 0xb8, 0x13, 0x95, 0x7b, 0x82, 0x82, 0x33, 0x6a, 0x68, 0x82, 0xd5,
+    0xc9, 0xbe, 0x5a, 0x51, 0x7d, 0xba, 0xa0, 0xcd, 0xbb, 0x91, 0x59, 0x2f, 0x2d, 0xee, 0x36, 0x8e,
+    0x3f, 0xaa, 0x82, 0xae, 0xbf, 0x8f, 0x4d, 0x5e, 0x98, 0x33, 0x6b, 0xed, 0xd4, 0xaa, 0xbc, 0x9a,
+    0x45, 0x28, 0xeb, 0x10, 0x52, 0x16, 0x0b, 0x93, 0x28, 0x4f, 0x91, 0xe0, 0xd1, 0xc6, 0xfe, 0x86,
+    0x5e, 0x1e, 0x13, 0x9a, 0x51, 0xc4, 0xb0, 0x28, 0x59, 0x09, 0x29, 0x59, 0x3e, 0x12, 0x81, 0x07,
+    0xdc, 0x49, 0x49, 0xa7, 0xcc, 0x8b, 0x2b, 0xca, 0xd7, 0xa8, 0xd6, 0x05, 0x1d, 0x59, 0x16, 0xc7,
+    0xef, 0x72, 0x69, 0x10, 0x44, 0xcd, 0xc0, 0x05, 0x08, 0xae, 0xf5, 0xd2, 0xe5, 0x6b, 0xd7, 0xe3,
+    0xef, 0xa5, 0x57, 0x6b, 0x99, 0xe8, 0xf6, 0x3c, 0xf5, 0x1a, 0xb3, 0xf0, 0x3c, 0x2d, 0x09, 0xa9,
+    0xc5, 0x6b, 0x2d, 0x11, 0x56, 0x2a, 0x70, 0x59, 0xcc, 0xbe, 0xa1, 0x59, 0x7b, 0xf9, 0x0e, 0x64,
+    0x85, 0x62, 0xa2, 0x7a, 0xac, 0x93, 0x58, 0x48, 0xdb, 0xd6, 0xdd, 0x4c, 0xb5, 0x43, 0xd2, 0xc1,
+    0x3a, 0xcb, 0x68, 0xbb, 0x9a, 0xd1, 0x7d, 0xb6, 0x10, 0x5f, 0x42, 0xf7, 0x19, 0xd1, 0x14, 0xb1,
+    0x4a, 0x26, 0xcc, 0x2b, 0x5f, 0x72, 0x53, 0x25, 0x76, 0x78, 0xac, 0xb0, 0xe7, 0x92, 0x53, 0xa5,
+    0x7a, 0x6d, 0x11, 0xcb, 0xac, 0x9c, 0x25, 0x13, 0x1e, 0xc8, 0x97, 0x13, 0xcd, 0xb3, 0x79, 0x40,
+    0x71, 0xa2, 0x79, 0xe5, 0xd5, 0xa4, 0x76, 0x5a, 0xf4, 0x33, 0x89, 0x3d, 0xee, 0xf6, 0x99, 0xc4,
+    0x3d, 0x3c, 0xde, 0x43, 0x49, 0x25, 0x42, 0x0f, 0x9b, 0x1e, 0x40, 0x86, 0xce, 0x2b, 0x87, 0x57,
+    0xd1, 0xa8, 0x21, 0x37, 0x3d, 0x77, 0x54, 0xa2, 0x57, 0x58, 0x2e, 0xd2, 0x44, 0xa7, 0x06, 0x42,
+    0x22, 0x43, 0xb2, 0xfd, 0xd8, 0x4b, 0xcc, 0x90, 0xec, 0xc8, 0xcb, 0xb6, 0x97, 0xca, 0x37, 0x16,
+    0x5a, 0xff, 0xff, 0xb6, 0xf3, 0xb8, 0x1d, 0x7a, 0x3b, 0xa8, 0xbc, 0xb0, 0xb8, 0x45, 0x2d, 0x76,
+    0x2b, 0x2a, 0xcf, 0xe2, 0x0a, 0x3e, 0xa7, 0xdf, 0x02, 0x8c, 0xc4, 0xee, 0xa2, 0x73, 0xba, 0x08,
+    0xc4, 0xcd, 0x98, 0x02, 0xdb, 0x83, 0x21, 0xa9, 0x44, 0xea, 0xca, 0xfc, 0x80, 0x3c, 0x23, 0xdb,
+    0x3a, 0x54, 0x24, 0xa5, 0x6d, 0x8e, 0x11, 0xf4, 0x0b, 0x9a, 0xc5, 0xf9, 0x1c, 0x56, 0x3f, 0x26,
+    0x5b, 0xe1, 0xde, 0x81, 0x5f, 0x5c, 0xb4, 0xd0, 0xbf, 0xd8, 0xa8, 0x43, 0xdc, 0xd7, 0x39, 0x83,
+    0x80, 0x56, 0x5b, 0xc5, 0x30, 0xaf, 0xc7, 0xce, 0x83, 0xa0, 0x7a, 0x49, 0x16, 0x54, 0x9a, 0x1e,
+    0x0c, 0x89, 0xd8, 0x63, 0xdf, 0xb6, 0x17, 0xe9, 0xaa, 0xa1, 0x4f, 0xbc, 0x57, 0xa9, 0x62, 0xd6,
+    0xda, 0x90, 0x9e, 0x55, 0xb6, 0xf7, 0x37, 0xb2, 0xbd, 0x35, 0x70, 0x2a, 0x8f, 0x64, 0x5c, 0x25,
+    0x51, 0x6f, 0x41, 0x7a, 0x88, 0x86, 0x5f, 0xb1, 0x7f, 0xb7, 0x9c, 0x5f, 0x8b, 0xee, 0x30, 0xa7,
+    0x74, 0x52, 0xc5, 0x7f, 0xee, 0x29, 0x43, 0x9e, 0x51, 0x8c, 0x09, 0xea, 0x65, 0x53, 0x17, 0x4b,
+    0x25, 0x29, 0xac, 0x40, 0xb8, 0x80, 0x90, 0x0e, 0x23, 0x6c, 0xa5, 0x79, 0xc2, 0xc7, 0x01, 0xee,
+    0x54, 0x01, 0x63, 0x7b, 0x7f, 0x10, 0x2e, 0x68, 0x7c, 0x81, 0xe7, 0x3f, 0xd8, 0x19, 0x92, 0xfe,
+    0x56, 0x7f, 0x60, 0x29, 0x82, 0x8d, 0x9d, 0x28, 0xe7, 0x25, 0xbd, 0x91, 0x30, 0x3a, 0xe3, 0x8a,
+    0x9a, 0x9c, 0x10, 0x56, 0xb4, 0x54, 0x9e, 0x5e, 0xe9, 0x15, 0xa9, 0x74, 0xcd, 0x3c, 0xb9, 0xb7,
+    0x5a, 0xc3, 0x02, 0x6f, 0x78, 0xa5, 0xdd, 0x95, 0xef, 0xa8, 0x8c, 0x8b, 0xb2, 0x9d, 0x21, 0xe6,
+    0x67, 0x4b, 0x3f, 0xc8, 0x50, 0x37, 0x7d, 0x88, 0x8a, 0xfd, 0xab, 0x34, 0xa7, 0x3c, 0xb0, 0x8b,
+    0x0d, 0x5a, 0xda, 0x40, 0x2a, 0x5e, 0x69, 0xb1, 0x2c, 0x67, 0x81, 0x16, 0x40, 0xeb, 0x61, 0x7d,
+    0xa0, 0x52, 0x7e, 0xdf, 0x6b, 0xae, 0x95, 0xcb, 0xe7, 0xad, 0xa6, 0x04, 0x13, 0x8b, 0x1d, 0xb6,
+    0x90, 0x2e, 0x25, 0x6c, 0xf4, 0xe0, 0x3a, 0xf7, 0xaa, 0xa7, 0x68, 0x5a, 0xc8, 0xa9, 0x2d, 0xa5,
+    0xf9, 0x34, 0xb8, 0xfa, 0x00, 0x30, 0x78, 0x30, 0x64, 0xd6, 0xb5, 0x52, 0x91, 0x49, 0x74, 0xa8,
+    0x5d, 0xf9, 0x91, 0xb7, 0xce, 0x83, 0xca, 0x28, 0x4c, 0x29, 0xa4, 0x61, 0xd3, 0xb2, 0x2d, 0xed,
+    0xe9, 0x53, 0x52, 0x99, 0x74, 0xda, 0xb5, 0x6a, 0x2c, 0x81, 0x4d, 0xc7, 0xc8, 0x92, 0x00, 0x22,
+    0x3c, 0xd7, 0x17, 0xeb, 0x46, 0x6c, 0xf1, 0x8e, 0x20, 0x2f, 0xb2, 0x10, 0x6c, 0x9e, 0xdc, 0x2b,
+    0x9e, 0x56, 0x57, 0x46, 0xa4, 0x4d, 0x6c, 0xa9, 0x66, 0x3b, 0xe0, 0xab, 0xff, 0x0e, 0xb7, 0x85,
+    0xb5, 0x22, 0x51, 0x73, 0xb0, 0x2f, 0x5f, 0x6a, 0x53, 0xee, 0x74, 0xb8, 0x60, 0x05, 0x06, 0x0f,
+    0x94, 0x86, 0xd0, 0xd1, 0x14, 0x4e, 0xa8, 0x68, 0xc7, 0x15, 0xf5, 0xa8, 0x5b, 0xe2, 0x02, 0x6b,
+    0x21, 0xdd, 0x13, 0x6c, 0x08, 0x1d, 0x6b, 0x61, 0x91, 0x95, 0x7f, 0x49, 0x69, 0xa3, 0x8f, 0x61,
+    0xa3, 0x1f, 0xb3, 0x2c, 0x51, 0xe4, 0x3d, 0xb8, 0x82, 0xfd, 0x7b, 0x09, 0x36, 0xfe, 0xc1, 0x80,
+    0x63, 0x29, 0x12, 0x2b, 0x9f, 0x2e, 0x83, 0xfa, 0x4d, 0xfa, 0x87, 0x31, 0xad, 0xea, 0x82, 0x9e,
+    0x89, 0xf9, 0xef, 0xe7, 0x0d, 0x1d, 0x80, 0xf2, 0xae, 0xa8, 0x2f, 0x18, 0xad, 0x6e, 0xf7, 0xa0,
+    0xde, 0x24, 0xd8, 0x82, 0x59, 0x83, 0x3b, 0x70, 0x1b, 0x09, 0x5b, 0x90, 0x1c, 0x88, 0x03, 0xb7,
+    0xcd, 0x30, 0x14, 0x97, 0x77, 0x91, 0xb1, 0xb5, 0x1e, 0xd9, 0x03, 0xaf, 0x09, 0xf1, 0x01, 0x0c,
+    0x09, 0x74, 0xe0, 0xf6, 0x28, 0x3e, 0x80, 0x21, 0x60, 0x0e, 0xbc, 0x06, 0xc6, 0x96, 0x4d, 0xb8,
+    0x20, 0x15, 0x04, 0xc8, 0x6a, 0x90, 0x16, 0xae, 0xf1, 0x53, 0xc7, 0x22, 0x8e, 0xe2, 0xdc, 0x36,
+    0x0b, 0xa1, 0xb8, 0x07, 0xc2, 0xa2, 0xf3, 0x9e, 0xdd, 0xac, 0x62, 0xdd, 0x5e, 0xd2, 0x11, 0x16,
+    0x1d, 0x1a, 0x2d, 0xda, 0xae, 0x11, 0xf1, 0xbb, 0x72, 0x0d, 0x7a, 0x4d, 0xe3, 0x35, 0x44, 0xbf,
+    0x23, 0xb7, 0x41, 0xe5, 0xcd, 0x08, 0xa6, 0x0b, 0xb7, 0x49, 0xe7, 0xcd, 0x28, 0xba, 0xf3, 0xb6,
+    0x41, 0xe5, 0x35, 0x04, 0xbf, 0xdb, 0xb6, 0xae, 0x73, 0xb8, 0x32, 0xcc, 0xf2, 0xdb, 0xcb, 0x9c,
+    0x62, 0xc3, 0x81, 0xe9, 0xac, 0x45, 0x5d, 0xc5, 0xa4, 0x5c, 0x46, 0x11, 0x00, 0x4e, 0x96, 0x69,
+    0x2a, 0xfa, 0xcb, 0xff, 0xa4, 0x01, 0x78, 0x8d, 0x32, 0x75, 0x0b, 0xf8, 0x0b, 0xb6, 0xf3, 0x56,
+    0x5a, 0x75, 0x9a, 0x24, 0x25, 0x36, 0x85, 0x21, 0x23, 0x66, 0x13, 0xba, 0x4c, 0x65, 0x2b, 0x82,
+    0x6b, 0xf5, 0x06, 0xc7, 0x89, 0x5d, 0x62, 0xdf, 0x66, 0x00, 0xe1, 0x5d, 0x55, 0x76, 0xf5, 0x49,
+    0xe9, 0xde, 0x1c, 0xa4, 0xd2, 0xaa, 0x0e, 0x0e, 0x77, 0x68, 0x6b, 0x10, 0xab, 0xee, 0xb6, 0x9f,
+    0xb3, 0xf7, 0x6f, 0xd5, 0xb3, 0xc4, 0x1b, 0xd8, 0x2e, 0x78, 0xe9, 0x61, 0xa5, 0xfb, 0x6b, 0x70,
+    0xf0, 0x3f, 0xd3, 0xe6, 0x46, 0x57, 0x73, 0x32, 0x00, 0x00,
+};
+
+// /static/js/sensors.js (3545 octets)
+static const uint8_t ASSET_5[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x1a, 0xdb, 0x6e, 0xdb, 0x38,
+    0xf6, 0x5d, 0x5f, 0xc1, 0xc9, 0xce, 0x8e, 0xe5, 0xa9, 0xad, 0xd8, 0xce, 0xa5, 0x59, 0xe7, 0x32,
+    0x48, 0x93, 0x0c, 0x26, 0x8b, 0xb4, 0x5d, 0x34, 0x99, 0xed, 0x02, 0x45, 0x80, 0xc8, 0x12, 0x6d,
+    0x6b, 0x2b, 0x8b, 0x5a, 0x91, 0x8e, 0x63, 0xa4, 0xfe, 0xa7, 0xf9, 0x86, 0xf9, 0xb2, 0x3d, 0x87,
+    0x17, 0x89, 0xba, 0x39, 0x99, 0x79, 0x59, 0x60, 0x8b, 0xda, 0x91, 0xc5, 0x73, 0xe3, 0xe1, 0xb9,
+    0xf1, 0x90, 0x01, 0x4b, 0xb8, 0x20, 0x19, 0x9d, 0x66, 0x94, 0xcf, 0xdf, 0x89, 0x84, 0x9c, 0x92,
+    0x90, 0x05, 0xcb, 0x05, 0x4d, 0x84, 0x37, 0xa3, 0xe2, 0x2a, 0xa6, 0xf8, 0xf8, 0x6e, 0x7d, 0x1d,
+    0xba, 0x1d, 0x0d, 0xd5, 0x9f, 0x88, 0xa4, 0xd3, 0x3d, 0x76, 0x02, 0x89, 0x1a, 0xfb, 0x5c, 0xfc,
+    0x9a, 0x86, 0xbe, 0xa0, 0xe1, 0x55, 0xbc, 0x0d, 0x1b, 0x01, 0xfb, 0x4b, 0x05, 0x59, 0xa0, 0x27,
+    0x54, 0xac, 0x58, 0xf6, 0xf5, 0x3a, 0x09, 0xa3, 0xc0, 0x17, 0x2c, 0xdb, 0x46, 0x41, 0xc3, 0xf6,
+    0x23, 0x03, 0x5c, 0x23, 0x73, 0x47, 0x9f, 0xc4, 0x6b, 0x28, 0x08, 0x80, 0x2b, 0x90, 0xf9, 0x9a,
+    0x0b, 0xba, 0xb8, 0x8b, 0x16, 0x74, 0xfb, 0x0c, 0x14, 0x5c, 0x5f, 0x00, 0xa0, 0x85, 0x4c, 0x13,
+    0xce, 0x32, 0x7e, 0xe7, 0x4f, 0x62, 0xfa, 0x8e, 0x85, 0xeb, 0xad, 0x04, 0x14, 0x6c, 0x5f, 0x20,
+    0x70, 0x7f, 0x02, 0xd0, 0x36, 0x1d, 0x3f, 0x0b, 0xe6, 0xd7, 0x49, 0xba, 0x14, 0xdb, 0x49, 0x20,
+    0x58, 0x5f, 0x53, 0xaa, 0x8a, 0x71, 0x49, 0x85, 0x1f, 0xc5, 0xfc, 0x1f, 0x7e, 0x42, 0xe3, 0x97,
+    0x05, 0xe9, 0x87, 0x0a, 0xbc, 0x9f, 0x22, 0x7c, 0x41, 0x2b, 0x88, 0x19, 0xa7, 0x9a, 0xd4, 0x0b,
+    0x26, 0x21, 0x41, 0x0d, 0x9d, 0x82, 0x82, 0x7a, 0x71, 0x2b, 0xb9, 0x7c, 0xf0, 0x17, 0x74, 0x1b,
+    0x09, 0x05, 0xab, 0x67, 0xd4, 0x4f, 0x7c, 0x5b, 0xb9, 0x6a, 0xec, 0x95, 0x14, 0x9a, 0x50, 0xdf,
+    0xfb, 0xc1, 0x2b, 0x30, 0x17, 0x7e, 0x50, 0x93, 0x5d, 0xf8, 0x62, 0xc9, 0x5f, 0x23, 0xb7, 0x04,
+    0xac, 0xa2, 0xdf, 0x80, 0xb1, 0xdf, 0x52, 0x9a, 0xbc, 0x82, 0x80, 0xf4, 0x0b, 0x0e, 0xb0, 0x55,
+    0x1a, 0x9f, 0xc1, 0x53, 0xb2, 0x1b, 0xfa, 0xb8, 0x7d, 0x29, 0x35, 0x95, 0x15, 0x02, 0xf7, 0x63,
+    0x84, 0xae, 0xd2, 0xb9, 0xa3, 0x8b, 0x94, 0x66, 0x20, 0x65, 0xf6, 0x1a, 0x2d, 0x8a, 0x02, 0x1a,
+    0x09, 0xc5, 0x54, 0x90, 0x79, 0xc4, 0xc1, 0xd9, 0xd6, 0x17, 0x73, 0x3f, 0x43, 0xdb, 0x4c, 0x96,
+    0x71, 0xac, 0x06, 0xb4, 0x15, 0x5e, 0xfa, 0xc2, 0x87, 0xf7, 0x5f, 0xee, 0xcd, 0xdb, 0x98, 0x06,
+    0xe0, 0xe4, 0x6a, 0xf9, 0x73, 0x04, 0x25, 0xd2, 0x82, 0x05, 0x5f, 0x7f, 0x51, 0xf4, 0x34, 0xda,
+    0xb3, 0x83, 0x0e, 0x05, 0x6a, 0x5c, 0xa4, 0x7c, 0x4c, 0xbe, 0x38, 0xf0, 0x9a, 0x7a, 0x09, 0x5b,
+    0xb9, 0x5d, 0xd2, 0x27, 0x47, 0x87, 0xfb, 0x03, 0xfc, 0xd7, 0x23, 0xbb, 0xbb, 0x64, 0xb4, 0x4f,
+    0xe6, 0x6c, 0x99, 0x71, 0xe2, 0xcf, 0x58, 0x19, 0xec, 0xed, 0x68, 0x60, 0x81, 0x0d, 0xda, 0xc0,
+    0x0e, 0xde, 0x1e, 0x16, 0x60, 0xc3, 0xc3, 0x36, 0xb0, 0xfd, 0xbd, 0x91, 0x05, 0x36, 0x6a, 0x03,
+    0x1b, 0x1d, 0x1d, 0x15, 0x60, 0x47, 0x6d, 0x50, 0xc3, 0x7d, 0x6b, 0x06, 0x2d, 0x13, 0x28, 0xfd,
+    0x03, 0x30, 0x78, 0xeb, 0xdc, 0xf7, 0x9c, 0x55, 0x6e, 0x00, 0xa8, 0x98, 0xd1, 0x41, 0x8f, 0xec,
+    0x01, 0x99, 0x7d, 0xfc, 0xc0, 0xf3, 0xc1, 0xa8, 0x47, 0x0e, 0xe1, 0xf9, 0xf0, 0x00, 0x40, 0xad,
+    0x55, 0x93, 0xb0, 0x30, 0x36, 0x1a, 0x79, 0x00, 0x35, 0xda, 0xc3, 0x8f, 0x7c, 0xda, 0xc7, 0x8f,
+    0x7c, 0x3a, 0xb8, 0x77, 0x36, 0xc7, 0xce, 0x74, 0x99, 0x04, 0x22, 0x62, 0x09, 0x89, 0x92, 0x48,
+    0xa8, 0xc5, 0x82, 0xc8, 0x31, 0xa3, 0x20, 0xd0, 0xb3, 0x53, 0x64, 0x04, 0xcf, 0x0f, 0xc3, 0xab,
+    0x47, 0x30, 0x93, 0x1b, 0x58, 0x36, 0x9a, 0xd0, 0x0c, 0xbd, 0x3e, 0x0a, 0xbe, 0x76, 0x7a, 0x64,
+    0x4a, 0x45, 0x30, 0xbf, 0x2d, 0x8c, 0x00, 0xec, 0xc5, 0x0a, 0x63, 0x0d, 0x88, 0x11, 0xbe, 0x47,
+    0xc4, 0x28, 0x86, 0xa9, 0x69, 0x4c, 0x34, 0xd7, 0x72, 0xc4, 0xd9, 0xc2, 0x72, 0x1e, 0x85, 0xf4,
+    0xd6, 0x8e, 0x75, 0x80, 0x9d, 0x9b, 0xf4, 0x7f, 0x96, 0x34, 0x5b, 0xdf, 0x4a, 0xf3, 0x63, 0xd9,
+    0x79, 0x1c, 0xbb, 0x1d, 0x4f, 0x87, 0x95, 0x98, 0x41, 0xc2, 0x80, 0xb9, 0x76, 0xba, 0xde, 0x94,
+    0x65, 0x57, 0x7e, 0x30, 0x77, 0xcd, 0x2b, 0x72, 0x7a, 0x06, 0xf3, 0x35, 0xbf, 0xb6, 0xb0, 0x06,
+    0xbd, 0x48, 0x50, 0x3b, 0xe0, 0xea, 0xd0, 0x94, 0x63, 0x83, 0x53, 0x9d, 0x0b, 0x91, 0x45, 0x93,
+    0xa5, 0xa0, 0xe0, 0x52, 0xa0, 0x13, 0x1d, 0xd8, 0xaa, 0x91, 0x1a, 0x90, 0x2c, 0xef, 0xf1, 0xa6,
+    0x90, 0xd3, 0x5c, 0x8e, 0xf4, 0xb9, 0x97, 0x48, 0x9a, 0xa7, 0xa7, 0x16, 0x0b, 0x40, 0x8e, 0xa6,
+    0xc4, 0x55, 0x2f, 0x70, 0x79, 0xf8, 0x9c, 0xad, 0x4a, 0x6a, 0x30, 0x63, 0xc7, 0xce, 0x86, 0x80,
+    0xbd, 0xd0, 0x46, 0x98, 0x67, 0x07, 0x69, 0x8f, 0x2d, 0xc2, 0x3d, 0x07, 0x62, 0xdf, 0x98, 0xec,
+    0x0c, 0x06, 0xe3, 0xf2, 0xff, 0x1d, 0xdb, 0xfc, 0xc6, 0x60, 0x70, 0xde, 0xa8, 0x64, 0x65, 0x63,
+    0x65, 0x55, 0x0e, 0xcc, 0x9b, 0xce, 0xc0, 0x99, 0xc7, 0x85, 0x0e, 0x4a, 0xab, 0x00, 0x4b, 0x60,
+    0x06, 0xfa, 0x21, 0x83, 0xa4, 0xeb, 0x05, 0x10, 0xf0, 0x38, 0x6a, 0xd7, 0x03, 0x7d, 0x80, 0x5c,
+    0x09, 0x77, 0x3b, 0x2b, 0x3f, 0x4b, 0xa2, 0x64, 0xd6, 0xe9, 0x92, 0x9f, 0xc8, 0x90, 0x8c, 0xc9,
+    0xa0, 0xe7, 0xc4, 0x3a, 0x82, 0xde, 0x52, 0x00, 0x0b, 0xc1, 0xa8, 0x87, 0x47, 0x03, 0x67, 0x83,
+    0xf3, 0x53, 0xdf, 0xd2, 0xd6, 0xc4, 0x75, 0x02, 0x32, 0x3e, 0xfa, 0xb1, 0xab, 0x0a, 0x0b, 0xcc,
+    0xe1, 0x3d, 0x32, 0x04, 0x77, 0x83, 0xe1, 0xaa, 0x75, 0xba, 0x88, 0xb2, 0x9c, 0xf0, 0x00, 0x96,
+    0x87, 0xde, 0x31, 0xb9, 0xca, 0xdc, 0xad, 0xd0, 0x31, 0x8b, 0x8c, 0xea, 0xfe, 0x8e, 0x4a, 0x90,
+    0x0b, 0x96, 0x24, 0x32, 0xa0, 0x75, 0x49, 0x13, 0xc9, 0x0d, 0xba, 0xa5, 0xe2, 0xb8, 0x91, 0xf1,
+    0xaf, 0x82, 0x05, 0x2b, 0x3d, 0xf5, 0x61, 0x45, 0x2c, 0x87, 0x6b, 0x90, 0xc2, 0xb0, 0x74, 0x3b,
+    0xf2, 0xcd, 0x2d, 0x84, 0x89, 0x80, 0x76, 0xc0, 0x35, 0xc9, 0x0a, 0x4c, 0x83, 0xad, 0xba, 0x5d,
+    0x28, 0xd2, 0x40, 0xf1, 0x89, 0x31, 0x23, 0xc5, 0x05, 0xa3, 0x2b, 0x5d, 0x11, 0x0b, 0xc7, 0xed,
+    0xec, 0xfa, 0x69, 0xb4, 0xab, 0x86, 0xd1, 0xea, 0xd4, 0x53, 0x83, 0x5d, 0xb3, 0x14, 0x72, 0x4e,
+    0x61, 0xd6, 0x75, 0xb1, 0x45, 0xb6, 0x04, 0xa9, 0x95, 0x66, 0x3f, 0xa8, 0xca, 0x49, 0xa5, 0x45,
+    0x17, 0x47, 0xf4, 0x22, 0xb4, 0x92, 0xa7, 0x59, 0x06, 0x66, 0xbf, 0x8d, 0xbe, 0x56, 0xcb, 0x56,
+    0x2a, 0xda, 0x7b, 0x7a, 0x6a, 0xbe, 0x75, 0x07, 0x04, 0x32, 0x7f, 0xbf, 0xfd, 0xf8, 0xc1, 0x4b,
+    0xfd, 0x8c, 0x53, 0x57, 0x02, 0x79, 0xa1, 0x0a, 0x45, 0x0a, 0x0c, 0xb4, 0x47, 0x9f, 0x1a, 0xbc,
+    0xed, 0x1a, 0xdf, 0x1b, 0x97, 0x5b, 0x60, 0x99, 0x90, 0x7b, 0x1c, 0xfe, 0xd4, 0x1e, 0xa7, 0xb0,
+    0xcf, 0x4e, 0xc9, 0x40, 0x7a, 0x5d, 0x41, 0xe3, 0x8b, 0x1c, 0xb9, 0xcf, 0x09, 0xdb, 0x7e, 0x67,
+    0x71, 0x4a, 0x97, 0x7c, 0x6e, 0xb9, 0xa6, 0x09, 0xab, 0xda, 0x84, 0xdc, 0xdc, 0xaf, 0x4b, 0x19,
+    0xf3, 0x87, 0x1f, 0x2a, 0x39, 0xb4, 0x49, 0xbe, 0x17, 0x82, 0xc0, 0x6b, 0xb4, 0x0a, 0x51, 0x91,
+    0x8b, 0x26, 0xd5, 0xe2, 0xfb, 0x2d, 0x8a, 0x2d, 0xa7, 0xfd, 0xb2, 0x62, 0x31, 0xae, 0xdb, 0x5a,
+    0xfd, 0xee, 0xf4, 0x54, 0x92, 0xd3, 0x3a, 0xad, 0xcf, 0x5f, 0xb9, 0x74, 0xee, 0x1a, 0x55, 0x00,
+    0x90, 0xa9, 0x94, 0x2c, 0x10, 0x45, 0x59, 0xa4, 0x7a, 0xf1, 0xde, 0x4f, 0x5d, 0x5e, 0xca, 0x40,
+    0xa5, 0x0d, 0x89, 0x87, 0x95, 0x3e, 0xd8, 0x9c, 0x90, 0x33, 0x24, 0x0f, 0x58, 0x97, 0x11, 0xbd,
+    0x09, 0x19, 0x93, 0xef, 0x9f, 0xd1, 0x79, 0x30, 0x11, 0xbb, 0x5d, 0x4f, 0xb0, 0x1b, 0x08, 0x54,
+    0xb1, 0x8c, 0x21, 0xb7, 0x10, 0xc2, 0x93, 0x99, 0xdb, 0xdd, 0x3c, 0x94, 0x84, 0x2b, 0x82, 0x8c,
+    0x14, 0x4c, 0x6f, 0x3d, 0xd8, 0x4a, 0x7b, 0xa1, 0x22, 0x04, 0xfa, 0xb1, 0xf6, 0x13, 0x15, 0x01,
+    0x00, 0xb8, 0x91, 0x51, 0x89, 0x0d, 0x64, 0xa8, 0x85, 0x2f, 0xe4, 0x70, 0x94, 0x80, 0x47, 0x73,
+    0x15, 0x02, 0x4d, 0x8c, 0xd0, 0x3f, 0xc9, 0x09, 0xa4, 0x7f, 0x95, 0xaa, 0x31, 0x2e, 0x90, 0x87,
+    0xef, 0x9f, 0xf5, 0xc8, 0x86, 0x18, 0x10, 0xa8, 0x33, 0x1e, 0x72, 0xcb, 0x2c, 0xe3, 0xee, 0x41,
+    0x29, 0x54, 0xc6, 0x7e, 0xef, 0x8b, 0xb9, 0x37, 0x8d, 0x19, 0x04, 0x6d, 0x03, 0xb6, 0x8b, 0x2c,
+    0x36, 0x64, 0x11, 0x25, 0x90, 0xcf, 0xb6, 0x92, 0x93, 0x85, 0xda, 0x2b, 0xe8, 0x49, 0xb6, 0x9b,
+    0xa2, 0x0c, 0x7a, 0xb0, 0x1c, 0xe7, 0x05, 0x54, 0xc5, 0x62, 0x43, 0x42, 0x7f, 0x9d, 0xa3, 0xd6,
+    0xd5, 0x76, 0x53, 0x2c, 0xbf, 0x9b, 0x17, 0x96, 0xc5, 0x6a, 0xe1, 0x80, 0xbd, 0x5c, 0x39, 0x08,
+    0xf9, 0xd1, 0xe4, 0x0d, 0x23, 0x46, 0xd5, 0x56, 0xf0, 0xe1, 0x35, 0x56, 0x92, 0x51, 0x5f, 0xfb,
+    0x2d, 0xff, 0x44, 0x79, 0x0a, 0x6c, 0xa9, 0x9b, 0xe9, 0x87, 0xaa, 0xd9, 0x48, 0xef, 0x82, 0xe4,
+    0x93, 0x03, 0x78, 0x73, 0xc0, 0xa6, 0x19, 0xc7, 0x4a, 0xc2, 0xed, 0xfc, 0xab, 0xff, 0x6b, 0xaa,
+    0xb6, 0x9b, 0x98, 0xd5, 0xba, 0xe4, 0xdb, 0x37, 0x32, 0xc8, 0x05, 0xcc, 0x51, 0xfe, 0xcd, 0x59,
+    0x82, 0x06, 0x3c, 0xa7, 0x89, 0x1b, 0x4a, 0xa7, 0x44, 0x57, 0xc6, 0x27, 0xaf, 0x98, 0x9e, 0xb4,
+    0xbd, 0x63, 0x47, 0x02, 0xe8, 0xaa, 0x88, 0x23, 0xbd, 0x2f, 0xf7, 0x45, 0x49, 0x64, 0x42, 0xea,
+    0x59, 0x1e, 0xc5, 0xbc, 0x4a, 0x1a, 0x06, 0x32, 0x72, 0x6d, 0x16, 0xfe, 0x93, 0x0b, 0xb5, 0x27,
+    0x4e, 0xa2, 0x4f, 0x2a, 0xa0, 0xda, 0xa9, 0xb5, 0x94, 0xc8, 0xaf, 0xe6, 0xe5, 0xf5, 0x3c, 0x8a,
+    0x7e, 0x8e, 0x2f, 0x75, 0xfa, 0xca, 0xf7, 0xb7, 0x8e, 0x9a, 0x56, 0x83, 0x4e, 0xcd, 0x50, 0x31,
+    0xe3, 0x72, 0x5c, 0xaa, 0x4f, 0xb4, 0x1c, 0x39, 0xd4, 0x96, 0xbd, 0x12, 0x3c, 0xb6, 0x87, 0x96,
+    0xa6, 0x54, 0x28, 0xd9, 0xe8, 0xbe, 0xc2, 0x27, 0x90, 0x72, 0xfd, 0x42, 0x08, 0xaa, 0x5b, 0x69,
+    0x79, 0xa1, 0x1a, 0x53, 0x42, 0x61, 0x36, 0xda, 0x1e, 0x6f, 0x5f, 0x2a, 0x22, 0x8b, 0x8c, 0x51,
+    0x4d, 0x24, 0x9a, 0x41, 0x89, 0x50, 0x73, 0x36, 0x29, 0x83, 0x28, 0x6f, 0xdb, 0x80, 0xda, 0xa1,
+    0x9c, 0x83, 0x85, 0x92, 0xf9, 0xbd, 0xc8, 0x1a, 0x2c, 0xa6, 0x9e, 0x7c, 0x05, 0x15, 0x8c, 0x1c,
+    0x91, 0xcb, 0x09, 0xfe, 0x61, 0x12, 0x35, 0x4e, 0x73, 0x8c, 0xd9, 0x06, 0x47, 0x5b, 0x94, 0x29,
+    0x2b, 0x82, 0xae, 0xbd, 0x57, 0xd4, 0x6b, 0x85, 0xdb, 0x4b, 0xe7, 0x99, 0xa8, 0xf2, 0x75, 0x47,
+    0xcf, 0x7e, 0xb8, 0xd3, 0x23, 0xaa, 0x7c, 0x3d, 0x3f, 0x1f, 0xbf, 0x7b, 0x37, 0xbe, 0xb8, 0x18,
+    0x5f, 0x5e, 0x8e, 0xaf, 0xae, 0xc6, 0x03, 0x1c, 0xb1, 0xcb, 0xd7, 0x3d, 0x2c, 0x5f, 0x49, 0xb9,
+    0x7c, 0x95, 0xdb, 0xa3, 0xa2, 0x7c, 0x05, 0x6b, 0xae, 0x97, 0x9c, 0xb0, 0x95, 0xdc, 0xf4, 0x6a,
+    0x7c, 0x47, 0xad, 0x7c, 0x47, 0x15, 0xbe, 0x87, 0x23, 0xef, 0x6d, 0x95, 0xef, 0x9e, 0x77, 0x64,
+    0xf3, 0x1d, 0x36, 0xf0, 0xdd, 0x3f, 0x68, 0x62, 0xbb, 0xd7, 0xca, 0x76, 0xaf, 0xc2, 0x76, 0x7f,
+    0xe4, 0x0d, 0xab, 0x6c, 0x87, 0xde, 0xde, 0x8b, 0xd3, 0x3d, 0x6a, 0x9c, 0xee, 0x7e, 0x2b, 0xdf,
+    0xfd, 0xaa, 0x9a, 0x8f, 0x50, 0xa7, 0x55, 0x35, 0x0f, 0x5e, 0xe2, 0x0b, 0xe5, 0x33, 0xd9, 0x38,
+    0xf7, 0xd5, 0xc2, 0xc2, 0x5a, 0xfe, 0x46, 0xcf, 0xb5, 0xc6, 0xeb, 0x75, 0x44, 0x93, 0x75, 0x45,
+    0xfc, 0x63, 0x12, 0x47, 0x09, 0x35, 0x89, 0xd4, 0xfe, 0x5d, 0xed, 0x43, 0xaa, 0x6d, 0x8a, 0xde,
+    0xde, 0x75, 0xf2, 0x8e, 0x23, 0x61, 0x12, 0xa3, 0x73, 0xec, 0x58, 0x1d, 0xc7, 0x8a, 0x87, 0x77,
+    0x34, 0x57, 0xf2, 0xd1, 0xc0, 0xe6, 0x19, 0xee, 0xd5, 0x5c, 0xa6, 0xd3, 0x3f, 0xc0, 0x26, 0x07,
+    0xde, 0xd4, 0x35, 0xd0, 0x14, 0xeb, 0xf2, 0xcd, 0x86, 0x15, 0x1d, 0xf5, 0xa3, 0x17, 0xd3, 0x64,
+    0x26, 0xe6, 0x32, 0x74, 0xd8, 0x25, 0x6f, 0xde, 0xde, 0xf4, 0x22, 0xa8, 0xdf, 0xb3, 0x5f, 0xee,
+    0xde, 0xdf, 0x60, 0x39, 0xe5, 0x9c, 0x88, 0xec, 0x0c, 0xbe, 0x42, 0x12, 0xb0, 0x98, 0xa7, 0x7e,
+    0x72, 0xba, 0xf3, 0x76, 0x87, 0xc8, 0x49, 0x9d, 0xee, 0xa0, 0xb8, 0xfd, 0x80, 0xe2, 0xce, 0x6a,
+    0x07, 0x80, 0xc2, 0xe8, 0xd1, 0x8c, 0x24, 0xac, 0x2f, 0xb7, 0xc6, 0x10, 0xf2, 0xb8, 0x3f, 0xa3,
+    0x38, 0x1a, 0x99, 0xb1, 0xa9, 0xcf, 0x61, 0x63, 0xa0, 0xfa, 0x59, 0x3b, 0x67, 0x27, 0xbb, 0x11,
+    0x0c, 0xa6, 0x67, 0x1f, 0x98, 0x91, 0x10, 0x38, 0xe9, 0x1d, 0xc4, 0xc9, 0x6e, 0x0a, 0x63, 0xbb,
+    0x40, 0x17, 0xff, 0x88, 0x50, 0x7e, 0x83, 0x38, 0x0f, 0x26, 0xf7, 0x98, 0x0d, 0xd9, 0x5c, 0x2c,
+    0xb0, 0x85, 0xd6, 0xe9, 0xe4, 0x16, 0xd6, 0x98, 0xf1, 0xf4, 0xb6, 0x42, 0xda, 0xca, 0x05, 0x0a,
+    0x93, 0x87, 0x57, 0xcf, 0xd8, 0xaf, 0xd2, 0x0b, 0x6c, 0x52, 0x3b, 0x7c, 0x19, 0x04, 0x20, 0x7d,
+    0x07, 0x36, 0xab, 0x6e, 0x13, 0xd0, 0x10, 0x81, 0xcc, 0xb6, 0x16, 0x80, 0x3a, 0xa1, 0x9f, 0xcc,
+    0xa8, 0xdd, 0x06, 0x90, 0x7c, 0x74, 0xc3, 0xba, 0x95, 0xcd, 0x07, 0xcc, 0x16, 0xf1, 0x76, 0x2e,
+    0x9f, 0x2d, 0x2e, 0xe7, 0x31, 0xcd, 0x64, 0x67, 0x5b, 0xce, 0xf9, 0x8d, 0x5e, 0x22, 0xa2, 0xb4,
+    0xed, 0x07, 0xa7, 0x3b, 0x58, 0x24, 0x9a, 0x4c, 0xb0, 0xd9, 0x91, 0x6b, 0x77, 0x76, 0x82, 0x2b,
+    0x67, 0xf4, 0x3f, 0xf1, 0xc3, 0x19, 0x25, 0x93, 0x59, 0x1f, 0x20, 0x0b, 0x55, 0x00, 0xa8, 0xf9,
+    0x8d, 0x22, 0x6f, 0x4e, 0x76, 0x11, 0xe7, 0x4c, 0xab, 0x1d, 0xbe, 0x72, 0xba, 0x18, 0x3b, 0x36,
+    0x0d, 0xef, 0x91, 0x5f, 0xc3, 0xeb, 0x22, 0x7c, 0x40, 0x69, 0xf5, 0x73, 0xf4, 0x04, 0xf9, 0x70,
+    0x08, 0x35, 0x5e, 0xb0, 0x68, 0x80, 0xb5, 0x02, 0x8b, 0x0d, 0xfc, 0xfb, 0x6f, 0x17, 0x36, 0x70,
+    0xbd, 0x7a, 0x6e, 0x2a, 0x64, 0xba, 0x96, 0x30, 0xce, 0xc9, 0x64, 0x29, 0x04, 0x2b, 0x54, 0x20,
+    0x12, 0x02, 0x9f, 0x3e, 0x5f, 0xc8, 0x3f, 0x71, 0x34, 0x9b, 0x0b, 0xf2, 0x18, 0xd1, 0x55, 0xde,
+    0x30, 0x87, 0xd7, 0x3b, 0xdb, 0x94, 0x5a, 0xb5, 0xe6, 0x28, 0x99, 0xb2, 0x7e, 0x10, 0x65, 0x41,
+    0x4c, 0x95, 0x4d, 0x13, 0x9d, 0x63, 0xc1, 0x64, 0x15, 0xef, 0x9a, 0x09, 0x6f, 0x8a, 0x8d, 0x56,
+    0xb3, 0xf3, 0xe1, 0x0a, 0x6f, 0xef, 0x7d, 0x55, 0x45, 0xb6, 0x9a, 0x5f, 0x38, 0x45, 0x69, 0xf4,
+    0x93, 0xad, 0xdd, 0x36, 0x97, 0x9a, 0xcd, 0xbb, 0x97, 0x66, 0x72, 0x0f, 0x78, 0x49, 0xa7, 0xfe,
+    0x32, 0x16, 0x6e, 0x91, 0xa4, 0x65, 0x87, 0x1d, 0xc9, 0x34, 0xf4, 0xbe, 0x4a, 0x8d, 0xf5, 0x6a,
+    0xe3, 0xab, 0xb1, 0x5e, 0x29, 0x0a, 0x94, 0xd7, 0x35, 0xbb, 0xf2, 0x66, 0x50, 0x4b, 0xe4, 0xb3,
+    0x8a, 0xb8, 0x6e, 0xa5, 0x75, 0x70, 0xa3, 0xfb, 0x52, 0xa5, 0x2e, 0xff, 0x6b, 0x5a, 0x88, 0xb6,
+    0x7c, 0x5c, 0xed, 0xd6, 0x4b, 0xc1, 0xf3, 0x4c, 0x85, 0x4e, 0xd0, 0x35, 0x71, 0x31, 0xfe, 0x44,
+    0xc0, 0x60, 0x70, 0x0c, 0x7f, 0x4e, 0x74, 0xf1, 0x1c, 0x25, 0x6e, 0x45, 0x04, 0x8d, 0xda, 0xab,
+    0x90, 0xea, 0x02, 0xd6, 0x9b, 0x37, 0x5d, 0x6b, 0x63, 0x6e, 0x7a, 0x96, 0xd5, 0x39, 0x7c, 0x89,
+    0xee, 0xdb, 0xf4, 0x2c, 0x87, 0xf2, 0xee, 0x1c, 0x6f, 0xed, 0x50, 0x1a, 0xe6, 0xd2, 0x85, 0xbb,
+    0x16, 0x4a, 0x6b, 0x43, 0x2f, 0xf6, 0x27, 0x78, 0xdc, 0x50, 0x49, 0x4c, 0x16, 0x95, 0xfc, 0x20,
+    0x82, 0x09, 0xbb, 0x4b, 0xba, 0xbd, 0x43, 0x88, 0x46, 0x2d, 0xca, 0x99, 0xb1, 0x04, 0x00, 0x7e,
+    0xb1, 0x8a, 0x44, 0x1e, 0xbc, 0xf3, 0x88, 0x28, 0xd5, 0xe4, 0x43, 0x9e, 0x1d, 0x8c, 0x49, 0x4e,
+    0x41, 0x36, 0x1a, 0xc1, 0xc0, 0xdd, 0x4e, 0xa2, 0x42, 0x29, 0xa8, 0x74, 0x02, 0xbb, 0x89, 0xaf,
+    0xc7, 0x0a, 0x76, 0xd8, 0x08, 0x9b, 0xf7, 0x23, 0xcb, 0xc0, 0xa3, 0x46, 0x60, 0x5f, 0xc7, 0x5c,
+    0x03, 0x1a, 0x2a, 0x17, 0xd9, 0x2e, 0x84, 0x2a, 0xa6, 0x4b, 0x7b, 0xa2, 0x72, 0x9b, 0xc3, 0x32,
+    0x56, 0xec, 0xa8, 0xdf, 0xd1, 0x6c, 0x21, 0x75, 0x5b, 0xb4, 0xd7, 0x1f, 0xfd, 0x78, 0xa9, 0x36,
+    0xa4, 0x2b, 0x9a, 0x5d, 0x80, 0x7c, 0xa6, 0x9d, 0xf4, 0x5d, 0x81, 0x82, 0x64, 0x5e, 0xdc, 0xf4,
+    0x14, 0xd9, 0x52, 0x71, 0x54, 0x92, 0x98, 0xc2, 0x9f, 0xb7, 0xf4, 0x78, 0x4c, 0xe6, 0x74, 0xac,
+    0xf5, 0x2e, 0x4b, 0x03, 0xe1, 0x2a, 0x88, 0x97, 0x21, 0x45, 0x7f, 0x2d, 0x04, 0xfa, 0xf6, 0xcd,
+    0x29, 0xa2, 0xe5, 0x2b, 0x10, 0x9c, 0x6e, 0x63, 0xf5, 0x57, 0x11, 0xb2, 0x1c, 0x01, 0x5a, 0x23,
+    0x86, 0xac, 0x68, 0x2a, 0xc7, 0x53, 0xa6, 0x81, 0x57, 0x3d, 0xb4, 0xdc, 0x66, 0xd6, 0xc5, 0xc1,
+    0xe4, 0xcb, 0x50, 0xef, 0x71, 0x9a, 0x4d, 0x40, 0x30, 0xff, 0xe3, 0xff, 0xaf, 0xaa, 0xc3, 0x3e,
+    0x3b, 0xad, 0xce, 0x39, 0xe7, 0x5c, 0x01, 0xab, 0x94, 0xc0, 0x90, 0x28, 0xa5, 0x61, 0x77, 0x9a,
+    0xc0, 0x72, 0x47, 0x7a, 0x90, 0xc5, 0x65, 0xb9, 0x44, 0x79, 0xc8, 0x05, 0x30, 0xa7, 0xaf, 0x8d,
+    0x5b, 0xef, 0x17, 0x2b, 0x03, 0x43, 0xe5, 0xb3, 0x55, 0x9a, 0x34, 0x2d, 0x5f, 0x63, 0xe9, 0x62,
+    0x90, 0xef, 0xec, 0x5a, 0xa5, 0x09, 0xbb, 0xb9, 0x98, 0x29, 0x9b, 0xfa, 0x2f, 0xd6, 0xc1, 0x6b,
+    0x91, 0xf3, 0xea, 0x47, 0xfd, 0x96, 0x72, 0x32, 0xba, 0x60, 0x8f, 0x10, 0xd8, 0xe7, 0x51, 0x18,
+    0xaa, 0x23, 0xe5, 0x06, 0x70, 0x1e, 0x64, 0x2c, 0x8e, 0xaf, 0x13, 0xc1, 0xfe, 0x09, 0x25, 0x82,
+    0xfb, 0x4c, 0x26, 0x74, 0xee, 0x3f, 0x46, 0x2c, 0x83, 0xb5, 0xe4, 0x0b, 0xc6, 0xc4, 0xbc, 0x43,
+    0x2a, 0x39, 0xb5, 0x76, 0xee, 0xe6, 0x16, 0xbb, 0x83, 0x16, 0x51, 0x64, 0xc0, 0xb3, 0xe5, 0x68,
+    0x3c, 0x16, 0x6e, 0xc9, 0xdb, 0x4d, 0x53, 0xcf, 0x7b, 0x44, 0x0f, 0xb2, 0x47, 0xa4, 0x8f, 0xa5,
+    0x7f, 0x52, 0xa3, 0xa7, 0xdf, 0x3f, 0xd3, 0x24, 0x60, 0x21, 0xfd, 0xf5, 0xd3, 0xf5, 0x05, 0x5b,
+    0xa4, 0x2c, 0x01, 0x75, 0xbb, 0x56, 0xc3, 0x7c, 0xf3, 0x43, 0x46, 0xf9, 0xe9, 0x70, 0xf1, 0x50,
+    0xf4, 0x94, 0x54, 0x23, 0xc9, 0x3a, 0xf0, 0xc9, 0x5b, 0x6a, 0xec, 0x2b, 0x72, 0x13, 0xf3, 0x8c,
+    0xad, 0xd4, 0x01, 0x8b, 0xea, 0x6c, 0xc0, 0x36, 0x44, 0x73, 0x45, 0x63, 0x22, 0x02, 0x7e, 0x90,
+    0xe2, 0x7c, 0x6f, 0xd3, 0xd2, 0x99, 0x3b, 0x96, 0x5d, 0x13, 0xc9, 0xd3, 0x60, 0xe7, 0x2c, 0xf5,
+    0x0b, 0x2f, 0x65, 0x11, 0xb6, 0xea, 0xab, 0xdb, 0xaf, 0x9a, 0x04, 0x57, 0x8b, 0x54, 0xac, 0x8d,
+    0x10, 0x86, 0x69, 0x12, 0x9a, 0xc4, 0x51, 0x52, 0x9b, 0x86, 0xfa, 0x39, 0x63, 0x8b, 0xf3, 0x34,
+    0x32, 0x3f, 0xbb, 0x5a, 0x9e, 0x3f, 0xd7, 0xc5, 0xd1, 0x44, 0xec, 0x46, 0x4e, 0x2b, 0xff, 0x62,
+    0x83, 0xae, 0x5f, 0x9b, 0x85, 0xac, 0x97, 0x6c, 0x2d, 0xa2, 0xe6, 0x49, 0x30, 0xa3, 0x01, 0x8d,
+    0x1e, 0x69, 0x78, 0x8e, 0x1e, 0x54, 0x9c, 0x9c, 0xe7, 0x5d, 0xc6, 0xf2, 0x25, 0x82, 0x8a, 0x52,
+    0x17, 0x50, 0x03, 0xa6, 0x38, 0x47, 0x8b, 0x4a, 0xbf, 0x50, 0xbd, 0x6a, 0x62, 0xa6, 0x5f, 0x06,
+    0xf7, 0x5d, 0xd3, 0x04, 0xae, 0x9c, 0xbd, 0xb7, 0xd1, 0x4b, 0xbf, 0x0c, 0xef, 0xbb, 0xd5, 0xc3,
+    0xf7, 0x76, 0xe0, 0xd1, 0x7d, 0x17, 0xcf, 0xdd, 0xad, 0x69, 0xb7, 0x6a, 0x28, 0x9f, 0xf8, 0x7c,
+    0xdb, 0x5d, 0x09, 0xcf, 0xf3, 0x2a, 0xf7, 0x29, 0x8a, 0x3e, 0x22, 0xaf, 0x5d, 0x20, 0xa8, 0x5f,
+    0x13, 0x90, 0xd7, 0x00, 0xf4, 0x9d, 0x9f, 0x65, 0x06, 0xeb, 0x28, 0x4a, 0x77, 0x4e, 0x6a, 0x71,
+    0xce, 0xca, 0x22, 0x99, 0x00, 0xa3, 0x28, 0x41, 0xd7, 0x29, 0xfc, 0x48, 0x06, 0xde, 0xdb, 0x63,
+    0xbc, 0xd0, 0xf0, 0x76, 0xf0, 0x57, 0xc2, 0xa6, 0x06, 0x84, 0xc8, 0x6b, 0x2a, 0x8d, 0xf5, 0xf1,
+    0xbc, 0x71, 0x2a, 0xc6, 0x2d, 0xfa, 0x64, 0x58, 0x29, 0x88, 0xd3, 0x8c, 0xcd, 0x60, 0x2e, 0x98,
+    0x34, 0x23, 0xb2, 0x9b, 0xaf, 0x69, 0x3b, 0x7e, 0x71, 0x6f, 0xcd, 0x4c, 0xb2, 0x3e, 0x97, 0x37,
+    0xc4, 0xad, 0x4f, 0xa6, 0xdf, 0x00, 0x89, 0xf6, 0x62, 0x24, 0x80, 0x2d, 0xb7, 0xc5, 0xdb, 0xd2,
+    0xbc, 0x3a, 0x03, 0x8c, 0x0d, 0x65, 0xb9, 0x03, 0xc8, 0xfc, 0x24, 0x64, 0x0b, 0x17, 0xf1, 0x0f,
+    0xf0, 0x26, 0x89, 0x77, 0x20, 0x7d, 0x62, 0x3b, 0x89, 0x9a, 0x4c, 0xdd, 0xca, 0xe2, 0x61, 0xce,
+    0x69, 0x4c, 0x30, 0xd5, 0x75, 0xd3, 0x80, 0x36, 0x1a, 0x08, 0x71, 0xfc, 0x3f, 0x5e, 0x11, 0xa1,
+    0xc5, 0xb7, 0x85, 0x2c, 0x96, 0x42, 0x4b, 0x69, 0x8f, 0xb6, 0xab, 0xdf, 0xb6, 0x73, 0xa5, 0x3c,
+    0xa1, 0xa9, 0x55, 0xd5, 0x3f, 0xf0, 0x8e, 0x80, 0xea, 0xc0, 0xdb, 0xaf, 0x2f, 0x40, 0x9d, 0x88,
+    0x25, 0x4a, 0x11, 0x7a, 0x2c, 0x94, 0xca, 0x31, 0xd0, 0xf6, 0xb0, 0x2c, 0x8b, 0xef, 0x5c, 0x6d,
+    0x81, 0x78, 0x7a, 0xc5, 0x85, 0x3d, 0x8d, 0xda, 0x0f, 0x90, 0x10, 0x6c, 0xbc, 0x00, 0x4c, 0x16,
+    0x16, 0x4f, 0xc2, 0xed, 0x8c, 0xac, 0x5b, 0x95, 0x31, 0xd4, 0xd4, 0xbc, 0xec, 0xcc, 0xf9, 0xce,
+    0x13, 0x82, 0x46, 0x8b, 0x99, 0x59, 0x77, 0x3a, 0x61, 0x5f, 0x87, 0x2b, 0xd8, 0xb2, 0x78, 0x18,
+    0xd3, 0x04, 0xb7, 0xbb, 0x66, 0xb5, 0x63, 0x35, 0x5e, 0x3a, 0x01, 0x6a, 0x3c, 0x37, 0x83, 0x80,
+    0x44, 0x9e, 0xe5, 0x49, 0x20, 0x94, 0x1d, 0xa3, 0x7e, 0x18, 0xcd, 0x22, 0x3c, 0x8d, 0x56, 0x87,
+    0x8d, 0xd6, 0x2b, 0x62, 0xb6, 0xf8, 0x56, 0xbe, 0x94, 0x9a, 0x44, 0xed, 0xd9, 0xbf, 0xe5, 0xf9,
+    0xb4, 0x97, 0x0b, 0xaf, 0x1e, 0x8e, 0x1b, 0x40, 0xf0, 0x0b, 0xf6, 0xc1, 0x1c, 0x42, 0xbe, 0xa7,
+    0x8e, 0x8f, 0x48, 0x8b, 0x4a, 0xb6, 0x62, 0x0f, 0x1b, 0xb1, 0x6d, 0xb3, 0xa9, 0xa0, 0xb3, 0x54,
+    0x6d, 0xf6, 0x39, 0x6a, 0x82, 0x7b, 0x6b, 0x5c, 0x8f, 0xca, 0x89, 0x9a, 0x75, 0xf2, 0x59, 0x5b,
+    0x44, 0x69, 0xad, 0x68, 0xa7, 0x25, 0xa2, 0xaa, 0x6a, 0x72, 0xed, 0x9b, 0x3f, 0xd5, 0x0b, 0x7b,
+    0xb0, 0x2a, 0xca, 0xf4, 0xc0, 0xca, 0x7a, 0x98, 0x44, 0xd6, 0x29, 0x2a, 0x58, 0x76, 0x8d, 0x7b,
+    0xf2, 0xa0, 0x70, 0x8c, 0x57, 0xa0, 0xa4, 0xbe, 0xc6, 0x5a, 0x6f, 0xea, 0x3d, 0xce, 0x13, 0x2f,
+    0xe5, 0xe9, 0xd1, 0x31, 0xd6, 0xfd, 0x20, 0x0f, 0x51, 0x02, 0xb9, 0xc1, 0xa2, 0x9b, 0x13, 0x68,
+    0xd1, 0x60, 0xcf, 0x99, 0xb0, 0x0c, 0x1c, 0xe1, 0x82, 0xc5, 0xb2, 0xbe, 0xfc, 0xcb, 0x60, 0xff,
+    0xf0, 0x30, 0x38, 0x02, 0xb4, 0x89, 0x1f, 0x7c, 0x9d, 0x65, 0x6c, 0x99, 0x84, 0x66, 0x2c, 0x9b,
+    0x4d, 0x7c, 0x77, 0x1f, 0x8f, 0x3a, 0xf1, 0xfe, 0x1a, 0xde, 0x99, 0x1b, 0x78, 0x43, 0xe4, 0xa0,
+    0x48, 0x7c, 0x8e, 0x42, 0x31, 0x1f, 0x93, 0x51, 0x0f, 0xaf, 0x04, 0x80, 0x2c, 0x78, 0x0b, 0x05,
+    0x73, 0x5a, 0xc2, 0x41, 0xab, 0x63, 0x74, 0xe2, 0x9e, 0xb3, 0x3e, 0x7f, 0x8a, 0xf8, 0xf5, 0x25,
+    0x10, 0x5b, 0x77, 0x1c, 0x3c, 0xcc, 0xc8, 0x05, 0xb7, 0xaf, 0x41, 0xba, 0xbf, 0xff, 0x76, 0xd1,
+    0x2c, 0xb9, 0xbd, 0x7a, 0x35, 0xd1, 0xe9, 0x74, 0x1f, 0xfe, 0xb5, 0x8b, 0x3e, 0xda, 0xfb, 0x5b,
+    0x8f, 0x1c, 0x1e, 0xa9, 0xcf, 0xc0, 0x1b, 0x1c, 0xfc, 0x69, 0xd9, 0x87, 0x20, 0xbc, 0x73, 0x8f,
+    0x13, 0xd0, 0x36, 0x33, 0x96, 0xe7, 0xe3, 0xb2, 0xac, 0x84, 0x0a, 0xc6, 0xe0, 0x2f, 0xfc, 0x48,
+    0x5e, 0xa1, 0x3a, 0xe7, 0x29, 0xd4, 0xd6, 0x9f, 0xb0, 0x47, 0x32, 0x56, 0xd7, 0x6a, 0x7a, 0x4e,
+    0x84, 0x8d, 0x77, 0x5f, 0xc6, 0x22, 0x44, 0x5e, 0x40, 0x69, 0x3c, 0x96, 0x67, 0x0c, 0xf4, 0xa9,
+    0xa3, 0x47, 0x39, 0x20, 0xe5, 0xf0, 0xc0, 0x2b, 0x8d, 0x97, 0xb3, 0x48, 0xf1, 0x12, 0x8c, 0xc5,
+    0x22, 0x4a, 0xf1, 0x91, 0x26, 0xb8, 0xe1, 0x0e, 0x0d, 0x4f, 0x80, 0x8b, 0xe9, 0x0c, 0x82, 0x1b,
+    0x8e, 0xa5, 0x8c, 0x47, 0x8a, 0x43, 0x47, 0xb0, 0x14, 0xe8, 0x6e, 0x70, 0x5c, 0xd9, 0x37, 0x8e,
+    0x3f, 0x49, 0x5a, 0x91, 0x88, 0x29, 0x3e, 0x84, 0x11, 0x4f, 0x63, 0x7f, 0x5d, 0xcc, 0xfe, 0x49,
+    0xe0, 0xc2, 0xe0, 0x01, 0xb7, 0x42, 0x5c, 0x8f, 0xcb, 0xd6, 0xe9, 0x67, 0xb8, 0x48, 0x65, 0x2c,
+    0x8b, 0x65, 0x4c, 0xa7, 0x10, 0x31, 0x5e, 0xa2, 0x5f, 0xb3, 0x58, 0xe4, 0x04, 0x9e, 0x37, 0xfe,
+    0xa3, 0x8e, 0x27, 0xe7, 0xbe, 0x1e, 0xfe, 0x31, 0x19, 0x33, 0xec, 0x1e, 0xbf, 0x2c, 0x64, 0xdd,
+    0x3a, 0x91, 0xd9, 0x2c, 0x8b, 0xa4, 0x9a, 0xc3, 0xcc, 0x5f, 0x7d, 0x4c, 0xa4, 0x0f, 0x9f, 0x67,
+    0xd4, 0xb7, 0xd7, 0x4c, 0xf7, 0x91, 0x74, 0x47, 0x29, 0x4f, 0x20, 0xf5, 0x9e, 0xee, 0xe5, 0xc7,
+    0xf7, 0x7a, 0x13, 0x7a, 0xc3, 0xfc, 0x90, 0x86, 0x10, 0x6a, 0x2b, 0x17, 0x3f, 0xbb, 0xc7, 0xff,
+    0x05, 0xe2, 0x12, 0x92, 0x0c, 0x0e, 0x30, 0x00, 0x00,
+};
+
+// /static/js/settings.js (3447 octets)
+static const uint8_t ASSET_6[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x5a, 0x6d, 0x73, 0xdb, 0x36,
+    0x12, 0xfe, 0xae, 0x5f, 0x81, 0xf8, 0x72, 0x21, 0xd5, 0x4a, 0x94, 0x9d, 0x5c, 0x9c, 0xd4, 0xb2,
+    0x7d, 0xe3, 0x24, 0x4e, 0xeb, 0xbb, 0xc4, 0xd6, 0x9d, 0xdd, 0xc9, 0x87, 0x4e, 0x67, 0x0c, 0x8b,
+    0x90, 0xc4, 0x9a, 0x22, 0x59, 0x12, 0xb2, 0xab, 0x71, 0xf5, 0xdf, 0x6f, 0x17, 0x2f, 0x24, 0x00,
+    0x52, 0xa2, 0x94, 0x99, 0xcc, 0x74, 0xe6, 0xda, 0xe9, 0x54, 0x26, 0x76, 0x1f, 0x2c, 0x16, 0xfb,
+    0x0a, 0x60, 0x9c, 0x26, 0x05, 0x27, 0x39, 0x9b, 0xe4, 0xac, 0x98, 0xbd, 0xe3, 0x09, 0x39, 0x21,
+    0x61, 0x3a, 0x5e, 0xcc, 0x59, 0xc2, 0x83, 0x29, 0xe3, 0xe7, 0x31, 0xc3, 0x9f, 0xef, 0x96, 0x17,
+    0xa1, 0xef, 0x29, 0xaa, 0xfe, 0x1d, 0x4f, 0xbc, 0xee, 0xb0, 0x33, 0x16, 0xac, 0x31, 0x2d, 0xf8,
+    0xcf, 0x59, 0x48, 0x39, 0x0b, 0xcf, 0xe3, 0x4d, 0xdc, 0x48, 0xd8, 0x5f, 0x48, 0xca, 0x8a, 0x3d,
+    0x61, 0xfc, 0x31, 0xcd, 0xef, 0x2f, 0x92, 0x30, 0x1a, 0x53, 0x9e, 0xe6, 0x9b, 0x10, 0x14, 0x6d,
+    0x3f, 0xd2, 0xc4, 0x35, 0x98, 0x1b, 0xf6, 0x07, 0xdf, 0x06, 0x81, 0x03, 0x5d, 0xc5, 0x5c, 0x2c,
+    0x0b, 0xce, 0xe6, 0x37, 0xd1, 0x9c, 0x6d, 0x5e, 0x81, 0xa4, 0xeb, 0x73, 0x20, 0xac, 0x98, 0x1f,
+    0xa3, 0x49, 0xf4, 0x3e, 0x4d, 0x12, 0x36, 0xe6, 0x51, 0x9a, 0x5c, 0x73, 0xca, 0x17, 0xc5, 0x26,
+    0x10, 0xa4, 0xef, 0x8f, 0x4b, 0x86, 0x7e, 0x21, 0x38, 0x6c, 0xbc, 0xeb, 0xeb, 0x8b, 0x0f, 0xad,
+    0x18, 0x45, 0x11, 0x85, 0x36, 0xdb, 0xc5, 0xa8, 0x95, 0x29, 0xca, 0x9c, 0x99, 0xa2, 0x69, 0x42,
+    0xe3, 0xf6, 0xb9, 0x04, 0x99, 0xa1, 0xb1, 0x31, 0x4d, 0xbe, 0xc0, 0x40, 0x8b, 0xc1, 0x20, 0x59,
+    0x5f, 0x00, 0x58, 0x26, 0xa3, 0x76, 0xa1, 0xf8, 0x94, 0xd2, 0x30, 0x4a, 0xa6, 0x5b, 0x6c, 0x58,
+    0xd1, 0x8f, 0x25, 0x6d, 0x03, 0x48, 0x54, 0xf0, 0xed, 0x10, 0x80, 0xd0, 0x5e, 0xfc, 0xa5, 0x1a,
+    0x7a, 0x97, 0x86, 0xcb, 0x56, 0x15, 0x94, 0x38, 0x77, 0x40, 0x6d, 0x88, 0x91, 0x6a, 0x94, 0xcf,
+    0xac, 0x28, 0xe8, 0x94, 0x6d, 0x94, 0x25, 0xad, 0x60, 0xe6, 0x92, 0xbc, 0x42, 0x0a, 0xd9, 0x43,
+    0x34, 0x66, 0x97, 0x74, 0xce, 0x2e, 0x92, 0x6c, 0xb1, 0x71, 0x4d, 0x92, 0xb4, 0x9f, 0x50, 0xd3,
+    0x10, 0x69, 0x86, 0x66, 0xd3, 0xca, 0x4b, 0x33, 0xc7, 0x72, 0x68, 0x36, 0xa2, 0x45, 0x01, 0x42,
+    0x85, 0xdb, 0xf0, 0x66, 0x8a, 0xb6, 0xe2, 0x9f, 0x47, 0xc9, 0x88, 0xb1, 0xbc, 0x68, 0xe5, 0x06,
+    0xc2, 0x7e, 0x86, 0x94, 0x8e, 0xf3, 0xcc, 0x28, 0x38, 0x43, 0x7c, 0xcd, 0x62, 0xf0, 0x88, 0x76,
+    0xcf, 0x91, 0xd4, 0x86, 0x29, 0xd2, 0x07, 0x76, 0x2d, 0x1c, 0xf3, 0x9a, 0x71, 0x0e, 0x26, 0x52,
+    0xb4, 0x19, 0x25, 0x30, 0xf4, 0x95, 0x2b, 0x17, 0x8a, 0xa5, 0x82, 0x83, 0x00, 0xc7, 0xf8, 0x4e,
+    0x78, 0x82, 0x63, 0x3d, 0xa0, 0x11, 0x1f, 0x3e, 0xa7, 0xe1, 0x16, 0xbe, 0xa6, 0x62, 0x43, 0x7f,
+    0x8e, 0xd4, 0x15, 0xce, 0xd8, 0xc0, 0xb8, 0x89, 0x78, 0xbc, 0xd1, 0xd0, 0x2c, 0x0c, 0x08, 0x58,
+    0x40, 0xde, 0x8c, 0xf4, 0x3e, 0x4e, 0x8b, 0x1d, 0x90, 0xc6, 0x48, 0x5e, 0x43, 0xda, 0xca, 0xee,
+    0x34, 0x90, 0x6d, 0x7c, 0xea, 0xeb, 0xd6, 0x16, 0xa8, 0x51, 0xea, 0x66, 0xa8, 0x65, 0x69, 0x0d,
+    0xc0, 0xa5, 0x20, 0x4e, 0xe0, 0xb5, 0x00, 0xb6, 0x70, 0x66, 0x1b, 0xa7, 0xee, 0xcf, 0xc6, 0xc6,
+    0xb7, 0x58, 0x90, 0xb5, 0xed, 0x56, 0xa4, 0x54, 0x1f, 0xdf, 0xd3, 0x64, 0xcc, 0xe2, 0x16, 0x14,
+    0x0d, 0x30, 0x16, 0xc4, 0x8d, 0x38, 0x98, 0xa0, 0x16, 0xe3, 0x31, 0x48, 0xda, 0x6a, 0x8a, 0x66,
+    0x86, 0x92, 0x2c, 0xae, 0x41, 0x16, 0x06, 0x52, 0xab, 0x19, 0x59, 0x18, 0xae, 0x19, 0xa9, 0xc1,
+    0xb6, 0xac, 0xa7, 0x31, 0x6c, 0x0b, 0x52, 0x5f, 0x2f, 0x46, 0x67, 0x61, 0x08, 0xae, 0x58, 0x6c,
+    0x83, 0x10, 0x65, 0x7d, 0x2a, 0xa9, 0x6b, 0x38, 0x57, 0xf7, 0x6d, 0xe1, 0x43, 0x61, 0xa4, 0xf7,
+    0xeb, 0x54, 0xfc, 0x91, 0x46, 0x31, 0x0b, 0x77, 0xd1, 0xf0, 0x44, 0x70, 0xb8, 0x0a, 0x9e, 0x54,
+    0x38, 0xad, 0xfa, 0x35, 0x11, 0x5c, 0xf5, 0xca, 0xb1, 0x36, 0xed, 0x2a, 0x04, 0x5b, 0xb9, 0xf8,
+    0x71, 0x91, 0xb3, 0xff, 0x32, 0x5a, 0xa4, 0x49, 0x1b, 0x37, 0x10, 0xf6, 0x73, 0x41, 0x69, 0x86,
+    0x53, 0x9e, 0x2f, 0x5b, 0x03, 0x28, 0xd0, 0xd8, 0xca, 0x94, 0xc2, 0x6c, 0x65, 0xf6, 0x4a, 0x6e,
+    0xdb, 0xea, 0x63, 0xa6, 0xab, 0x3a, 0x1d, 0xc4, 0x01, 0xe2, 0xa9, 0x53, 0xa5, 0xd8, 0x23, 0xe2,
+    0x9d, 0xc5, 0x2c, 0x17, 0xde, 0x0e, 0x3b, 0xe0, 0xf5, 0x3a, 0x32, 0x7d, 0xc2, 0xf7, 0x8f, 0x71,
+    0x9a, 0x86, 0x72, 0x50, 0x20, 0x88, 0x31, 0x1d, 0xa0, 0x60, 0x7c, 0x82, 0xe3, 0x14, 0xc7, 0x0f,
+    0x5e, 0xbe, 0x82, 0x41, 0x9d, 0xff, 0x8e, 0xc8, 0x41, 0xaf, 0x63, 0x24, 0xb4, 0x23, 0x72, 0xd8,
+    0x59, 0x49, 0x51, 0xe8, 0x03, 0x08, 0x49, 0xef, 0x62, 0xa6, 0x6b, 0x05, 0x90, 0xe6, 0x97, 0x5f,
+    0x95, 0x98, 0x22, 0xef, 0xb1, 0x50, 0x0d, 0xc1, 0x48, 0xb2, 0x88, 0x63, 0x39, 0x56, 0x99, 0xc8,
+    0x19, 0x07, 0x49, 0x32, 0x7e, 0x91, 0x8c, 0xf2, 0x74, 0xaa, 0xcc, 0x7c, 0x42, 0xe3, 0x82, 0x0d,
+    0x3b, 0x93, 0x45, 0x22, 0x48, 0x48, 0x94, 0x44, 0x5c, 0x2f, 0x77, 0x04, 0xa1, 0xc8, 0xef, 0xc2,
+    0x92, 0xab, 0xca, 0x3e, 0x00, 0x93, 0x3f, 0x7f, 0x00, 0xbd, 0x61, 0xc5, 0xc4, 0x12, 0x96, 0x83,
+    0x09, 0xc6, 0xd1, 0xf8, 0xde, 0xeb, 0xe9, 0xf2, 0xff, 0x2c, 0x8e, 0x3f, 0x50, 0x4e, 0x41, 0x7f,
+    0x46, 0x7d, 0xb7, 0x81, 0x4d, 0x53, 0xe9, 0x55, 0x21, 0x63, 0x53, 0x36, 0xde, 0x04, 0x51, 0xa3,
+    0x07, 0x90, 0xe6, 0x1c, 0xbc, 0x51, 0xfe, 0x1a, 0x83, 0x34, 0x25, 0x3b, 0xcf, 0x6d, 0x40, 0x10,
+    0x2e, 0x63, 0xa6, 0x69, 0xe0, 0xb7, 0x03, 0xf8, 0x26, 0x66, 0x49, 0x74, 0x93, 0xa2, 0x32, 0xaa,
+    0x89, 0x4b, 0xf3, 0xdd, 0x71, 0xde, 0x5a, 0x60, 0x6d, 0xe3, 0x37, 0x63, 0x7a, 0xc5, 0x2f, 0x22,
+    0xd9, 0x8e, 0xac, 0x6e, 0xc8, 0x69, 0x63, 0x37, 0x42, 0x9d, 0xd8, 0x37, 0xe9, 0xec, 0x1b, 0x77,
+    0x2a, 0xcd, 0x58, 0xe2, 0x2c, 0xd8, 0xf1, 0xf6, 0xdd, 0x26, 0x85, 0x9d, 0xbf, 0x48, 0x38, 0xcb,
+    0x1f, 0x68, 0xec, 0xcb, 0xee, 0x12, 0x1b, 0xb9, 0x1e, 0x39, 0xd8, 0xdf, 0xdf, 0x17, 0x32, 0x99,
+    0xa6, 0xed, 0xc3, 0x17, 0xa7, 0xfb, 0x08, 0xc6, 0xd0, 0x98, 0x8a, 0x2e, 0x02, 0xe7, 0xf5, 0xbd,
+    0x59, 0x14, 0x86, 0x4c, 0x04, 0x11, 0x40, 0x46, 0xa8, 0x74, 0xc1, 0x7d, 0xd7, 0xd2, 0x4b, 0xf8,
+    0x55, 0xe5, 0x7e, 0xd5, 0xe4, 0xc2, 0xf1, 0x74, 0x7b, 0xf0, 0x88, 0x1e, 0xcd, 0x1e, 0x09, 0x4c,
+    0xcf, 0x70, 0x7a, 0xb3, 0xd9, 0x0c, 0xb0, 0x0f, 0x05, 0x65, 0xc0, 0x2a, 0xb1, 0xea, 0x01, 0xe2,
+    0x80, 0xa7, 0x9f, 0xd2, 0x31, 0x44, 0x17, 0x24, 0xb8, 0xe6, 0x39, 0x08, 0xe8, 0xdb, 0xd3, 0x4c,
+    0xd2, 0x7c, 0x4e, 0xf9, 0xa7, 0xaa, 0xeb, 0x56, 0x6e, 0xce, 0x17, 0x79, 0x42, 0x6e, 0xf1, 0xbb,
+    0x92, 0x04, 0x62, 0xd5, 0xf3, 0xa7, 0x6a, 0xe6, 0x46, 0xe4, 0xd5, 0xad, 0x85, 0xed, 0x2a, 0x0b,
+    0x80, 0xad, 0xf6, 0xde, 0x91, 0xb7, 0x41, 0x14, 0xd8, 0x4c, 0xc6, 0xc7, 0x33, 0xdf, 0x1b, 0xd0,
+    0x2c, 0x1a, 0xe8, 0x12, 0xab, 0x13, 0xf0, 0x19, 0x4b, 0x7c, 0xc0, 0xce, 0x40, 0x2b, 0x90, 0xc8,
+    0x4e, 0x89, 0xfe, 0x1d, 0xfc, 0x06, 0xf9, 0xc2, 0xef, 0x6a, 0x12, 0x80, 0xa1, 0x38, 0xfc, 0xd4,
+    0x91, 0x8b, 0x40, 0xa5, 0xcb, 0x8a, 0x4c, 0x0c, 0x01, 0xbe, 0xfc, 0xae, 0x36, 0xc2, 0x18, 0x0a,
+    0xd4, 0xbe, 0x42, 0xae, 0x0a, 0x97, 0x40, 0xe7, 0xb4, 0x53, 0x01, 0xd8, 0xc7, 0x42, 0xa4, 0x50,
+    0xa4, 0xad, 0x06, 0xc9, 0x9f, 0x7f, 0x3a, 0x99, 0xc2, 0x18, 0x1c, 0x76, 0xac, 0xe6, 0xc6, 0xc6,
+    0xd0, 0x43, 0x0d, 0x08, 0x7a, 0x68, 0xd8, 0x89, 0x26, 0x44, 0x4a, 0x87, 0xc1, 0x04, 0xf5, 0x69,
+    0x74, 0x69, 0x36, 0x1c, 0x12, 0x04, 0x72, 0xb4, 0x01, 0x51, 0x0e, 0x38, 0x78, 0x81, 0x6a, 0x86,
+    0x10, 0xb7, 0xd6, 0x49, 0x35, 0xa0, 0x2b, 0x72, 0xdc, 0x72, 0xf8, 0x17, 0x54, 0x3e, 0xa6, 0xb8,
+    0x57, 0x2c, 0xcf, 0xf1, 0xdc, 0xe5, 0x54, 0x19, 0x6d, 0x1a, 0xb3, 0x40, 0x7c, 0xf2, 0xbd, 0x73,
+    0x31, 0x22, 0x76, 0x14, 0xfb, 0x74, 0x29, 0x13, 0x91, 0xbb, 0x7a, 0x04, 0xee, 0x28, 0xc8, 0xd6,
+    0xec, 0x89, 0xc8, 0x4e, 0x68, 0xba, 0x4d, 0x5e, 0x62, 0x93, 0x46, 0xc5, 0x55, 0x12, 0x47, 0x09,
+    0xc3, 0x75, 0xe0, 0x02, 0xcd, 0xbf, 0xdd, 0xf3, 0x21, 0xe9, 0xae, 0x62, 0xe7, 0x4e, 0x88, 0x57,
+    0x9e, 0x04, 0x91, 0x54, 0x70, 0x78, 0xa5, 0x7b, 0xe3, 0x49, 0x90, 0x63, 0xae, 0x9e, 0x4e, 0xb1,
+    0x57, 0x9a, 0x76, 0x45, 0x18, 0x08, 0xb9, 0xcb, 0x2c, 0x93, 0xc9, 0x0e, 0xd3, 0x94, 0xc4, 0xab,
+    0xba, 0x06, 0x5c, 0xc3, 0x56, 0x4b, 0x2f, 0x37, 0x8b, 0xbc, 0x78, 0x61, 0xec, 0x1c, 0xa8, 0x5c,
+    0xc5, 0x4c, 0x16, 0x96, 0xbb, 0xed, 0x1c, 0x3a, 0xb9, 0x62, 0x94, 0x0c, 0xde, 0xb0, 0x99, 0xde,
+    0x59, 0xe3, 0x24, 0xed, 0x4b, 0x93, 0x41, 0x1c, 0x5d, 0xf4, 0x2b, 0x5e, 0x34, 0x3e, 0x07, 0xdf,
+    0x12, 0x4e, 0x5b, 0xad, 0xf7, 0x73, 0x72, 0x0f, 0x51, 0x2c, 0x21, 0x4a, 0x07, 0x8a, 0xfd, 0x62,
+    0xb4, 0x89, 0xf9, 0x62, 0x24, 0x58, 0xfb, 0x5e, 0x59, 0x34, 0x42, 0x11, 0x6a, 0x11, 0x89, 0x0f,
+    0x40, 0xb3, 0xaf, 0x4a, 0x26, 0x71, 0x1a, 0xf5, 0x9f, 0x05, 0x8d, 0x23, 0x8e, 0x07, 0x37, 0xde,
+    0x28, 0x4d, 0x73, 0xcf, 0x1c, 0x7b, 0x8f, 0x4b, 0xc3, 0x11, 0xb1, 0x96, 0x90, 0x26, 0x53, 0x86,
+    0x04, 0xa8, 0x61, 0x81, 0x75, 0x4a, 0xfa, 0x87, 0xfb, 0xa8, 0xc8, 0x1a, 0xd4, 0xf9, 0x1f, 0x90,
+    0x84, 0x62, 0x90, 0x12, 0xc8, 0x9b, 0xb0, 0x2a, 0xbd, 0x28, 0xe3, 0x31, 0x31, 0xdf, 0x34, 0x63,
+    0xfe, 0x08, 0x05, 0xe3, 0xd7, 0xc0, 0xbd, 0x6d, 0x86, 0x83, 0xfc, 0x97, 0xaf, 0x81, 0x7b, 0xa4,
+    0x79, 0x82, 0xa7, 0x64, 0x68, 0x72, 0xd5, 0xf1, 0x9e, 0xa3, 0xfc, 0xdb, 0xe7, 0x4f, 0x38, 0xc3,
+    0x8a, 0x84, 0xef, 0xe6, 0xc4, 0x7f, 0xfe, 0x64, 0x4d, 0xb0, 0xea, 0xde, 0x0e, 0x4d, 0x56, 0xd3,
+    0x48, 0x6e, 0x0d, 0x23, 0xd1, 0x6c, 0x62, 0x7e, 0x91, 0x46, 0xb4, 0x2f, 0x6d, 0x63, 0x9b, 0x97,
+    0x69, 0x59, 0xdc, 0x7e, 0xa5, 0x7d, 0x96, 0x7b, 0xba, 0xc6, 0x3c, 0x85, 0x39, 0x35, 0xda, 0x5e,
+    0x39, 0xd2, 0xa8, 0x1c, 0x77, 0x74, 0x8d, 0x10, 0xae, 0x53, 0xbb, 0x05, 0x82, 0x6f, 0xc4, 0xae,
+    0x86, 0x4a, 0x23, 0x67, 0xf3, 0xf4, 0x81, 0x99, 0xc5, 0x86, 0x79, 0x9c, 0xb9, 0xbe, 0x24, 0xa9,
+    0x9d, 0x36, 0x6e, 0xa8, 0x5e, 0x8c, 0x12, 0x3e, 0x8c, 0x0a, 0xec, 0x3e, 0x42, 0x58, 0x03, 0xcf,
+    0x17, 0xcc, 0x4e, 0xd2, 0xb8, 0xd8, 0x01, 0x52, 0x7f, 0x5d, 0x9e, 0x6e, 0xea, 0x6d, 0xcc, 0x7c,
+    0x2c, 0xf2, 0x23, 0x36, 0x3b, 0x55, 0xdc, 0xbb, 0x34, 0xd6, 0xba, 0x53, 0x45, 0x86, 0xce, 0x51,
+    0x9b, 0x2f, 0x00, 0x6f, 0x9d, 0xf2, 0x19, 0x38, 0xcc, 0xbe, 0xa5, 0x74, 0x5b, 0x91, 0x75, 0x8d,
+    0x57, 0xc1, 0x7f, 0x83, 0x52, 0x1b, 0xd8, 0xd6, 0x69, 0x56, 0xb5, 0x63, 0xdb, 0xe7, 0x55, 0xc4,
+    0x41, 0x6f, 0x25, 0x5f, 0xa2, 0x8f, 0x51, 0x79, 0x9e, 0x6d, 0xe6, 0x55, 0xcd, 0x16, 0xa7, 0x53,
+    0xdf, 0xfb, 0xb9, 0x40, 0xda, 0x79, 0x3a, 0xbe, 0x97, 0x0c, 0xc8, 0x2e, 0x34, 0x8d, 0x52, 0x35,
+    0xed, 0x02, 0x74, 0xca, 0x9f, 0x81, 0xda, 0x36, 0xcb, 0xff, 0xa3, 0x7d, 0x18, 0x36, 0x67, 0x5d,
+    0x7b, 0xd5, 0x58, 0xe2, 0x42, 0xda, 0x98, 0xf1, 0x39, 0x1e, 0xd6, 0x78, 0x5e, 0x83, 0x2a, 0x83,
+    0x22, 0xcd, 0xb9, 0xef, 0xd3, 0x1e, 0xb9, 0xeb, 0xe2, 0x76, 0xde, 0xc9, 0x7c, 0xd4, 0x27, 0x54,
+    0xfc, 0x68, 0xd2, 0x7e, 0x00, 0xa5, 0xf1, 0x39, 0x05, 0x1b, 0x48, 0x74, 0x57, 0x7f, 0x5a, 0xb6,
+    0x04, 0x32, 0x6e, 0x42, 0x05, 0x2e, 0xd5, 0x25, 0xf6, 0xe9, 0xda, 0xfa, 0x76, 0x01, 0x84, 0x9a,
+    0x53, 0x4f, 0xa1, 0x78, 0xd9, 0x78, 0x91, 0x43, 0x94, 0xbe, 0x59, 0x66, 0x4c, 0x71, 0x1a, 0x5f,
+    0xb0, 0x18, 0x29, 0xf9, 0x58, 0x32, 0xce, 0x97, 0x19, 0xae, 0x1d, 0xb8, 0xc5, 0xf2, 0xbe, 0x87,
+    0x08, 0xde, 0x39, 0xe6, 0xb9, 0x30, 0x1a, 0x71, 0xd0, 0x73, 0xb2, 0xf7, 0xfc, 0x89, 0x81, 0x1a,
+    0x33, 0xf6, 0xd3, 0xcd, 0xe7, 0x4f, 0x25, 0x2b, 0x0e, 0x75, 0x57, 0x7b, 0xa7, 0x40, 0x1c, 0x9e,
+    0x6e, 0xa0, 0x38, 0x1e, 0xc0, 0xb8, 0x22, 0xb2, 0x57, 0x65, 0x0f, 0x19, 0x22, 0x1a, 0x03, 0x9d,
+    0xe3, 0xbb, 0x05, 0xe7, 0xb0, 0x35, 0x62, 0x97, 0x4f, 0xf6, 0xee, 0x78, 0x42, 0xe0, 0xbf, 0x7e,
+    0x31, 0x17, 0xff, 0xcb, 0xf2, 0x68, 0x4e, 0xf3, 0xa5, 0x4e, 0x13, 0xe5, 0x35, 0xd2, 0xde, 0x0e,
+    0xe2, 0x47, 0x1a, 0x7b, 0x42, 0x0b, 0xb0, 0x8b, 0x7e, 0x16, 0x2f, 0xa6, 0x7b, 0xa7, 0xc7, 0x83,
+    0xe8, 0x94, 0xa8, 0x6c, 0xd3, 0x39, 0x1e, 0x48, 0x29, 0x80, 0x5a, 0x4a, 0x36, 0xe0, 0xf9, 0x69,
+    0xe7, 0x56, 0xda, 0x8f, 0x7b, 0x49, 0x14, 0x44, 0xc0, 0x94, 0xe3, 0x64, 0xa0, 0x7c, 0xd4, 0x29,
+    0xb4, 0x19, 0xfa, 0x5c, 0xea, 0xf7, 0x05, 0xcb, 0x97, 0xb2, 0xf4, 0x4e, 0x73, 0xe8, 0xa0, 0x7c,
+    0x2f, 0x70, 0x45, 0xf7, 0xba, 0xa5, 0x5d, 0xe0, 0x62, 0x85, 0x4d, 0xdc, 0x6d, 0xec, 0x77, 0x7d,
+    0xd6, 0xb5, 0x4c, 0x07, 0x56, 0x06, 0x33, 0xb3, 0x80, 0xd3, 0x1c, 0xf6, 0x3e, 0x10, 0xed, 0x30,
+    0x58, 0xb1, 0x27, 0xd7, 0x00, 0xf8, 0xf0, 0xf5, 0x8c, 0x43, 0x73, 0x07, 0x1f, 0xc0, 0x5b, 0x4a,
+    0x4d, 0xa1, 0xc3, 0xb8, 0x8d, 0xb7, 0x2f, 0xf4, 0xa4, 0x1c, 0xc5, 0x76, 0x96, 0x66, 0x8b, 0x14,
+    0x96, 0xa8, 0xfc, 0x25, 0x82, 0x0f, 0x65, 0xe9, 0xa1, 0xb4, 0x8b, 0xcb, 0xd4, 0x55, 0x98, 0xe2,
+    0x53, 0xf7, 0xb1, 0x9e, 0xa7, 0xcf, 0xb3, 0xe2, 0x34, 0x2f, 0xd9, 0xac, 0x82, 0xec, 0x84, 0xf4,
+    0x5f, 0xcb, 0x72, 0xc7, 0x61, 0x35, 0x0b, 0x32, 0x9b, 0xbf, 0xad, 0x80, 0x3a, 0x29, 0x8b, 0x3c,
+    0x07, 0x52, 0xd5, 0x63, 0x3b, 0xa3, 0xbd, 0x69, 0x44, 0x53, 0xe5, 0x58, 0x03, 0x9a, 0x51, 0x8d,
+    0xe9, 0x18, 0xe7, 0x32, 0xab, 0xca, 0xb5, 0x81, 0xb9, 0x2c, 0x70, 0x56, 0x65, 0x73, 0x7f, 0x5c,
+    0x64, 0xb4, 0x74, 0x97, 0xe7, 0x4f, 0x15, 0x13, 0x18, 0x7b, 0x65, 0xeb, 0xcf, 0x9f, 0xca, 0xcd,
+    0x59, 0x29, 0x63, 0x07, 0x1f, 0x34, 0xe6, 0x5d, 0x61, 0xd1, 0x57, 0x56, 0x80, 0xdd, 0xe3, 0x01,
+    0xc2, 0x9e, 0xde, 0xd6, 0x2c, 0xc0, 0x8d, 0x2c, 0x46, 0x44, 0x51, 0xdd, 0xca, 0xb3, 0xea, 0x13,
+    0x66, 0x79, 0xe3, 0xaf, 0x93, 0x13, 0x58, 0x07, 0x5a, 0x9c, 0xd7, 0x34, 0x70, 0x35, 0x3a, 0xbf,
+    0xf4, 0x8c, 0x63, 0x0b, 0x4f, 0xac, 0xec, 0xb4, 0xe6, 0xaf, 0x31, 0xa4, 0xaf, 0x3e, 0xa2, 0xa8,
+    0x75, 0x5c, 0xc1, 0x4f, 0x25, 0xae, 0x50, 0x0c, 0xca, 0xe0, 0x62, 0x7f, 0x39, 0x1f, 0x6d, 0x0b,
+    0xad, 0x50, 0x81, 0x63, 0x3d, 0x28, 0xb8, 0xfc, 0x38, 0x5e, 0x84, 0xac, 0xf0, 0xbd, 0x2f, 0xa3,
+    0xb3, 0x97, 0x5e, 0x77, 0x47, 0x6c, 0xe0, 0xd9, 0x16, 0xfc, 0xd5, 0x57, 0x80, 0xbf, 0xda, 0x16,
+    0xfc, 0x2b, 0xb0, 0x4d, 0xe8, 0xed, 0x19, 0x85, 0xd9, 0xb0, 0xd0, 0x64, 0x2e, 0xad, 0xaa, 0x39,
+    0x04, 0xa1, 0x5b, 0xd4, 0x0e, 0xc1, 0x1b, 0x52, 0x2a, 0xb4, 0xe1, 0xbe, 0x88, 0x9a, 0x49, 0x20,
+    0x03, 0x21, 0x6c, 0xb7, 0x8a, 0x61, 0xb5, 0xcb, 0x51, 0xb7, 0xe5, 0x51, 0xb3, 0x12, 0x9e, 0x12,
+    0x70, 0x10, 0xe4, 0x5a, 0xed, 0xdd, 0x96, 0x7c, 0xf5, 0x23, 0x19, 0xa4, 0x28, 0x87, 0xad, 0xdb,
+    0xc9, 0x92, 0xc4, 0xb3, 0xfb, 0x16, 0x31, 0xb7, 0x5b, 0x32, 0x51, 0x58, 0xf7, 0x83, 0xbe, 0x8a,
+    0xa9, 0x43, 0x4d, 0x20, 0x79, 0x88, 0x9a, 0xcc, 0xba, 0x7b, 0x5c, 0x5f, 0x77, 0x39, 0x27, 0xd2,
+    0x0d, 0x45, 0x4f, 0xa5, 0xeb, 0xda, 0xc9, 0xb2, 0xef, 0x1c, 0x1c, 0xb8, 0x02, 0xeb, 0x12, 0xab,
+    0x92, 0x79, 0xdd, 0xd5, 0x84, 0x39, 0x8b, 0x79, 0xf4, 0xed, 0x97, 0x71, 0xc1, 0xe5, 0x84, 0x18,
+    0xb0, 0xe1, 0x2e, 0xa3, 0x4b, 0xa4, 0x79, 0x0d, 0xed, 0x34, 0xd7, 0xbc, 0x39, 0x9a, 0x48, 0xdf,
+    0x00, 0x57, 0x84, 0x0d, 0xdb, 0xa4, 0x89, 0xa3, 0x02, 0x43, 0x47, 0xb5, 0x0e, 0x57, 0xc0, 0xc0,
+    0x0a, 0x64, 0x9d, 0x0d, 0xa3, 0x56, 0x60, 0x6b, 0x25, 0x14, 0x81, 0x4e, 0xa6, 0xb9, 0x67, 0xb6,
+    0x0c, 0x2f, 0x5e, 0x90, 0x67, 0x7a, 0x09, 0xe2, 0x5c, 0x10, 0x2f, 0x94, 0x7c, 0x6f, 0x14, 0x33,
+    0x0a, 0x89, 0x82, 0xe1, 0x89, 0x36, 0x81, 0x4e, 0x4b, 0x96, 0xfa, 0x9a, 0x30, 0x68, 0xb7, 0x24,
+    0xad, 0xc9, 0xd5, 0x5a, 0x9b, 0xaa, 0x97, 0xd2, 0xeb, 0xcd, 0x4a, 0x76, 0x8b, 0x9b, 0xaf, 0xa1,
+    0x4a, 0x1a, 0x71, 0xdd, 0x07, 0x65, 0x50, 0xc1, 0x3f, 0x88, 0xee, 0x10, 0xfd, 0x1a, 0x76, 0xf2,
+    0x48, 0xec, 0x67, 0xaf, 0x93, 0x95, 0x57, 0x68, 0xfa, 0x17, 0x5e, 0x8f, 0xd5, 0x3a, 0x51, 0x35,
+    0x19, 0x14, 0x3f, 0x4f, 0x9d, 0x39, 0xe3, 0xb3, 0x14, 0xef, 0xdc, 0x46, 0x57, 0xd7, 0x37, 0x5e,
+    0xaf, 0x33, 0x63, 0x34, 0x14, 0x37, 0x6d, 0x4f, 0x1d, 0x4f, 0x39, 0x77, 0x1f, 0xd3, 0x93, 0x07,
+    0x24, 0x34, 0xcb, 0x62, 0x3c, 0xa5, 0x03, 0x29, 0x07, 0xd8, 0xab, 0x02, 0xf9, 0xaa, 0xd7, 0xc1,
+    0xc7, 0x3a, 0x47, 0xe4, 0x5f, 0xd7, 0x57, 0x97, 0x41, 0x21, 0xce, 0xbc, 0xa3, 0xc9, 0xd2, 0x37,
+    0xa4, 0xec, 0x8a, 0x7e, 0x6d, 0xf7, 0xae, 0x77, 0xab, 0x9b, 0xb9, 0xf2, 0x40, 0x4f, 0x95, 0x15,
+    0xe2, 0x5a, 0xa0, 0xee, 0x96, 0xe0, 0x68, 0xb3, 0xf4, 0xd1, 0xbc, 0x89, 0x11, 0x71, 0xb1, 0x27,
+    0xdb, 0xe8, 0x28, 0xb3, 0xaf, 0x22, 0xec, 0x33, 0xfa, 0xea, 0x22, 0x42, 0x57, 0x18, 0x6b, 0x27,
+    0x30, 0xae, 0x4d, 0x4c, 0x7c, 0xf5, 0x6e, 0xc1, 0x3a, 0xbd, 0x93, 0x9d, 0x6b, 0x3a, 0x86, 0x48,
+    0x9e, 0xcb, 0xc7, 0x7a, 0xbb, 0x9c, 0x17, 0x6b, 0xdd, 0x40, 0xb7, 0x0a, 0xe1, 0x16, 0x0d, 0xd8,
+    0xe9, 0x69, 0xdb, 0x35, 0xa7, 0x3b, 0xa5, 0xf9, 0x22, 0x86, 0xae, 0x4d, 0xa9, 0x06, 0x86, 0x3f,
+    0x53, 0x3e, 0x0b, 0x72, 0x9a, 0x84, 0xe9, 0x1c, 0x82, 0x0d, 0x74, 0x9a, 0xc1, 0xab, 0x21, 0x19,
+    0x0c, 0xc8, 0x9b, 0xfd, 0xbf, 0xeb, 0x0b, 0x7c, 0x92, 0x03, 0x87, 0x50, 0xbd, 0xc3, 0xbe, 0xab,
+    0xf6, 0xbd, 0x83, 0x1f, 0x5e, 0x06, 0x07, 0x87, 0x6f, 0x83, 0x83, 0xc0, 0x23, 0xdf, 0xcb, 0xa9,
+    0xf1, 0xee, 0x37, 0xf7, 0x6d, 0x29, 0xbe, 0x23, 0x2f, 0x5f, 0xbf, 0xee, 0x76, 0x87, 0x7f, 0x85,
+    0x43, 0x59, 0x99, 0xb6, 0x9a, 0x8f, 0xbd, 0x76, 0x5a, 0xce, 0xc6, 0x13, 0xb2, 0xc3, 0xd7, 0xf2,
+    0xe8, 0x10, 0xeb, 0xe8, 0xee, 0x56, 0xc7, 0x65, 0xa4, 0xb9, 0xba, 0xde, 0xc9, 0x5a, 0xbd, 0x4a,
+    0x57, 0xea, 0x7d, 0x40, 0x40, 0x54, 0xb8, 0x1c, 0xcf, 0xd8, 0xf8, 0x5e, 0x84, 0xcb, 0x32, 0x2b,
+    0xc0, 0x72, 0x20, 0x32, 0x2d, 0x09, 0x9d, 0xd2, 0x28, 0x09, 0xb4, 0x09, 0x5b, 0xb9, 0x6b, 0xcd,
+    0xbe, 0x47, 0x99, 0x7a, 0x49, 0x22, 0x0a, 0x93, 0xea, 0x69, 0x4a, 0xa3, 0xaa, 0xdd, 0xd7, 0x27,
+    0x0e, 0x51, 0x89, 0x65, 0xda, 0xbd, 0x39, 0xe7, 0xfa, 0x82, 0xc1, 0x4d, 0xe5, 0x96, 0xa4, 0x5d,
+    0x2b, 0x04, 0xad, 0x01, 0xac, 0x27, 0x74, 0x67, 0xf1, 0x75, 0x1d, 0xcb, 0xe7, 0x1b, 0x88, 0x5e,
+    0x3d, 0x1a, 0x69, 0x5c, 0xb7, 0xf5, 0x30, 0xc4, 0xa1, 0x90, 0x20, 0xe6, 0x8a, 0x8d, 0x89, 0xb6,
+    0x5f, 0xb0, 0x29, 0x9d, 0xbd, 0xde, 0x66, 0xb8, 0x8d, 0xcb, 0xad, 0xdf, 0x3b, 0xfb, 0x65, 0x3c,
+    0xb0, 0x26, 0x92, 0x51, 0xdb, 0xc9, 0xeb, 0x48, 0x5a, 0xaf, 0x5d, 0x9d, 0xdc, 0xaf, 0xdb, 0x69,
+    0x4b, 0xcb, 0xb5, 0xe7, 0x0d, 0xe6, 0xdd, 0x30, 0x7b, 0x5c, 0xfb, 0x3a, 0xa5, 0xf1, 0xf6, 0xb2,
+    0x7a, 0xa4, 0x52, 0xbb, 0x45, 0xb4, 0xdf, 0xa8, 0x38, 0x4f, 0x3a, 0x35, 0x49, 0xf5, 0x52, 0x25,
+    0xa3, 0x79, 0x01, 0xc8, 0xdc, 0x6f, 0xb8, 0xdf, 0xec, 0x3a, 0xaf, 0x58, 0x4a, 0xda, 0x35, 0x57,
+    0x8c, 0x5d, 0x4c, 0xe3, 0xa2, 0xc2, 0x31, 0x16, 0x64, 0x5c, 0xa2, 0x1a, 0xd5, 0xcd, 0x07, 0xf1,
+    0x91, 0xe0, 0xbb, 0x55, 0x82, 0x87, 0x9f, 0x29, 0x27, 0x77, 0x50, 0xec, 0x40, 0x12, 0x10, 0x2f,
+    0x6a, 0xab, 0xda, 0xa5, 0x06, 0x27, 0x17, 0x6c, 0x40, 0x9d, 0xc9, 0x60, 0x3f, 0x4a, 0x23, 0xb0,
+    0x39, 0x71, 0xfd, 0xd4, 0x0a, 0x68, 0xe3, 0x69, 0x0d, 0x61, 0x25, 0xb6, 0x66, 0xe4, 0x19, 0x96,
+    0x70, 0xdf, 0xa9, 0x7f, 0xbc, 0xf5, 0x84, 0xfa, 0xe4, 0xf3, 0x98, 0xbc, 0x5d, 0x27, 0x61, 0x19,
+    0x97, 0xe6, 0x8b, 0x42, 0xc8, 0x48, 0x39, 0xc1, 0xd8, 0xc5, 0xc9, 0x5b, 0x88, 0x5e, 0x34, 0x07,
+    0xa3, 0xc5, 0xab, 0xe4, 0x38, 0x95, 0x4f, 0x9c, 0xb7, 0x12, 0xfc, 0xc4, 0x12, 0xaf, 0x2b, 0x2c,
+    0x28, 0x66, 0x9c, 0xad, 0x91, 0x52, 0xf8, 0x83, 0x79, 0x39, 0xaf, 0x48, 0x06, 0xf2, 0x68, 0xf4,
+    0x5b, 0x16, 0x5c, 0x86, 0x40, 0x5f, 0x5b, 0x70, 0x35, 0xd5, 0x52, 0x4a, 0xd1, 0xa5, 0x13, 0xa1,
+    0xb7, 0x85, 0xba, 0x0e, 0x98, 0x40, 0xab, 0xb2, 0x0c, 0xc8, 0x0d, 0x24, 0x05, 0x69, 0x8b, 0xe4,
+    0x31, 0x8a, 0x63, 0x9c, 0x88, 0xd3, 0x5c, 0x34, 0x82, 0xb8, 0x80, 0x25, 0x6a, 0x3f, 0x99, 0xb2,
+    0x22, 0x70, 0x5e, 0x7c, 0xf8, 0xea, 0xe0, 0xed, 0x11, 0xba, 0xce, 0xf4, 0x31, 0x80, 0x06, 0x57,
+    0xac, 0x14, 0xa2, 0x0c, 0xbe, 0x44, 0x17, 0x6f, 0x32, 0x7a, 0xe4, 0xb5, 0x53, 0x7b, 0x29, 0x81,
+    0x64, 0x40, 0xc1, 0x29, 0x50, 0x22, 0xa2, 0x15, 0x0d, 0x3a, 0x83, 0xc4, 0xeb, 0x6f, 0xae, 0xba,
+    0xbc, 0xee, 0x8e, 0xd5, 0x16, 0x4c, 0x21, 0xee, 0xe6, 0xf5, 0x24, 0x46, 0xa9, 0xd5, 0xae, 0x9f,
+    0xaa, 0x48, 0x0a, 0xbb, 0x3b, 0xea, 0x0a, 0x93, 0xe9, 0xd5, 0xdd, 0x6f, 0x18, 0x06, 0xc0, 0xc0,
+    0x20, 0xfb, 0xfb, 0xf6, 0x93, 0x85, 0x9e, 0x69, 0x86, 0x6e, 0x30, 0xae, 0x3d, 0xd7, 0x2a, 0x5b,
+    0x47, 0x58, 0xe3, 0x24, 0xca, 0xe7, 0xe0, 0x3e, 0x39, 0x23, 0xcb, 0x74, 0x01, 0xe2, 0xaa, 0x1f,
+    0x8f, 0x34, 0x11, 0xa2, 0x08, 0x6e, 0x42, 0x41, 0x3e, 0xbd, 0x66, 0xfc, 0x1a, 0xb2, 0x09, 0x5d,
+    0xc4, 0x9c, 0x88, 0x90, 0x54, 0xfc, 0x53, 0x1e, 0x77, 0xac, 0x7b, 0x03, 0x62, 0xbf, 0xfd, 0x1b,
+    0x36, 0x3e, 0xca, 0xa8, 0xbf, 0x03, 0x1c, 0x76, 0x1a, 0xe3, 0xaa, 0x38, 0x01, 0xb5, 0xde, 0x04,
+    0xae, 0x7b, 0x36, 0xe2, 0x1d, 0xe8, 0xaa, 0xaf, 0xf1, 0xa1, 0x86, 0x77, 0xe8, 0x0d, 0x9b, 0x3d,
+    0x54, 0x2c, 0xb9, 0xc1, 0x41, 0xbf, 0xa1, 0x2f, 0x49, 0x2d, 0x6f, 0xe5, 0x4b, 0xdf, 0xc6, 0x75,
+    0x94, 0x00, 0xdf, 0xd4, 0x77, 0xc4, 0x1c, 0x7c, 0x5b, 0xf7, 0xa9, 0xab, 0xc4, 0x72, 0x1f, 0xed,
+    0x14, 0x7f, 0x91, 0x77, 0xa7, 0x56, 0x1d, 0x62, 0xdc, 0x92, 0x40, 0x54, 0x36, 0x4e, 0x02, 0xe1,
+    0xaf, 0x0e, 0x6c, 0x4c, 0x16, 0xd3, 0x31, 0xf3, 0x07, 0x2f, 0x06, 0x53, 0xa8, 0xb3, 0x5f, 0xd0,
+    0x79, 0x36, 0xc4, 0xcb, 0xe0, 0xf2, 0xfb, 0xb1, 0xfc, 0x1e, 0x73, 0xfb, 0xf3, 0xa9, 0xfc, 0x3c,
+    0x75, 0x3e, 0xef, 0xc9, 0xcf, 0xbf, 0x2f, 0x52, 0x67, 0xc0, 0x93, 0x03, 0x7f, 0xdb, 0x7f, 0xf5,
+    0xc3, 0xd0, 0xab, 0xdd, 0x38, 0xd4, 0xef, 0x2a, 0x2b, 0x31, 0x7f, 0xe9, 0x3c, 0x11, 0x79, 0x96,
+    0xe0, 0xfd, 0x94, 0x42, 0xf1, 0xa0, 0x9f, 0x97, 0xf4, 0xc4, 0x5b, 0x91, 0x23, 0xd2, 0xff, 0xc7,
+    0xeb, 0x9e, 0x71, 0xca, 0x0c, 0x64, 0x78, 0xf0, 0xda, 0x1f, 0x5d, 0xff, 0xdb, 0x23, 0x90, 0x94,
+    0x4a, 0xe6, 0xab, 0xc9, 0x04, 0xad, 0x17, 0x7b, 0xd2, 0x8a, 0xf7, 0x70, 0x7f, 0x2b, 0xde, 0x1f,
+    0xf1, 0xcc, 0xa0, 0x3e, 0xf3, 0x9b, 0x97, 0x0e, 0xb7, 0x38, 0xf3, 0xb1, 0x38, 0x2f, 0x59, 0x34,
+    0x9d, 0xdd, 0x81, 0xbd, 0xd9, 0xf3, 0xbe, 0x79, 0x5b, 0x9f, 0xf7, 0x55, 0x7d, 0xde, 0x8b, 0xf4,
+    0xa6, 0x3e, 0xeb, 0xe1, 0x76, 0xeb, 0x7d, 0x9f, 0xce, 0xe7, 0x8b, 0x04, 0xdf, 0x8d, 0xd8, 0x53,
+    0xbf, 0xdd, 0xc0, 0xde, 0xf9, 0x15, 0x77, 0xa6, 0xbc, 0xd7, 0xaa, 0x5f, 0x4e, 0x7d, 0xb8, 0xfa,
+    0xac, 0x6a, 0x01, 0xbc, 0x28, 0x86, 0x56, 0xb6, 0x57, 0x7b, 0x7a, 0xdc, 0x1d, 0xfe, 0x0f, 0xc5,
+    0x77, 0x0b, 0x86, 0x58, 0x38, 0x00, 0x00,
+};
+
+// /static/logo.svg (478 octets)
+static const uint8_t ASSET_7[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xa5, 0x94, 0x51, 0x6f, 0x9b, 0x30,
+    0x10, 0xc7, 0xdf, 0xf7, 0x29, 0x6e, 0xde, 0xcb, 0x26, 0x85, 0x60, 0x3b, 0xb6, 0x4b, 0xa6, 0x50,
+    0x69, 0xed, 0x1e, 0xbb, 0x87, 0xaa, 0x93, 0x26, 0xed, 0x8d, 0x38, 0x86, 0xa0, 0x52, 0x88, 0x8c,
+    0x17, 0xda, 0x6f, 0x3f, 0xdb, 0x60, 0xba, 0x34, 0xa4, 0xa9, 0x56, 0x24, 0x30, 0x77, 0xf6, 0xdd,
+    0xfd, 0xfe, 0xf6, 0xc1, 0xaa, 0xdd, 0x17, 0xf0, 0xf8, 0x50, 0xd5, 0x6d, 0x8a, 0xb6, 0xc6, 0xec,
+    0xbe, 0xc6, 0x71, 0xd7, 0x75, 0xf3, 0x6e, 0x31, 0x6f, 0x74, 0x11, 0x53, 0x8c, 0x71, 0x6c, 0x57,
+    0x20, 0xd8, 0x97, 0xaa, 0xbb, 0x6a, 0x1e, 0x53, 0x84, 0x01, 0x83, 0x75, 0xbb, 0x1b, 0x5d, 0x7e,
+    0x00, 0x58, 0x7d, 0x8c, 0x22, 0xb8, 0xca, 0xe4, 0x7d, 0xa1, 0x9b, 0x3f, 0xf5, 0x06, 0xae, 0x4b,
+    0x2d, 0x2b, 0x05, 0x51, 0xe4, 0x27, 0x65, 0x6f, 0x49, 0x1b, 0x48, 0x6c, 0x00, 0xc8, 0xa7, 0xe1,
+    0x45, 0xa7, 0x68, 0x69, 0x87, 0xbc, 0xac, 0xaa, 0x14, 0x7d, 0xc2, 0x19, 0x21, 0x34, 0x41, 0x10,
+    0x9f, 0x0d, 0x4a, 0xf8, 0x18, 0x44, 0x2e, 0x28, 0xe7, 0x6c, 0x08, 0x0a, 0x24, 0xbf, 0x32, 0xa3,
+    0xb4, 0x7d, 0xee, 0x55, 0x1b, 0x18, 0x76, 0x99, 0xd9, 0xc2, 0x26, 0x45, 0x3f, 0x18, 0x9e, 0xd9,
+    0x34, 0x70, 0xcb, 0xf9, 0x2c, 0xc1, 0x70, 0x31, 0x58, 0x09, 0x9f, 0x11, 0x8a, 0xc1, 0xbe, 0xf7,
+    0x36, 0x21, 0x7e, 0x9a, 0x2c, 0x82, 0xcd, 0x86, 0x05, 0xc2, 0x3b, 0x90, 0x2b, 0xd5, 0x5f, 0xad,
+    0xd1, 0xcd, 0xbd, 0x72, 0xf8, 0x4c, 0x08, 0x69, 0xf1, 0x7b, 0x47, 0xd4, 0x95, 0x1b, 0xb3, 0xb5,
+    0xa8, 0x81, 0xb4, 0x6e, 0x6a, 0x15, 0xb4, 0x1d, 0xc0, 0x50, 0xee, 0x61, 0x08, 0xe6, 0x9e, 0xc6,
+    0x99, 0x8e, 0x86, 0xf1, 0x9e, 0xc6, 0xd9, 0x8e, 0xc6, 0xcd, 0x7b, 0x1c, 0xef, 0x60, 0xc3, 0x0a,
+    0xe1, 0x1d, 0x93, 0x38, 0x3c, 0xa1, 0x32, 0x7b, 0x0b, 0x4e, 0xd8, 0xb5, 0x6f, 0x95, 0xd2, 0x06,
+    0x7e, 0xea, 0x32, 0xab, 0x8b, 0xe7, 0xc3, 0x1b, 0x59, 0x1d, 0x8d, 0x2d, 0x79, 0x43, 0x16, 0x3d,
+    0xcc, 0x8d, 0xe8, 0xc7, 0xdf, 0x87, 0x29, 0x47, 0x80, 0x7c, 0xbd, 0xce, 0x29, 0x7b, 0x09, 0xc0,
+    0x8e, 0xf6, 0xc0, 0xe5, 0x15, 0x2e, 0xaf, 0x1d, 0xdd, 0xc1, 0x9e, 0x49, 0x20, 0x46, 0x47, 0x55,
+    0xd6, 0x4a, 0x66, 0xbb, 0x14, 0xf9, 0x9e, 0x7b, 0xad, 0x6f, 0x96, 0xdc, 0xb7, 0xcd, 0x62, 0xec,
+    0x9a, 0x90, 0xfa, 0x40, 0xff, 0x9d, 0xaa, 0xdb, 0x46, 0xc3, 0xf7, 0xc6, 0xb4, 0x13, 0x9d, 0x2b,
+    0x42, 0x0f, 0xb2, 0xbe, 0x07, 0xc5, 0x98, 0x4c, 0xe5, 0xcc, 0x5e, 0x13, 0xf5, 0x93, 0x10, 0xc2,
+    0x5f, 0x86, 0x10, 0xbc, 0x5e, 0x26, 0x64, 0x0a, 0x99, 0xfe, 0x47, 0x0c, 0x3b, 0x89, 0x36, 0xad,
+    0xb3, 0x2c, 0xea, 0xac, 0x1a, 0x3e, 0x8f, 0xcf, 0xb9, 0x6e, 0x1e, 0xa0, 0xf5, 0xd2, 0xdb, 0x2f,
+    0x6f, 0xd0, 0x4d, 0xe8, 0x89, 0xf3, 0x0e, 0xdb, 0x70, 0x78, 0x5c, 0x76, 0x75, 0xb3, 0xcb, 0x64,
+    0x69, 0x6c, 0x0a, 0x3c, 0x17, 0x13, 0xf8, 0x47, 0x05, 0x92, 0x77, 0x14, 0xf8, 0x57, 0xeb, 0x6b,
+    0x5b, 0x74, 0x52, 0xc5, 0x74, 0xd3, 0x9d, 0x57, 0x71, 0x5c, 0x21, 0x79, 0x47, 0x85, 0x5e, 0xc6,
+    0xca, 0xfd, 0x75, 0x2f, 0xff, 0x02, 0xe0, 0x6a, 0xb0, 0x5d, 0x9d, 0x05, 0x00, 0x00,
+};
+
+// /static/script.js (3251 octets)
+static const uint8_t ASSET_8[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x5a, 0xef, 0x6e, 0xdb, 0x38,
+    0x12, 0xff, 0xee, 0xa7, 0xe0, 0x06, 0x7b, 0xb0, 0x7c, 0xb5, 0x65, 0xa7, 0xed, 0x06, 0x5d, 0xe7,
+    0xcf, 0x22, 0x4d, 0xbb, 0xb8, 0x1c, 0x92, 0xb6, 0x68, 0x5a, 0xf4, 0x70, 0x41, 0x80, 0xd0, 0x12,
+    0x6d, 0x6b, 0x2b, 0x4b, 0x3a, 0x49, 0x4e, 0x62, 0x64, 0xf5, 0x4e, 0xf7, 0x0c, 0xf7, 0x64, 0x37,
+    0x33, 0x24, 0x25, 0x8a, 0x92, 0x65, 0xef, 0x02, 0xf7, 0xe5, 0x3e, 0xc4, 0xb1, 0xc9, 0xdf, 0x0c,
+    0x87, 0x33, 0xc3, 0x99, 0xe1, 0x48, 0x5e, 0x1c, 0x65, 0x39, 0x4b, 0xc5, 0x3c, 0x15, 0xd9, 0xf2,
+    0x6d, 0x1e, 0xb1, 0x53, 0xe6, 0xc7, 0xde, 0x7a, 0x25, 0xa2, 0xdc, 0x5d, 0x88, 0xfc, 0x7d, 0x28,
+    0xf0, 0xeb, 0xdb, 0xcd, 0xa5, 0xef, 0xf4, 0x15, 0x6a, 0x34, 0xcb, 0xa3, 0xfe, 0xe0, 0xb8, 0xe7,
+    0x11, 0x69, 0xc8, 0xb3, 0xfc, 0x6b, 0xe2, 0xf3, 0x5c, 0xf8, 0xef, 0xc3, 0x2e, 0x6a, 0x04, 0x8e,
+    0xd6, 0x12, 0x59, 0x91, 0x47, 0x22, 0x7f, 0x8c, 0xd3, 0xef, 0x97, 0x91, 0x1f, 0x78, 0x3c, 0x8f,
+    0xd3, 0x2e, 0x0e, 0x0a, 0x3b, 0x0a, 0x34, 0xb8, 0xc1, 0xe6, 0x8b, 0x78, 0xca, 0xf7, 0xe1, 0x90,
+    0x03, 0xae, 0x22, 0xce, 0x36, 0x59, 0x2e, 0x56, 0x5f, 0x82, 0x95, 0xe8, 0xde, 0x81, 0xc4, 0x8d,
+    0x72, 0x00, 0x56, 0xc4, 0xdc, 0xcb, 0x83, 0x07, 0x71, 0x23, 0xa2, 0x2c, 0x4e, 0xb3, 0x8b, 0x78,
+    0x1d, 0x75, 0x0a, 0x20, 0xd1, 0xa3, 0x4c, 0xc2, 0x47, 0x1e, 0xe2, 0x8d, 0x5d, 0xc4, 0xe9, 0x8a,
+    0x87, 0x3b, 0x99, 0x48, 0x98, 0x4d, 0xfc, 0xc8, 0xd3, 0x28, 0x88, 0x16, 0x3b, 0xa9, 0x15, 0xce,
+    0x26, 0xe7, 0xa1, 0x48, 0xf3, 0xdd, 0xf2, 0x23, 0xca, 0x26, 0xcd, 0xf4, 0xe6, 0xa3, 0x9c, 0x07,
+    0x91, 0xe8, 0xb4, 0x61, 0xb5, 0x73, 0x05, 0xae, 0xd8, 0xf8, 0xe2, 0x21, 0xf0, 0xc4, 0x07, 0xbe,
+    0xcb, 0x0c, 0x12, 0x37, 0x8a, 0xb8, 0x69, 0x06, 0x39, 0x78, 0xcd, 0xbd, 0xbd, 0x68, 0x57, 0xdc,
+    0x33, 0x76, 0x9e, 0x5c, 0x26, 0xdd, 0x54, 0x3c, 0x19, 0x05, 0x89, 0xa1, 0xe9, 0x60, 0x1e, 0xdc,
+    0xe4, 0x3c, 0x5f, 0x67, 0xdd, 0x64, 0x88, 0x1b, 0x65, 0x04, 0xb4, 0x9d, 0xed, 0x6b, 0x92, 0xef,
+    0xeb, 0x6e, 0xeb, 0xa4, 0xee, 0x70, 0xf0, 0x19, 0x09, 0x0f, 0x0e, 0xd1, 0x27, 0x21, 0xd2, 0x1d,
+    0x12, 0x94, 0xd8, 0x51, 0x82, 0xe0, 0x8a, 0x89, 0x78, 0x4a, 0x78, 0xe4, 0x2b, 0xaf, 0xed, 0xe2,
+    0x20, 0x81, 0xda, 0x61, 0x6d, 0x06, 0x17, 0x4b, 0x9e, 0xe6, 0x7b, 0x90, 0x7b, 0x88, 0xab, 0x88,
+    0x57, 0xb1, 0x8f, 0x6e, 0xbe, 0x87, 0xbb, 0x10, 0xb2, 0xcd, 0x59, 0x68, 0xe2, 0x4b, 0x90, 0x87,
+    0x62, 0x37, 0x79, 0x8e, 0x30, 0x8b, 0xf4, 0x6d, 0xec, 0x6f, 0x76, 0x53, 0xce, 0x00, 0x65, 0x8b,
+    0x1d, 0xc6, 0xd9, 0x1e, 0x6b, 0x7a, 0x08, 0x43, 0xd2, 0x50, 0xe0, 0xd1, 0xcc, 0x45, 0x7a, 0x25,
+    0x1e, 0x44, 0xa8, 0x15, 0x16, 0xad, 0xc3, 0x50, 0xce, 0x29, 0xcd, 0xbe, 0xe3, 0x39, 0x87, 0xf1,
+    0xdb, 0x3b, 0x35, 0x4a, 0xb6, 0x97, 0x4e, 0x06, 0xc3, 0xcf, 0xc5, 0x71, 0x6f, 0xbe, 0x8e, 0x20,
+    0x78, 0xc4, 0x11, 0x0b, 0xa2, 0x20, 0x7f, 0xc7, 0xb3, 0xe5, 0x2c, 0xe6, 0xa9, 0xef, 0x0c, 0xd8,
+    0x73, 0xaf, 0x0a, 0xdf, 0x2e, 0xf7, 0xfd, 0xf7, 0x0f, 0x20, 0xcb, 0x55, 0x00, 0x0c, 0x40, 0x63,
+    0xe0, 0x03, 0x61, 0xe0, 0x7d, 0xef, 0x0f, 0xd9, 0x5c, 0xe4, 0xde, 0xf2, 0x3c, 0x0c, 0x71, 0x25,
+    0x90, 0xab, 0xe6, 0x01, 0x1d, 0x64, 0xb0, 0xc0, 0xe9, 0x19, 0xcb, 0x96, 0xf1, 0xe3, 0x35, 0x6e,
+    0xcc, 0xe9, 0x6b, 0xa7, 0xf9, 0xf8, 0x20, 0xd2, 0x87, 0x40, 0x3c, 0x02, 0xc6, 0x4b, 0x05, 0xec,
+    0x50, 0x4d, 0x5c, 0x6b, 0xe3, 0x02, 0x3b, 0x67, 0x30, 0x28, 0x97, 0xa2, 0xad, 0xff, 0x91, 0x85,
+    0xbe, 0xa1, 0xd6, 0x18, 0xa9, 0x2d, 0x63, 0x44, 0x5d, 0x2e, 0x45, 0xbf, 0x9a, 0x0b, 0x55, 0x06,
+    0xea, 0x58, 0x67, 0x19, 0xf8, 0x82, 0x48, 0x81, 0x20, 0x13, 0xf9, 0x25, 0xd0, 0xa7, 0x0f, 0xb0,
+    0x9e, 0x4c, 0x4d, 0x98, 0x05, 0x86, 0xec, 0x70, 0x32, 0x99, 0xc0, 0xb4, 0xa9, 0x32, 0x07, 0xe1,
+    0xeb, 0x59, 0xe6, 0xa5, 0xc1, 0x4c, 0x7c, 0x89, 0x89, 0x79, 0xe6, 0x58, 0x3c, 0xe4, 0x1e, 0x9e,
+    0x7b, 0xc1, 0x9c, 0x39, 0x3f, 0x08, 0x82, 0x5c, 0xe8, 0x23, 0x38, 0x60, 0x36, 0xbb, 0x62, 0xc8,
+    0x5e, 0x4d, 0xe4, 0x4a, 0x05, 0x59, 0xdd, 0xa2, 0x00, 0xc3, 0xcf, 0x79, 0x98, 0x09, 0xc3, 0xf6,
+    0x2d, 0x12, 0xe8, 0xe5, 0x9c, 0x3e, 0x8d, 0xdc, 0xc4, 0xeb, 0xd4, 0x13, 0x7d, 0xf0, 0x12, 0x88,
+    0x53, 0x91, 0x1f, 0x3f, 0x0e, 0x06, 0x90, 0xde, 0xf3, 0x75, 0x1a, 0x95, 0x47, 0x97, 0x08, 0xd1,
+    0x09, 0xc5, 0x23, 0x33, 0x68, 0x9c, 0xfe, 0x98, 0x27, 0xc1, 0x58, 0x4e, 0xa3, 0xeb, 0xca, 0x6f,
+    0x2d, 0xaa, 0x8c, 0x13, 0x11, 0x95, 0x16, 0x7b, 0xee, 0x35, 0xc5, 0xce, 0xd3, 0x35, 0x48, 0x2d,
+    0x35, 0xfa, 0x41, 0xe6, 0x5c, 0xe9, 0xcb, 0x0e, 0xce, 0xe0, 0x7e, 0xbb, 0xd8, 0x8b, 0x34, 0x85,
+    0xdc, 0xde, 0xc5, 0x5f, 0xa9, 0xa5, 0x93, 0x8b, 0x3c, 0x58, 0xc0, 0x86, 0x10, 0x92, 0x93, 0x99,
+    0xaf, 0x80, 0xcd, 0xdf, 0x6f, 0x3e, 0x7e, 0x70, 0x13, 0x9e, 0x66, 0xc2, 0x21, 0x90, 0xeb, 0xcb,
+    0xb3, 0x21, 0x61, 0xa0, 0x3d, 0xf1, 0x04, 0x28, 0xe3, 0x84, 0xba, 0x73, 0x18, 0xbc, 0xc4, 0x71,
+    0x27, 0x23, 0x6f, 0x75, 0x21, 0x93, 0xb0, 0xd3, 0x53, 0x0d, 0xc2, 0x9f, 0x40, 0x8f, 0xf6, 0x90,
+    0xd4, 0x67, 0xa7, 0x6c, 0x82, 0x16, 0x32, 0x78, 0xdc, 0xd2, 0xcc, 0x5d, 0xc9, 0x18, 0xb6, 0xc1,
+    0xc0, 0xc3, 0x45, 0x1d, 0xe5, 0x26, 0xeb, 0x6c, 0xe9, 0xc8, 0x01, 0xf2, 0x0f, 0x75, 0xc6, 0xd5,
+    0x21, 0x73, 0x06, 0x7b, 0xed, 0x7e, 0x04, 0x67, 0x21, 0x6f, 0x53, 0x01, 0x8e, 0x77, 0x28, 0xa0,
+    0x1e, 0x94, 0xea, 0x0a, 0x08, 0xc1, 0xd7, 0xcd, 0xdd, 0xff, 0x00, 0xbb, 0x47, 0x76, 0x6a, 0xef,
+    0xed, 0x72, 0x16, 0x95, 0x0b, 0xdb, 0x00, 0x90, 0x49, 0x3a, 0x4a, 0x15, 0xd3, 0x9e, 0xf5, 0x92,
+    0xd3, 0x5a, 0x78, 0x84, 0xf3, 0x62, 0xc6, 0x45, 0x0c, 0xae, 0x66, 0xf1, 0xe9, 0x62, 0x55, 0xa7,
+    0xe2, 0x01, 0x48, 0x7d, 0x7f, 0x05, 0x93, 0x4c, 0x15, 0x9c, 0x53, 0xf6, 0xe3, 0x33, 0xba, 0x3b,
+    0xf0, 0x11, 0xce, 0xc0, 0xcd, 0xe3, 0xab, 0xd8, 0x83, 0x5a, 0x06, 0x4f, 0xfb, 0x4d, 0x9e, 0x42,
+    0x39, 0xe4, 0x0c, 0x8a, 0xfb, 0x9a, 0x98, 0x55, 0x38, 0x20, 0x11, 0x75, 0x81, 0xf6, 0xa8, 0xce,
+    0x8d, 0x64, 0x04, 0x9a, 0x32, 0x6a, 0x47, 0x4b, 0x00, 0x00, 0xb7, 0x2e, 0x54, 0x5b, 0x66, 0x8e,
+    0xb5, 0x5c, 0x4e, 0xd3, 0x41, 0x04, 0x67, 0x30, 0x13, 0xb0, 0x92, 0x9f, 0xe9, 0x53, 0xad, 0x7e,
+    0xb2, 0x13, 0x76, 0x34, 0x91, 0x91, 0x1e, 0x4f, 0x32, 0xbb, 0xff, 0xf1, 0x59, 0xcd, 0x14, 0x4c,
+    0x43, 0xf8, 0x22, 0xbe, 0x2f, 0x7d, 0xa9, 0x4e, 0xfb, 0xea, 0x68, 0x62, 0x51, 0x5f, 0xf3, 0x7c,
+    0xe9, 0xce, 0xc3, 0x38, 0x4e, 0x4b, 0xd8, 0x18, 0x97, 0x28, 0xd8, 0x2a, 0x88, 0xd6, 0xb9, 0xe8,
+    0x64, 0xf7, 0xe6, 0xe8, 0xf5, 0x5e, 0xfc, 0x68, 0xd9, 0x82, 0x2d, 0x21, 0xba, 0x58, 0xfc, 0x76,
+    0x92, 0xca, 0x25, 0x0a, 0xe6, 0xf3, 0x4d, 0x49, 0xda, 0x54, 0xdb, 0x55, 0x65, 0x7e, 0x07, 0x8b,
+    0x24, 0xa8, 0xb5, 0x56, 0x49, 0x65, 0x2d, 0x9c, 0x30, 0xcd, 0x55, 0x42, 0xd8, 0x5f, 0x75, 0x84,
+    0xd7, 0x62, 0xd8, 0xbe, 0x82, 0x5f, 0xf6, 0xf1, 0x12, 0x29, 0x87, 0xac, 0xe6, 0x4c, 0xdb, 0x69,
+    0x01, 0x36, 0x18, 0x67, 0x3b, 0x76, 0xa8, 0x63, 0x8d, 0xd4, 0x51, 0x0d, 0x5a, 0x62, 0xff, 0xa2,
+    0x15, 0xae, 0x34, 0x5a, 0x96, 0x23, 0xca, 0x52, 0xdb, 0xa8, 0xa4, 0xd5, 0xc9, 0xac, 0xb2, 0xa8,
+    0x80, 0x63, 0xb7, 0x0e, 0xd1, 0x33, 0xfb, 0x7d, 0x19, 0xa3, 0x48, 0xbe, 0x33, 0xa6, 0x6c, 0x49,
+    0x93, 0x2f, 0x4e, 0xd1, 0x26, 0x38, 0x51, 0xf8, 0x8c, 0xf6, 0x8a, 0x40, 0x29, 0x1e, 0x20, 0xd9,
+    0xef, 0xbf, 0xb3, 0xad, 0x54, 0x84, 0x2a, 0x96, 0x92, 0xac, 0x36, 0xa3, 0x44, 0x2d, 0x56, 0xf7,
+    0xa5, 0xca, 0xe5, 0xbc, 0x15, 0x19, 0xb8, 0x2e, 0x48, 0x3e, 0x8b, 0x2c, 0x81, 0x4d, 0x0a, 0x27,
+    0x55, 0x5f, 0xec, 0x33, 0x48, 0x41, 0x0b, 0xf2, 0x6e, 0x09, 0x70, 0x97, 0x40, 0x0d, 0x35, 0x2e,
+    0xd6, 0x63, 0x4e, 0xff, 0x1f, 0xa3, 0xaf, 0xaa, 0x6c, 0xc6, 0x64, 0x3e, 0x40, 0xb1, 0x27, 0xe6,
+    0xd2, 0x92, 0xe4, 0xb7, 0x2c, 0x8e, 0x30, 0x1a, 0x2c, 0x45, 0xe4, 0xf8, 0x14, 0xeb, 0x30, 0x42,
+    0xe2, 0x37, 0xb7, 0xf2, 0x15, 0x3a, 0xc8, 0xc7, 0x3d, 0x02, 0xb8, 0x2a, 0x1c, 0x21, 0xbf, 0xdb,
+    0xbb, 0x81, 0x0b, 0xe6, 0x7f, 0xcf, 0x3d, 0x1d, 0xa7, 0x25, 0xb9, 0xca, 0x04, 0x18, 0x9a, 0x6e,
+    0x84, 0x88, 0x6e, 0x94, 0x3d, 0x94, 0x95, 0x56, 0xfc, 0xc9, 0x99, 0x0c, 0x69, 0x13, 0x23, 0x66,
+    0x41, 0x55, 0xac, 0x54, 0x52, 0xe2, 0x7a, 0x8d, 0xe0, 0x59, 0x2f, 0x21, 0x60, 0xb5, 0x4f, 0x69,
+    0xbc, 0x0a, 0xb0, 0xde, 0x09, 0x43, 0xe7, 0x56, 0x16, 0x2c, 0x2a, 0x8f, 0x97, 0x25, 0xbb, 0xdc,
+    0x5f, 0x8b, 0x72, 0x07, 0xc3, 0x3a, 0x81, 0xba, 0xa9, 0x68, 0xbc, 0x04, 0xe1, 0xa6, 0x2c, 0x85,
+    0x0d, 0x7a, 0x77, 0x83, 0x9e, 0x44, 0x39, 0xb7, 0x59, 0x9d, 0x27, 0x84, 0x68, 0x62, 0xa3, 0x7f,
+    0xdf, 0x0d, 0x4c, 0xad, 0x58, 0x19, 0x45, 0x83, 0xea, 0x6a, 0xd5, 0x41, 0xb5, 0xac, 0x7e, 0xeb,
+    0x1c, 0x8f, 0x1b, 0xe9, 0x62, 0x87, 0x08, 0x83, 0xf6, 0x4a, 0xc4, 0x96, 0x41, 0xf5, 0x06, 0x3e,
+    0x83, 0x9e, 0x36, 0x3b, 0x52, 0x4b, 0x33, 0xfa, 0xd8, 0xcc, 0xaa, 0x68, 0x84, 0x26, 0xec, 0xb9,
+    0x1e, 0x47, 0x3d, 0x53, 0x61, 0x53, 0xa5, 0xe1, 0x38, 0x14, 0x2e, 0x0d, 0x41, 0xe9, 0x46, 0x33,
+    0x64, 0x0d, 0x08, 0x33, 0x64, 0xfb, 0x29, 0xe6, 0x6d, 0x1c, 0xde, 0x22, 0x3f, 0xd5, 0x40, 0xcd,
+    0xf4, 0xda, 0x06, 0x0d, 0xb2, 0x8f, 0x51, 0x08, 0xf7, 0x27, 0x9d, 0x55, 0xcc, 0xdf, 0x76, 0x03,
+    0xc6, 0xf5, 0x60, 0xe7, 0x19, 0xde, 0xc2, 0x31, 0x50, 0x94, 0xad, 0x16, 0x16, 0x13, 0x05, 0x04,
+    0x0e, 0xa3, 0xd5, 0x62, 0xa9, 0xa5, 0xaf, 0x56, 0x65, 0x1f, 0x35, 0xb6, 0x0c, 0xf7, 0x7b, 0xaf,
+    0x32, 0x9f, 0xff, 0x81, 0x65, 0x4a, 0x70, 0xd1, 0xd4, 0xc0, 0xfe, 0xee, 0x61, 0xd5, 0x85, 0xd9,
+    0x6e, 0xff, 0xc4, 0x60, 0x2a, 0x9b, 0x30, 0xd5, 0x0d, 0x7a, 0xa2, 0xaf, 0x7a, 0xd4, 0x5d, 0x69,
+    0x8c, 0x53, 0xe3, 0xa4, 0x36, 0xaa, 0x78, 0xb6, 0xc7, 0x90, 0xc7, 0x20, 0x2f, 0x87, 0xd0, 0x79,
+    0xc4, 0x22, 0x4e, 0x37, 0x24, 0x29, 0x07, 0x7d, 0x4e, 0xa6, 0xf5, 0xe5, 0x5f, 0xbc, 0x38, 0x66,
+    0x33, 0x38, 0xe0, 0xdf, 0x8f, 0xe5, 0xfc, 0xe1, 0xd4, 0x92, 0xc3, 0x06, 0xbc, 0x9c, 0xd6, 0x04,
+    0x32, 0xa6, 0x0b, 0xf2, 0xa7, 0x66, 0x53, 0xcb, 0xb2, 0x81, 0x16, 0x3e, 0x14, 0xd1, 0x22, 0x5f,
+    0x82, 0xb5, 0xaa, 0xce, 0x55, 0xa3, 0x0a, 0x32, 0x04, 0x3d, 0xee, 0x99, 0x5d, 0x2a, 0x0b, 0x59,
+    0x17, 0x19, 0x84, 0x28, 0x3b, 0x52, 0x16, 0xd0, 0x14, 0x5d, 0x9f, 0x0d, 0xf9, 0xf3, 0x02, 0xec,
+    0x5d, 0x9e, 0xec, 0xf2, 0xdc, 0x7c, 0xab, 0x5f, 0xbf, 0x1b, 0xf3, 0x37, 0x46, 0xb8, 0x71, 0x1a,
+    0xb1, 0xa3, 0xe1, 0x59, 0x6d, 0x4b, 0xe9, 0x4b, 0x98, 0xe1, 0x28, 0x75, 0x15, 0xd1, 0x25, 0xc1,
+    0xbc, 0x0a, 0x94, 0xed, 0x0f, 0x37, 0x80, 0x7b, 0x4d, 0xfa, 0xb7, 0x2f, 0xd7, 0x57, 0x58, 0xb4,
+    0xf6, 0x4e, 0xfc, 0xe0, 0x81, 0xd1, 0xe9, 0x38, 0x3d, 0x88, 0xe2, 0x11, 0x46, 0x82, 0x11, 0xc4,
+    0x92, 0x8c, 0x2f, 0xc4, 0xc1, 0x59, 0xef, 0x24, 0xd0, 0x73, 0x73, 0x9e, 0xc1, 0x35, 0x68, 0x44,
+    0xad, 0x85, 0x83, 0xb3, 0x93, 0x71, 0x00, 0x93, 0xc9, 0xd9, 0x87, 0xb8, 0xf4, 0xe2, 0xb2, 0xf7,
+    0x73, 0x32, 0x4e, 0x60, 0x6e, 0x0c, 0x7c, 0xcf, 0x7a, 0x65, 0xfe, 0xd5, 0x57, 0xce, 0x65, 0xbe,
+    0x0a, 0x55, 0x45, 0xd0, 0xe5, 0x90, 0x08, 0xd5, 0x6e, 0x78, 0x81, 0x02, 0x28, 0x1a, 0xea, 0x55,
+    0x90, 0xc6, 0x54, 0xeb, 0x95, 0x18, 0xed, 0xf2, 0xde, 0x5e, 0x83, 0x95, 0xf4, 0x12, 0xa4, 0xad,
+    0x31, 0xfb, 0xa0, 0x87, 0xeb, 0xde, 0xdd, 0xa4, 0x57, 0xbe, 0xd3, 0x60, 0xf0, 0xad, 0x1c, 0xaf,
+    0xbb, 0x7f, 0x93, 0x03, 0x39, 0x55, 0x83, 0xfe, 0x5c, 0x8d, 0x2a, 0x6a, 0x5f, 0xcc, 0x39, 0x54,
+    0x2d, 0x2d, 0xe4, 0x0d, 0xca, 0xaf, 0xd1, 0x77, 0x48, 0xf2, 0x11, 0x05, 0x27, 0x52, 0xf2, 0x0b,
+    0xdb, 0xba, 0xea, 0x8a, 0xe6, 0x81, 0x23, 0x41, 0xc5, 0x59, 0xe3, 0x58, 0x1c, 0x30, 0x69, 0x78,
+    0xee, 0x9d, 0x1e, 0x60, 0xad, 0xaf, 0x2f, 0x97, 0x05, 0xfa, 0xc0, 0xf2, 0xd5, 0x59, 0x39, 0x86,
+    0x5d, 0xd0, 0xe2, 0x64, 0x0c, 0x43, 0x68, 0xfe, 0x2e, 0xf7, 0x60, 0x46, 0x3f, 0x05, 0x4b, 0x5c,
+    0xc5, 0xa0, 0xea, 0x4d, 0x41, 0xbd, 0xfb, 0x6b, 0xf0, 0x04, 0xc9, 0xec, 0x10, 0x0a, 0x6f, 0x6f,
+    0x25, 0xdd, 0xa6, 0x85, 0x27, 0x9c, 0x95, 0x44, 0xa4, 0xb0, 0xd7, 0x54, 0x8c, 0x96, 0xc1, 0x62,
+    0xa9, 0xd8, 0x7f, 0xa9, 0x86, 0x0d, 0xf6, 0x06, 0xd8, 0xe4, 0xff, 0x9f, 0x7f, 0x5f, 0x6c, 0xe5,
+    0x1f, 0x44, 0xf3, 0x78, 0xe4, 0x05, 0xa9, 0x17, 0x0a, 0xc5, 0x5a, 0x1e, 0x4d, 0xe2, 0x5a, 0xea,
+    0xb8, 0xd8, 0x4a, 0xef, 0x85, 0xb1, 0xf7, 0x5d, 0x51, 0xfe, 0xf8, 0xdc, 0xbc, 0x60, 0xb5, 0x95,
+    0x67, 0x83, 0xc2, 0x3a, 0x25, 0x45, 0x75, 0x0b, 0x6e, 0x3f, 0xa9, 0x68, 0x53, 0x70, 0x08, 0xdd,
+    0x05, 0xfc, 0xd7, 0x5a, 0xa4, 0x9b, 0x1b, 0x11, 0xc2, 0x89, 0x8b, 0x53, 0x28, 0xd0, 0x9c, 0xbe,
+    0x6b, 0xd8, 0xb7, 0x5f, 0x95, 0x8a, 0x64, 0x6e, 0x59, 0x02, 0xc0, 0xb7, 0x9d, 0xfd, 0x30, 0x9d,
+    0x9b, 0xa8, 0xcf, 0xc0, 0x88, 0x04, 0x0a, 0xdc, 0xf3, 0x1c, 0xae, 0x23, 0x33, 0x28, 0xa9, 0x9d,
+    0xbe, 0xf6, 0x13, 0xbb, 0x1d, 0x6f, 0x04, 0x69, 0x6c, 0x5a, 0xd8, 0xfd, 0x8a, 0xaa, 0x51, 0xa1,
+    0x7a, 0x0c, 0x18, 0x99, 0x96, 0xf1, 0xa3, 0x0c, 0x6e, 0xef, 0x04, 0xec, 0x38, 0x34, 0xdb, 0x0f,
+    0xc5, 0xb6, 0x4a, 0x63, 0x5b, 0x70, 0x2d, 0x25, 0xf7, 0xf2, 0xa7, 0xee, 0xc7, 0x11, 0x40, 0x3f,
+    0x0a, 0x91, 0x81, 0x6e, 0x13, 0x23, 0x86, 0xa2, 0xfd, 0x13, 0x54, 0xf2, 0x2f, 0x8d, 0x87, 0x45,
+    0xc0, 0x18, 0xe2, 0x59, 0x95, 0x45, 0x6f, 0x5d, 0x57, 0xa7, 0xe6, 0x3b, 0x17, 0x27, 0x1d, 0x87,
+    0x0f, 0xd9, 0x8c, 0x14, 0x37, 0x33, 0x3c, 0x1b, 0x4a, 0x6d, 0x6e, 0xfc, 0x34, 0x9e, 0x5d, 0xcd,
+    0xb0, 0xb7, 0x78, 0x5a, 0x67, 0x0c, 0x3a, 0x4a, 0x8c, 0xe0, 0x67, 0x1c, 0xb4, 0xea, 0x69, 0x83,
+    0x2a, 0x63, 0x77, 0x93, 0xb5, 0xac, 0x3a, 0xe3, 0xde, 0xf7, 0x45, 0x0a, 0x79, 0xcd, 0xbf, 0x88,
+    0x43, 0x69, 0xa8, 0x0e, 0x3e, 0xfb, 0x14, 0x03, 0xea, 0xc6, 0xd0, 0x4f, 0x17, 0x33, 0xee, 0x1c,
+    0x1e, 0xc1, 0x95, 0xe7, 0xcd, 0x4f, 0xf0, 0xf1, 0xf2, 0xe7, 0x21, 0x9b, 0xb8, 0x47, 0x83, 0xfe,
+    0x31, 0x1b, 0x8f, 0x59, 0xb6, 0xf6, 0x3c, 0xc8, 0x23, 0x65, 0x85, 0x50, 0x23, 0x7a, 0xf9, 0xd3,
+    0x21, 0x10, 0xfc, 0x0c, 0x1f, 0xaf, 0x8e, 0x4c, 0x22, 0x15, 0x57, 0xcb, 0xaa, 0xa1, 0x4e, 0xf4,
+    0x0a, 0x16, 0x38, 0x7a, 0x23, 0xff, 0x14, 0x0d, 0x12, 0xf9, 0x3c, 0x5a, 0x88, 0xb4, 0x0c, 0x96,
+    0x96, 0x78, 0xaf, 0x01, 0x7c, 0x78, 0xf4, 0x0a, 0x85, 0x7c, 0x6d, 0x2e, 0xb5, 0x48, 0xf9, 0x46,
+    0x39, 0x1a, 0xba, 0xa5, 0xd5, 0x33, 0xc7, 0xed, 0x5a, 0x43, 0xd4, 0xac, 0x72, 0x4b, 0x1b, 0xca,
+    0x2f, 0xc7, 0xed, 0x28, 0xfc, 0xc8, 0x44, 0x9e, 0xdd, 0x4e, 0xee, 0x5c, 0x65, 0x3c, 0x79, 0xbf,
+    0xda, 0x89, 0x6e, 0x5a, 0xcb, 0x1a, 0x69, 0xf2, 0x90, 0x07, 0x83, 0x1a, 0x3d, 0xba, 0xfe, 0x6d,
+    0x79, 0x02, 0x20, 0x1e, 0x65, 0x53, 0xdb, 0x81, 0x03, 0x32, 0x04, 0x48, 0xbe, 0x49, 0x20, 0x70,
+    0xf6, 0x67, 0x3c, 0xed, 0x0f, 0xe9, 0x0e, 0x3a, 0xc5, 0xbc, 0x4b, 0x9b, 0x9a, 0xaa, 0xcd, 0xc9,
+    0x71, 0x94, 0x6c, 0xca, 0x6e, 0xd5, 0xe4, 0x94, 0x99, 0x8d, 0x72, 0xe6, 0x78, 0xab, 0x41, 0x49,
+    0x8f, 0x9f, 0xc3, 0x9e, 0x25, 0xef, 0xd4, 0xde, 0x00, 0x20, 0xe2, 0x14, 0xae, 0xce, 0x6a, 0x56,
+    0x3b, 0x04, 0x78, 0x50, 0xf5, 0x31, 0x71, 0xdf, 0x20, 0x5b, 0x09, 0xfc, 0x16, 0xf8, 0xf9, 0x72,
+    0xca, 0x0e, 0x7b, 0xc5, 0x5d, 0xaf, 0x18, 0xf6, 0xe2, 0x04, 0xc3, 0x41, 0x36, 0x95, 0xed, 0x00,
+    0x2c, 0x9b, 0xa0, 0x76, 0x9c, 0x52, 0x0f, 0x78, 0xd8, 0x5b, 0x41, 0xe4, 0xc4, 0xe8, 0x79, 0x9e,
+    0x25, 0x10, 0x1a, 0x3f, 0x73, 0x80, 0x4e, 0x65, 0xfb, 0x76, 0xd8, 0x4b, 0xc2, 0xf5, 0x22, 0x90,
+    0x84, 0xa1, 0x58, 0x88, 0xc8, 0xc7, 0x6f, 0x7e, 0x90, 0x25, 0x21, 0xdf, 0x28, 0x10, 0xf2, 0xcf,
+    0xe3, 0x38, 0xcc, 0x83, 0x64, 0x4a, 0x0e, 0x1f, 0x86, 0x28, 0x3d, 0xd1, 0xf0, 0x39, 0xea, 0x54,
+    0xea, 0x40, 0x07, 0x25, 0xc7, 0x93, 0x71, 0xc3, 0x2e, 0xea, 0x2f, 0x55, 0x2f, 0x57, 0x4d, 0x93,
+    0x85, 0x69, 0xac, 0x6a, 0x01, 0xd9, 0xf9, 0xcb, 0x3c, 0x93, 0xb7, 0x06, 0x97, 0xbb, 0x8e, 0x9c,
+    0xa6, 0xda, 0x54, 0x05, 0x8a, 0x9d, 0x61, 0xeb, 0x88, 0x04, 0xdd, 0xe0, 0xc7, 0x4c, 0xc0, 0x5e,
+    0xcf, 0xf3, 0x7f, 0x8a, 0x34, 0xd6, 0xba, 0xa1, 0xe7, 0x52, 0xb5, 0x3d, 0xab, 0x71, 0x90, 0xb0,
+    0xcd, 0xac, 0x9a, 0xb7, 0x0a, 0xc4, 0xcd, 0xc2, 0xb4, 0x59, 0xc7, 0x56, 0x85, 0xa9, 0xfa, 0xa9,
+    0xab, 0x3f, 0xf3, 0x61, 0xab, 0x5d, 0xdb, 0x13, 0xd4, 0xad, 0x10, 0x58, 0xcd, 0xf6, 0x47, 0x7d,
+    0x4d, 0x44, 0x0f, 0x59, 0xbb, 0x68, 0x00, 0x50, 0x92, 0xc8, 0x87, 0xab, 0xed, 0x68, 0x7c, 0x3e,
+    0xfa, 0x8b, 0x0b, 0x88, 0x4f, 0x25, 0x9c, 0x12, 0x92, 0x39, 0x0b, 0x3f, 0x8c, 0x27, 0x28, 0xda,
+    0xa8, 0x69, 0x96, 0x05, 0xaa, 0xd0, 0x32, 0xd0, 0x2e, 0x0e, 0xb3, 0x5f, 0xd8, 0x3d, 0x73, 0x6e,
+    0x82, 0x45, 0xc4, 0xc3, 0xaa, 0x62, 0xa8, 0xe6, 0x0b, 0xe6, 0xbf, 0x5d, 0x0d, 0xee, 0xd9, 0x94,
+    0x6a, 0x36, 0xf3, 0x51, 0x6e, 0xbd, 0x10, 0xaf, 0x1e, 0x37, 0xe4, 0x31, 0x3b, 0xc9, 0xf2, 0x34,
+    0x8e, 0x16, 0x67, 0x75, 0x76, 0xf0, 0xfd, 0xe6, 0xe6, 0xf2, 0x1d, 0x09, 0xff, 0x2d, 0xf8, 0x35,
+    0xe8, 0x43, 0x11, 0x51, 0x02, 0xb5, 0x88, 0x85, 0xd9, 0xf5, 0xac, 0x2d, 0x67, 0xdf, 0x6a, 0x63,
+    0xe3, 0xd9, 0x2e, 0x2e, 0x4a, 0x2c, 0xd1, 0xd0, 0xf5, 0x47, 0xc6, 0xad, 0xbd, 0x08, 0xdd, 0x81,
+    0x94, 0xd2, 0xc9, 0x47, 0xc6, 0x32, 0xe1, 0xd4, 0x9e, 0x15, 0xdb, 0x2d, 0xf2, 0x72, 0x3f, 0x75,
+    0x20, 0xb5, 0xcb, 0x0a, 0x36, 0xae, 0xd4, 0xb7, 0x0a, 0xa2, 0x72, 0xe6, 0xd0, 0xea, 0x81, 0x6e,
+    0x2b, 0x1b, 0xaa, 0x0a, 0xc0, 0x2a, 0x96, 0xad, 0x4c, 0x26, 0xaf, 0x46, 0x60, 0xb7, 0xbe, 0x4a,
+    0x51, 0x7d, 0x30, 0x8e, 0xd3, 0x06, 0x3a, 0x44, 0x90, 0x2e, 0xf5, 0xd1, 0x82, 0x32, 0xd3, 0x18,
+    0x05, 0x82, 0x59, 0x82, 0x6f, 0x5d, 0x46, 0xdd, 0x2a, 0x3a, 0x57, 0xf9, 0x66, 0xac, 0x22, 0x2f,
+    0x01, 0xe6, 0x03, 0x78, 0xad, 0xbf, 0xb6, 0x7a, 0xde, 0x27, 0x25, 0x60, 0x9d, 0xde, 0x9c, 0x93,
+    0x3d, 0x4a, 0x36, 0x5b, 0x8c, 0x9a, 0x05, 0x7f, 0x96, 0x6f, 0x42, 0x71, 0x7a, 0x90, 0x40, 0x45,
+    0x08, 0x0b, 0x43, 0x78, 0xfd, 0x29, 0x79, 0x3a, 0x86, 0xc5, 0x28, 0x28, 0x3f, 0x2e, 0x83, 0x5c,
+    0xc0, 0x25, 0x9d, 0xe2, 0xef, 0x28, 0xe5, 0x7e, 0x80, 0xf5, 0x30, 0x22, 0xba, 0x2f, 0x04, 0x1d,
+    0x95, 0xb3, 0x2c, 0x75, 0x5b, 0x84, 0xc4, 0x4e, 0x21, 0x48, 0x90, 0x95, 0x22, 0x55, 0x21, 0x39,
+    0x84, 0x80, 0xc9, 0x16, 0x1c, 0x62, 0xf1, 0xcb, 0x09, 0x4a, 0xb7, 0xe2, 0x29, 0x44, 0xb5, 0x51,
+    0x1e, 0xeb, 0x11, 0x6b, 0xdb, 0x8a, 0x15, 0xd5, 0xc0, 0x5b, 0xa6, 0x02, 0x50, 0xe7, 0xce, 0x8b,
+    0x6d, 0x53, 0x56, 0x4d, 0xfe, 0xc0, 0xc3, 0x35, 0x5c, 0x13, 0x76, 0x5c, 0x67, 0x3a, 0x18, 0x50,
+    0x12, 0x3d, 0x38, 0xb3, 0x83, 0xad, 0xa6, 0xd8, 0x4e, 0xf8, 0x27, 0xf6, 0xd4, 0x7e, 0x73, 0xfa,
+    0x23, 0xdb, 0xdb, 0x92, 0x7a, 0x76, 0xef, 0xcf, 0xc8, 0x6e, 0xcc, 0x81, 0x4c, 0x65, 0x6f, 0x70,
+    0xab, 0x37, 0xac, 0xc0, 0x9d, 0x4b, 0x4f, 0xd8, 0x6a, 0x6f, 0xdb, 0x53, 0x16, 0x69, 0xe0, 0x1f,
+    0xd3, 0x27, 0x6d, 0x3a, 0x04, 0xed, 0x8e, 0xc0, 0x95, 0xd7, 0x2b, 0x4c, 0xf7, 0x87, 0xf3, 0x14,
+    0xff, 0x94, 0x27, 0x1d, 0x1a, 0x7c, 0xd0, 0x97, 0x5f, 0x9f, 0x5d, 0x9f, 0x5f, 0xb0, 0x73, 0xdf,
+    0x87, 0x62, 0x22, 0x03, 0x47, 0x7e, 0x4d, 0x8e, 0x5c, 0xbb, 0x04, 0xdb, 0x0e, 0x2c, 0xc9, 0xe8,
+    0x19, 0x0e, 0xde, 0xe9, 0x0c, 0xa2, 0x3f, 0x73, 0xfb, 0x6b, 0xfd, 0x07, 0x21, 0xaf, 0x7a, 0x35,
+    0xe1, 0x5e, 0x86, 0x3b, 0xe3, 0x9a, 0x4b, 0xa7, 0xee, 0x7e, 0xa8, 0x63, 0xc3, 0xa0, 0x11, 0x20,
+    0x25, 0x21, 0x65, 0xfc, 0x0a, 0x05, 0x11, 0xb2, 0x7a, 0x8f, 0xc5, 0x8a, 0xcd, 0x04, 0x55, 0xaf,
+    0x34, 0xe0, 0xcb, 0x2a, 0xb5, 0xec, 0xa4, 0x18, 0xe8, 0x37, 0x1e, 0xca, 0x0b, 0x2a, 0x99, 0x0e,
+    0xaf, 0x92, 0x78, 0xaf, 0xd4, 0x6f, 0x9b, 0xf5, 0xeb, 0xd2, 0x94, 0xef, 0x3f, 0x38, 0xe5, 0xfa,
+    0x6d, 0x0c, 0x52, 0xb1, 0x8a, 0x1f, 0xc4, 0x16, 0x1e, 0x1d, 0x2f, 0x7c, 0x58, 0x9d, 0x30, 0x6a,
+    0xf8, 0x57, 0xdd, 0x30, 0x7a, 0x86, 0x6c, 0x77, 0xc4, 0x74, 0x05, 0xf6, 0xbf, 0xef, 0x7d, 0xc9,
+    0x9e, 0x57, 0x77, 0x00, 0xcf, 0x46, 0x39, 0x9f, 0x85, 0xa2, 0x7a, 0xe9, 0x08, 0x97, 0xa6, 0xa1,
+    0x56, 0x1c, 0xcd, 0x62, 0x5c, 0xc7, 0xff, 0x29, 0xfd, 0x50, 0x51, 0xf7, 0x64, 0x0c, 0x5f, 0xe9,
+    0x37, 0x16, 0x51, 0xd5, 0x2f, 0x23, 0xd4, 0x54, 0x83, 0xc6, 0xf9, 0xac, 0x06, 0x0d, 0x8f, 0xa6,
+    0xa1, 0x31, 0x2d, 0x30, 0x2e, 0x97, 0xc3, 0xd7, 0x93, 0xa4, 0x6b, 0x9a, 0x4f, 0xe8, 0x5b, 0xda,
+    0x77, 0xff, 0x7f, 0x79, 0x98, 0x0c, 0x28, 0x5b, 0x6a, 0x52, 0xeb, 0xfe, 0xd9, 0x49, 0x96, 0xf0,
+    0x48, 0xdb, 0x68, 0xc6, 0xfd, 0x85, 0x68, 0x4d, 0xb4, 0x67, 0x56, 0x2e, 0x44, 0x2a, 0xf0, 0xa1,
+    0xdc, 0x97, 0x5c, 0xec, 0x44, 0xda, 0x18, 0xef, 0x68, 0x98, 0x35, 0xb0, 0x5d, 0xdd, 0xaf, 0x0a,
+    0xbc, 0x7f, 0x90, 0x22, 0x1a, 0xf2, 0x02, 0xd5, 0xa2, 0xaa, 0x6b, 0x62, 0xac, 0x3c, 0x02, 0xbe,
+    0xa0, 0x6b, 0x36, 0xbb, 0xbe, 0x55, 0xe0, 0x68, 0x1c, 0xe6, 0x96, 0x57, 0xaa, 0x1a, 0x47, 0x53,
+    0x45, 0xf9, 0xa5, 0x80, 0xdc, 0x05, 0x37, 0x94, 0xd7, 0x13, 0x1d, 0xba, 0x3d, 0x1e, 0x3d, 0xc0,
+    0x99, 0x0c, 0x7c, 0x48, 0x11, 0xf4, 0xfa, 0x9b, 0xec, 0xea, 0x50, 0x3f, 0x07, 0x0f, 0xa8, 0x9c,
+    0xaf, 0x9f, 0xc4, 0xb2, 0x23, 0xd4, 0x6c, 0x81, 0xbd, 0xfb, 0x78, 0xad, 0x84, 0xb8, 0x8a, 0xa1,
+    0x60, 0xf2, 0xfb, 0xc3, 0xfa, 0x4b, 0x6f, 0x83, 0xe3, 0xff, 0x02, 0x75, 0x28, 0x2c, 0xd9, 0xb7,
+    0x2c, 0x00, 0x00,
+};
+
+// /static/sensors.html (1565 octets)
+static const uint8_t ASSET_9[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x58, 0xeb, 0x6e, 0xdb, 0x36,
+    0x14, 0xfe, 0xbf, 0xa7, 0xe0, 0x04, 0x0c, 0x68, 0x81, 0xc9, 0x8a, 0x2f, 0x4d, 0xd3, 0xcc, 0xf6,
+    0x90, 0x25, 0x2b, 0xd6, 0x21, 0x6d, 0x87, 0xa5, 0xc3, 0xb0, 0x9f, 0x14, 0x45, 0xdb, 0x4c, 0x29,
+    0x52, 0x20, 0x69, 0x3b, 0x7e, 0xab, 0x3d, 0xc3, 0x9e, 0x6c, 0x87, 0xa4, 0x68, 0xd1, 0x92, 0xdc,
+    0x3a, 0x69, 0x00, 0x1b, 0x12, 0x0f, 0x79, 0x2e, 0x3c, 0x97, 0x8f, 0x87, 0x9a, 0x7e, 0x7f, 0xf3,
+    0xf1, 0xfa, 0xd3, 0x3f, 0x7f, 0xfc, 0x8a, 0x56, 0xa6, 0xe4, 0xf3, 0xef, 0xa6, 0xf6, 0x81, 0x38,
+    0x16, 0xcb, 0x59, 0x42, 0x45, 0x62, 0x09, 0x14, 0x17, 0xf0, 0x28, 0xa9, 0xc1, 0x88, 0xac, 0xb0,
+    0xd2, 0xd4, 0xcc, 0x92, 0xbf, 0x3e, 0xbd, 0x4d, 0x2f, 0x92, 0x40, 0x16, 0xb8, 0xa4, 0xb3, 0x64,
+    0xc3, 0xe8, 0xb6, 0x92, 0xca, 0x24, 0x88, 0x48, 0x61, 0xa8, 0x80, 0x65, 0x5b, 0x56, 0x98, 0xd5,
+    0xac, 0xa0, 0x1b, 0x46, 0x68, 0xea, 0x06, 0x3f, 0x22, 0x26, 0x98, 0x61, 0x98, 0xa7, 0x9a, 0x60,
+    0x4e, 0x67, 0xc3, 0xc1, 0x99, 0x15, 0x63, 0x98, 0xe1, 0x74, 0xfe, 0x96, 0x4b, 0x59, 0xa0, 0x2b,
+    0x4e, 0x95, 0x41, 0x77, 0x3b, 0x6d, 0x68, 0x89, 0x52, 0x74, 0x47, 0x85, 0x96, 0x4a, 0x4f, 0x33,
+    0xbf, 0xe6, 0xbb, 0x29, 0x67, 0xe2, 0x33, 0x52, 0x94, 0xcf, 0x12, 0x6d, 0x76, 0x9c, 0xea, 0x15,
+    0xa5, 0xa0, 0x73, 0xa5, 0xe8, 0x62, 0x96, 0x64, 0xda, 0x60, 0xc3, 0x48, 0x46, 0xb4, 0xce, 0xfc,
+    0xec, 0x00, 0x5e, 0x7f, 0xde, 0xcc, 0xde, 0x5c, 0xe4, 0x63, 0x72, 0x7e, 0x31, 0x49, 0xbe, 0x22,
+    0x60, 0x65, 0x4c, 0xa5, 0x2f, 0xb3, 0x8c, 0x14, 0xe2, 0x1e, 0x78, 0xb9, 0x5c, 0x17, 0x0b, 0x8e,
+    0x15, 0x1d, 0x10, 0x59, 0x66, 0xf8, 0x1e, 0x3f, 0x64, 0x9c, 0xe5, 0x3a, 0x5b, 0xc0, 0x0e, 0x53,
+    0xbc, 0xa5, 0x5a, 0x96, 0x34, 0x3b, 0x1f, 0xbc, 0x1a, 0x0c, 0x9d, 0x4a, 0xcc, 0xf9, 0xa0, 0x64,
+    0xc2, 0xea, 0x7c, 0x26, 0x45, 0x58, 0xb0, 0x12, 0x1b, 0x6a, 0x25, 0x66, 0x93, 0xc1, 0x10, 0xf4,
+    0x04, 0x4a, 0xa4, 0x27, 0xab, 0x63, 0x94, 0xcb, 0x62, 0x07, 0x8f, 0x82, 0x6d, 0x10, 0xe1, 0x58,
+    0xeb, 0x59, 0x82, 0xab, 0x2a, 0xb5, 0xd1, 0xc0, 0x4c, 0x50, 0x65, 0x97, 0x62, 0xcd, 0x0a, 0x1a,
+    0x66, 0xed, 0x7b, 0x8e, 0x1d, 0x3d, 0xe2, 0xa9, 0xa9, 0xa9, 0x15, 0xea, 0x99, 0x58, 0xb9, 0x44,
+    0x5a, 0x91, 0xc6, 0xbd, 0x40, 0xc8, 0xb8, 0x5c, 0xca, 0x81, 0xde, 0x2c, 0x13, 0x84, 0x39, 0x84,
+    0xfa, 0x16, 0x86, 0x49, 0x10, 0x61, 0xe7, 0x5c, 0xee, 0x8c, 0xe2, 0x98, 0x82, 0x9d, 0x23, 0x6b,
+    0x2d, 0xe8, 0x82, 0x87, 0xc0, 0x1d, 0x8d, 0x40, 0xb2, 0x5c, 0x6b, 0xee, 0x7c, 0x67, 0xad, 0x6d,
+    0x85, 0x95, 0x89, 0x82, 0x3e, 0x0c, 0x6c, 0x8a, 0x42, 0x48, 0xf3, 0xe1, 0xd9, 0x68, 0x42, 0xc6,
+    0x38, 0x99, 0x4f, 0x59, 0x90, 0xb4, 0xc0, 0x1a, 0x2d, 0x70, 0x6a, 0x30, 0x59, 0x41, 0x64, 0x0c,
+    0x55, 0x29, 0x18, 0x07, 0x0b, 0x32, 0x36, 0x47, 0x37, 0x58, 0xaf, 0x72, 0x89, 0x55, 0x31, 0xcd,
+    0xb0, 0x35, 0xc3, 0x69, 0xe0, 0x7b, 0x56, 0x4c, 0x0c, 0xdb, 0xd0, 0x64, 0x8e, 0x7a, 0xf4, 0x6a,
+    0x9f, 0x83, 0x4e, 0x73, 0x8f, 0xba, 0x2d, 0xc4, 0x43, 0xd5, 0x5a, 0xf6, 0xe9, 0x7a, 0xa0, 0xa3,
+    0x47, 0x26, 0xb6, 0x2e, 0xd1, 0x61, 0x33, 0x43, 0x4c, 0x69, 0xfe, 0xea, 0x6c, 0xd2, 0x23, 0x3d,
+    0xa7, 0x9c, 0xd7, 0xc2, 0x9d, 0x1b, 0x5b, 0xb2, 0xfb, 0x44, 0x0b, 0xcc, 0x77, 0xf0, 0xb2, 0x97,
+    0xbe, 0x38, 0x1f, 0x2e, 0x46, 0xaf, 0xf3, 0xa2, 0x47, 0xba, 0x2d, 0x69, 0x93, 0x42, 0xa6, 0xd2,
+    0xa0, 0x23, 0x30, 0x7f, 0x55, 0x0d, 0x20, 0x81, 0x61, 0x62, 0x79, 0xd4, 0x2d, 0x44, 0x2e, 0xf7,
+    0x4e, 0xf1, 0x2b, 0x63, 0x91, 0x99, 0x0b, 0x73, 0x06, 0x31, 0xef, 0x4f, 0xbf, 0x85, 0x94, 0x86,
+    0xb6, 0x73, 0x53, 0x50, 0xb3, 0x95, 0xea, 0x73, 0x6a, 0x2d, 0x58, 0xeb, 0x30, 0xc9, 0x8a, 0x66,
+    0x06, 0x52, 0x84, 0x11, 0x6c, 0xa4, 0xda, 0x27, 0xe3, 0x9e, 0x82, 0xa4, 0x08, 0xfb, 0xf4, 0x29,
+    0xa8, 0x2b, 0x2c, 0x0e, 0x98, 0x0d, 0x7d, 0x80, 0x6c, 0xf9, 0xe0, 0x47, 0xe8, 0xa3, 0x5b, 0x3e,
+    0xcd, 0xec, 0xb2, 0x26, 0x6f, 0xc3, 0xc3, 0x55, 0x92, 0x45, 0x40, 0xa8, 0xad, 0xa0, 0xca, 0xbe,
+    0xa7, 0x35, 0xfa, 0x05, 0xec, 0xa4, 0x2a, 0xcc, 0xd6, 0x13, 0x51, 0x61, 0x45, 0x3b, 0xf3, 0xc4,
+    0xd4, 0x81, 0x9c, 0x63, 0x1d, 0xce, 0xeb, 0x54, 0x42, 0xef, 0x21, 0x9e, 0x4b, 0x5a, 0x02, 0x2b,
+    0x54, 0xd0, 0x10, 0xe6, 0x2a, 0x67, 0x34, 0xf0, 0x99, 0x74, 0x5d, 0x15, 0x90, 0x7c, 0x10, 0xd8,
+    0x5b, 0x18, 0xa1, 0x7a, 0x74, 0x89, 0x7e, 0x5f, 0xc3, 0x48, 0xc8, 0xed, 0x34, 0xab, 0x1a, 0x93,
+    0xbb, 0xda, 0x6c, 0xce, 0x4b, 0xe1, 0xfc, 0x98, 0xaf, 0x8d, 0x91, 0xde, 0x1b, 0x10, 0x64, 0x05,
+    0x60, 0x95, 0xe6, 0x46, 0xec, 0x9d, 0x08, 0xef, 0x08, 0xfe, 0x90, 0x28, 0xcb, 0x95, 0xe9, 0x89,
+    0xb5, 0xde, 0x09, 0x12, 0xd5, 0xda, 0x9f, 0x5e, 0xc4, 0x34, 0xf3, 0x62, 0x5b, 0x11, 0x76, 0xd0,
+    0x0e, 0x5b, 0x2d, 0x69, 0xe2, 0x14, 0xc6, 0x84, 0xf9, 0xd9, 0xd9, 0xa5, 0xfb, 0xb5, 0xfd, 0xed,
+    0x4d, 0x3e, 0x94, 0x04, 0x81, 0xa1, 0x3c, 0xe9, 0xa1, 0x45, 0x3e, 0x06, 0xcc, 0xe9, 0x58, 0x5b,
+    0xe2, 0x0a, 0xfe, 0xea, 0x33, 0x2d, 0x22, 0x9b, 0x83, 0xbb, 0x3f, 0x6e, 0xa8, 0xb2, 0x67, 0xd9,
+    0x21, 0x5c, 0x75, 0x34, 0x58, 0xb0, 0x6d, 0xa9, 0xb6, 0x62, 0x0f, 0xd0, 0x36, 0x24, 0x67, 0x8d,
+    0x1f, 0x56, 0x6f, 0x0f, 0x4b, 0xc5, 0x31, 0xa1, 0x2b, 0xc9, 0xbb, 0x49, 0xe1, 0xf9, 0x52, 0x2e,
+    0x21, 0x7f, 0x21, 0x50, 0x09, 0x72, 0xe7, 0xc8, 0x2c, 0x31, 0xb2, 0xba, 0x44, 0xe3, 0xb3, 0x1f,
+    0x7e, 0x42, 0x9c, 0x2e, 0xcc, 0x25, 0x1a, 0xc1, 0x6b, 0x82, 0x20, 0xf6, 0x10, 0x08, 0xc7, 0x32,
+    0x4b, 0xfc, 0x6e, 0x86, 0x2d, 0x81, 0x41, 0x52, 0x5a, 0x48, 0x9b, 0x1f, 0xaa, 0xc4, 0xbc, 0x29,
+    0x87, 0xbe, 0x75, 0x1c, 0xe7, 0xd6, 0xc3, 0x5e, 0x1a, 0x1a, 0xb6, 0x82, 0x72, 0xaa, 0xa9, 0xaf,
+    0x1a, 0x53, 0x27, 0xc7, 0x4c, 0x1d, 0x7d, 0xc9, 0xd4, 0x2d, 0x56, 0x02, 0x00, 0xe4, 0x31, 0xb6,
+    0x8e, 0x9e, 0x68, 0xeb, 0xeb, 0xc6, 0xd6, 0xf3, 0x63, 0xb6, 0x8e, 0x9f, 0xd7, 0xad, 0xe3, 0x27,
+    0x9a, 0x3a, 0x69, 0x4c, 0xbd, 0x38, 0x66, 0xea, 0xe4, 0x79, 0x4d, 0x9d, 0x1c, 0x37, 0xd5, 0x65,
+    0x3f, 0xae, 0x9c, 0x99, 0xf3, 0x77, 0x00, 0x75, 0xca, 0x1f, 0xa9, 0x75, 0x61, 0x01, 0x8c, 0x55,
+    0xed, 0x9a, 0xfe, 0xc2, 0xe3, 0x19, 0xaa, 0x9c, 0x33, 0xdd, 0xae, 0xed, 0x5b, 0x20, 0xd5, 0x75,
+    0xdd, 0x11, 0x16, 0x81, 0xe1, 0x41, 0x00, 0xb0, 0x22, 0x80, 0x85, 0xf2, 0xc1, 0x75, 0x42, 0xa2,
+    0x5a, 0x1b, 0x64, 0x76, 0x95, 0x0d, 0x81, 0x3d, 0x2c, 0xea, 0xf2, 0x76, 0x6b, 0xea, 0x2a, 0x4f,
+    0x50, 0x54, 0xd0, 0x36, 0x0c, 0x76, 0x12, 0x85, 0x16, 0x62, 0x30, 0x70, 0x72, 0xda, 0xf0, 0xe9,
+    0x16, 0x79, 0x63, 0x4f, 0x74, 0x48, 0x1f, 0x00, 0x05, 0x9c, 0x31, 0x38, 0xe7, 0xf4, 0x10, 0x8a,
+    0x1c, 0xa9, 0x77, 0x9d, 0x9b, 0xad, 0x3b, 0x48, 0xa3, 0xdc, 0x60, 0x7e, 0xe7, 0xce, 0x57, 0xe8,
+    0xb9, 0x57, 0x7e, 0xfc, 0x01, 0x3a, 0xfc, 0x66, 0xf4, 0xfe, 0xea, 0x1a, 0x5d, 0x15, 0x05, 0x20,
+    0x7c, 0xb4, 0xe4, 0x6f, 0xdb, 0x04, 0xa1, 0x5b, 0xba, 0xa1, 0xbc, 0x21, 0x7e, 0xa2, 0x65, 0x05,
+    0x79, 0x60, 0xd6, 0x2a, 0x62, 0x77, 0x47, 0xd5, 0x1d, 0xa5, 0xa2, 0x21, 0x5d, 0x79, 0xdf, 0xd7,
+    0x84, 0xcc, 0x99, 0x91, 0xed, 0x8d, 0xb2, 0x3b, 0x3d, 0xc0, 0x51, 0xbf, 0xbf, 0xe0, 0x00, 0x6f,
+    0x74, 0x01, 0xd7, 0x0e, 0x6e, 0x8f, 0xea, 0x59, 0xf2, 0x7a, 0x7f, 0x6c, 0xd9, 0x18, 0xa5, 0x84,
+    0x8a, 0x6e, 0x27, 0xc1, 0x25, 0x2e, 0x00, 0x51, 0x52, 0x5d, 0x31, 0x51, 0xbb, 0xa8, 0x13, 0x14,
+    0x3f, 0x15, 0x5e, 0x43, 0x74, 0x5c, 0x3b, 0x70, 0xeb, 0xd9, 0xa3, 0xb0, 0x76, 0xfa, 0x04, 0x53,
+    0x44, 0x5b, 0xa9, 0x5b, 0xf3, 0xcc, 0x59, 0xfe, 0xa5, 0x10, 0x37, 0xdb, 0x4c, 0x0b, 0xb8, 0x5b,
+    0x31, 0xae, 0x53, 0x9f, 0xff, 0x07, 0xc1, 0x47, 0x2b, 0x56, 0x14, 0xfe, 0x7e, 0xf6, 0xc8, 0xa2,
+    0x60, 0x62, 0x21, 0x53, 0xc2, 0x14, 0xe1, 0xa1, 0xe1, 0x6b, 0xda, 0x20, 0xaf, 0xb0, 0xce, 0xe3,
+    0xd4, 0xde, 0xea, 0xf6, 0x75, 0x7f, 0xe3, 0x6d, 0xa9, 0x37, 0x79, 0x42, 0x09, 0x45, 0xfd, 0x04,
+    0x5c, 0x6e, 0x34, 0x0d, 0xbb, 0x89, 0x3b, 0x8a, 0x94, 0x11, 0x0b, 0x69, 0xae, 0xe7, 0x99, 0x25,
+    0xd7, 0x76, 0x59, 0x50, 0xd4, 0xd7, 0xd4, 0x43, 0x7b, 0xa0, 0xbd, 0xcd, 0x51, 0x5f, 0xf1, 0xd4,
+    0x22, 0xd9, 0x7b, 0x77, 0xa9, 0x58, 0xd1, 0xbf, 0xc2, 0xb9, 0x4a, 0x53, 0xe2, 0x11, 0x0d, 0xdc,
+    0x39, 0x9e, 0xff, 0x02, 0x5d, 0x1f, 0x41, 0xef, 0x60, 0x02, 0x80, 0xd3, 0xd2, 0xc1, 0x13, 0xe3,
+    0x43, 0x66, 0xc7, 0xd5, 0x23, 0xd4, 0xd1, 0x19, 0xf4, 0x39, 0x49, 0xe8, 0x3c, 0xe3, 0x89, 0x1a,
+    0x65, 0x6d, 0x9d, 0x5d, 0xee, 0x33, 0xa9, 0xb3, 0x6a, 0x83, 0xf9, 0xba, 0xee, 0x99, 0xea, 0x58,
+    0xf9, 0x20, 0xa5, 0xed, 0xe4, 0x7b, 0xac, 0xde, 0xa8, 0xa2, 0x1f, 0xa5, 0xbe, 0xc4, 0xe4, 0x19,
+    0xb4, 0x7b, 0xb4, 0x79, 0x94, 0xe2, 0x70, 0x01, 0xf8, 0x66, 0xdd, 0x7b, 0x30, 0x7a, 0x94, 0x7a,
+    0xd7, 0x7b, 0x6b, 0x6a, 0x2b, 0x30, 0x3d, 0x76, 0x41, 0x38, 0x76, 0x96, 0xd7, 0x87, 0x74, 0x9c,
+    0x56, 0xd7, 0x6b, 0xa5, 0x00, 0xa4, 0xa0, 0x6d, 0x76, 0xa8, 0xa2, 0xbb, 0x59, 0xa5, 0xea, 0x99,
+    0x6e, 0x7f, 0x79, 0xb8, 0x00, 0x4e, 0x60, 0x55, 0x1c, 0x99, 0x72, 0xd5, 0xd6, 0x83, 0x73, 0xd1,
+    0xf5, 0xb5, 0xcf, 0xec, 0xc0, 0xde, 0xf5, 0x82, 0x63, 0x4c, 0xb9, 0x85, 0x7c, 0xe7, 0x87, 0xa3,
+    0xac, 0xb5, 0xaf, 0xa3, 0x23, 0x02, 0xbd, 0x20, 0xe5, 0xcb, 0xe3, 0xae, 0xfa, 0x86, 0xdd, 0x98,
+    0xe6, 0xc8, 0x49, 0x57, 0x70, 0x5b, 0x79, 0xca, 0xc6, 0x22, 0x19, 0x27, 0x6d, 0x2c, 0x3a, 0xe6,
+    0xd0, 0x8b, 0xff, 0xfe, 0xbd, 0x7e, 0x79, 0x6a, 0x6b, 0x53, 0xa7, 0xc4, 0x0a, 0xda, 0x12, 0xa9,
+    0x76, 0xad, 0xac, 0xf8, 0xcd, 0x51, 0xe1, 0xee, 0xca, 0xd1, 0x0d, 0xe4, 0x4c, 0x37, 0x29, 0xfc,
+    0xdd, 0xfd, 0x20, 0x23, 0x08, 0x16, 0x1b, 0xf0, 0x43, 0x74, 0x8a, 0x04, 0xd9, 0x6e, 0xb1, 0x75,
+    0x86, 0x5f, 0x72, 0x5a, 0x17, 0x96, 0xd9, 0x1b, 0x6d, 0x33, 0xd4, 0x44, 0xb1, 0xca, 0xf8, 0x6f,
+    0x41, 0x27, 0x7e, 0xc0, 0x72, 0x6a, 0x07, 0xf7, 0x3a, 0x1b, 0x0f, 0xde, 0xd8, 0xaf, 0x64, 0x6e,
+    0x68, 0xbf, 0x5d, 0xdd, 0x3b, 0x2c, 0xf7, 0x12, 0x5b, 0xa2, 0xc3, 0x07, 0x06, 0xe0, 0x0a, 0xe7,
+    0xeb, 0xbd, 0xfd, 0x88, 0x97, 0x17, 0x0b, 0x3a, 0x59, 0x58, 0xc8, 0x89, 0x18, 0xb3, 0x70, 0xb4,
+    0xba, 0x0f, 0x98, 0xff, 0x03, 0x86, 0x34, 0xad, 0x50, 0xd0, 0x14, 0x00, 0x00,
+};
+
+// /static/settings.html (2106 octets)
+static const uint8_t ASSET_10[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x19, 0xdb, 0x6e, 0xdb, 0x38,
+    0xf6, 0xbd, 0x5f, 0xc1, 0xd1, 0xd3, 0xee, 0x62, 0x65, 0xd9, 0xb1, 0x93, 0xe6, 0x62, 0x7b, 0x11,
+    0x24, 0x53, 0x60, 0x66, 0x67, 0xda, 0x60, 0xd2, 0x62, 0xd1, 0x47, 0x5a, 0xa2, 0x6d, 0xb6, 0x14,
+    0xa9, 0x25, 0x29, 0x27, 0x9e, 0xaf, 0x9f, 0xc3, 0x9b, 0x44, 0xc5, 0x52, 0x13, 0xb7, 0xc5, 0xb4,
+    0x48, 0x21, 0x89, 0x3c, 0x37, 0x9e, 0xfb, 0xa1, 0xe7, 0x3f, 0xdd, 0xbe, 0xbb, 0x79, 0xff, 0xf1,
+    0xee, 0x67, 0xb4, 0xd5, 0x25, 0x5b, 0xbe, 0x9a, 0x9b, 0x07, 0x62, 0x98, 0x6f, 0x16, 0x09, 0xe1,
+    0x89, 0x59, 0x20, 0xb8, 0x80, 0x47, 0x49, 0x34, 0x46, 0xf9, 0x16, 0x4b, 0x45, 0xf4, 0x22, 0xf9,
+    0xf0, 0xfe, 0x4d, 0x7a, 0x9e, 0x84, 0x65, 0x8e, 0x4b, 0xb2, 0x48, 0x76, 0x94, 0x3c, 0x54, 0x42,
+    0xea, 0x04, 0xe5, 0x82, 0x6b, 0xc2, 0x01, 0xec, 0x81, 0x16, 0x7a, 0xbb, 0x28, 0xc8, 0x8e, 0xe6,
+    0x24, 0xb5, 0x1f, 0xff, 0x46, 0x94, 0x53, 0x4d, 0x31, 0x4b, 0x55, 0x8e, 0x19, 0x59, 0x4c, 0x46,
+    0x63, 0x43, 0x46, 0x53, 0xcd, 0xc8, 0xf2, 0x0d, 0x13, 0xa2, 0x40, 0xd7, 0x8c, 0x48, 0x8d, 0xee,
+    0xf7, 0x4a, 0x93, 0x12, 0xa5, 0xe8, 0x9e, 0x68, 0x4d, 0xf9, 0x46, 0xcd, 0x33, 0x07, 0xf4, 0x6a,
+    0xce, 0x28, 0xff, 0x8c, 0x24, 0x61, 0x8b, 0x44, 0xe9, 0x3d, 0x23, 0x6a, 0x4b, 0x08, 0x30, 0xdd,
+    0x4a, 0xb2, 0x5e, 0x24, 0x99, 0xd2, 0x58, 0xd3, 0x3c, 0xcb, 0x95, 0xca, 0xdc, 0xee, 0x08, 0x5e,
+    0xff, 0xb3, 0x5b, 0x5c, 0x9c, 0xaf, 0xa6, 0xf9, 0xd9, 0xf9, 0x2c, 0x79, 0x86, 0xc0, 0x56, 0xeb,
+    0x4a, 0x5d, 0x66, 0x59, 0x5e, 0xf0, 0x4f, 0x80, 0xcb, 0x44, 0x5d, 0xac, 0x19, 0x96, 0x64, 0x94,
+    0x8b, 0x32, 0xc3, 0x9f, 0xf0, 0x63, 0xc6, 0xe8, 0x4a, 0x65, 0x6b, 0x38, 0x62, 0x8a, 0x1f, 0x88,
+    0x12, 0x25, 0xc9, 0xce, 0x46, 0xa7, 0xa3, 0x89, 0x65, 0x89, 0x19, 0x1b, 0x95, 0x94, 0x1b, 0x9e,
+    0xdf, 0x89, 0x11, 0xe6, 0xb4, 0xc4, 0x9a, 0x18, 0x8a, 0xd9, 0x6c, 0x34, 0x01, 0x3e, 0x61, 0x25,
+    0xe2, 0x93, 0x79, 0x23, 0xad, 0x44, 0xb1, 0x87, 0x47, 0x41, 0x77, 0x28, 0x67, 0x58, 0xa9, 0x45,
+    0x82, 0xab, 0x2a, 0x35, 0xe6, 0xc0, 0x94, 0x13, 0x69, 0x40, 0xb1, 0xa2, 0x05, 0x09, 0xbb, 0xe6,
+    0x7d, 0x85, 0xed, 0x7a, 0x84, 0xe3, 0x57, 0x53, 0x43, 0xd4, 0x21, 0xd1, 0x72, 0x83, 0x94, 0xcc,
+    0x5b, 0xf5, 0xc2, 0x42, 0xc6, 0xc4, 0x46, 0x8c, 0xd4, 0x6e, 0x93, 0x20, 0xcc, 0xc0, 0xd6, 0xbf,
+    0xc1, 0x67, 0x12, 0x48, 0x98, 0x3d, 0xeb, 0x3c, 0x27, 0xb1, 0x51, 0x41, 0xce, 0x13, 0x23, 0x2d,
+    0xf0, 0x82, 0x07, 0xc7, 0x07, 0x1c, 0x61, 0xc9, 0x60, 0xd5, 0xcc, 0xea, 0xce, 0x48, 0xfb, 0xc4,
+    0xac, 0x94, 0x17, 0xe4, 0x71, 0x64, 0x7c, 0x14, 0x4c, 0xba, 0x9a, 0x8c, 0x4f, 0x66, 0xf9, 0x14,
+    0x27, 0xcb, 0x39, 0x0d, 0x94, 0xd6, 0x58, 0xa1, 0x35, 0x4e, 0x35, 0xce, 0xb7, 0x60, 0x19, 0x4d,
+    0x64, 0x0a, 0xc2, 0x01, 0x40, 0x46, 0x97, 0xe8, 0x16, 0xab, 0xed, 0x4a, 0x60, 0x59, 0xcc, 0x33,
+    0x6c, 0xc4, 0xb0, 0x1c, 0x7a, 0xd9, 0x28, 0xc2, 0x95, 0x90, 0x2a, 0x30, 0x5a, 0xcf, 0x8a, 0xbc,
+    0xc0, 0xd3, 0x8b, 0x1e, 0x46, 0x0f, 0x60, 0x09, 0xe9, 0xe9, 0xdf, 0x3b, 0xac, 0x67, 0xa9, 0x63,
+    0xa3, 0x8b, 0x86, 0xf8, 0x04, 0x13, 0xb2, 0x3a, 0x1d, 0xcf, 0x7a, 0x88, 0xaf, 0x08, 0x63, 0x9e,
+    0xb6, 0xd5, 0xdf, 0x0b, 0x48, 0x73, 0xcc, 0xf6, 0xf0, 0xd2, 0x8a, 0x7e, 0x36, 0x59, 0x9f, 0xbc,
+    0x5e, 0x15, 0x3d, 0xd4, 0x4d, 0x30, 0xeb, 0x14, 0x5c, 0x94, 0x04, 0x1e, 0x01, 0xb9, 0xcb, 0xa6,
+    0x71, 0xa5, 0x5c, 0xd3, 0x1d, 0x49, 0x7a, 0xd5, 0xe5, 0x42, 0xd4, 0x32, 0xed, 0xe3, 0x24, 0x36,
+    0x8d, 0x8a, 0x42, 0x30, 0xb7, 0x1c, 0x32, 0x6b, 0xee, 0x0c, 0x6c, 0xdf, 0xef, 0x86, 0x6b, 0x21,
+    0x34, 0x79, 0xea, 0xa3, 0x9c, 0xe8, 0x07, 0x21, 0x3f, 0xa7, 0x46, 0x82, 0x5a, 0x85, 0x4d, 0x5a,
+    0xb4, 0x3b, 0xe0, 0x2a, 0x34, 0xc7, 0x5a, 0xc8, 0xc6, 0x29, 0x9b, 0x15, 0x24, 0x78, 0x38, 0xb6,
+    0x73, 0x45, 0x55, 0x61, 0xde, 0x41, 0xd6, 0xe4, 0x11, 0xbc, 0xe6, 0xad, 0xfb, 0x42, 0xef, 0x2c,
+    0xf8, 0x3c, 0x33, 0x60, 0xad, 0xff, 0x86, 0x87, 0x8d, 0x28, 0x93, 0x0a, 0x21, 0xc6, 0x02, 0x2b,
+    0xf3, 0x9e, 0xfa, 0x34, 0x18, 0x92, 0x28, 0x91, 0x61, 0xd7, 0x6f, 0x44, 0x01, 0x16, 0x9d, 0xcc,
+    0x2d, 0xa6, 0x36, 0xd9, 0x59, 0xd4, 0xc9, 0xd2, 0xe7, 0xc2, 0x56, 0x79, 0xb0, 0xf6, 0x6a, 0x5e,
+    0x59, 0x89, 0x01, 0x49, 0xa7, 0x75, 0x55, 0x80, 0x1f, 0x82, 0x91, 0x7f, 0x83, 0x2f, 0xe4, 0xbf,
+    0x2e, 0xd1, 0xaf, 0x35, 0x7c, 0x71, 0xf1, 0x30, 0xcf, 0xaa, 0x56, 0xde, 0x43, 0x56, 0xc6, 0xb0,
+    0x82, 0x5b, 0x25, 0xae, 0x6a, 0xad, 0x85, 0x53, 0x05, 0x58, 0x58, 0x42, 0xc6, 0x4a, 0x57, 0x9a,
+    0x37, 0x1a, 0x84, 0x77, 0x04, 0xff, 0xc1, 0x69, 0x36, 0x5b, 0xdd, 0x63, 0x68, 0xb5, 0xe7, 0x79,
+    0x14, 0x70, 0x7f, 0x38, 0x12, 0xf3, 0xcc, 0x91, 0x7d, 0x62, 0x5e, 0x7b, 0x28, 0x38, 0x67, 0x49,
+    0x12, 0xcb, 0x30, 0x5e, 0x58, 0x8e, 0xc7, 0x97, 0xf6, 0xef, 0xa9, 0xb2, 0x9d, 0xc8, 0x5d, 0x4a,
+    0x60, 0x15, 0xc2, 0x92, 0x9e, 0xb5, 0x48, 0xc1, 0x90, 0x78, 0x0e, 0x63, 0x97, 0xae, 0xa9, 0x97,
+    0xf4, 0x7f, 0xf4, 0x0d, 0x45, 0x37, 0x82, 0xaf, 0xe9, 0xa6, 0x96, 0xd8, 0xa8, 0xc3, 0xe7, 0xaa,
+    0x03, 0x92, 0xfd, 0xca, 0x82, 0x62, 0xc6, 0x2d, 0xbd, 0x5e, 0x75, 0x55, 0x12, 0x32, 0xb6, 0xdc,
+    0xf7, 0x29, 0x8c, 0x60, 0x99, 0x6f, 0x43, 0x70, 0x00, 0x11, 0xe4, 0x7d, 0x4e, 0x45, 0x4a, 0xeb,
+    0xaa, 0xe0, 0x40, 0x22, 0x93, 0xf4, 0xe3, 0x00, 0xb0, 0x62, 0xb8, 0xb8, 0x88, 0x52, 0x7f, 0xa3,
+    0x76, 0xb7, 0xa1, 0x88, 0x3d, 0x87, 0x55, 0xcd, 0x74, 0x79, 0x53, 0x4b, 0x09, 0x0e, 0x69, 0x34,
+    0xc0, 0xdd, 0x06, 0x1c, 0x7f, 0xda, 0x65, 0x46, 0xf9, 0x5a, 0xa4, 0x1b, 0x49, 0x8b, 0xa4, 0x67,
+    0x9d, 0x82, 0xe5, 0x92, 0x10, 0x48, 0xf1, 0x06, 0xc3, 0x2b, 0x63, 0x9b, 0x96, 0x30, 0xba, 0xb7,
+    0x02, 0x5c, 0x36, 0xd1, 0x74, 0x80, 0xb2, 0xc3, 0xac, 0xf6, 0x2e, 0x61, 0x8f, 0x92, 0x37, 0xb8,
+    0x4d, 0xb4, 0xbf, 0x15, 0x1a, 0xf9, 0x65, 0x52, 0x3c, 0x8d, 0xcb, 0xaf, 0x94, 0x8d, 0x14, 0x48,
+    0x8b, 0x23, 0xc4, 0x52, 0xca, 0xa8, 0x22, 0xfd, 0x56, 0xee, 0xbf, 0xdc, 0xa1, 0xeb, 0xa2, 0x80,
+    0x30, 0x39, 0x46, 0x25, 0xb4, 0xfa, 0x0e, 0x9c, 0xef, 0xe9, 0x06, 0x12, 0x3e, 0xd8, 0x03, 0x4c,
+    0xbf, 0xd1, 0xdb, 0x63, 0x8e, 0x6e, 0x31, 0x7b, 0x44, 0x38, 0xf4, 0xd4, 0x06, 0xc7, 0x67, 0xd6,
+    0x3e, 0x97, 0x2c, 0x75, 0x3a, 0xf3, 0x8e, 0x78, 0xbd, 0xc3, 0x14, 0xc4, 0x63, 0x24, 0x8a, 0x83,
+    0xc6, 0x11, 0xa3, 0x04, 0xad, 0x52, 0x26, 0x70, 0x01, 0xc9, 0x30, 0xea, 0x38, 0xec, 0x77, 0xaa,
+    0x2a, 0xca, 0x7d, 0xab, 0x73, 0x10, 0x6c, 0x6e, 0x2b, 0xbc, 0xba, 0xa8, 0x73, 0xc7, 0x5d, 0x9a,
+    0xd8, 0xe3, 0x80, 0x8f, 0xd6, 0x50, 0x1e, 0x02, 0x93, 0xd1, 0x68, 0xd4, 0xa7, 0xe4, 0xae, 0x1c,
+    0x54, 0xe9, 0x46, 0x88, 0x2d, 0x2d, 0x0a, 0xd7, 0x35, 0x6b, 0x7b, 0x08, 0xbf, 0xdc, 0x55, 0x80,
+    0xdd, 0xb2, 0x30, 0xbe, 0x6b, 0xd3, 0xd2, 0x7e, 0x34, 0xe5, 0xe6, 0x2d, 0xb4, 0xd3, 0xd0, 0xed,
+    0x6e, 0xdd, 0xaa, 0x33, 0x53, 0xf4, 0x4d, 0xf2, 0x5a, 0x52, 0xbd, 0x6f, 0x57, 0xae, 0x7d, 0xc4,
+    0xda, 0xef, 0xcc, 0x52, 0xcb, 0x1a, 0xda, 0x26, 0x3b, 0xf4, 0x58, 0x21, 0x24, 0x8d, 0x4c, 0xfb,
+    0x9e, 0x31, 0xb3, 0x62, 0xf5, 0x1c, 0x54, 0xb4, 0x48, 0x25, 0x78, 0x29, 0xde, 0x90, 0xe6, 0xb8,
+    0xb0, 0x07, 0x95, 0x06, 0x87, 0x75, 0xd4, 0x1e, 0x7f, 0x38, 0xd5, 0x42, 0xdd, 0x82, 0xf0, 0x75,
+    0x09, 0x37, 0x10, 0x06, 0xa5, 0xd7, 0xbc, 0x18, 0xa1, 0x3b, 0x46, 0xb0, 0x22, 0x48, 0xcb, 0x3d,
+    0x52, 0xc1, 0x1e, 0x78, 0x03, 0xce, 0x32, 0xea, 0x54, 0xb0, 0x41, 0x67, 0xfb, 0xc6, 0x7a, 0xa0,
+    0x18, 0x14, 0x72, 0xa9, 0xd2, 0x26, 0x1f, 0xbb, 0xb2, 0xdb, 0x57, 0x16, 0x5e, 0x92, 0x8b, 0x43,
+    0xc2, 0xf5, 0x55, 0xbb, 0x2f, 0x77, 0x36, 0x7b, 0xdd, 0x74, 0x7c, 0x6b, 0x07, 0xa6, 0xb8, 0xde,
+    0x4f, 0x07, 0xf0, 0xc0, 0x5b, 0xcb, 0x27, 0x34, 0xcd, 0x12, 0xf0, 0x12, 0x75, 0x65, 0x27, 0x10,
+    0x13, 0xeb, 0xc6, 0xa9, 0x17, 0x89, 0x1f, 0xc3, 0xcc, 0xb0, 0x96, 0x04, 0x16, 0xc6, 0xd5, 0x20,
+    0xf0, 0x2d, 0x94, 0x31, 0x1b, 0xaf, 0x6a, 0x8d, 0xf4, 0xbe, 0x82, 0x71, 0xce, 0xb6, 0x40, 0xd6,
+    0x05, 0x62, 0xc4, 0x0e, 0x17, 0x13, 0xca, 0x52, 0xb0, 0x04, 0xd9, 0x04, 0xb1, 0x48, 0x6c, 0x93,
+    0x6a, 0xf2, 0xbb, 0x3f, 0xca, 0xa1, 0x96, 0x06, 0x85, 0xc3, 0x95, 0x4f, 0xa8, 0xd7, 0x79, 0x0e,
+    0xde, 0x84, 0xee, 0x04, 0x85, 0x7a, 0x74, 0x7f, 0xff, 0xcb, 0xed, 0xb3, 0xe2, 0x05, 0xd4, 0x2f,
+    0x8a, 0x66, 0xa7, 0x10, 0x27, 0x9f, 0xb5, 0xea, 0xf1, 0xe2, 0x55, 0x00, 0x01, 0xde, 0xfa, 0x54,
+    0xc4, 0x3b, 0xbf, 0x3c, 0x20, 0x66, 0x83, 0x15, 0x44, 0x6d, 0x17, 0xbe, 0x24, 0xee, 0xbf, 0xfc,
+    0xbf, 0xe4, 0x05, 0xee, 0x3e, 0xe0, 0x44, 0x21, 0x9b, 0x7c, 0x67, 0x2f, 0x82, 0xa9, 0x33, 0xad,
+    0x08, 0x84, 0x49, 0xb2, 0xfc, 0x1d, 0x46, 0xf9, 0xb2, 0x2e, 0xa1, 0xcd, 0xfb, 0x7f, 0x4d, 0x25,
+    0xd4, 0xcf, 0x3b, 0xb3, 0x3e, 0xa0, 0x08, 0x5e, 0x97, 0x2b, 0x93, 0xf3, 0x8d, 0x1a, 0x5a, 0x1a,
+    0x5f, 0x54, 0xc2, 0x24, 0x41, 0x00, 0xe9, 0x9e, 0xf8, 0x71, 0x91, 0x9c, 0x8c, 0x8f, 0xb4, 0x9a,
+    0x6b, 0x1f, 0xb6, 0x90, 0x49, 0x4c, 0x3e, 0x70, 0x3d, 0x9e, 0xfb, 0x8a, 0x84, 0x54, 0x84, 0x81,
+    0xde, 0xa2, 0x76, 0xc3, 0xc3, 0xf7, 0x8a, 0x06, 0xf0, 0xa2, 0xb2, 0x6d, 0x4c, 0x23, 0xe3, 0xd2,
+    0x93, 0x44, 0x93, 0x79, 0xe6, 0xf6, 0x0e, 0x80, 0x4e, 0x5a, 0xa0, 0x93, 0x41, 0xa0, 0x69, 0x0b,
+    0x34, 0x1d, 0x04, 0x9a, 0xb5, 0x40, 0xb3, 0x41, 0xa0, 0xd3, 0x16, 0xe8, 0x74, 0x10, 0xe8, 0x2c,
+    0x41, 0xee, 0xe4, 0xa4, 0x68, 0xa0, 0xcf, 0x06, 0xa1, 0x5f, 0xb7, 0x24, 0x5f, 0x0f, 0x02, 0x9d,
+    0xb7, 0x40, 0xe7, 0x83, 0x40, 0x17, 0x2d, 0xd0, 0xc5, 0x20, 0xd0, 0x64, 0x1c, 0xa9, 0x75, 0x3c,
+    0x0c, 0x16, 0x6b, 0x3f, 0x56, 0x7f, 0xe6, 0x8e, 0xf6, 0xf2, 0x92, 0xd1, 0x84, 0xc2, 0x40, 0x7b,
+    0x8f, 0x77, 0x24, 0xf5, 0xf3, 0x49, 0x00, 0x3d, 0xa6, 0xcb, 0xc7, 0xbb, 0x30, 0x63, 0xdf, 0xc3,
+    0x6b, 0x14, 0x92, 0x4d, 0x8f, 0xdf, 0x19, 0xbc, 0x80, 0xc5, 0xb3, 0xdc, 0x86, 0x46, 0x30, 0x28,
+    0xa4, 0xa2, 0x19, 0xbf, 0x00, 0x1b, 0x9a, 0x5a, 0x74, 0x4b, 0xd6, 0xb8, 0x66, 0x7a, 0x70, 0xa4,
+    0x08, 0x0f, 0x33, 0xb5, 0x0e, 0xb4, 0x6f, 0xbe, 0xdb, 0x4e, 0x4b, 0x51, 0xe0, 0x36, 0x36, 0xdc,
+    0x57, 0x57, 0x95, 0x76, 0xad, 0x99, 0x7d, 0x91, 0xbd, 0xf8, 0x32, 0x03, 0xf1, 0xa3, 0xbb, 0x00,
+    0xbc, 0x44, 0xa7, 0xe3, 0x71, 0xf5, 0x78, 0xd5, 0x8b, 0x15, 0xd7, 0x67, 0xcb, 0xbb, 0xc3, 0x36,
+    0xcc, 0xc4, 0xbe, 0x61, 0x37, 0x27, 0x33, 0x31, 0xed, 0x4b, 0x72, 0xa4, 0xc1, 0x2e, 0x56, 0xce,
+    0x84, 0x22, 0xb1, 0xfe, 0x52, 0x0a, 0x00, 0x09, 0xb2, 0xd4, 0x16, 0xc9, 0x8d, 0xdd, 0xee, 0xb9,
+    0x42, 0x82, 0x39, 0x54, 0x39, 0x4d, 0x1e, 0x2a, 0xee, 0x40, 0xf2, 0x9e, 0xc2, 0x3f, 0x98, 0x96,
+    0x82, 0x78, 0xae, 0xe0, 0xc5, 0x5d, 0xdf, 0xb3, 0xb5, 0xae, 0x83, 0xda, 0x9f, 0x3c, 0x25, 0xe8,
+    0x50, 0x70, 0xb6, 0x3f, 0x2e, 0x55, 0x06, 0xc2, 0x6d, 0x95, 0x3b, 0xaa, 0xb0, 0x1d, 0xa0, 0xf7,
+    0xcb, 0x56, 0x31, 0x9c, 0x93, 0xad, 0x60, 0x60, 0xe4, 0x45, 0xf2, 0x33, 0x78, 0x88, 0x74, 0x8d,
+    0x60, 0xcb, 0xf5, 0xc0, 0xfb, 0x9a, 0x13, 0xbb, 0xd1, 0xef, 0xb0, 0xd3, 0x8e, 0x4e, 0xf7, 0x6d,
+    0x33, 0x40, 0x0f, 0xbb, 0xa6, 0xe3, 0x6d, 0x06, 0x58, 0xbe, 0xe9, 0x19, 0x0a, 0x8e, 0xce, 0x27,
+    0x9d, 0x90, 0x3a, 0xee, 0xc6, 0xa0, 0x62, 0x75, 0xb8, 0x4c, 0xf3, 0x32, 0xf5, 0x67, 0x91, 0x40,
+    0x1d, 0xfa, 0xe8, 0xdc, 0x34, 0xa6, 0x47, 0xdc, 0xe2, 0x44, 0x9e, 0x8f, 0x6e, 0x2c, 0xfa, 0xb3,
+    0x99, 0xa3, 0xd7, 0x66, 0x76, 0x62, 0xaf, 0x6d, 0xb3, 0xf4, 0x37, 0xe6, 0x8d, 0xce, 0x5d, 0x83,
+    0xe3, 0xbe, 0xae, 0xd9, 0x61, 0x92, 0xe8, 0x48, 0xf6, 0xc3, 0x92, 0x44, 0x23, 0x45, 0x18, 0xad,
+    0xfc, 0xb9, 0x4d, 0xc8, 0xa7, 0x18, 0x2c, 0xc4, 0x2f, 0x51, 0x4e, 0x4c, 0xa4, 0x5c, 0x41, 0x13,
+    0x24, 0x37, 0x14, 0xbe, 0x4f, 0x40, 0x0f, 0x68, 0x7c, 0xd5, 0xe7, 0xde, 0xf9, 0x96, 0xe4, 0x9f,
+    0xd3, 0x9c, 0xca, 0x9c, 0xb5, 0xb4, 0x72, 0xc1, 0x84, 0xbc, 0x84, 0xa2, 0x29, 0xff, 0x91, 0x06,
+    0x83, 0xfc, 0xf3, 0x0a, 0xd9, 0x9f, 0x30, 0x14, 0xfd, 0x93, 0x5c, 0xa2, 0xd9, 0x39, 0x68, 0xd6,
+    0xd3, 0x07, 0x29, 0xe1, 0x18, 0xa5, 0x63, 0x73, 0x15, 0x02, 0x04, 0x7a, 0xc7, 0x56, 0x99, 0x6c,
+    0xdf, 0xde, 0xbe, 0x98, 0x2c, 0x0c, 0xc3, 0x66, 0x98, 0xe5, 0x7e, 0xf2, 0x6d, 0x66, 0xd5, 0xd1,
+    0x71, 0x41, 0x60, 0xe4, 0x67, 0xa0, 0xa8, 0x8f, 0xa2, 0x96, 0xc8, 0xcd, 0x13, 0x88, 0x2a, 0x73,
+    0x37, 0xd9, 0xa5, 0x34, 0x57, 0x90, 0x28, 0x60, 0xea, 0x8b, 0x91, 0x5d, 0x9a, 0x84, 0x98, 0xb3,
+    0x5b, 0x4b, 0x3f, 0x0b, 0x76, 0x19, 0x98, 0x0b, 0x91, 0xe8, 0x26, 0xa5, 0x97, 0x0e, 0xad, 0x52,
+    0xec, 0xf6, 0x23, 0x6a, 0x43, 0x57, 0xa3, 0xcf, 0x35, 0x04, 0x9e, 0xa6, 0xf8, 0x7c, 0x64, 0xf8,
+    0x5a, 0x03, 0xf9, 0xd8, 0x7a, 0xf7, 0xdf, 0xaf, 0x8f, 0xab, 0x35, 0xe8, 0x93, 0x14, 0x3f, 0x28,
+    0xac, 0xde, 0x58, 0xe6, 0x87, 0x21, 0x15, 0x0b, 0xf5, 0xe3, 0xca, 0xae, 0x17, 0xe2, 0xfb, 0x04,
+    0x14, 0x79, 0x84, 0xef, 0xd2, 0x4e, 0xb4, 0x5f, 0x0c, 0xab, 0x02, 0xf3, 0x0d, 0x91, 0x5f, 0x11,
+    0x55, 0x4e, 0x97, 0xc6, 0xf7, 0xf3, 0xb6, 0xad, 0x19, 0x0c, 0x28, 0x73, 0xb8, 0x5a, 0x92, 0x14,
+    0x8a, 0xbc, 0x32, 0x93, 0xde, 0x07, 0x6e, 0xef, 0x99, 0xba, 0xd8, 0xb1, 0xf3, 0x7b, 0x6d, 0x3c,
+    0x8d, 0xa1, 0x70, 0xd5, 0x62, 0xdd, 0xd1, 0xb2, 0x0b, 0x25, 0x18, 0x61, 0x5e, 0xd8, 0x1b, 0x98,
+    0x9e, 0x8b, 0x97, 0x97, 0xc7, 0x87, 0x24, 0x40, 0xe2, 0xc8, 0xd0, 0x80, 0x09, 0x32, 0x74, 0xae,
+    0xef, 0x81, 0xff, 0xb5, 0xe1, 0xdf, 0x5f, 0xdb, 0xfc, 0xa1, 0xfe, 0xce, 0xd2, 0xa6, 0x72, 0x49,
+    0x2b, 0xdd, 0xfd, 0x11, 0xf4, 0x93, 0x6a, 0x7f, 0xf9, 0xfa, 0x64, 0x7e, 0x63, 0x7e, 0x3d, 0xbb,
+    0x38, 0x9f, 0x8e, 0xcf, 0x2e, 0xac, 0xa6, 0x2d, 0x82, 0x21, 0x10, 0x2e, 0xd8, 0xec, 0x0f, 0xec,
+    0x7f, 0x01, 0x15, 0xd8, 0x9d, 0x4f, 0x70, 0x1f, 0x00, 0x00,
+};
+
+const uint16_t ASSET_BUNDLE_COUNT = 11;
+const uint16_t ASSET_BUNDLE_BUCKETS = 6;
+const uint16_t ASSET_BUNDLE_SLOTS = 13;
+const uint16_t ASSET_BUNDLE_SEEDS[] = {0, 13, 0, 2, 4, 1};
+
+const BundledAsset ASSET_BUNDLE[] = {
+    {"/static/settings.html", ASSET_10, 2106, "\"b6530968678e607b\"", "text/html", true},
+    {"/static/script.js", ASSET_8, 3251, "\"b5b2158cc73595d1\"", "application/javascript", true},
+    {"/static/css/styles.css", ASSET_2, 3163, "\"98b3c68497f50418\"", "text/css", true},
+    {nullptr, nullptr, 0, nullptr, nullptr, false},
+    {"/static/index.html", ASSET_3, 1333, "\"b1024c3a71894bbf\"", "text/html", true},
+    {nullptr, nullptr, 0, nullptr, nullptr, false},
+    {"/static/alerts.html", ASSET_0, 1916, "\"1aeeb504fd904dcd\"", "text/html", true},
+    {"/static/sensors.html", ASSET_9, 1565, "\"f4dcda39472cd292\"", "text/html", true},
+    {"/static/js/alerts.js", ASSET_4, 3402, "\"423969613ca0670d\"", "application/javascript", true},
+    {"/static/analytics.html", ASSET_1, 20, "\"f61f27bd17de5462\"", "text/html", true},
+    {"/static/js/settings.js", ASSET_6, 3447, "\"7498306921ceb7e8\"", "application/javascript", true},
+    {"/static/js/sensors.js", ASSET_5, 3545, "\"bdfe4fac3b2be1ee\"", "application/javascript", true},
+    {"/static/logo.svg", ASSET_7, 478, "\"ada5229c4a351641\"", "image/svg+xml", true},
+};
@@ -1,6 +1,45 @@
 #include "indicators/BuzzerAlertIndicator.h"
 #include "Config.h"
-#include "utils/logger.h"
+#include "utils/Logger.h"
+
+// Sound patterns (frequency 0 = silence), kept in flash
+static const ToneStep CRITICAL_NOTES[] = {{2500, 150}, {0, 50}, {2500, 150}, {0, 50}, {2500, 150}};
+static const ToneStep WARNING_LEVEL_NOTES[] = {{2000, 200}, {0, 100}, {2000, 200}};
+static const ToneStep DEFAULT_ALERT_NOTES[] = {{1800, 200}, {0, 100}, {1800, 200}};
+static const ToneStep WARNING_NOTES[] = {{1500, 100}, {0, 50}, {1500, 100}, {0, 50}, {1500, 100}};
+static const ToneStep ERROR_NOTES[] = {{400, 200}, {300, 200}, {200, 200}};
+static const ToneStep SUCCESS_NOTES[] = {{1000, 100}, {1500, 100}, {2000, 100}};
+
+// SOS pattern: ... --- ...
+static const ToneStep SOS_NOTES[] = {
+    {1000, 200}, {0, 200}, {1000, 200}, {0, 200}, {1000, 200}, {0, 200},   // Short beeps
+    {0, 600},                                                              // Pause between SOS and long beeps
+    {1000, 600}, {0, 200}, {1000, 600}, {0, 200}, {1000, 600}, {0, 200},   // Long beeps
+    {0, 600}                                                               // Pause before next SOS
+};
+
+// Beeping while an alert is active, faster with the severity
+static const ToneStep WATER_BEEP_NOTES[] = {{2000, 1000}, {0, 1000}};   // 1 second on, 1 second off
+static const ToneStep TEMP_BEEP_NOTES[] = {{2000, 500}, {0, 500}};      // 0.5 second on, 0.5 second off
+static const ToneStep SYSTEM_BEEP_NOTES[] = {{2000, 250}, {0, 250}};    // 0.25 second on, 0.25 second off
+
+static const ToneStep REST_NOTES[] = {{0, 50}};
+static const uint16_t REST_MS = 50;
+
+static const TonePattern ALERT_TONES[] = {
+    TONE_PATTERN(DEFAULT_ALERT_NOTES, 1),
+    TONE_PATTERN(WARNING_LEVEL_NOTES, 1),
+    TONE_PATTERN(CRITICAL_NOTES, 1)
+};
+static const TonePattern ALERT_BEEPS[] = {
+    TONE_PATTERN(WATER_BEEP_NOTES, 0),    // Normal alert - slow beeping
+    TONE_PATTERN(TEMP_BEEP_NOTES, 0),     // Warning - medium beeping
+    TONE_PATTERN(SYSTEM_BEEP_NOTES, 0)    // Critical - rapid beeping
+};
+static const TonePattern WARNING_TONE = TONE_PATTERN(WARNING_NOTES, 1);
+static const TonePattern ERROR_TONE = TONE_PATTERN(ERROR_NOTES, 1);
+static const TonePattern SUCCESS_TONE = TONE_PATTERN(SUCCESS_NOTES, 1);
+static const TonePattern SOS_TONE = TONE_PATTERN(SOS_NOTES, 1);
 
 BuzzerAlertIndicator::BuzzerAlertIndicator(uint8_t buzzerPin)
     : _buzzerPin(buzzerPin),
@@ -10,8 +49,8 @@ BuzzerAlertIndicator::BuzzerAlertIndicator(uint8_t buzzerPin)
       _lastWaterLevelUpdate(0), 
       _lastWaterLevel(0), 
       _lastCategory(0),
-      _lastToneToggle(0),
-      _toneState(false) {
+      _sequencer(_output, this),
+      _lastPriority(TONE_PRIORITY_FEEDBACK) {
 }
 
 bool BuzzerAlertIndicator::begin() {
@@ -111,157 +150,81 @@ void BuzzerAlertIndicator::showAlert(bool isAlert, uint8_t alertType) {
     // Serial.print("Buzzer Alert state changed to: ");
     // Serial.println(isAlert ? "ACTIVE" : "INACTIVE");
     
+    // Replace the beeping of the previous alert state
+    _sequencer.cancel(TONE_PRIORITY_ALERT);
+    
     if (isAlert && !_silenced) {
-        // Play initial alert tone
-        playAlertTone(alertType);
-    } else {
-        // Turn off buzzer when alert is cleared
-        setBuzzer(false);
+        // Initial alert tone, then beep until the alert clears or is silenced
+        uint8_t index = alertType < 3 ? alertType : 0;
+        _play(ALERT_TONES[index], TONE_PRIORITY_ALERT);
+        _play(ALERT_BEEPS[index], TONE_PRIORITY_ALERT);
     }
 }
 
 void BuzzerAlertIndicator::silenceAlert() {
+    // Drop any queued pattern as well
+    _sequencer.stop();
+    
     if (_alertState) {
         _silenced = true;
-        setBuzzer(false);
         // Serial.println("Buzzer alert silenced by user");
     }
 }
 
 void BuzzerAlertIndicator::playAlertTone(uint8_t alertType) {
     // Use alertType to determine pattern - for now we'll use based on category
-    switch (alertType) {
-        case 2: // Critical water level
-            // Urgent rapid beeping
-            tone(_buzzerPin, 2500);
-            delay(150);
-            noTone(_buzzerPin);
-            delay(50);
-            tone(_buzzerPin, 2500);
-            delay(150);
-            noTone(_buzzerPin);
-            delay(50);
-            tone(_buzzerPin, 2500);
-            delay(150);
-            noTone(_buzzerPin);
-            break;
-            
-        case 1: // Warning water level
-            // Medium-pitched beeping
-            tone(_buzzerPin, 2000);
-            delay(200);
-            noTone(_buzzerPin);
-            delay(100);
-            tone(_buzzerPin, 2000);
-            delay(200);
-            noTone(_buzzerPin);
-            break;
-            
-        default: // Other alerts
-            // Default alert sound
-            tone(_buzzerPin, 1800);
-            delay(200);
-            noTone(_buzzerPin);
-            delay(100);
-            tone(_buzzerPin, 1800);
-            delay(200);
-            noTone(_buzzerPin);
-    }
+    // (waits behind an active alert, whose beeping has priority)
+    _play(ALERT_TONES[alertType < 3 ? alertType : 0], TONE_PRIORITY_WARNING);
 }
 
 void BuzzerAlertIndicator::playWarningTone() {
-    tone(_buzzerPin, 1500);
-    delay(100);
-    noTone(_buzzerPin);
-    delay(50);
-    tone(_buzzerPin, 1500);
-    delay(100);
-    noTone(_buzzerPin);
-    delay(50);
-    tone(_buzzerPin, 1500);
-    delay(100);
-    noTone(_buzzerPin);
+    _play(WARNING_TONE, TONE_PRIORITY_WARNING);
 }
 
 void BuzzerAlertIndicator::playErrorTone() {
-    tone(_buzzerPin, 400);
-    delay(200);
-    tone(_buzzerPin, 300);
-    delay(200);
-    tone(_buzzerPin, 200);
-    delay(200);
-    noTone(_buzzerPin);
+    _play(ERROR_TONE, TONE_PRIORITY_WARNING);
 }
 
 void BuzzerAlertIndicator::playSuccessTone() {
-    tone(_buzzerPin, 1000);
-    delay(100);
-    tone(_buzzerPin, 1500);
-    delay(100);
-    tone(_buzzerPin, 2000);
-    delay(100);
-    noTone(_buzzerPin);
+    _play(SUCCESS_TONE, TONE_PRIORITY_FEEDBACK);
+}
+
+void BuzzerAlertIndicator::playSOSTone() {
+    _play(SOS_TONE, TONE_PRIORITY_ALERT);
 }
 
 void BuzzerAlertIndicator::setBuzzer(bool state) {
-    if (state) {
-        tone(_buzzerPin, 2000); // 2000 Hz tone
-    } else {
-        noTone(_buzzerPin);
-    }
-    
-    _toneState = state;
+    // Direct control takes over from the patterns, through the sequencer
+    // so that it still knows what the buzzer plays
+    _sequencer.force(state ? 2000 : 0); // 2000 Hz tone
     // Serial.print("Buzzer: ");
     // Serial.println(state ? "ON" : "OFF");
 }
 
-void BuzzerAlertIndicator::playSOSTone() {
-    // SOS pattern: ... --- ...
-    for (int i = 0; i < 3; i++) {
-        tone(_buzzerPin, 1000); // Short beep
-        delay(200);
-        noTone(_buzzerPin);
-        delay(200);
-    }
-    
-    delay(600); // Pause between SOS and long beeps
-    
-    for (int i = 0; i < 3; i++) {
-        tone(_buzzerPin, 1000); // Long beep
-        delay(600);
-        noTone(_buzzerPin);
-        delay(200);
+void BuzzerAlertIndicator::pause(uint16_t durationMs) {
+    uint16_t rests = (durationMs + REST_MS - 1) / REST_MS;
+    if (rests == 0) {
+        return;
     }
-    
-    delay(600); // Pause before next SOS
+    TonePattern rest = {REST_NOTES, 1, (uint8_t)(rests < 255 ? rests : 255)};
+    _sequencer.play(rest, _lastPriority);
 }
 
-void BuzzerAlertIndicator::tick() {
-    // This method should be called in every loop iteration
-    // to handle alert pattern timing
-    
-    if (_alertState && !_silenced) {
-        unsigned long currentTime = millis();
-        unsigned long interval = _getToneInterval(_currentAlertType);
-        
-        // Toggle buzzer state based on the interval
-        if (currentTime - _lastToneToggle >= interval) {
-            _lastToneToggle = currentTime;
-            _toneState = !_toneState;
-            setBuzzer(_toneState);
-        }
-    } else {
-        // Make sure buzzer is off when no alert is active
-        if (_toneState) {
-            setBuzzer(false);
-        }
-    }
+unsigned long BuzzerAlertIndicator::tick() {
+    // Called by the indicator task, which sleeps for the returned delay
+    return _sequencer.tick(millis());
 }
 
-unsigned long BuzzerAlertIndicator::_getToneInterval(uint8_t alertType) {
-    switch (alertType) {
-        case 2: return SYSTEM_ALERT_INTERVAL; // Critical - rapid beeping (250ms)
-        case 1: return TEMP_ALERT_INTERVAL;   // Warning - medium beeping (500ms)
-        default: return WATER_ALERT_INTERVAL; // Normal alert - slow beeping (1000ms)
+void BuzzerAlertIndicator::_play(const TonePattern& pattern, uint8_t priority) {
+    _sequencer.play(pattern, priority);
+    _lastPriority = priority;
+}
+
+void BuzzerAlertIndicator::_output(void* context, uint16_t frequency) {
+    BuzzerAlertIndicator* buzzer = static_cast<BuzzerAlertIndicator*>(context);
+    if (frequency > 0) {
+        tone(buzzer->_buzzerPin, frequency);
+    } else {
+        noTone(buzzer->_buzzerPin);
     }
-}
\ No newline at end of file
+}
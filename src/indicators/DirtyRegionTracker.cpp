@@ -0,0 +1,87 @@
+#include "indicators/DirtyRegionTracker.h"
+#include <string.h>
+
+DirtyRegionTracker::DirtyRegionTracker()
+    : _previousCount(0),
+      _currentCount(0),
+      _previousScreen(0),
+      _screen(0),
+      _valid(false),
+      _overflow(false) {
+}
+
+void DirtyRegionTracker::beginFrame(uint8_t screen) {
+    _screen = screen;
+    _currentCount = 0;
+    _overflow = false;
+}
+
+void DirtyRegionTracker::add(int16_t x, int16_t y, int16_t w, int16_t h, uint32_t key) {
+    if (_currentCount == MAX_ELEMENTS) {
+        _overflow = true;
+        return;
+    }
+    Element& element = _current[_currentCount++];
+    element.rect.x = x;
+    element.rect.y = y;
+    element.rect.w = w;
+    element.rect.h = h;
+    element.key = key;
+}
+
+bool DirtyRegionTracker::endFrame(DirtyRect& area) {
+    area.x = area.y = area.w = area.h = 0;
+    bool comparable = _valid && !_overflow && _screen == _previousScreen &&
+                      _currentCount == _previousCount;
+
+    if (comparable) {
+        for (uint8_t i = 0; i < _currentCount; i++) {
+            const Element& before = _previous[i];
+            const Element& now = _current[i];
+            if (before.key == now.key && memcmp(&before.rect, &now.rect, sizeof(DirtyRect)) == 0) {
+                continue;
+            }
+            // The old content must be wiped as well as the new one drawn
+            _merge(area, before.rect);
+            _merge(area, now.rect);
+        }
+    }
+
+    memcpy(_previous, _current, _currentCount * sizeof(Element));
+    _previousCount = _currentCount;
+    _previousScreen = _screen;
+    _valid = !_overflow;
+    return comparable;
+}
+
+uint32_t DirtyRegionTracker::key(const char* text, uint32_t seed) {
+    uint32_t hash = seed;
+    for (; *text; text++) {
+        hash = (hash ^ (uint8_t)*text) * 16777619u;
+    }
+    return hash;
+}
+
+uint32_t DirtyRegionTracker::key(int32_t value, uint32_t seed) {
+    uint32_t hash = seed;
+    for (uint8_t i = 0; i < 4; i++) {
+        hash = (hash ^ (uint8_t)(value >> (8 * i))) * 16777619u;
+    }
+    return hash;
+}
+
+void DirtyRegionTracker::_merge(DirtyRect& area, const DirtyRect& rect) {
+    if (rect.w <= 0 || rect.h <= 0) {
+        return;
+    }
+    if (area.w == 0) {
+        area = rect;
+        return;
+    }
+    int16_t right = area.x + area.w > rect.x + rect.w ? area.x + area.w : rect.x + rect.w;
+    int16_t bottom = area.y + area.h > rect.y + rect.h ? area.y + area.h : rect.y + rect.h;
+    area.x = area.x < rect.x ? area.x : rect.x;
+    area.y = area.y < rect.y ? area.y : rect.y;
+    area.w = right - area.x;
+    area.h = bottom - area.y;
+}
@@ -2,20 +2,47 @@
 #include "FloodAlertSystem.h"
 #include <time.h>
 
+#ifndef NATIVE_SIM
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+// State fields shown by each screen (footer: network and alert)
+const uint8_t EInkDisplay::SCREEN_BINDINGS[] = {
+    STATE_ALERT | STATE_NETWORK,                                          // SCREEN_CLOCK
+    STATE_ALERT | STATE_NETWORK | STATE_WATER_LEVEL | STATE_TEMPERATURE,  // SCREEN_WATER_LEVEL
+    STATE_ALERT | STATE_NETWORK | STATE_SENSORS,                          // SCREEN_SYSTEM_INFO
+    STATE_ALERT | STATE_WATER_LEVEL,                                      // SCREEN_ALERT
+    STATE_NETWORK,                                                        // SCREEN_NETWORK
+    0                                                                     // SCREEN_WELCOME
+};
+
 // Constructor
 EInkDisplay::EInkDisplay(uint8_t csPin, uint8_t dcPin, uint8_t rstPin, uint8_t busyPin)
-    : _csPin(csPin), _dcPin(dcPin), _rstPin(rstPin), _busyPin(busyPin),
+    : _display(nullptr),
+      _csPin(csPin), _dcPin(dcPin), _rstPin(rstPin), _busyPin(busyPin),
       _floodSystem(nullptr),
       _currentScreen(SCREEN_WELCOME),
+      _homeScreen(SCREEN_WELCOME),
       _needsRefresh(true),
-      _partialRefreshEnabled(false),
+      _state(),
+      _dataChanged(false),
       _rotation(2),
-      _lastFullRefresh(0),
       _lastClockUpdate(0),
       _lastDataUpdate(0),
       _hour(12), _minute(0), _second(0),
       _lastTimeUpdate(0),
-      _isInitialized(false) {
+      _isInitialized(false),
+      _alertCategory(0),
+      _fullRefreshRequests(0),
+      _renderTask(nullptr),
+      _renderedFullRequest(0),
+      _layoutPass(false),
+      _partialBudget(0),
+      _fullRefreshes(0),
+      _partialRefreshes(0),
+      _skippedRefreshes(0),
+      _partialPixels(0) {
 }
 
 // Initialize the display
@@ -27,7 +54,7 @@ bool EInkDisplay::begin() {
     
     // Create GxEPD2 instance
     GxEPD2_579_GDEY0579T93 epd_raw(_csPin, _dcPin, _rstPin, _busyPin);
-    _display = new GxEPD2_BW<GxEPD2_579_GDEY0579T93, GxEPD2_579_GDEY0579T93::HEIGHT>(epd_raw);
+    _display = new Panel(epd_raw);
     
     // Initialize the display
     _display->init();
@@ -37,14 +64,23 @@ bool EInkDisplay::begin() {
     // Set orientation
     _display->setRotation(_rotation);  // Landscape mode
     
-    // Show welcome screen
-    showWelcomeScreen();
-    
     // Initial time
     _updateTime();
+
+    // Show welcome screen (drawn here, the render task does not exist yet)
+    _currentScreen = SCREEN_WELCOME;
+    _post(true);
+
+#ifndef NATIVE_SIM
+    if (xTaskCreatePinnedToCore(_renderLoop, "eink", EINK_TASK_STACK_SIZE, this,
+                                EINK_TASK_PRIORITY, (TaskHandle_t*)&_renderTask,
+                                EINK_TASK_CORE) != pdPASS) {
+        Logger::error("E-Ink render task could not be created, drawing from the loop");
+        _renderTask = nullptr;
+    }
+#endif
     
     _isInitialized = true;
-    _lastFullRefresh = millis();
     _lastClockUpdate = millis();
     _lastDataUpdate = millis();
     
@@ -64,378 +100,413 @@ void EInkDisplay::update() {
         _lastTimeUpdate = currentTime;
     }
     
-    // Check if we need a display refresh based on timing or system state
-    bool needClockUpdate = (currentTime - _lastClockUpdate >= CLOCK_UPDATE_INTERVAL);
-    bool needDataUpdate = (currentTime - _lastDataUpdate >= DATA_UPDATE_INTERVAL);
-    bool needFullRefresh = (currentTime - _lastFullRefresh >= FULL_REFRESH_INTERVAL);
-    
-    // Get system status to determine which screen to show
-    bool networkReady = _floodSystem->getNetwork().isNetworkReady();
-    uint8_t category = 0; // Default to normal
-    
-    // Determine highest alert category from all sensors
-    if (_floodSystem) {
-        // Logic to find the highest alert category
-        // This would need to access the sensor data from _floodSystem
-        // For now, we'll use a placeholder
-        // In a real implementation, you would iterate through _floodSystem->_remoteSensors
-        // and find the highest category value
-        
-        // Placeholder - in the real implementation, get this from system
-        category = 0; // 0 = normal, 1 = warning, 2 = alert
-    }
-    
-    // Choose screen based on system state
-    ScreenType targetScreen = _currentScreen;
-    
-    if (category >= 2) {
-        // Critical alert - show alert screen
-        targetScreen = SCREEN_ALERT;
-    } 
-    else if (category == 1) {
-        // Warning - show water level screen
-        targetScreen = SCREEN_WATER_LEVEL;
-    }
-    else if (!networkReady) {
-        // Network issues - show network screen
-        targetScreen = SCREEN_NETWORK;
-    }
-    else if (needDataUpdate) {
-        // Cycle between screens during regular updates
-        // This rotates through main screens every 5 minutes
-        switch (_currentScreen) {
-            case SCREEN_CLOCK:
-                targetScreen = SCREEN_WATER_LEVEL;
-                break;
-            case SCREEN_WATER_LEVEL:
-                targetScreen = SCREEN_SYSTEM_INFO;
-                break;
-            case SCREEN_SYSTEM_INFO:
-                targetScreen = SCREEN_NETWORK;
-                break;
-            case SCREEN_NETWORK:
-            case SCREEN_ALERT:
-            default:
-                targetScreen = SCREEN_CLOCK;
-                break;
-        }
+    // Just update the clock if we're showing it
+    if (_currentScreen == SCREEN_CLOCK && currentTime - _lastClockUpdate >= CLOCK_UPDATE_INTERVAL) {
+        _needsRefresh = true;
     }
-    else if (needClockUpdate && _currentScreen == SCREEN_CLOCK) {
-        // Just update the clock if we're already showing it
+
+    // Values shown on this screen changed since the last redraw
+    if (_dataChanged && currentTime - _lastDataUpdate >= DATA_UPDATE_INTERVAL) {
         _needsRefresh = true;
     }
     
-    // If screen changed or refresh needed
-    if (targetScreen != _currentScreen || _needsRefresh || needFullRefresh) {
-        _currentScreen = targetScreen;
-        
-        // Do a full refresh periodically to prevent ghosting
-        if (needFullRefresh) {
-            _partialRefreshEnabled = false;
-            _lastFullRefresh = currentTime;
-        } else {
-            _partialRefreshEnabled = true;
-        }
-        
-        // Display the current screen
+    if (_needsRefresh) {
         refresh();
-        
-        // Update timing
-        if (needClockUpdate) _lastClockUpdate = currentTime;
-        if (needDataUpdate) _lastDataUpdate = currentTime;
     }
 }
 
 // Set reference to the main system
 void EInkDisplay::setFloodAlertSystem(FloodAlertSystem* system) {
     _floodSystem = system;
+    if (_floodSystem) {
+        _state = _floodSystem->getSystemState();
+        _alertCategory = _state.alertCategory;
+        _floodSystem->addStateListener(&EInkDisplay::_onStateChanged, this);
+        _followState();
+    }
 }
 
-// Change current screen
+// Change the home screen
 void EInkDisplay::setScreen(ScreenType screenType) {
-    if (_currentScreen != screenType) {
-        _currentScreen = screenType;
+    _homeScreen = screenType;
+    _followState();
+}
+
+void EInkDisplay::_onStateChanged(void* context, const SystemState& state, uint8_t changed) {
+    EInkDisplay* display = static_cast<EInkDisplay*>(context);
+    display->_state = state;
+    display->_alertCategory = state.alertCategory;
+    if (changed & SCREEN_BINDINGS[display->_currentScreen]) {
+        display->_dataChanged = true;
+    }
+    display->_followState();
+
+    // Screen changes and alerts do not wait for the next update()
+    if (display->_isInitialized && (display->_needsRefresh || (display->_dataChanged && (changed & STATE_ALERT)))) {
+        display->refresh();
+    }
+}
+
+ScreenType EInkDisplay::_targetScreen() const {
+    if (_state.alertCategory >= 2) {
+        // Critical alert - show alert screen
+        return SCREEN_ALERT;
+    }
+    if (_state.alertCategory == 1) {
+        // Warning - show water level screen
+        return SCREEN_WATER_LEVEL;
+    }
+    if (_floodSystem && !_state.networkReady) {
+        // Network issues - show network screen
+        return SCREEN_NETWORK;
+    }
+    return _homeScreen;
+}
+
+void EInkDisplay::_followState() {
+    ScreenType target = _targetScreen();
+    if (target != _currentScreen) {
+        _currentScreen = target;
         _needsRefresh = true;
     }
 }
 
-// Force a refresh of the current screen
-void EInkDisplay::refresh() {
+// Redraw the current screen
+void EInkDisplay::refresh(bool fullRefresh) {
     if (!_isInitialized) return;
-    
-    // Determine alert category outside of switch statement
-    uint8_t category = 0;
-    if (_floodSystem && _currentScreen == SCREEN_ALERT) {
-        // In a real implementation, get this from system
-        // category = highest alert from system
+
+    _post(fullRefresh);
+    _needsRefresh = false;
+    _dataChanged = false;
+    _lastDataUpdate = millis();
+    if (_currentScreen == SCREEN_CLOCK) {
+        _lastClockUpdate = _lastDataUpdate;
     }
-    
-    // Display the appropriate screen
-    switch (_currentScreen) {
+}
+
+// Different screen display methods
+void EInkDisplay::showClockScreen() {
+    Logger::debug("Showing clock screen");
+    _currentScreen = SCREEN_CLOCK;
+    refresh();
+}
+
+void EInkDisplay::showWaterLevelScreen() {
+    Logger::debug("Showing water level screen");
+    _currentScreen = SCREEN_WATER_LEVEL;
+    refresh();
+}
+
+void EInkDisplay::showSystemInfoScreen() {
+    Logger::debug("Showing system info screen");
+    _currentScreen = SCREEN_SYSTEM_INFO;
+    refresh();
+}
+
+void EInkDisplay::showAlertScreen(uint8_t category) {
+    Logger::debug("Showing alert screen");
+    _alertCategory = category;
+    _currentScreen = SCREEN_ALERT;
+    refresh();
+}
+
+void EInkDisplay::showNetworkScreen() {
+    Logger::debug("Showing network screen");
+    _currentScreen = SCREEN_NETWORK;
+    refresh();
+}
+
+void EInkDisplay::showWelcomeScreen() {
+    Logger::debug("Showing welcome screen");
+    _currentScreen = SCREEN_WELCOME;
+    refresh();
+}
+
+void EInkDisplay::_post(bool fullRefresh) {
+    if (fullRefresh) {
+        _fullRefreshRequests++;
+    }
+
+    EInkFrame& frame = _mailbox.back();
+    frame.screen = _currentScreen;
+    frame.alertCategory = _alertCategory;
+    frame.fullRefreshRequest = _fullRefreshRequests;
+    frame.hour = _hour;
+    frame.minute = _minute;
+    frame.second = _second;
+    frame.uptimeSeconds = millis() / 1000;
+    frame.hasSystem = _floodSystem != nullptr;
+    frame.networkReady = _state.networkReady;
+    frame.connectedToMaster = _state.connectedToMaster;
+    frame.peerCount = _state.peerCount;
+    frame.sensorCount = _state.sensorCount;
+    frame.waterLevel = _state.waterLevel;
+    frame.temperature = _state.temperature;
+    _mailbox.publish();
+
+#ifndef NATIVE_SIM
+    if (_renderTask) {
+        xTaskNotifyGive((TaskHandle_t)_renderTask);
+        return;
+    }
+#endif
+    _renderPending();
+}
+
+#ifndef NATIVE_SIM
+void EInkDisplay::_renderLoop(void* arg) {
+    EInkDisplay* display = static_cast<EInkDisplay*>(arg);
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        display->_renderPending();
+    }
+}
+#endif
+
+void EInkDisplay::_renderPending() {
+    if (!_mailbox.take()) {
+        return;
+    }
+    _frame = _mailbox.front();
+
+    if (_frame.fullRefreshRequest != _renderedFullRequest) {
+        _renderedFullRequest = _frame.fullRefreshRequest;
+        _tracker.invalidate();
+    }
+
+    switch (_frame.screen) {
         case SCREEN_CLOCK:
-            showClockScreen();
+            _present(&EInkDisplay::_drawClockScreen, true);
             break;
         case SCREEN_WATER_LEVEL:
-            showWaterLevelScreen();
+            _present(&EInkDisplay::_drawWaterLevelScreen, true);
             break;
         case SCREEN_SYSTEM_INFO:
-            showSystemInfoScreen();
+            _present(&EInkDisplay::_drawSystemInfoScreen, false);
             break;
         case SCREEN_ALERT:
-            showAlertScreen(category);
+            _present(&EInkDisplay::_drawAlertScreen, false);
             break;
         case SCREEN_NETWORK:
-            showNetworkScreen();
+            _present(&EInkDisplay::_drawNetworkScreen, false);
             break;
         case SCREEN_WELCOME:
         default:
-            showWelcomeScreen();
+            _present(&EInkDisplay::_drawWelcomeScreen, false);
             break;
     }
-    
-    _needsRefresh = false;
 }
 
-// Different screen display methods
-void EInkDisplay::showClockScreen() {
-    Logger::debug("Showing clock screen");
-    
-    _display->setFullWindow();
-    
-    // Use partial refresh if enabled
-    if (_partialRefreshEnabled) {
-        // For real partial refresh, you'd need to set a partial window
-        // that covers just the clock area
-        _display->setPartialWindow(0, 0, _width, _height);
+void EInkDisplay::_present(DrawFn draw, bool partialCapable) {
+    // Layout pass: the helpers only record their elements (the page loop
+    // below starts from a blank buffer, so the direct draws are harmless)
+    _tracker.beginFrame(_frame.screen);
+    _layoutPass = true;
+    (this->*draw)();
+    _layoutPass = false;
+
+    DirtyRect area;
+    bool comparable = _tracker.endFrame(area);
+    bool partial = comparable && partialCapable && _partialBudget > 0;
+
+    if (partial && area.w == 0) {
+        _skippedRefreshes++;
+        return;
     }
-    
+
+    if (partial) {
+        _display->setPartialWindow(area.x, area.y, area.w, area.h);
+        _partialBudget--;
+        _partialRefreshes++;
+        _partialPixels += (uint32_t)area.w * area.h;
+    } else {
+        _display->setFullWindow();
+        _partialBudget = PARTIAL_REFRESH_BUDGET;
+        _fullRefreshes++;
+    }
+
     _display->firstPage();
     do {
-        _display->fillScreen(GxEPD_WHITE);
-        
-        // Draw large clock in center
-        drawBigClock();
-        
-        // Draw date below clock
-        drawCenteredText(_getDateString().c_str(), _width/2, _height/2 + 50, 2);
-        
-        // Draw system status footer
-        _display->drawLine(0, _height - 40, _width, _height - 40, GxEPD_BLACK);
-        drawSystemStatus();
-        
+        (this->*draw)();
     } while (_display->nextPage());
-    
-    // Hibernate to save power
-    _display->hibernate();
+
+    // Hibernation loses the controller RAM that the next partial refresh
+    // diffs against, so screens updated in place only power off
+    if (partialCapable) {
+        _display->powerOff();
+    } else {
+        _display->hibernate();
+    }
 }
 
-void EInkDisplay::showWaterLevelScreen() {
-    Logger::debug("Showing water level screen");
-    
-    // Get sensor data - in real implementation, get this from system
-    float waterLevel = 0.0f;
-    float temperature = 25.0f;
-    
-    _display->setFullWindow();
-    _display->firstPage();
-    
-    do {
-        _display->fillScreen(GxEPD_WHITE);
-        
-        // Title
-        drawCenteredText("NIVEAU D'EAU", _width/2, 30, 3);
-        
-        // Water level visualization
-        drawWaterLevel(waterLevel, 50, 70, _width - 100, 100);
-        
-        // Temperature display
-        drawTemperature(temperature, _width - 150, 70);
-        
-        // Current time in corner
-        _display->setCursor(20, 30);
-        _display->setTextSize(1);
-        _display->print(_getTimeString());
-        
-        // Draw system status footer
-        _display->drawLine(0, _height - 40, _width, _height - 40, GxEPD_BLACK);
-        drawSystemStatus();
-        
-    } while (_display->nextPage());
-    
-    _display->hibernate();
+bool EInkDisplay::_trackRegion(int x, int y, int w, int h, uint32_t key) {
+    if (!_layoutPass) {
+        return false;
+    }
+    _tracker.add(x, y, w, h, key);
+    return true;
 }
 
-void EInkDisplay::showSystemInfoScreen() {
-    Logger::debug("Showing system info screen");
-    
-    _display->setFullWindow();
-    _display->firstPage();
-    
-    do {
-        _display->fillScreen(GxEPD_WHITE);
-        
-        // Title
-        drawCenteredText("INFORMATIONS SYSTÈME", _width/2, 30, 2);
-        
-        // System information
-        int lineHeight = 40;
-        int startY = 80;
-        int leftColumnX = 50;
-        int rightColumnX = _width/2 + 50;
-        
-        // Left column - Device info
-        _display->setTextSize(1);
-        _display->setCursor(leftColumnX, startY);
-        _display->print("Nom de l'appareil: ");
-        _display->print(DEVICE_NAME);
-        
-        _display->setCursor(leftColumnX, startY + lineHeight);
-        _display->print("Mode: ");
-        _display->print(MODE_MASTER ? "MASTER" : "SLAVE");
-        
-        _display->setCursor(leftColumnX, startY + lineHeight*2);
-        _display->print("Adresse MAC: ");
-        // Get MAC address from system in real implementation
-        _display->print("XX:XX:XX:XX:XX:XX");
-        
-        _display->setCursor(leftColumnX, startY + lineHeight*3);
-        _display->print("Temps de fonctionnement: ");
-        // Get uptime from system
-        unsigned long uptime = millis() / 1000;
-        int hours = uptime / 3600;
-        int mins = (uptime % 3600) / 60;
-        int secs = uptime % 60;
-        _display->printf("%02d:%02d:%02d", hours, mins, secs);
-        
-        // Right column - Sensor info
-        _display->setCursor(rightColumnX, startY);
-        _display->print("Capteurs actifs: ");
-        // Get from system
-        _display->print("0");
-        
-        _display->setCursor(rightColumnX, startY + lineHeight);
-        _display->print("Niveau d'alerte: ");
-        // Get from system
-        _display->print("Normal");
-        
-        _display->setCursor(rightColumnX, startY + lineHeight*2);
-        _display->print("Batterie: ");
-        // Get from system
-        int batteryLevel = 100;
-        _display->print(batteryLevel);
-        _display->print("%");
-        drawBatteryLevel(batteryLevel, rightColumnX + 100, startY + lineHeight*2 - 5);
-        
-        // Current time in corner
-        _display->setCursor(20, 30);
-        _display->setTextSize(1);
-        _display->print(_getTimeString());
-        
-        // Draw system status footer
-        _display->drawLine(0, _height - 40, _width, _height - 40, GxEPD_BLACK);
-        drawSystemStatus();
-        
-    } while (_display->nextPage());
-    
-    _display->hibernate();
+void EInkDisplay::_drawClockScreen() {
+    _display->fillScreen(GxEPD_WHITE);
+
+    // Draw large clock in center
+    drawBigClock();
+
+    // Draw date below clock
+    drawCenteredText(_getDateString().c_str(), _width/2, _height/2 + 50, 2);
+
+    // Draw system status footer
+    _display->drawLine(0, _height - 40, _width, _height - 40, GxEPD_BLACK);
+    drawSystemStatus();
 }
 
-void EInkDisplay::showAlertScreen(uint8_t category) {
-    Logger::debug("Showing alert screen");
-    
-    _display->setFullWindow();
-    _display->firstPage();
-    
-    do {
-        if (category >= 2) {
-            // Critical alert - use inverse display for emphasis
-            _display->fillScreen(GxEPD_BLACK);
-            _display->setTextColor(GxEPD_WHITE);
-        } else {
-            _display->fillScreen(GxEPD_WHITE);
-            _display->setTextColor(GxEPD_BLACK);
-        }
-        
-        // Title
-        drawCenteredText(_getAlertTitle(category), _width/2, _height/2 - 50, 4);
-        
-        // Alert message
-        drawCenteredText(_getAlertMessage(category), _width/2, _height/2 + 20, 2);
-        
-        // Current time and date
-        if (category >= 2) {
-            _display->setTextColor(GxEPD_WHITE);
-        } else {
-            _display->setTextColor(GxEPD_BLACK);
-        }
-        
-        _display->setCursor(20, 30);
-        _display->setTextSize(1);
-        _display->print(_getTimeString());
-        _display->print(" - ");
-        _display->print(_getDateString());
-        
-        // Water level if available
-        float waterLevel = 0.0f; // Get from system
-        _display->setCursor(_width - 150, 30);
-        _display->print("Niveau: ");
-        _display->print(waterLevel, 1);
-        _display->print(" cm");
-        
-    } while (_display->nextPage());
-    
-    _display->hibernate();
+void EInkDisplay::_drawWaterLevelScreen() {
+    _display->fillScreen(GxEPD_WHITE);
+
+    // Title
+    drawCenteredText("NIVEAU D'EAU", _width/2, 30, 3);
+
+    // Water level visualization
+    drawWaterLevel(_frame.waterLevel, 50, 70, _width - 100, 100);
+
+    // Temperature display
+    drawTemperature(_frame.temperature, _width - 150, 70);
+
+    // Current time in corner
+    drawTextAt(_getTimeString().c_str(), 20, 30, 1);
+
+    // Draw system status footer
+    _display->drawLine(0, _height - 40, _width, _height - 40, GxEPD_BLACK);
+    drawSystemStatus();
 }
 
-void EInkDisplay::showNetworkScreen() {
-    Logger::debug("Showing network screen");
-    
-    _display->setFullWindow();
-    _display->firstPage();
-    
-    do {
-        _display->fillScreen(GxEPD_WHITE);
-        
-        // Title
-        drawCenteredText("ÉTAT DU RÉSEAU", _width/2, 30, 2);
-        
-        // Network information
-        drawNetworkStatus();
-        
-        // Current time in corner
-        _display->setCursor(20, 30);
-        _display->setTextSize(1);
-        _display->print(_getTimeString());
-        
-    } while (_display->nextPage());
-    
-    _display->hibernate();
+void EInkDisplay::_drawSystemInfoScreen() {
+    _display->fillScreen(GxEPD_WHITE);
+
+    // Title
+    drawCenteredText("INFORMATIONS SYSTÈME", _width/2, 30, 2);
+
+    // System information
+    int lineHeight = 40;
+    int startY = 80;
+    int leftColumnX = 50;
+    int rightColumnX = _width/2 + 50;
+
+    // Left column - Device info
+    _display->setTextSize(1);
+    _display->setCursor(leftColumnX, startY);
+    _display->print("Nom de l'appareil: ");
+    _display->print(DEVICE_NAME);
+
+    _display->setCursor(leftColumnX, startY + lineHeight);
+    _display->print("Mode: ");
+    _display->print(MODE_MASTER ? "MASTER" : "SLAVE");
+
+    _display->setCursor(leftColumnX, startY + lineHeight*2);
+    _display->print("Adresse MAC: ");
+    // Get MAC address from system in real implementation
+    _display->print("XX:XX:XX:XX:XX:XX");
+
+    _display->setCursor(leftColumnX, startY + lineHeight*3);
+    _display->print("Temps de fonctionnement: ");
+    // Get uptime from system
+    unsigned long uptime = _frame.uptimeSeconds;
+    int hours = uptime / 3600;
+    int mins = (uptime % 3600) / 60;
+    int secs = uptime % 60;
+    _display->printf("%02d:%02d:%02d", hours, mins, secs);
+
+    // Right column - Sensor info
+    _display->setCursor(rightColumnX, startY);
+    _display->print("Capteurs actifs: ");
+    _display->print(_frame.sensorCount);
+
+    _display->setCursor(rightColumnX, startY + lineHeight);
+    _display->print("Niveau d'alerte: ");
+    _display->print(_getAlertTitle(_frame.alertCategory));
+
+    _display->setCursor(rightColumnX, startY + lineHeight*2);
+    _display->print("Batterie: ");
+    // Get from system
+    int batteryLevel = 100;
+    _display->print(batteryLevel);
+    _display->print("%");
+    drawBatteryLevel(batteryLevel, rightColumnX + 100, startY + lineHeight*2 - 5);
+
+    // Current time in corner
+    drawTextAt(_getTimeString().c_str(), 20, 30, 1);
+
+    // Draw system status footer
+    _display->drawLine(0, _height - 40, _width, _height - 40, GxEPD_BLACK);
+    drawSystemStatus();
 }
 
-void EInkDisplay::showWelcomeScreen() {
-    Logger::debug("Showing welcome screen");
-    
-    _display->setFullWindow();
-    _display->firstPage();
-    
-    do {
+void EInkDisplay::_drawAlertScreen() {
+    uint8_t category = _frame.alertCategory;
+
+    if (category >= 2) {
+        // Critical alert - use inverse display for emphasis
+        _display->fillScreen(GxEPD_BLACK);
+        _display->setTextColor(GxEPD_WHITE);
+    } else {
         _display->fillScreen(GxEPD_WHITE);
-        
-        // Logo or title
-        drawCenteredText("FLOOD ALERT SYSTEM", _width/2, _height/2 - 50, 3);
-        
-        // Subtitle
-        drawCenteredText("Système de Surveillance des Inondations", _width/2, _height/2, 2);
-        
-        // Version
-        drawCenteredText("v1.0", _width/2, _height/2 + 40, 1);
-        
-        // Status message
-        drawCenteredText("Initialisation en cours...", _width/2, _height/2 + 80, 1);
-        
-    } while (_display->nextPage());
-    
-    _display->hibernate();
+        _display->setTextColor(GxEPD_BLACK);
+    }
+
+    // Title
+    drawCenteredText(_getAlertTitle(category), _width/2, _height/2 - 50, 4);
+
+    // Alert message
+    drawCenteredText(_getAlertMessage(category), _width/2, _height/2 + 20, 2);
+
+    // Current time and date
+    if (category >= 2) {
+        _display->setTextColor(GxEPD_WHITE);
+    } else {
+        _display->setTextColor(GxEPD_BLACK);
+    }
+
+    _display->setCursor(20, 30);
+    _display->setTextSize(1);
+    _display->print(_getTimeString());
+    _display->print(" - ");
+    _display->print(_getDateString());
+
+    // Water level if available
+    _display->setCursor(_width - 150, 30);
+    _display->print("Niveau: ");
+    _display->print(_frame.waterLevel, 1);
+    _display->print(" cm");
+}
+
+void EInkDisplay::_drawNetworkScreen() {
+    _display->fillScreen(GxEPD_WHITE);
+
+    // Title
+    drawCenteredText("ÉTAT DU RÉSEAU", _width/2, 30, 2);
+
+    // Network information
+    drawNetworkStatus();
+
+    // Current time in corner
+    drawTextAt(_getTimeString().c_str(), 20, 30, 1);
+}
+
+void EInkDisplay::_drawWelcomeScreen() {
+    _display->fillScreen(GxEPD_WHITE);
+
+    // Logo or title
+    drawCenteredText("FLOOD ALERT SYSTEM", _width/2, _height/2 - 50, 3);
+
+    // Subtitle
+    drawCenteredText("Système de Surveillance des Inondations", _width/2, _height/2, 2);
+
+    // Version
+    drawCenteredText("v1.0", _width/2, _height/2 + 40, 1);
+
+    // Status message
+    drawCenteredText("Initialisation en cours...", _width/2, _height/2 + 80, 1);
 }
 
 // Helper methods for drawing
@@ -444,19 +515,24 @@ void EInkDisplay::drawCenteredText(const char* text, int x, int y, uint8_t textS
     int16_t x1, y1;
     uint16_t w, h;
     _display->getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
+    if (_trackRegion(x - w/2, y, w, h, DirtyRegionTracker::key(text))) return;
     _display->setCursor(x - w/2, y);
     _display->print(text);
 }
 
 void EInkDisplay::drawTextAt(const char* text, int x, int y, uint8_t textSize) {
     _display->setTextSize(textSize);
+    int16_t x1, y1;
+    uint16_t w, h;
+    _display->getTextBounds(text, x, y, &x1, &y1, &w, &h);
+    if (_trackRegion(x1, y1, w, h, DirtyRegionTracker::key(text))) return;
     _display->setCursor(x, y);
     _display->print(text);
 }
 
 void EInkDisplay::drawBigClock() {
-    char timeStr[9];
-    sprintf(timeStr, "%02d:%02d:%02d", _hour, _minute, _second);
+    char timeStr[12];
+    sprintf(timeStr, "%02d:%02d:%02d", _frame.hour, _frame.minute, _frame.second);
     
     // Calculate font size based on display width
     int textSize = 6; // Adjust as needed for your display
@@ -467,6 +543,7 @@ void EInkDisplay::drawBigClock() {
     int16_t x1, y1;
     uint16_t w, h;
     _display->getTextBounds(timeStr, 0, 0, &x1, &y1, &w, &h);
+    if (_trackRegion(_width/2 - w/2, _height/2, w, h, DirtyRegionTracker::key(timeStr))) return;
     
     // Center the clock
     _display->setCursor(_width/2 - w/2, _height/2);
@@ -474,12 +551,20 @@ void EInkDisplay::drawBigClock() {
 }
 
 void EInkDisplay::drawWaterLevel(float waterLevel, int x, int y, int width, int height) {
-    // Draw tank outline
-    _display->drawRect(x, y, width, height, GxEPD_BLACK);
-    
     // Calculate fill level (max 100 cm)
     int maxWaterLevel = 100; // cm
     int fillHeight = min(height, (int)(height * waterLevel / maxWaterLevel));
+    char valueStr[10];
+    sprintf(valueStr, "%.1f cm", waterLevel);
+
+    // Scale labels on the left, value (text size 2) below the tank
+    if (_trackRegion(x - 30, y, width + 30, height + 46,
+                     DirtyRegionTracker::key(valueStr, DirtyRegionTracker::key(fillHeight)))) {
+        return;
+    }
+
+    // Draw tank outline
+    _display->drawRect(x, y, width, height, GxEPD_BLACK);
     
     // Draw fill
     _display->fillRect(x, y + height - fillHeight, width, fillHeight, GxEPD_BLACK);
@@ -496,23 +581,36 @@ void EInkDisplay::drawWaterLevel(float waterLevel, int x, int y, int width, int
     }
     
     // Draw current value
-    char valueStr[10];
-    sprintf(valueStr, "%.1f cm", waterLevel);
-    
     _display->setTextSize(2);
     _display->setCursor(x + width/2 - 50, y + height + 30);
     _display->print(valueStr);
 }
 
 void EInkDisplay::drawTemperature(float temperature, int x, int y) {
+    char tempStr[12];
+    snprintf(tempStr, sizeof(tempStr), "%.1f°C", temperature);
+
     _display->setTextSize(3);
+    int16_t x1, y1;
+    uint16_t w, h;
+    _display->getTextBounds(tempStr, x, y, &x1, &y1, &w, &h);
+    if (_trackRegion(x1, y1, w, h, DirtyRegionTracker::key(tempStr))) return;
+
     _display->setCursor(x, y);
-    _display->print(temperature, 1);
-    _display->print("°C");
+    _display->print(tempStr);
 }
 
 void EInkDisplay::drawSystemStatus() {
     int y = _height - 25;
+    bool networkReady = _frame.networkReady;
+    uint8_t peerCount = _frame.peerCount;
+    uint8_t category = _frame.alertCategory;
+
+    uint32_t key = DirtyRegionTracker::key(_frame.hasSystem);
+    key = DirtyRegionTracker::key(networkReady, key);
+    key = DirtyRegionTracker::key(peerCount, key);
+    key = DirtyRegionTracker::key(category, key);
+    if (_trackRegion(0, y, _width, 8, key)) return;
     
     _display->setTextColor(GxEPD_BLACK);
     _display->setTextSize(1);
@@ -520,10 +618,7 @@ void EInkDisplay::drawSystemStatus() {
     // Left side - network status
     _display->setCursor(20, y);
     
-    if (_floodSystem) {
-        bool networkReady = _floodSystem->getNetwork().isNetworkReady();
-        uint8_t peerCount = _floodSystem->getNetwork().getPeerCount();
-        
+    if (_frame.hasSystem) {
         _display->print("Réseau: ");
         _display->print(networkReady ? "CONNECTÉ" : "DÉCONNECTÉ");
         _display->print(" | Pairs: ");
@@ -535,8 +630,6 @@ void EInkDisplay::drawSystemStatus() {
     // Right side - alert status
     _display->setCursor(_width - 200, y);
     
-    // In real implementation, get from system
-    uint8_t category = 0;
     _display->print("État: ");
     
     switch (category) {
@@ -558,11 +651,18 @@ void EInkDisplay::drawSystemStatus() {
 }
 
 void EInkDisplay::drawNetworkStatus() {
-    if (!_floodSystem) return;
+    if (!_frame.hasSystem) return;
     
     int startY = 80;
     int lineHeight = 30;
     int leftX = 50;
+    bool networkReady = _frame.networkReady;
+    bool connectedToMaster = _frame.connectedToMaster;
+
+    uint32_t key = DirtyRegionTracker::key(networkReady);
+    key = DirtyRegionTracker::key(_frame.peerCount, key);
+    key = DirtyRegionTracker::key(connectedToMaster, key);
+    if (_trackRegion(leftX, startY, _width - leftX, lineHeight*4 + 8, key)) return;
     
     _display->setTextSize(1);
     
@@ -570,19 +670,18 @@ void EInkDisplay::drawNetworkStatus() {
     _display->setCursor(leftX, startY);
     _display->print("État du réseau: ");
     
-    bool networkReady = _floodSystem->getNetwork().isNetworkReady();
     _display->print(networkReady ? "CONNECTÉ" : "DÉCONNECTÉ");
     
     // Number of peers
     _display->setCursor(leftX, startY + lineHeight);
     _display->print("Nombre de pairs: ");
-    _display->print(_floodSystem->getNetwork().getPeerCount());
+    _display->print(_frame.peerCount);
     
     // Master info if slave
     if (!MODE_MASTER) {
         _display->setCursor(leftX, startY + lineHeight*2);
         _display->print("Connecté au master: ");
-        _display->print(_floodSystem->getNetwork().isConnectedToMaster() ? "OUI" : "NON");
+        _display->print(connectedToMaster ? "OUI" : "NON");
     }
     
     // Connected peers
@@ -601,6 +700,7 @@ void EInkDisplay::drawNetworkStatus() {
 void EInkDisplay::drawBatteryLevel(int percentage, int x, int y) {
     int width = 30;
     int height = 15;
+    if (_trackRegion(x, y, width + 3, height, DirtyRegionTracker::key(percentage))) return;
     
     // Battery outline
     _display->drawRect(x, y, width, height, GxEPD_BLACK);
@@ -612,6 +712,17 @@ void EInkDisplay::drawBatteryLevel(int percentage, int x, int y) {
 }
 
 void EInkDisplay::drawProgressBar(int x, int y, int width, int height, int percentage) {
+    char percentStr[5];
+    sprintf(percentStr, "%d%%", percentage);
+    
+    int16_t x1, y1;
+    uint16_t w, h;
+    _display->getTextBounds(percentStr, 0, 0, &x1, &y1, &w, &h);
+
+    // The percentage starts half its height below the middle of the bar
+    int bottom = max(y + height, y + height/2 + (int)h/2 + (int)h);
+    if (_trackRegion(x, y, width, bottom - y, DirtyRegionTracker::key(percentage))) return;
+
     // Draw outline
     _display->drawRect(x, y, width, height, GxEPD_BLACK);
     
@@ -620,13 +731,6 @@ void EInkDisplay::drawProgressBar(int x, int y, int width, int height, int perce
     _display->fillRect(x + 1, y + 1, fillWidth, height - 2, GxEPD_BLACK);
     
     // Draw percentage
-    char percentStr[5];
-    sprintf(percentStr, "%d%%", percentage);
-    
-    int16_t x1, y1;
-    uint16_t w, h;
-    _display->getTextBounds(percentStr, 0, 0, &x1, &y1, &w, &h);
-    
     _display->setCursor(x + width/2 - w/2, y + height/2 + h/2);
     _display->print(percentStr);
 }
@@ -666,8 +770,8 @@ void EInkDisplay::_updateTime() {
 }
 
 String EInkDisplay::_getTimeString() {
-    char timeStr[9];
-    sprintf(timeStr, "%02d:%02d:%02d", _hour, _minute, _second);
+    char timeStr[12];
+    sprintf(timeStr, "%02d:%02d:%02d", _frame.hour, _frame.minute, _frame.second);
     return String(timeStr);
 }
 
@@ -1,25 +1,55 @@
 #include "indicators/LEDAlertIndicator.h"
 #include "Config.h"
-#include "utils/logger.h"
+#include "utils/Logger.h"
+
+#ifndef NATIVE_SIM
+#include <driver/ledc.h>
+#endif
+
+// Effects channels, also offsets from LED_PWM_FIRST_CHANNEL
+enum { RED_CHANNEL, YELLOW_CHANNEL, GREEN_CHANNEL };
+
+// Blink: on, then off (200 ms each, BLINK_MS in all), repeated by blinkLED
+static const LedStep BLINK_STEPS[] = {{255, 0, 200}, {0, 0, 200}};
+// Breathe: rise and fall in short fades (a fade is never interrupted, so a
+// blink over it waits at most 500 ms)
+static const LedStep BREATHE_STEPS[] = {{80, 500, 0}, {255, 500, 100}, {80, 500, 0}, {0, 500, 300}};
+// Pulse: short flash fading out, then rest
+static const LedStep PULSE_STEPS[] = {{255, 0, 60}, {0, 300, 640}};
+
+static const LedPattern BREATHE = LED_PATTERN(BREATHE_STEPS, 0);
+static const LedPattern PULSE = LED_PATTERN(PULSE_STEPS, 0);
 
 LEDAlertIndicator::LEDAlertIndicator(uint8_t redPin, uint8_t yellowPin, uint8_t greenPin)
     : _redPin(redPin), _yellowPin(yellowPin), _greenPin(greenPin),
-      _alertState(false), _lastWaterLevelUpdate(0), _lastWaterLevel(0), _lastCategory(0) {
+      _alertState(false), _lastWaterLevelUpdate(0), _lastWaterLevel(0), _lastCategory(0),
+      _effects(_output, this) {
 }
 
 bool LEDAlertIndicator::begin() {
     // Initialize pins
+#ifdef NATIVE_SIM
     pinMode(_redPin, OUTPUT);
     pinMode(_yellowPin, OUTPUT);
     pinMode(_greenPin, OUTPUT);
+#else
+    // One LEDC channel per LED, 8-bit duty; the fade service lets the
+    // peripheral ramp the duty without the CPU
+    const uint8_t pins[] = {_redPin, _yellowPin, _greenPin};
+    for (uint8_t i = 0; i < 3; i++) {
+        ledcSetup(LED_PWM_FIRST_CHANNEL + i, LED_PWM_FREQUENCY, 8);
+        ledcAttachPin(pins[i], LED_PWM_FIRST_CHANNEL + i);
+    }
+    ledc_fade_func_install(0);
+#endif
     
     // Start with all LEDs off
     allOff();
     
-    // Flash all LEDs to indicate startup
+    // Flash the LEDs one after the other to indicate startup
     blinkLED(_greenPin, 1);
-    blinkLED(_yellowPin, 1);
-    blinkLED(_redPin, 1);
+    blinkLED(_yellowPin, 1, BLINK_MS);
+    blinkLED(_redPin, 1, 2 * BLINK_MS);
     
     Logger::info("LED Alert Indicator initialized");
     return true;
@@ -99,13 +129,19 @@ void LEDAlertIndicator::update(float waterLevel, uint8_t category) {
         case 2: // Critical
             setGreen(false);
             if (!_alertState) {
-                // Blink yellow if we're not yet in full alert
+                // Breathe yellow if we're not yet in full alert
                 setYellow(true);
+                if (!_effects.isActive(YELLOW_CHANNEL, LED_LAYER_STATUS)) {
+                    breatheLED(_yellowPin);
+                }
             } else {
                 setYellow(false);
             }
             break;
     }
+    if (category != 2 || _alertState) {
+        stopEffect(_yellowPin);
+    }
     
     // Store the water level data
     _lastWaterLevel = waterLevel;
@@ -134,35 +170,80 @@ void LEDAlertIndicator::showAlert(bool isAlert) {
     }
 }
 
-void LEDAlertIndicator::blinkLED(uint8_t pin, int times, int delayMs) {
-    for (int i = 0; i < times; i++) {
-        digitalWrite(pin, HIGH);
-        delay(delayMs);
-        digitalWrite(pin, LOW);
-        delay(delayMs);
+void LEDAlertIndicator::blinkLED(uint8_t pin, int times, uint16_t startDelayMs) {
+    if (times <= 0) {
+        return;
     }
+    LedPattern blink = {BLINK_STEPS, 2, (uint8_t)min(times, 255)};
+    _effects.play(_channel(pin), blink, LED_LAYER_NOTIFY, startDelayMs);
+}
+
+void LEDAlertIndicator::breatheLED(uint8_t pin) {
+    _effects.play(_channel(pin), BREATHE, LED_LAYER_STATUS);
+}
+
+void LEDAlertIndicator::pulseLED(uint8_t pin) {
+    _effects.play(_channel(pin), PULSE, LED_LAYER_STATUS);
+}
+
+void LEDAlertIndicator::stopEffect(uint8_t pin) {
+    _effects.cancel(_channel(pin), LED_LAYER_STATUS);
+}
+
+unsigned long LEDAlertIndicator::tick() {
+    return _effects.tick(millis());
+}
+
+uint8_t LEDAlertIndicator::_channel(uint8_t pin) const {
+    if (pin == _redPin) return RED_CHANNEL;
+    if (pin == _yellowPin) return YELLOW_CHANNEL;
+    if (pin == _greenPin) return GREEN_CHANNEL;
+    return LedEffects::MAX_CHANNELS;
+}
+
+void LEDAlertIndicator::_output(void* context, uint8_t channel, uint8_t level, uint16_t fadeMs) {
+    LEDAlertIndicator* led = static_cast<LEDAlertIndicator*>(context);
+#ifdef NATIVE_SIM
+    // No PWM in the simulator: lit at any level above zero
+    uint8_t pins[] = {led->_redPin, led->_yellowPin, led->_greenPin};
+    digitalWrite(pins[channel], level > 0 ? HIGH : LOW);
+    (void)fadeMs;
+#else
+    (void)led;
+    ledc_channel_t ledcChannel = (ledc_channel_t)(LED_PWM_FIRST_CHANNEL + channel);
+    if (fadeMs > 0) {
+        ledc_set_fade_with_time(LEDC_HIGH_SPEED_MODE, ledcChannel, level, fadeMs);
+        ledc_fade_start(LEDC_HIGH_SPEED_MODE, ledcChannel, LEDC_FADE_NO_WAIT);
+    } else {
+        ledcWrite(LED_PWM_FIRST_CHANNEL + channel, level);
+    }
+#endif
 }
 
 void LEDAlertIndicator::setRed(bool state) {
-    digitalWrite(_redPin, state ? HIGH : LOW);
+    _effects.setSteady(RED_CHANNEL, state ? 255 : 0, millis());
     // Serial.print("Red LED: ");
     // Serial.println(state ? "ON" : "OFF");
 }
 
 void LEDAlertIndicator::setYellow(bool state) {
-    digitalWrite(_yellowPin, state ? HIGH : LOW);
+    _effects.setSteady(YELLOW_CHANNEL, state ? 255 : 0, millis());
     // Serial.print("Yellow LED: ");
     // Serial.println(state ? "ON" : "OFF");
 }
 
 void LEDAlertIndicator::setGreen(bool state) {
-    digitalWrite(_greenPin, state ? HIGH : LOW);
+    _effects.setSteady(GREEN_CHANNEL, state ? 255 : 0, millis());
     // Serial.print("Green LED: ");
     // Serial.println(state ? "ON" : "OFF");
 }
 
 void LEDAlertIndicator::allOff() {
-    digitalWrite(_redPin, LOW);
-    digitalWrite(_yellowPin, LOW);
-    digitalWrite(_greenPin, LOW);
-}
\ No newline at end of file
+    for (uint8_t channel = 0; channel < 3; channel++) {
+        for (uint8_t layer = 0; layer < LED_LAYER_COUNT; layer++) {
+            _effects.cancel(channel, layer);
+        }
+        _effects.setSteady(channel, 0, millis());
+    }
+    _effects.tick(millis());
+}
@@ -0,0 +1,178 @@
+#include "indicators/LedEffects.h"
+
+LedEffects::LedEffects(Output output, void* context)
+    : _output(output),
+      _context(context) {
+    for (uint8_t i = 0; i < MAX_CHANNELS; i++) {
+        Channel& channel = _channels[i];
+        for (uint8_t l = 0; l < LED_LAYER_COUNT; l++) {
+            channel.layers[l].active = false;
+            channel.layers[l].waiting = false;
+            channel.layers[l].serial = 0;
+        }
+        channel.steady = 0;
+        channel.shownLayer = NONE;
+        channel.shownSerial = 0;
+        channel.dirty = false;
+        channel.fadeEnd = 0;
+    }
+}
+
+void LedEffects::setSteady(uint8_t channel, uint8_t level, uint32_t now) {
+    if (channel >= MAX_CHANNELS) return;
+    Channel& c = _channels[channel];
+    c.steady = level;
+    if (c.shownLayer == NONE) {
+        c.dirty = true;
+        _refresh(channel, now);
+    }
+}
+
+bool LedEffects::play(uint8_t channel, const LedPattern& pattern, uint8_t layer, uint16_t delayMs) {
+    if (channel >= MAX_CHANNELS || layer >= LED_LAYER_COUNT || pattern.count == 0) {
+        return false;
+    }
+    if (pattern.repeat == 0) {
+        // A loop needs a duration, or tick() would never get past it
+        uint32_t total = 0;
+        for (uint8_t i = 0; i < pattern.count; i++) total += pattern.steps[i].fadeMs + pattern.steps[i].holdMs;
+        if (total == 0) return false;
+    }
+
+    Layer& l = _channels[channel].layers[layer];
+    l.pattern = pattern;
+    l.active = true;
+    l.started = false;
+    l.waiting = delayMs > 0;
+    l.delayMs = delayMs;
+    l.step = 0;
+    l.cycle = 0;
+    return true;
+}
+
+void LedEffects::cancel(uint8_t channel, uint8_t layer) {
+    if (channel >= MAX_CHANNELS || layer >= LED_LAYER_COUNT) return;
+    _channels[channel].layers[layer].active = false;
+}
+
+bool LedEffects::isActive(uint8_t channel, uint8_t layer) const {
+    if (channel >= MAX_CHANNELS || layer >= LED_LAYER_COUNT) return false;
+    return _channels[channel].layers[layer].active;
+}
+
+uint32_t LedEffects::tick(uint32_t now) {
+    uint32_t next = 0;
+    for (uint8_t i = 0; i < MAX_CHANNELS; i++) {
+        Channel& c = _channels[i];
+        for (uint8_t l = 0; l < LED_LAYER_COUNT; l++) {
+            Layer& layer = c.layers[l];
+            if (layer.active && !_advance(layer, now)) {
+                layer.active = false;
+            }
+        }
+        _refresh(i, now);
+
+        // Next segment of every layer (hidden ones keep their timing), or
+        // the end of the fade holding back a change
+        for (uint8_t l = 0; l < LED_LAYER_COUNT; l++) {
+            const Layer& layer = c.layers[l];
+            if (!layer.active) continue;
+            uint32_t wait = layer.stepEnd - now;
+            if (next == 0 || wait < next) next = wait;
+        }
+        if (c.dirty) {
+            uint32_t wait = c.fadeEnd - now;
+            if (next == 0 || wait < next) next = wait;
+        }
+    }
+    return next;
+}
+
+bool LedEffects::_advance(Layer& layer, uint32_t now) {
+    uint32_t start = now;
+    if (layer.waiting) {
+        // Delayed start, counted from the first tick after play()
+        if (layer.delayMs > 0) {
+            layer.stepEnd = now + layer.delayMs;
+            layer.delayMs = 0;
+        }
+        if ((int32_t)(now - layer.stepEnd) < 0) {
+            return true;
+        }
+        layer.waiting = false;
+        start = layer.stepEnd;
+    } else if (layer.started) {
+        if ((int32_t)(now - layer.stepEnd) < 0) {
+            return true;
+        }
+        // The next segment starts when this one ended, not when the tick came
+        start = layer.stepEnd;
+        if (++layer.step == layer.pattern.count) {
+            layer.step = 0;
+            if (layer.pattern.repeat != 0 && ++layer.cycle >= layer.pattern.repeat) {
+                return false;
+            }
+        }
+    }
+
+    for (;;) {
+        const LedStep& step = layer.pattern.steps[layer.step];
+        uint32_t length = step.fadeMs + step.holdMs;
+        // Too late for the whole segment: play it from now rather than skip it
+        if ((int32_t)(now - (start + length)) >= 0) {
+            start = now;
+        }
+        layer.started = true;
+        layer.serial++;
+        layer.stepStart = start;
+        layer.stepEnd = start + length;
+        if (length > 0) {
+            return true;
+        }
+
+        // Empty segment: straight to the next one
+        if (++layer.step == layer.pattern.count) {
+            layer.step = 0;
+            if (layer.pattern.repeat != 0 && ++layer.cycle >= layer.pattern.repeat) {
+                return false;
+            }
+        }
+    }
+}
+
+uint8_t LedEffects::_topLayer(const Channel& channel) const {
+    for (uint8_t l = LED_LAYER_COUNT; l-- > 0;) {
+        if (channel.layers[l].active && !channel.layers[l].waiting) return l;
+    }
+    return NONE;
+}
+
+void LedEffects::_refresh(uint8_t index, uint32_t now) {
+    Channel& c = _channels[index];
+    uint8_t top = _topLayer(c);
+    if (top != c.shownLayer || (top != NONE && c.layers[top].serial != c.shownSerial)) {
+        c.dirty = true;
+    }
+    // Never cut a fade short: the change goes out when it ends
+    if (!c.dirty || (int32_t)(now - c.fadeEnd) < 0) {
+        return;
+    }
+
+    uint8_t level = c.steady;
+    uint16_t fadeMs = 0;
+    if (top != NONE) {
+        const Layer& layer = c.layers[top];
+        const LedStep& step = layer.pattern.steps[layer.step];
+        level = step.level;
+        // Rest of the segment's fade, from whatever brightness the LED has now
+        uint32_t fadeEnd = layer.stepStart + step.fadeMs;
+        if ((int32_t)(fadeEnd - now) > 0) {
+            fadeMs = (uint16_t)(fadeEnd - now);
+        }
+        c.shownSerial = layer.serial;
+    }
+    c.shownLayer = top;
+    c.dirty = false;
+    c.fadeEnd = now + fadeMs;
+    _output(_context, index, level, fadeMs);
+}
@@ -1,6 +1,6 @@
 // src/indicators/ToggleSwitchIndicator.cpp
 #include "indicators/ToggleSwitchIndicator.h"
-#include "utils/logger.h"
+#include "utils/Logger.h"
 
 ToggleSwitchIndicator::ToggleSwitchIndicator(uint8_t switchPin, uint8_t ledPin)
     : _switchPin(switchPin), 
@@ -0,0 +1,148 @@
+#include "indicators/ToneSequencer.h"
+
+ToneSequencer::ToneSequencer(Output output, void* context)
+    : _output(output),
+      _context(context),
+      _count(0),
+      _step(0),
+      _started(false),
+      _frequency(0),
+      _stepEnd(0) {
+}
+
+bool ToneSequencer::play(const TonePattern& pattern, uint8_t priority) {
+    if (pattern.count == 0) {
+        return false;
+    }
+    if (pattern.repeat == 0) {
+        // A loop needs a duration, or tick() would never get past it
+        uint32_t total = 0;
+        for (uint8_t i = 0; i < pattern.count; i++) total += pattern.steps[i].durationMs;
+        if (total == 0) return false;
+    }
+    Entry entry = {pattern, priority, 0};
+
+    // Nothing playing, or something less important: start right away
+    if (_count == 0 || priority > _queue[0].priority) {
+        if (_count == 0) _count = 1;
+        _queue[0] = entry;
+        _step = 0;
+        _started = false;
+        return true;
+    }
+
+    return _insert(entry);
+}
+
+void ToneSequencer::cancel(uint8_t priority) {
+    for (uint8_t i = _count; i-- > 0;) {
+        if (_queue[i].priority != priority) continue;
+        _remove(i);
+        if (i == 0) {
+            _step = 0;
+            _started = false;
+        }
+    }
+    if (_count == 0) {
+        _emit(0);
+    }
+}
+
+void ToneSequencer::stop() {
+    force(0);
+}
+
+void ToneSequencer::force(uint16_t frequency) {
+    _count = 0;
+    _step = 0;
+    _started = false;
+    _emit(frequency);
+}
+
+uint32_t ToneSequencer::tick(uint32_t now) {
+    while (_count > 0) {
+        uint32_t start = now;
+        if (_started) {
+            if ((int32_t)(now - _stepEnd) < 0) {
+                return _stepEnd - now;
+            }
+            // The next note starts when this one ended, not when the tick
+            // came: lateness does not accumulate over a pattern
+            start = _stepEnd;
+            if (!_advance()) {
+                Entry finished = _queue[0];
+                _remove(0);
+                _step = 0;
+                // A loop that gave way goes back in line
+                if (finished.pattern.repeat == 0) _insert(finished);
+                if (_count == 0) break;
+            }
+        }
+
+        const ToneStep& step = _queue[0].pattern.steps[_step];
+        // Too late for the whole note: play it in full from now rather than skip it
+        if ((int32_t)(now - (start + step.durationMs)) >= 0) {
+            start = now;
+        }
+        _started = true;
+        _stepEnd = start + step.durationMs;
+        _emit(step.frequency);
+        if (step.durationMs > 0) {
+            return _stepEnd - now;
+        }
+    }
+
+    // Silence once the last pattern ends; a forced tone is left alone
+    if (_started) {
+        _started = false;
+        _emit(0);
+    }
+    return 0;
+}
+
+bool ToneSequencer::_advance() {
+    Entry& entry = _queue[0];
+    if (++_step < entry.pattern.count) {
+        return true;
+    }
+    _step = 0;
+
+    if (entry.pattern.repeat == 0) {
+        // Loop until a pattern of the same priority is waiting
+        return _count == 1 || _queue[1].priority < entry.priority;
+    }
+    return ++entry.cycle < entry.pattern.repeat;
+}
+
+// Behind every waiting pattern of the same or higher priority
+bool ToneSequencer::_insert(const Entry& entry) {
+    uint8_t index = 1;
+    while (index < _count && _queue[index].priority >= entry.priority) {
+        index++;
+    }
+    if (_count == MAX_QUEUED) {
+        if (index == MAX_QUEUED) {
+            return false;
+        }
+        _count--;   // Drop the least important waiting pattern
+    }
+    for (uint8_t i = _count; i > index; i--) {
+        _queue[i] = _queue[i - 1];
+    }
+    _queue[index] = entry;
+    _count++;
+    return true;
+}
+
+void ToneSequencer::_remove(uint8_t index) {
+    for (uint8_t i = index; i + 1 < _count; i++) {
+        _queue[i] = _queue[i + 1];
+    }
+    _count--;
+}
+
+void ToneSequencer::_emit(uint16_t frequency) {
+    if (frequency == _frequency) return;
+    _frequency = frequency;
+    _output(_context, frequency);
+}
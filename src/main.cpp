@@ -11,11 +11,6 @@
 #include "Menu.h"
 // Inclure le système de logs
 #include "utils/Logger.h"
-#include <Ticker.h>
-
-Ticker alertTestTicker;
-bool testingAlert = false;
-int testPhase = 0;
 
 // Créer l'instance du système
 FloodAlertSystem floodSystem;
@@ -101,24 +96,25 @@ void setup() {
     ledIndicator.setGreen(true);
     buzzerIndicator.playSuccessTone();
     
+    // Mettre à jour l'encodeur rotatif et le menu si en mode master
+    if (isMaster && encoder != nullptr && menu != nullptr) {
+        floodSystem.getScheduler().addPeriodic("menu", 10, []() {
+            encoder->update();
+            menu->update();
+        });
+    }
+    
     Logger::ui("Configuration terminée!");
     
     // Switch to clock screen after 10 seconds
-    delay(10000);
-    einkDisplay.setScreen(SCREEN_CLOCK);
-    einkDisplay.refresh();
+    floodSystem.getScheduler().runAfter("clock-screen", 10000, []() {
+        einkDisplay.setScreen(SCREEN_CLOCK);
+        einkDisplay.refresh();
+    });
 }
 
 void loop() {
-    // Mettre à jour le système (gère tous les composants)
+    // Exécuter les tâches prêtes ; la boucle dort jusqu'à la prochaine
+    // échéance ou jusqu'à un signal (plus de delay(10))
     floodSystem.update();
-    
-    // Mettre à jour l'encodeur rotatif et le menu si en mode master
-    if (MODE_MASTER && encoder != nullptr && menu != nullptr) {
-        encoder->update();
-        menu->update();
-    }
-    
-    // Petite pause pour économiser de l'énergie
-    delay(10);
 }
\ No newline at end of file
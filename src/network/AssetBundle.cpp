@@ -0,0 +1,19 @@
+#include "network/AssetBundle.h"
+
+uint32_t AssetBundle::hash(const char* text, uint32_t seed) {
+    uint32_t h = 2166136261u ^ seed;
+    for (const uint8_t* p = (const uint8_t*)text; *p; p++) {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+const BundledAsset* AssetBundle::find(const char* path) {
+    if (ASSET_BUNDLE_COUNT == 0) return nullptr;
+
+    uint16_t seed = ASSET_BUNDLE_SEEDS[hash(path, 0) % ASSET_BUNDLE_BUCKETS];
+    const BundledAsset& asset = ASSET_BUNDLE[hash(path, seed) % ASSET_BUNDLE_SLOTS];
+    if (asset.path == nullptr || strcmp(asset.path, path) != 0) return nullptr;
+    return &asset;
+}
@@ -1,8 +1,9 @@
 #include "network/FloodAlertNetwork.h"
-#include "utils/logger.h"
+#include "network/WireFormat.h"
+#include "utils/Logger.h"
 
 // Initialize static instance pointer
-FloodAlertNetwork* FloodAlertNetwork::_instance = nullptr;
+NODE_LOCAL FloodAlertNetwork* FloodAlertNetwork::_instance = nullptr;
 
 // Constructor implementation
 FloodAlertNetwork::FloodAlertNetwork() 
@@ -13,9 +14,19 @@ FloodAlertNetwork::FloodAlertNetwork()
       _min_peers(1), 
       _message_counter(0), 
       _peer_count(0),
+      _state_generation(0),
       _last_discovery(0),
       _last_status_send(0),
-      _network_ready_time(0) {
+      _network_ready_time(0),
+      _message_callback(nullptr),
+      _delivery_callback(nullptr),
+      _data_ready_callback(nullptr),
+      _frame_queued_callback(nullptr),
+      _batch_callback(nullptr),
+      _rx_dropped(0),
+      _rx_processed(0),
+      _rx_invalid(0),
+      _rx_high_water(0) {
     
     memset(_own_mac, 0, 6);
     memset(_master_mac, 0, 6);
@@ -98,6 +109,16 @@ void FloodAlertNetwork::onDataReady(DataReadyCallback callback) {
     _data_ready_callback = callback;
 }
 
+// Set callback for when a frame has been queued by the WiFi task
+void FloodAlertNetwork::onFrameQueued(FrameQueuedCallback callback) {
+    _frame_queued_callback = callback;
+}
+
+// Set callback for batched sensor readings (master)
+void FloodAlertNetwork::onBatchReceived(BatchCallback callback) {
+    _batch_callback = callback;
+}
+
 // Send sensor data to the master device (for slave devices)
 bool FloodAlertNetwork::sendToMaster(const float* data, uint8_t data_count, const char* text) {
     if (!_master_found) {
@@ -125,10 +146,44 @@ bool FloodAlertNetwork::sendToMaster(const float* data, uint8_t data_count, cons
     return _sendMessage(_master_mac, msg);
 }
 
+// Send several timestamped readings to the master in one frame (for slave devices)
+bool FloodAlertNetwork::sendBatchToMaster(const sensor_batch_t& batch) {
+    if (!_master_found || !_initialized || batch.count == 0) {
+        return false;
+    }
+    
+#if WIRE_FORMAT_LEGACY_TX
+    // Old masters only understand SENSOR_DATA: send the newest reading
+    const SensorReading& newest = batch.readings[batch.count - 1];
+    return sendToMaster(newest.values, batch.value_count, batch.name);
+#else
+    network_message_t header;
+    memset(&header, 0, sizeof(network_message_t));
+    header.type = SENSOR_BATCH;
+    header.message_id = _message_counter++;
+    header.is_master = _is_master;
+    header.ready = true;
+    header.battery_level = 100;  // Placeholder, implement actual battery level reading
+    
+    uint8_t frame[ESP_NOW_MAX_DATA_LEN];
+    uint8_t sent = 0;
+    size_t len = WireFormat::encodeBatch(header, batch, frame, sizeof(frame), &sent);
+    if (len == 0) {
+        Logger::error("Sensor batch does not fit in an ESP-NOW frame");
+        return false;
+    }
+    if (sent < batch.count) {
+        Logger::warningF("Batch trop long: %d mesures les plus anciennes non envoyées", batch.count - sent);
+    }
+    
+    return esp_now_send(_master_mac, frame, len) == ESP_OK;
+#endif
+}
+
 // Send alert or status update to all slave devices (for master device)
 bool FloodAlertNetwork::sendToAllSlaves(const float* data, uint8_t data_count, uint8_t alert_level, const char* text) {
     if (!_is_master) {
-        Serial.println("Only master can send to all slaves.");
+        Logger::warning("Only master can send to all slaves.");
         return false;
     }
     
@@ -267,10 +322,14 @@ uint8_t FloodAlertNetwork::getMinPeers() {
 // Set minimum required peers
 void FloodAlertNetwork::setMinPeers(uint8_t min_peers) {
     _min_peers = min_peers;
+    _state_generation++;
 }
 
 // Process network tasks (call this regularly in loop())
 void FloodAlertNetwork::update() {
+    // Handle what the callbacks queued since the last call
+    processReceived();
+    
     uint32_t now = millis();
     
     // Periodic discovery broadcasts (more frequent during initial setup)
@@ -317,6 +376,9 @@ void FloodAlertNetwork::printNetworkStatus() {
     Logger::infoF("Rôle: %s", _is_master ? "MASTER" : "SLAVE");
     Logger::infoF("Pairs connectés: %d (minimum: %d)", _peer_count, _min_peers);
     Logger::infoF("Réseau prêt: %s", isNetworkReady() ? "OUI" : "NON");
+    Logger::infoF("Trames reçues: %u (perdues: %u, invalides: %u, file max: %u/%u)",
+                  (unsigned)_rx_processed, (unsigned)_rx_dropped, (unsigned)_rx_invalid,
+                  (unsigned)_rx_high_water, (unsigned)RX_QUEUE_LENGTH);
     
     if (!_is_master) {
         Logger::infoF("Connecté au master: %s", _master_found ? "OUI" : "NON");
@@ -334,13 +396,12 @@ void FloodAlertNetwork::printPeers() {
         if (_peers[i].in_use) {
             pairsCount++;
             const uint8_t* mac = _peers[i].peer_info.peer_addr;
-            Logger::ui("Pair MAC: ");
-            Serial.printf("%02X:%02X:%02X:%02X:%02X:%02X", 
+            Logger::uiF("Pair MAC: %02X:%02X:%02X:%02X:%02X:%02X",
                         mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
             Logger::uiF(" Rôle: %s", _peers[i].is_master ? "MASTER" : "SLAVE");
             Logger::uiF(" Prêt: %s", _peers[i].is_ready ? "OUI" : "NON");
-            Logger::uiF(" Dernière connexion: %d secondes",
-                      (millis() - _peers[i].last_seen) / 1000);
+            Logger::uiF(" Dernière connexion: %lu secondes",
+                      (unsigned long)((millis() - _peers[i].last_seen) / 1000));
         }
     }
     
@@ -420,14 +481,13 @@ bool FloodAlertNetwork::_addPeer(const uint8_t* mac_addr, bool is_master) {
         return false;
     }
     
+    _peer_index.insert(mac_addr, (uint16_t)slot);
     _peer_count++;
+    _state_generation++;
     
-    Logger::info("Nouveau pair ajouté: ");
-    for (int i = 0; i < 6; i++) {
-        Serial.printf("%02X", mac_addr[i]);
-        if (i < 5) Serial.print(":");
-    }
-    Logger::infoF(" Rôle: %s", is_master ? "MASTER" : "SLAVE");
+    Logger::infoF("Nouveau pair ajouté: %02X:%02X:%02X:%02X:%02X:%02X Rôle: %s",
+                  mac_addr[0], mac_addr[1], mac_addr[2], mac_addr[3], mac_addr[4], mac_addr[5],
+                  is_master ? "MASTER" : "SLAVE");
     
     return true;
 }
@@ -442,21 +502,18 @@ bool FloodAlertNetwork::_removePeer(const uint8_t* mac_addr) {
     // Remove peer from ESP-NOW
     esp_err_t result = esp_now_del_peer(mac_addr);
     if (result != ESP_OK) {
-        Serial.print("Failed to remove peer: ");
-        Serial.println(result);
+        Logger::warningF("Failed to remove peer: %d", (int)result);
         // Continue anyway to remove from our list
     }
     
     // Clear peer slot
     _peers[idx].in_use = false;
+    _peer_index.erase(mac_addr);
     _peer_count--;
+    _state_generation++;
     
-    Serial.print("Removed peer: ");
-    for (int i = 0; i < 6; i++) {
-        Serial.print(mac_addr[i], HEX);
-        if (i < 5) Serial.print(":");
-    }
-    Serial.println();
+    Logger::infoF("Removed peer: %02X:%02X:%02X:%02X:%02X:%02X",
+                  mac_addr[0], mac_addr[1], mac_addr[2], mac_addr[3], mac_addr[4], mac_addr[5]);
     
     return true;
 }
@@ -464,22 +521,29 @@ bool FloodAlertNetwork::_removePeer(const uint8_t* mac_addr) {
 // Send a message to a specific peer
 bool FloodAlertNetwork::_sendMessage(const uint8_t* mac_addr, network_message_t& msg) {
     if (!_initialized) {
-        Serial.println("Cannot send message, network not initialized.");
+        Logger::error("Cannot send message, network not initialized.");
         return false;
     }
     
+#if WIRE_FORMAT_LEGACY_TX
+    // Mixed network: nodes with the old firmware only understand the raw struct
     esp_err_t result = esp_now_send(mac_addr, (uint8_t*)&msg, sizeof(network_message_t));
+#else
+    uint8_t frame[ESP_NOW_MAX_DATA_LEN];
+    size_t len = WireFormat::encode(msg, frame, sizeof(frame));
+    if (len == 0) {
+        Logger::error("Message too large for an ESP-NOW frame");
+        return false;
+    }
+    esp_err_t result = esp_now_send(mac_addr, frame, len);
+#endif
     return (result == ESP_OK);
 }
 
 // Find peer index by MAC address
 int FloodAlertNetwork::_findPeerIndex(const uint8_t* mac_addr) {
-    for (int i = 0; i < MAX_PEERS; i++) {
-        if (_peers[i].in_use && _compareMac(_peers[i].peer_info.peer_addr, mac_addr)) {
-            return i;
-        }
-    }
-    return -1;  // Not found
+    const uint16_t* slot = _peer_index.find(mac_addr);
+    return slot ? *slot : -1;  // -1: not found
 }
 
 // Find an empty slot in the peers array
@@ -497,31 +561,71 @@ bool FloodAlertNetwork::_compareMac(const uint8_t* mac1, const uint8_t* mac2) {
     return memcmp(mac1, mac2, 6) == 0;
 }
 
-// Static callback for ESP-NOW receive
-void FloodAlertNetwork::_onReceiveHandler(const uint8_t* mac_addr, const uint8_t* data, int data_len) {
-    if (!_instance) return;
+// Drain the frames and delivery results queued by the ESP-NOW callbacks.
+// Runs in the loop task, so _peers and the application callbacks are only
+// ever touched from there.
+uint16_t FloodAlertNetwork::processReceived() {
+    uint16_t handled = 0;
     
-    if (data_len != sizeof(network_message_t)) {
-        Serial.println("Received message with invalid size.");
-        return;
+    // Track the deepest backlog seen, to size RX_QUEUE_LENGTH
+    size_t backlog = _rx_queue.size();
+    if (backlog > _rx_high_water) {
+        _rx_high_water = (uint8_t)backlog;
+    }
+    
+    // Delivery results first: a failed send may remove a peer
+    SendResult result;
+    for (size_t i = 0; i < RX_QUEUE_LENGTH && _send_queue.pop(result); i++) {
+        _handleSendResult(result.mac, result.success);
+        handled++;
     }
     
+    // Bounded batch: frames arriving meanwhile wait for the next call
+    for (size_t i = 0; i < RX_QUEUE_LENGTH; i++) {
+        const RawFrame* frame = _rx_queue.front();
+        if (!frame) break;
+        
+        _handleFrame(*frame);
+        _rx_queue.popFront();
+        _rx_processed++;
+        handled++;
+    }
+    
+    return handled;
+}
+
+// Decode and dispatch one received frame
+void FloodAlertNetwork::_handleFrame(const RawFrame& frame) {
+    const uint8_t* mac_addr = frame.mac;
+    
     network_message_t msg;
-    memcpy(&msg, data, sizeof(network_message_t));
     
-    // Update peer information
-    int peer_idx = _instance->_findPeerIndex(mac_addr);
-    if (peer_idx >= 0) {
-        _instance->_peers[peer_idx].last_seen = millis();
-        _instance->_peers[peer_idx].is_master = msg.is_master;
-        _instance->_peers[peer_idx].is_ready = msg.ready;
-    } else {
-        // New peer, process discovery if it's a discovery message
-        if (msg.type == DISCOVERY) {
-            _instance->_processPeerDiscovery(msg, mac_addr);
+    // Batched readings: decoded straight into the batch buffer
+    if (WireFormat::peekType(frame.data, frame.len) == SENSOR_BATCH) {
+        if (!WireFormat::decodeBatch(frame.data, frame.len, mac_addr, msg, _rx_batch)) {
+            _rx_invalid++;
+            Logger::warningF("Batch invalide ignoré (%d octets)", frame.len);
+            return;
         }
+        
+        _updatePeer(msg, mac_addr);
+        
+        // Only master processes sensor data
+        if (_is_master && _batch_callback) {
+            _batch_callback(_rx_batch, mac_addr);
+        }
+        return;
+    }
+    
+    // Compact frame, or raw struct from a node running the old firmware
+    if (!WireFormat::decode(frame.data, frame.len, mac_addr, msg)) {
+        _rx_invalid++;
+        Logger::warningF("Trame invalide ignorée (%d octets)", frame.len);
+        return;
     }
     
+    _updatePeer(msg, mac_addr);
+    
     // Handle message based on type
     switch (msg.type) {
         case DISCOVERY:
@@ -530,8 +634,8 @@ void FloodAlertNetwork::_onReceiveHandler(const uint8_t* mac_addr, const uint8_t
             
         case SENSOR_DATA:
             // Only master processes sensor data
-            if (_instance->_is_master && _instance->_data_ready_callback) {
-                _instance->_data_ready_callback(msg.data, msg.data_count);
+            if (_is_master && _data_ready_callback) {
+                _data_ready_callback(msg.data, msg.data_count);
             }
             break;
             
@@ -546,61 +650,98 @@ void FloodAlertNetwork::_onReceiveHandler(const uint8_t* mac_addr, const uint8_t
             break;
             
         default:
-            Serial.print("Unknown message type: ");
-            Serial.println(msg.type);
+            Logger::warningF("Unknown message type: %d", (int)msg.type);
             break;
     }
     
     // Call user callback if registered
-    if (_instance->_message_callback) {
-        _instance->_message_callback(msg, mac_addr);
+    if (_message_callback) {
+        _message_callback(msg, mac_addr);
     }
 }
 
-// Static callback for ESP-NOW send status
-void FloodAlertNetwork::_onSendHandler(const uint8_t* mac_addr, esp_now_send_status_t status) {
-    if (!_instance) return;
-    
-    bool success = (status == ESP_NOW_SEND_SUCCESS);
-    
+// Refresh the peer that sent msg, or register it on discovery
+void FloodAlertNetwork::_updatePeer(const network_message_t& msg, const uint8_t* mac_addr) {
+    int peer_idx = _findPeerIndex(mac_addr);
+    if (peer_idx >= 0) {
+        _peers[peer_idx].last_seen = millis();
+        _peers[peer_idx].is_master = msg.is_master;
+        _peers[peer_idx].is_ready = msg.ready;
+    } else {
+        // New peer, process discovery if it's a discovery message
+        if (msg.type == DISCOVERY) {
+            _processPeerDiscovery(msg, mac_addr);
+        }
+    }
+}
+
+// Apply one delivery result
+void FloodAlertNetwork::_handleSendResult(const uint8_t* mac_addr, bool success) {
     // Update retry count for failed sends
-    if (!success && mac_addr) {
-        int peer_idx = _instance->_findPeerIndex(mac_addr);
+    if (!success) {
+        int peer_idx = _findPeerIndex(mac_addr);
         if (peer_idx >= 0) {
-            _instance->_peers[peer_idx].retry_count++;
+            _peers[peer_idx].retry_count++;
             
             // If too many failures, consider removing the peer
-            if (_instance->_peers[peer_idx].retry_count > 5) {
-                Serial.print("Too many failed sends to peer, removing: ");
-                for (int i = 0; i < 6; i++) {
-                    Serial.print(mac_addr[i], HEX);
-                    if (i < 5) Serial.print(":");
-                }
-                Serial.println();
+            if (_peers[peer_idx].retry_count > 5) {
+                Logger::warningF("Too many failed sends to peer, removing: %02X:%02X:%02X:%02X:%02X:%02X",
+                                 mac_addr[0], mac_addr[1], mac_addr[2], mac_addr[3], mac_addr[4], mac_addr[5]);
                 
-                _instance->_removePeer(mac_addr);
+                _removePeer(mac_addr);
                 
                 // If the master was removed, reset master_found flag
-                if (!_instance->_is_master && 
-                    _instance->_master_found && 
-                    _instance->_compareMac(mac_addr, _instance->_master_mac)) {
-                    _instance->_master_found = false;
-                    memset(_instance->_master_mac, 0, 6);
+                if (!_is_master && _master_found && _compareMac(mac_addr, _master_mac)) {
+                    _master_found = false;
+                    memset(_master_mac, 0, 6);
                 }
             }
         }
     }
     
     // Reset retry count for successful sends
-    if (success && mac_addr) {
-        int peer_idx = _instance->_findPeerIndex(mac_addr);
+    if (success) {
+        int peer_idx = _findPeerIndex(mac_addr);
         if (peer_idx >= 0) {
-            _instance->_peers[peer_idx].retry_count = 0;
+            _peers[peer_idx].retry_count = 0;
         }
     }
     
     // Call user callback if registered
-    if (_instance->_delivery_callback) {
-        _instance->_delivery_callback(success, mac_addr);
+    if (_delivery_callback) {
+        _delivery_callback(success, mac_addr);
     }
-}
\ No newline at end of file
+}
+
+// Static callback for ESP-NOW receive (WiFi task): copy the frame and return
+void FloodAlertNetwork::_onReceiveHandler(const uint8_t* mac_addr, const uint8_t* data, int data_len) {
+    if (!_instance || !mac_addr || data_len <= 0 || data_len > ESP_NOW_MAX_DATA_LEN) return;
+    
+    RawFrame* frame = _instance->_rx_queue.reserve();
+    if (!frame) {
+        // Loop too slow for this burst
+        _instance->_rx_dropped++;
+        return;
+    }
+    
+    memcpy(frame->mac, mac_addr, 6);
+    frame->len = (uint8_t)data_len;
+    memcpy(frame->data, data, data_len);
+    _instance->_rx_queue.commit();
+    
+    if (_instance->_frame_queued_callback) {
+        _instance->_frame_queued_callback();
+    }
+}
+
+// Static callback for ESP-NOW send status (WiFi task): queue the result
+void FloodAlertNetwork::_onSendHandler(const uint8_t* mac_addr, esp_now_send_status_t status) {
+    if (!_instance || !mac_addr) return;
+    
+    SendResult* result = _instance->_send_queue.reserve();
+    if (!result) return;  // Only statistics are lost
+    
+    memcpy(result->mac, mac_addr, 6);
+    result->success = (status == ESP_NOW_SEND_SUCCESS);
+    _instance->_send_queue.commit();
+}
@@ -0,0 +1,752 @@
+#include "network/HttpServer.h"
+#include "utils/Logger.h"
+
+#include <errno.h>
+
+#ifdef NATIVE_SIM
+#include <SimHeap.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#else
+#include <lwip/sockets.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+static const char* statusText(int code) {
+    switch (code) {
+        case 200: return "OK";
+        case 204: return "No Content";
+        case 302: return "Found";
+        case 304: return "Not Modified";
+        case 400: return "Bad Request";
+        case 404: return "Not Found";
+        case 405: return "Method Not Allowed";
+        case 413: return "Payload Too Large";
+        case 431: return "Request Header Fields Too Large";
+        case 500: return "Internal Server Error";
+        case 503: return "Service Unavailable";
+        default: return "";
+    }
+}
+
+static int hexValue(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Decode %XX and '+' in place
+static void urlDecode(char* text) {
+    char* out = text;
+    for (char* in = text; *in; in++) {
+        if (*in == '+') {
+            *out++ = ' ';
+        } else if (*in == '%' && hexValue(in[1]) >= 0 && hexValue(in[2]) >= 0) {
+            *out++ = (char)(hexValue(in[1]) << 4 | hexValue(in[2]));
+            in += 2;
+        } else {
+            *out++ = *in;
+        }
+    }
+    *out = '\0';
+}
+
+static bool startsWithIgnoreCase(const char* text, const char* prefix) {
+    for (; *prefix; text++, prefix++) {
+        if (tolower((unsigned char)*text) != tolower((unsigned char)*prefix)) return false;
+    }
+    return true;
+}
+
+// Value of a header in a raw "Name: value\r\n..." block
+static const char* findHeader(const char* headers, const char* name, size_t& length) {
+    size_t nameLength = strlen(name);
+    for (const char* line = headers; line && *line; ) {
+        const char* end = strstr(line, "\r\n");
+        if (!end || end == line) break;
+        if (startsWithIgnoreCase(line, name) && line[nameLength] == ':') {
+            const char* value = line + nameLength + 1;
+            while (*value == ' ' || *value == '\t') value++;
+            length = end - value;
+            return value;
+        }
+        line = end + 2;
+    }
+    return nullptr;
+}
+
+static void setNonBlocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+HttpServer::HttpServer(int port)
+    : _port((uint16_t)port), _listenFd(-1), _connections(nullptr), _pool(nullptr), _routeCount(0),
+      _notFound(nullptr), _notFoundOwner(nullptr), _current(nullptr), _contentLength(CONTENT_LENGTH_NOT_SET),
+      _headersSent(false) {
+    memset(&_stats, 0, sizeof(_stats));
+    memset(&_request, 0, sizeof(_request));
+    memset(_routeSlots, 0, sizeof(_routeSlots));
+}
+
+HttpServer::~HttpServer() {
+    stop();
+}
+
+bool HttpServer::begin() {
+    if (_listenFd >= 0) return true;
+
+    // Pool: one request buffer and one output buffer per connection, allocated once
+    _connections = new (std::nothrow) Connection[HTTP_MAX_CONNECTIONS];
+    _pool = new (std::nothrow) char[HTTP_MAX_CONNECTIONS * (HTTP_REQUEST_BUFFER + HTTP_OUTPUT_BUFFER)];
+    if (!_connections || !_pool) {
+        Logger::error("HttpServer: connection pool allocation failed");
+        stop();
+        return false;
+    }
+    char* next = _pool;
+    for (int i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        Connection& c = _connections[i];
+        c.fd = -1;
+        c.state = CONN_FREE;
+        c.generation = 0;
+        c.constLength = 0;
+        c.request = next;
+        next += HTTP_REQUEST_BUFFER;
+        c.out = next;
+        next += HTTP_OUTPUT_BUFFER;
+    }
+
+    _listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (_listenFd < 0) {
+        Logger::error("HttpServer: socket() failed");
+        stop();
+        return false;
+    }
+    int reuse = 1;
+    setsockopt(_listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(_port);
+    if (bind(_listenFd, (struct sockaddr*)&address, sizeof(address)) < 0 ||
+        listen(_listenFd, HTTP_MAX_CONNECTIONS) < 0) {
+        Logger::errorF("HttpServer: cannot listen on port %u", (unsigned)_port);
+        stop();
+        return false;
+    }
+    setNonBlocking(_listenFd);
+
+    // Port 0 lets the system pick one (native build)
+    socklen_t length = sizeof(address);
+    if (getsockname(_listenFd, (struct sockaddr*)&address, &length) == 0) {
+        _port = ntohs(address.sin_port);
+    }
+    return true;
+}
+
+void HttpServer::stop() {
+    if (_connections) {
+        for (int i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+            if (_connections[i].state != CONN_FREE) _close(_connections[i]);
+        }
+    }
+    if (_listenFd >= 0) {
+        close(_listenFd);
+        _listenFd = -1;
+    }
+    delete[] _connections;
+    delete[] _pool;
+    _connections = nullptr;
+    _pool = nullptr;
+}
+
+bool HttpServer::addRoutes(const HttpRoute* routes, size_t count, void* owner) {
+    static_assert((HTTP_ROUTE_SLOTS & (HTTP_ROUTE_SLOTS - 1)) == 0, "HTTP_ROUTE_SLOTS must be a power of two");
+    static_assert(HTTP_ROUTE_SLOTS > HTTP_MAX_ROUTES, "the route index needs free slots");
+
+    for (size_t i = 0; i < count; i++) {
+        const HttpRoute& route = routes[i];
+        if (_routeCount >= HTTP_MAX_ROUTES) {
+            Logger::errorF("HttpServer: too many routes, %s ignored", route.uri);
+            return false;
+        }
+        for (uint8_t j = 0; j < _routeCount; j++) {
+            const HttpRoute* other = _routes[j].route;
+            if (other->prefix == route.prefix && strcmp(other->uri, route.uri) == 0 &&
+                (other->method == route.method || other->method == HTTP_ANY || route.method == HTTP_ANY)) {
+                Logger::errorF("HttpServer: %s registered twice", route.uri);
+                return false;
+            }
+        }
+
+        Route& entry = _routes[_routeCount++];
+        entry.route = &route;
+        entry.owner = owner;
+        entry.hits = 0;
+        entry.maxUs = 0;
+        entry.heapPeak = 0;
+
+        // Exact paths: linear probing from the hash
+        if (!route.prefix) {
+            uint32_t slot = route.hash & (HTTP_ROUTE_SLOTS - 1);
+            while (_routeSlots[slot] != 0) slot = (slot + 1) & (HTTP_ROUTE_SLOTS - 1);
+            _routeSlots[slot] = _routeCount;
+        }
+    }
+    return true;
+}
+
+bool HttpServer::hasRoute(const char* uri) const {
+    for (uint8_t i = 0; i < _routeCount; i++) {
+        if (strcmp(_routes[i].route->uri, uri) == 0) return true;
+    }
+    return false;
+}
+
+// Exact path through the index, then prefixes in registration order
+HttpServer::Route* HttpServer::_findRoute(const char* path, HTTPMethod method) {
+    uint32_t hash = httpRequestHash(path);
+    for (uint32_t slot = hash & (HTTP_ROUTE_SLOTS - 1); _routeSlots[slot] != 0;
+         slot = (slot + 1) & (HTTP_ROUTE_SLOTS - 1)) {
+        Route& entry = _routes[_routeSlots[slot] - 1];
+        const HttpRoute* route = entry.route;
+        if (route->hash == hash && (route->method == HTTP_ANY || route->method == method) &&
+            strcmp(route->uri, path) == 0) {
+            return &entry;
+        }
+    }
+
+    for (uint8_t i = 0; i < _routeCount; i++) {
+        const HttpRoute* route = _routes[i].route;
+        if (route->prefix && (route->method == HTTP_ANY || route->method == method) &&
+            strncmp(path, route->uri, route->length) == 0) {
+            return &_routes[i];
+        }
+    }
+    return nullptr;
+}
+
+void HttpServer::handleClient() {
+    if (_listenFd < 0) return;
+
+    _accept();
+
+    for (int i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        Connection& c = _connections[i];
+        switch (c.state) {
+            case CONN_READING:
+                _read(c);
+                if (c.state == CONN_READING && millis() - c.lastActivity > HTTP_IDLE_TIMEOUT_MS) {
+                    _stats.timeouts++;
+                    _close(c);
+                }
+                break;
+            case CONN_WRITING:
+            case CONN_STREAMING:
+                if (!_pump(c)) break;
+                // A client that stops reading a finite response is eventually dropped
+                if (c.state == CONN_WRITING && millis() - c.lastActivity > HTTP_IDLE_TIMEOUT_MS) {
+                    _stats.aborted++;
+                    _close(c);
+                }
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void HttpServer::_accept() {
+    for (int i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        Connection& c = _connections[i];
+        if (c.state != CONN_FREE) continue;
+
+        // Pool full: further clients wait in the listen backlog
+        int fd = accept(_listenFd, nullptr, nullptr);
+        if (fd < 0) return;
+
+        setNonBlocking(fd);
+        int noDelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+#ifdef NATIVE_SIM
+        // lwIP send buffer (TCP_SND_BUF) instead of the host's megabytes
+        int sendBuffer = 5744;
+        setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sendBuffer, sizeof(sendBuffer));
+#endif
+
+        c.fd = fd;
+        c.state = CONN_READING;
+        c.generation++;
+        c.aborted = false;
+        c.lastActivity = millis();
+        c.requestLength = 0;
+        c.outLength = 0;
+        c.outSent = 0;
+        c.constLength = 0;
+        _stats.accepted++;
+
+        uint8_t open = activeConnections();
+        if (open > _stats.peakConnections) _stats.peakConnections = open;
+    }
+}
+
+void HttpServer::_read(Connection& c) {
+    // Keep one byte for the terminating NUL
+    size_t room = HTTP_REQUEST_BUFFER - 1 - c.requestLength;
+    if (room > 0) {
+        ssize_t n = recv(c.fd, c.request + c.requestLength, room, MSG_DONTWAIT);
+        if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+            _close(c);
+            return;
+        }
+        if (n > 0) {
+            c.requestLength += (uint16_t)n;
+            c.lastActivity = millis();
+        }
+    }
+    c.request[c.requestLength] = '\0';
+
+    char* end = strstr(c.request, "\r\n\r\n");
+    if (!end) {
+        if (c.requestLength >= HTTP_REQUEST_BUFFER - 1) {
+            _fail(c, 431, "Request too large");
+        }
+        return;
+    }
+
+    // Wait for the body announced by Content-Length
+    size_t headerEnd = end - c.request;
+    size_t bodyLength = 0;
+    size_t length;
+    const char* value = findHeader(strstr(c.request, "\r\n") + 2, "Content-Length", length);
+    if (value) bodyLength = (size_t)atol(value);
+    if (headerEnd + 4 + bodyLength > HTTP_REQUEST_BUFFER - 1) {
+        _fail(c, 413, "Request body too large");
+        return;
+    }
+    if (c.requestLength < headerEnd + 4 + bodyLength) return;
+
+    _dispatch(c, headerEnd, bodyLength);
+}
+
+bool HttpServer::_parse(Connection& c, size_t headerEnd, size_t bodyLength) {
+    char* text = c.request;
+    char* body = text + headerEnd + 4;
+    body[bodyLength] = '\0';
+
+    // Request line: METHOD SP target SP version CRLF
+    char* lineEnd = strstr(text, "\r\n");
+    char* space = strchr(text, ' ');
+    if (!space || space > lineEnd) return false;
+    *space = '\0';
+    char* target = space + 1;
+    char* targetEnd = strchr(target, ' ');
+    if (!targetEnd || targetEnd > lineEnd) return false;
+    *targetEnd = '\0';
+    _request.headers = lineEnd + 2;
+    text[headerEnd + 2] = '\0';   // Header block ends with its last CRLF
+
+    if (strcmp(text, "GET") == 0) _request.method = HTTP_GET;
+    else if (strcmp(text, "POST") == 0) _request.method = HTTP_POST;
+    else if (strcmp(text, "PUT") == 0) _request.method = HTTP_PUT;
+    else if (strcmp(text, "DELETE") == 0) _request.method = HTTP_DELETE;
+    else if (strcmp(text, "PATCH") == 0) _request.method = HTTP_PATCH;
+    else if (strcmp(text, "OPTIONS") == 0) _request.method = HTTP_OPTIONS;
+    else if (strcmp(text, "HEAD") == 0) _request.method = HTTP_HEAD;
+    else return false;
+
+    _request.argCount = 0;
+    char* query = strchr(target, '?');
+    if (query) {
+        *query = '\0';
+        _parseArgs(query + 1);
+    }
+    urlDecode(target);
+    _request.path = target;
+
+    // Form bodies become arguments, anything else is available as "plain"
+    if (bodyLength > 0) {
+        size_t length;
+        const char* type = findHeader(_request.headers, "Content-Type", length);
+        if (type && startsWithIgnoreCase(type, "application/x-www-form-urlencoded")) {
+            _parseArgs(body);
+        } else if (_request.argCount < HTTP_MAX_ARGS) {
+            _request.argNames[_request.argCount] = "plain";
+            _request.argValues[_request.argCount] = body;
+            _request.argCount++;
+        }
+    }
+    return true;
+}
+
+// "a=1&b=2" split and decoded in place
+void HttpServer::_parseArgs(char* text) {
+    while (text && *text && _request.argCount < HTTP_MAX_ARGS) {
+        char* next = strchr(text, '&');
+        if (next) *next++ = '\0';
+        char* value = strchr(text, '=');
+        if (value) {
+            *value++ = '\0';
+        } else {
+            value = text + strlen(text);
+        }
+        urlDecode(text);
+        urlDecode(value);
+        _request.argNames[_request.argCount] = text;
+        _request.argValues[_request.argCount] = value;
+        _request.argCount++;
+        text = next;
+    }
+}
+
+void HttpServer::_dispatch(Connection& c, size_t headerEnd, size_t bodyLength) {
+    if (!_parse(c, headerEnd, bodyLength)) {
+        _fail(c, 400, "Malformed request");
+        return;
+    }
+
+    _current = &c;
+    _contentLength = CONTENT_LENGTH_NOT_SET;
+    _extraHeaders = String();
+    _headersSent = false;
+    c.state = CONN_WRITING;
+
+    Route* route = _findRoute(_request.path, _request.method);
+
+#ifdef NATIVE_SIM
+    sim::beginThreadHeapScope();
+#endif
+    uint32_t start = micros();
+    if (route) {
+        route->route->handler(route->owner);
+    } else if (_notFound) {
+        _notFound(_notFoundOwner);
+    } else {
+        send(404, "text/plain", "Not found");
+    }
+    uint32_t elapsed = micros() - start;
+
+    _stats.requests++;
+    if (elapsed > _stats.maxHandlerUs) _stats.maxHandlerUs = elapsed;
+    if (route) {
+        route->hits++;
+        if (elapsed > route->maxUs) route->maxUs = elapsed;
+#ifdef NATIVE_SIM
+        int64_t heap = sim::threadHeapScopePeak();
+        if (heap > route->heapPeak) route->heapPeak = heap;
+#endif
+    }
+
+    if (!_headersSent) {
+        send(500, "text/plain", "No response");
+    }
+    _current = nullptr;
+    _extraHeaders = String();
+
+    _pump(c);
+}
+
+String HttpServer::uri() const {
+    return _current ? String(_request.path) : String();
+}
+
+String HttpServer::arg(const String& name) const {
+    if (!_current) return String();
+    for (uint8_t i = 0; i < _request.argCount; i++) {
+        if (name == _request.argNames[i]) return String(_request.argValues[i]);
+    }
+    return String();
+}
+
+bool HttpServer::hasArg(const String& name) const {
+    if (!_current) return false;
+    for (uint8_t i = 0; i < _request.argCount; i++) {
+        if (name == _request.argNames[i]) return true;
+    }
+    return false;
+}
+
+String HttpServer::header(const String& name) const {
+    if (!_current) return String();
+    size_t length;
+    const char* value = findHeader(_request.headers, name.c_str(), length);
+    return value ? String(value, length) : String();
+}
+
+void HttpServer::_writeHeaders(int code, const char* contentType, const char* connection) {
+    char line[128];
+    int n = snprintf(line, sizeof(line), "HTTP/1.1 %d %s\r\nContent-Type: %s\r\n", code, statusText(code),
+                     contentType ? contentType : "text/html");
+    _write(*_current, line, n);
+    if (_contentLength != CONTENT_LENGTH_NOT_SET && _contentLength != CONTENT_LENGTH_UNKNOWN) {
+        n = snprintf(line, sizeof(line), "Content-Length: %lu\r\n", (unsigned long)_contentLength);
+        _write(*_current, line, n);
+    }
+    _write(*_current, _extraHeaders.c_str(), _extraHeaders.length());
+    n = snprintf(line, sizeof(line), "Connection: %s\r\n\r\n", connection);
+    _write(*_current, line, n);
+    _headersSent = true;
+}
+
+void HttpServer::send(int code, const char* contentType, const String& content) {
+    if (!_current || _headersSent) return;
+    if (_contentLength == CONTENT_LENGTH_NOT_SET) {
+        _contentLength = content.length();
+    }
+    _writeHeaders(code, contentType, "close");
+    if (_request.method != HTTP_HEAD) {
+        _write(*_current, content.c_str(), content.length());
+    }
+}
+
+void HttpServer::sendHeader(const String& name, const String& value, bool first) {
+    String line = name + ": " + value + "\r\n";
+    _extraHeaders = first ? line + _extraHeaders : _extraHeaders + line;
+}
+
+void HttpServer::sendContent(const char* content, size_t size) {
+    if (!_current || _request.method == HTTP_HEAD) return;
+    _write(*_current, content, size);
+}
+
+size_t HttpServer::streamFile(File& file, const String& contentType, int code) {
+    if (!_current) return 0;
+    size_t size = file.size();
+    setContentLength(size);
+    send(code, contentType.c_str(), String());
+    if (_request.method != HTTP_HEAD) {
+        _current->file = file;
+    }
+    return size;
+}
+
+void HttpServer::send_P(int code, const char* contentType, const char* content, size_t contentLength) {
+    if (!_current || _headersSent) return;
+    _contentLength = contentLength;
+    _writeHeaders(code, contentType, "close");
+    if (_request.method != HTTP_HEAD) {
+        _current->constBody = content;
+        _current->constLength = contentLength;
+    }
+}
+
+void HttpServer::send(int code, const char* contentType, const std::shared_ptr<const String>& body) {
+    if (!_current || _headersSent || !body) return;
+    send_P(code, contentType, body->c_str(), body->length());
+    if (_current->constLength > 0) _current->sharedBody = body;
+}
+
+int HttpServer::keepOpen(const char* contentType) {
+    if (!_current || _headersSent) return -1;
+    _contentLength = CONTENT_LENGTH_UNKNOWN;
+    sendHeader("Cache-Control", "no-cache");
+    _writeHeaders(200, contentType, "keep-alive");
+    if (_current->aborted) return -1;
+    // From now on the connection outlives its handler
+    _current->state = CONN_STREAMING;
+    return (int)((_current - _connections) | (_current->generation << 8));
+}
+
+HttpServer::Connection* HttpServer::_stream(int stream) const {
+    if (stream < 0 || !_connections) return nullptr;
+    int index = stream & 0xFF;
+    if (index >= HTTP_MAX_CONNECTIONS) return nullptr;
+    Connection* c = &_connections[index];
+    if (c->state != CONN_STREAMING || c->generation != (uint8_t)(stream >> 8)) return nullptr;
+    return c;
+}
+
+bool HttpServer::isStreamOpen(int stream) const {
+    return _stream(stream) != nullptr;
+}
+
+bool HttpServer::streamWrite(int stream, const char* data, size_t length) {
+    Connection* c = _stream(stream);
+    if (!c) return false;
+
+    // Make room by sending what the socket accepts now; never wait for a stream
+    if (c->outLength + length > HTTP_OUTPUT_BUFFER) {
+        if (!_pump(*c)) return false;
+        _compact(*c);
+        if (c->outLength + length > HTTP_OUTPUT_BUFFER) {
+            _stats.aborted++;
+            _close(*c);
+            return false;
+        }
+    }
+    // Sent by the next handleClient(): the pieces of one event leave together
+    memcpy(c->out + c->outLength, data, length);
+    c->outLength += (uint16_t)length;
+    return true;
+}
+
+void HttpServer::closeStream(int stream) {
+    Connection* c = _stream(stream);
+    if (c) _close(*c);
+}
+
+uint8_t HttpServer::activeConnections() const {
+    uint8_t count = 0;
+    if (!_connections) return 0;
+    for (int i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+        if (_connections[i].state != CONN_FREE) count++;
+    }
+    return count;
+}
+
+HttpRouteStats HttpServer::routeStats(size_t index) const {
+    HttpRouteStats stats = {"", 0, 0, 0};
+    if (index < _routeCount) {
+        const Route& r = _routes[index];
+        stats.uri = r.route->uri;
+        stats.hits = r.hits;
+        stats.maxUs = r.maxUs;
+        stats.heapPeak = r.heapPeak;
+    }
+    return stats;
+}
+
+// Buffer handler output; only a full buffer the socket will not take makes the handler wait
+void HttpServer::_write(Connection& c, const char* data, size_t length) {
+    while (length > 0 && !c.aborted) {
+        if (c.outLength == HTTP_OUTPUT_BUFFER) {
+            if (!_pump(c)) return;
+            _compact(c);
+            if (c.outLength == HTTP_OUTPUT_BUFFER) {
+                _waitWritable(c, HTTP_SEND_TIMEOUT_MS);
+                if (!_pump(c)) return;
+                _compact(c);
+                if (c.outLength == HTTP_OUTPUT_BUFFER) {
+                    // Client not reading: drop the rest of this response
+                    _stats.aborted++;
+                    c.aborted = true;
+                    return;
+                }
+            }
+        }
+        size_t n = HTTP_OUTPUT_BUFFER - c.outLength;
+        if (n > length) n = length;
+        memcpy(c.out + c.outLength, data, n);
+        c.outLength += (uint16_t)n;
+        data += n;
+        length -= n;
+    }
+}
+
+// Send as much as the socket takes without blocking. False once the connection is closed.
+bool HttpServer::_pump(Connection& c) {
+    if (c.state == CONN_FREE) return false;
+
+    while (!c.aborted) {
+        if (c.outSent < c.outLength) {
+            ssize_t n = ::send(c.fd, c.out + c.outSent, c.outLength - c.outSent, MSG_DONTWAIT | MSG_NOSIGNAL);
+            if (n < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) return true;
+                _close(c);
+                return false;
+            }
+            c.outSent += (uint16_t)n;
+            c.lastActivity = millis();
+            if (c.outSent < c.outLength) return true;
+        }
+        c.outSent = 0;
+        c.outLength = 0;
+
+        // Constant body: sent from where it is
+        if (c.constLength > 0) {
+            ssize_t n = ::send(c.fd, c.constBody, c.constLength, MSG_DONTWAIT | MSG_NOSIGNAL);
+            if (n < 0) {
+                if (errno == EAGAIN || errno == EWOULDBLOCK) return true;
+                _close(c);
+                return false;
+            }
+            c.constBody += n;
+            c.constLength -= n;
+            c.lastActivity = millis();
+            if (c.constLength > 0) return true;
+        }
+
+        // Refill from the file being served
+        if (c.file) {
+            int n = (int)c.file.read((uint8_t*)c.out, HTTP_OUTPUT_BUFFER);
+            if (n > 0) {
+                c.outLength = (uint16_t)n;
+                continue;
+            }
+            c.file.close();
+        }
+
+        // Finite response fully sent (not while its handler is still writing)
+        if (c.state == CONN_WRITING && &c != _current) {
+            _close(c);
+            return false;
+        }
+        return true;
+    }
+
+    // Aborted: finish off once the handler is done with it
+    if (&c != _current) {
+        _close(c);
+        return false;
+    }
+    return true;
+}
+
+// Move the unsent bytes to the front of the output buffer
+void HttpServer::_compact(Connection& c) {
+    if (c.outSent == 0) return;
+    memmove(c.out, c.out + c.outSent, c.outLength - c.outSent);
+    c.outLength -= c.outSent;
+    c.outSent = 0;
+}
+
+void HttpServer::_waitWritable(Connection& c, uint32_t timeoutMs) {
+    fd_set writable;
+    FD_ZERO(&writable);
+    FD_SET(c.fd, &writable);
+    struct timeval timeout;
+    timeout.tv_sec = timeoutMs / 1000;
+    timeout.tv_usec = (timeoutMs % 1000) * 1000;
+    select(c.fd + 1, nullptr, &writable, nullptr, &timeout);
+}
+
+void HttpServer::_close(Connection& c) {
+    if (c.state == CONN_FREE) return;
+    if (c.file) c.file.close();
+    shutdown(c.fd, SHUT_RDWR);
+    close(c.fd);
+    c.fd = -1;
+    c.state = CONN_FREE;
+    c.aborted = true;   // Stop a handler still writing to it
+    c.requestLength = 0;
+    c.outLength = 0;
+    c.outSent = 0;
+    c.constLength = 0;
+    c.sharedBody.reset();
+}
+
+// Answer an unusable request and close once the answer is out
+void HttpServer::_fail(Connection& c, int code, const char* message) {
+    _stats.rejected++;
+    _request.method = HTTP_GET;
+    _current = &c;
+    _contentLength = CONTENT_LENGTH_NOT_SET;
+    _extraHeaders = String();
+    _headersSent = false;
+    c.state = CONN_WRITING;
+    send(code, "text/plain", message);
+    _current = nullptr;
+    _pump(c);
+}
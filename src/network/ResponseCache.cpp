@@ -0,0 +1,16 @@
+#include "network/ResponseCache.h"
+
+std::shared_ptr<const String> ResponseCache::lookup(uint32_t version) {
+    if (_body && _version == version) {
+        _hits++;
+        return _body;
+    }
+    _misses++;
+    return nullptr;
+}
+
+std::shared_ptr<const String> ResponseCache::store(uint32_t version, String&& body) {
+    _body = std::make_shared<const String>(std::move(body));
+    _version = version;
+    return _body;
+}
@@ -0,0 +1,407 @@
+#include "network/WireFormat.h"
+#include <math.h>
+
+// Sentinel for NaN values (zigzag encodes to the largest varint)
+static const int32_t WIRE_FIXED_NAN = INT32_MIN;
+
+// Largest text field carried on the wire (network_message_t.text minus terminator)
+static const size_t WIRE_MAX_TEXT = sizeof(((network_message_t*)0)->text) - 1;
+
+void WireWriter::u8(uint8_t value) {
+    if (_len >= _cap) {
+        _overflow = true;
+        return;
+    }
+    _buf[_len++] = value;
+}
+
+void WireWriter::u16(uint16_t value) {
+    u8((uint8_t)(value & 0xFF));
+    u8((uint8_t)(value >> 8));
+}
+
+void WireWriter::varint(uint32_t value) {
+    while (value >= 0x80) {
+        u8((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    u8((uint8_t)value);
+}
+
+void WireWriter::svarint(int32_t value) {
+    varint(((uint32_t)value << 1) ^ (uint32_t)(value >> 31));
+}
+
+int32_t WireWriter::toFixed(float value) {
+    if (isnan(value)) {
+        return WIRE_FIXED_NAN;
+    }
+
+    float scaled = value * WIRE_FIXED_SCALE;
+    if (scaled > 2000000000.0f) scaled = 2000000000.0f;
+    if (scaled < -2000000000.0f) scaled = -2000000000.0f;
+    return (int32_t)lroundf(scaled);
+}
+
+void WireWriter::fixed(float value) {
+    svarint(toFixed(value));
+}
+
+void WireWriter::text(const char* value, size_t maxLen) {
+    size_t len = value ? strnlen(value, maxLen) : 0;
+    u8((uint8_t)len);
+    bytes((const uint8_t*)value, len);
+}
+
+void WireWriter::bytes(const uint8_t* data, size_t len) {
+    if (_len + len > _cap) {
+        _overflow = true;
+        return;
+    }
+    memcpy(_buf + _len, data, len);
+    _len += len;
+}
+
+uint8_t WireReader::u8() {
+    if (_error || _pos >= _len) {
+        _error = true;
+        return 0;
+    }
+    return _buf[_pos++];
+}
+
+uint16_t WireReader::u16() {
+    uint16_t low = u8();
+    uint16_t high = u8();
+    return (uint16_t)(low | (high << 8));
+}
+
+uint32_t WireReader::varint() {
+    uint32_t value = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        uint8_t byte = u8();
+        value |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+    _error = true;  // More than 5 bytes
+    return 0;
+}
+
+int32_t WireReader::svarint() {
+    uint32_t value = varint();
+    return (int32_t)((value >> 1) ^ (~(value & 1) + 1));
+}
+
+float WireReader::fromFixed(int32_t value) {
+    if (value == WIRE_FIXED_NAN) {
+        return NAN;
+    }
+    return value / WIRE_FIXED_SCALE;
+}
+
+float WireReader::fixed() {
+    return fromFixed(svarint());
+}
+
+void WireReader::text(char* out, size_t outSize) {
+    size_t len = u8();
+    if (_error || len > _len - _pos) {
+        _error = true;
+        out[0] = '\0';
+        return;
+    }
+
+    size_t copy = len < outSize - 1 ? len : outSize - 1;
+    memcpy(out, _buf + _pos, copy);
+    out[copy] = '\0';
+    _pos += len;
+}
+
+void WireReader::skip(size_t len) {
+    if (_error || len > _len - _pos) {
+        _error = true;
+        return;
+    }
+    _pos += len;
+}
+
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF)
+uint16_t WireFormat::crc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+bool WireFormat::isCompact(const uint8_t* data, size_t len) {
+    return len >= 4 && data[0] == WIRE_MAGIC;
+}
+
+uint8_t WireFormat::peekType(const uint8_t* data, size_t len) {
+    return isCompact(data, len) ? (data[1] & 0x0F) : 0;
+}
+
+void WireFormat::_encodeHeader(const network_message_t& msg, WireWriter& out) {
+    uint8_t flags = 0;
+    if (msg.is_master) flags |= WIRE_FLAG_MASTER;
+    if (msg.ready) flags |= WIRE_FLAG_READY;
+    if (msg.battery_level != 0) flags |= WIRE_FLAG_BATTERY;
+
+    out.u8(WIRE_MAGIC);
+    out.u8((uint8_t)((WIRE_VERSION << 4) | (msg.type & 0x0F)));
+    out.u8(flags);
+    out.varint(msg.message_id);
+    if (flags & WIRE_FLAG_BATTERY) {
+        out.u8(msg.battery_level);
+    }
+}
+
+// Check the CRC and read the common header; in is left at the payload
+bool WireFormat::_decodeHeader(const uint8_t* data, size_t len, const uint8_t* mac,
+                               network_message_t& msg, WireReader& in) {
+    uint16_t expected = (uint16_t)(data[len - 2] | (data[len - 1] << 8));
+    if (crc16(data, len - 2) != expected) {
+        return false;
+    }
+
+    in.u8();  // Magic
+    uint8_t versionType = in.u8();
+    uint8_t flags = in.u8();
+
+    // Version 0 does not exist; newer versions only append fields
+    if ((versionType >> 4) == 0) {
+        return false;
+    }
+
+    msg.type = versionType & 0x0F;
+    memcpy(msg.sender_id, mac, 6);
+    msg.message_id = in.varint();
+    msg.is_master = (flags & WIRE_FLAG_MASTER) ? 1 : 0;
+    msg.ready = (flags & WIRE_FLAG_READY) != 0;
+    msg.battery_level = (flags & WIRE_FLAG_BATTERY) ? in.u8() : 0;
+
+    return !in.error();
+}
+
+size_t WireFormat::encode(const network_message_t& msg, uint8_t* buffer, size_t capacity) {
+    WireWriter out(buffer, capacity);
+
+    _encodeHeader(msg, out);
+    _encodePayload(msg, out);
+
+    // CRC over everything before it
+    out.u16(crc16(buffer, out.length()));
+
+    return out.overflow() ? 0 : out.length();
+}
+
+bool WireFormat::decode(const uint8_t* data, size_t len, const uint8_t* mac, network_message_t& msg) {
+    memset(&msg, 0, sizeof(network_message_t));
+
+    // Node running the old firmware: raw struct
+    if (!isCompact(data, len)) {
+        if (len != sizeof(network_message_t)) {
+            return false;
+        }
+        memcpy(&msg, data, sizeof(network_message_t));
+        msg.text[sizeof(msg.text) - 1] = '\0';
+        if (msg.data_count > 5) msg.data_count = 5;
+        return true;
+    }
+
+    WireReader in(data, len - 2);
+    if (!_decodeHeader(data, len, mac, msg, in)) {
+        return false;
+    }
+
+    _decodePayload(msg.type, in, msg);
+
+    return !in.error();
+}
+
+size_t WireFormat::encodeBatch(const network_message_t& header, const sensor_batch_t& batch,
+                               uint8_t* buffer, size_t capacity, uint8_t* readingsSent) {
+    // Leave out the oldest readings until the frame fits
+    for (uint8_t first = 0; first < batch.count; first++) {
+        WireWriter out(buffer, capacity);
+        _encodeHeader(header, out);
+        out.text(batch.name, sizeof(batch.name) - 1);
+        if (!_encodeReadings(batch, first, out)) {
+            continue;
+        }
+        out.u16(crc16(buffer, out.length()));
+        if (out.overflow()) {
+            continue;
+        }
+
+        if (readingsSent) *readingsSent = batch.count - first;
+        return out.length();
+    }
+
+    if (readingsSent) *readingsSent = 0;
+    return 0;
+}
+
+bool WireFormat::_encodeReadings(const sensor_batch_t& batch, uint8_t first, WireWriter& out) {
+    uint8_t valueCount = batch.value_count > 5 ? 5 : batch.value_count;
+    out.u8(valueCount);
+    out.u8((uint8_t)(batch.count - first));
+
+    uint32_t previousAge = 0;
+    int32_t previous[5] = {0};
+    for (uint8_t i = first; i < batch.count && !out.overflow(); i++) {
+        const SensorReading& reading = batch.readings[i];
+
+        // Oldest reading: its age; next ones: time since the previous reading
+        out.varint(i == first ? reading.age_ms : previousAge - reading.age_ms);
+        previousAge = reading.age_ms;
+
+        for (uint8_t v = 0; v < valueCount; v++) {
+            int32_t value = WireWriter::toFixed(reading.values[v]);
+            // Wrapping difference: NaN sentinels survive the round trip
+            out.svarint((int32_t)((uint32_t)value - (uint32_t)previous[v]));
+            previous[v] = value;
+        }
+    }
+
+    return !out.overflow();
+}
+
+bool WireFormat::decodeBatch(const uint8_t* data, size_t len, const uint8_t* mac,
+                             network_message_t& msg, sensor_batch_t& batch) {
+    memset(&msg, 0, sizeof(network_message_t));
+    batch.count = 0;
+    batch.value_count = 0;
+
+    if (peekType(data, len) != SENSOR_BATCH) {
+        return false;
+    }
+
+    WireReader in(data, len - 2);
+    if (!_decodeHeader(data, len, mac, msg, in)) {
+        return false;
+    }
+
+    in.text(batch.name, sizeof(batch.name));
+    strncpy(msg.text, batch.name, sizeof(msg.text) - 1);
+
+    uint8_t valueCount = in.u8();
+    uint8_t count = in.u8();
+    batch.value_count = valueCount > 5 ? 5 : valueCount;
+
+    // More readings than we keep: the oldest are decoded (each one is a
+    // delta of the previous) but only the newest SENSOR_BATCH_MAX are kept
+    uint8_t skipped = count > SENSOR_BATCH_MAX ? count - SENSOR_BATCH_MAX : 0;
+
+    uint32_t age = 0;
+    int32_t previous[5] = {0};
+    for (uint8_t i = 0; i < count && !in.error(); i++) {
+        uint32_t delta = in.varint();
+        age = (i == 0) ? delta : (delta > age ? 0 : age - delta);
+
+        float values[5] = {0};
+        for (uint8_t v = 0; v < valueCount; v++) {
+            int32_t step = in.svarint();
+            if (v < 5) {
+                previous[v] = (int32_t)((uint32_t)previous[v] + (uint32_t)step);
+                values[v] = WireReader::fromFixed(previous[v]);
+            }
+        }
+
+        if (i >= skipped) {
+            SensorReading& reading = batch.readings[batch.count++];
+            reading.age_ms = age;
+            memcpy(reading.values, values, sizeof(values));
+        }
+    }
+
+    return !in.error();
+}
+
+// Type-specific payloads: only what each message actually uses is sent
+void WireFormat::_encodePayload(const network_message_t& msg, WireWriter& out) {
+    switch (msg.type) {
+        case DISCOVERY:
+            // Device name
+            out.text(msg.text, WIRE_MAX_TEXT);
+            break;
+
+        case SENSOR_DATA:
+            // Device name + readings
+            out.text(msg.text, WIRE_MAX_TEXT);
+            _encodeValues(msg, out);
+            break;
+
+        case ALERT:
+        case STATUS_UPDATE:
+            out.u8(msg.alert_level);
+            _encodeValues(msg, out);
+            out.text(msg.text, WIRE_MAX_TEXT);
+            break;
+
+        case COMMAND:
+            _encodeValues(msg, out);
+            out.text(msg.text, WIRE_MAX_TEXT);
+            break;
+
+        case PING:
+        default:
+            break;
+    }
+}
+
+void WireFormat::_decodePayload(uint8_t type, WireReader& in, network_message_t& msg) {
+    switch (type) {
+        case DISCOVERY:
+            in.text(msg.text, sizeof(msg.text));
+            break;
+
+        case SENSOR_DATA:
+            in.text(msg.text, sizeof(msg.text));
+            _decodeValues(in, msg);
+            break;
+
+        case ALERT:
+        case STATUS_UPDATE:
+            msg.alert_level = in.u8();
+            _decodeValues(in, msg);
+            in.text(msg.text, sizeof(msg.text));
+            break;
+
+        case COMMAND:
+            _decodeValues(in, msg);
+            in.text(msg.text, sizeof(msg.text));
+            break;
+
+        case PING:
+        default:
+            break;
+    }
+
+    // Anything left was appended by a newer version: ignored
+}
+
+void WireFormat::_encodeValues(const network_message_t& msg, WireWriter& out) {
+    uint8_t count = msg.data_count > 5 ? 5 : msg.data_count;
+    out.u8(count);
+    for (uint8_t i = 0; i < count; i++) {
+        out.fixed(msg.data[i]);
+    }
+}
+
+void WireFormat::_decodeValues(WireReader& in, network_message_t& msg) {
+    uint8_t count = in.u8();
+    for (uint8_t i = 0; i < count; i++) {
+        float value = in.fixed();
+        if (i < 5) {
+            msg.data[i] = value;
+        }
+    }
+    msg.data_count = count > 5 ? 5 : count;
+}
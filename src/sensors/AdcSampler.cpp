@@ -0,0 +1,85 @@
+#include "sensors/AdcSampler.h"
+#include "Config.h"
+#include "utils/Logger.h"
+
+#ifndef NATIVE_SIM
+#include <driver/adc.h>
+#include <driver/i2s.h>
+
+static bool s_dmaInUse = false;
+#endif
+
+AdcSampler::AdcSampler(uint8_t pin) : _pin(pin) {
+}
+
+AdcSampler::~AdcSampler() {
+#ifndef NATIVE_SIM
+    if (_dma) {
+        i2s_adc_disable(I2S_NUM_0);
+        i2s_driver_uninstall(I2S_NUM_0);
+        s_dmaInUse = false;
+    }
+#endif
+}
+
+bool AdcSampler::begin() {
+    pinMode(_pin, INPUT);
+
+#ifndef NATIVE_SIM
+    // Canaux 0-7 : ADC1 ; l'I2S ne sait pas échantillonner l'ADC2
+    int channel = digitalPinToAnalogChannel(_pin);
+    if (channel < 0 || channel >= ADC1_CHANNEL_MAX || s_dmaInUse) {
+        Logger::warningF("ADC pin %d: pas de DMA, lectures analogRead()", _pin);
+        return true;
+    }
+
+    i2s_config_t config = {};
+    config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_RX | I2S_MODE_ADC_BUILT_IN);
+    config.sample_rate = WATER_ADC_SAMPLE_RATE;
+    config.bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT;
+    config.channel_format = I2S_CHANNEL_FMT_ONLY_LEFT;
+    config.communication_format = I2S_COMM_FORMAT_STAND_I2S;
+    // Le DMA garde les WATER_ADC_BLOCK derniers échantillons, un read() les prend tous
+    config.dma_buf_count = 4;
+    config.dma_buf_len = WATER_ADC_BLOCK / 4;
+    config.use_apll = false;
+
+    if (i2s_driver_install(I2S_NUM_0, &config, 0, NULL) != ESP_OK) {
+        Logger::error("Impossible d'installer le pilote I2S pour l'ADC");
+        return true;
+    }
+    adc1_config_width(ADC_WIDTH_BIT_12);
+    adc1_config_channel_atten((adc1_channel_t)channel, ADC_ATTEN_DB_11);
+    if (i2s_set_adc_mode(ADC_UNIT_1, (adc1_channel_t)channel) != ESP_OK ||
+        i2s_adc_enable(I2S_NUM_0) != ESP_OK) {
+        Logger::error("Impossible de démarrer l'ADC en mode DMA");
+        i2s_driver_uninstall(I2S_NUM_0);
+        return true;
+    }
+    _dma = true;
+    s_dmaInUse = true;
+    Logger::infoF("ADC pin %d échantillonné par DMA à %d Hz", _pin, WATER_ADC_SAMPLE_RATE);
+#endif
+    return true;
+}
+
+uint16_t AdcSampler::read(uint16_t* samples, uint16_t max) {
+#ifndef NATIVE_SIM
+    if (_dma) {
+        size_t bytes = 0;
+        // Sans attente : ce que le DMA a déjà rempli
+        i2s_read(I2S_NUM_0, samples, max * sizeof(uint16_t), &bytes, 0);
+        uint16_t count = bytes / sizeof(uint16_t);
+        for (uint16_t i = 0; i < count; i++) {
+            samples[i] &= 0x0FFF;   // Les 4 bits de poids fort portent le canal
+        }
+        return count;
+    }
+#endif
+
+    uint16_t count = max < POLLED_SAMPLES ? max : POLLED_SAMPLES;
+    for (uint16_t i = 0; i < count; i++) {
+        samples[i] = analogRead(_pin);
+    }
+    return count;
+}
@@ -2,11 +2,27 @@
 #include <DHT.h>
 #include "utils/Logger.h"
 
+#ifndef NATIVE_SIM
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 DHT11Sensor::DHT11Sensor(uint8_t pin) : _pin(pin) {
     _dht = new DHT(pin, DHT11);
 }
 
 DHT11Sensor::~DHT11Sensor() {
+#ifndef NATIVE_SIM
+    // La tâche sort d'elle-même entre deux lectures : la supprimer de
+    // l'extérieur pourrait la couper en tenant _cacheLock
+    if (_task) {
+        _stopping = true;
+        xTaskNotifyGive((TaskHandle_t)_task);
+        while (_task) {
+            vTaskDelay(1);
+        }
+    }
+#endif
     if (_dht) {
         delete _dht;
     }
@@ -14,27 +30,94 @@ DHT11Sensor::~DHT11Sensor() {
 
 bool DHT11Sensor::begin() {
     _dht->begin();
+#ifndef NATIVE_SIM
+    // Sur le cœur de la boucle, en dessous d'elle : la lecture ne passe que
+    // quand la boucle attend, et les quelques millisecondes d'interruptions
+    // masquées ne touchent que ce cœur, pas le WiFi/ESP-NOW du cœur 0. La
+    // boucle peut en revanche attendre jusqu'à la fin d'une lecture commencée.
+    if (xTaskCreatePinnedToCore(_samplingTask, "dht11", DHT_TASK_STACK_SIZE, this,
+                                DHT_TASK_PRIORITY, (TaskHandle_t*)&_task, DHT_TASK_CORE) != pdPASS) {
+        Logger::error("Impossible de créer la tâche de lecture du DHT11");
+        return false;
+    }
+#endif
     _isActive = true;
     Logger::infoF("Capteur DHT11 initialisé sur le pin %d", _pin);
     return true;
 }
 
 void DHT11Sensor::update() {
-    _temperature = _dht->readTemperature();
-    _humidity = _dht->readHumidity();
-    
-    // Vérifier si la lecture a échoué
-    if (isnan(_temperature) || isnan(_humidity)) {
-        // Logger::error("Échec de lecture du capteur DHT!");
-        return;
+#ifdef NATIVE_SIM
+    if ((long)(millis() - _nextSampleTime) >= 0) {
+        _nextSampleTime = millis() + _sample();
     }
-    
-    _lastReadTime = millis();
+#endif
+
+    // Ne jamais attendre la lecture en cours : la mesure sera reprise au prochain appel
+    Reading reading;
+    {
+        std::unique_lock<std::mutex> lock(_cacheLock, std::try_to_lock);
+        if (!lock.owns_lock() || !_fresh) {
+            return;
+        }
+        reading = _cached;
+        _fresh = false;
+    }
+
+    _temperature = reading.temperature;
+    _humidity = reading.humidity;
+    _lastReadTime = reading.time;
     _calculateCategory();
 
     Logger::debugF("DHT11: Température=%.1f°C, Humidité=%.1f%%", _temperature, _humidity);
 }
 
+uint32_t DHT11Sensor::_sample() {
+    // La bibliothèque garde la trame : readHumidity() ne relit pas le capteur
+    float temperature = _dht->readTemperature();
+    float humidity = _dht->readHumidity();
+
+    // Vérifier si la lecture a échoué
+    if (isnan(temperature) || isnan(humidity)) {
+        if (_failures < 255) _failures++;
+        if (_failures == 1) {
+            Logger::warning("Échec de lecture du capteur DHT11");
+        }
+        // Intervalle doublé à chaque échec consécutif
+        uint32_t delayMs = DHT_MAX_BACKOFF_MS;
+        if (_failures < 16) {
+            delayMs = (uint32_t)DHT_MIN_INTERVAL_MS << _failures;
+            if (delayMs > DHT_MAX_BACKOFF_MS) delayMs = DHT_MAX_BACKOFF_MS;
+        }
+        return delayMs;
+    }
+
+    if (_failures > 0) {
+        Logger::infoF("Capteur DHT11 de nouveau lisible après %d échecs", _failures);
+        _failures = 0;
+    }
+
+    std::lock_guard<std::mutex> lock(_cacheLock);
+    _cached.temperature = temperature;
+    _cached.humidity = humidity;
+    _cached.time = millis();
+    _fresh = true;
+    return DHT_MIN_INTERVAL_MS;
+}
+
+#ifndef NATIVE_SIM
+void DHT11Sensor::_samplingTask(void* arg) {
+    DHT11Sensor* sensor = static_cast<DHT11Sensor*>(arg);
+    while (!sensor->_stopping) {
+        // Attente réveillée par le destructeur
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sensor->_sample()));
+    }
+    // Dernier accès à l'objet : le destructeur attend ce signal
+    sensor->_task = nullptr;
+    vTaskDelete(nullptr);
+}
+#endif
+
 const char* DHT11Sensor::getName() {
     return "DHT11";
 }
@@ -0,0 +1,151 @@
+// src/sensors/SensorRegistry.cpp
+#include "sensors/SensorRegistry.h"
+#include "utils/Logger.h"
+#include <new>
+
+SensorRegistry::SensorRegistry()
+    : _slots(nullptr),
+      _capacity(0),
+      _size(0),
+      _newest(NONE),
+      _oldest(NONE),
+      _free(NONE),
+      _evictions(0),
+      _generation(0) {
+}
+
+SensorRegistry::~SensorRegistry() {
+    delete[] _slots;
+}
+
+bool SensorRegistry::begin(uint16_t capacity) {
+    if (_slots) {
+        Logger::error("SensorRegistry: pool déjà alloué");
+        return false;
+    }
+    if (capacity > SENSOR_REGISTRY_MAX) {
+        Logger::warningF("SensorRegistry: capacité limitée à %d capteurs", SENSOR_REGISTRY_MAX);
+        capacity = SENSOR_REGISTRY_MAX;
+    }
+    if (capacity == 0) {
+        return true;
+    }
+
+    _slots = new (std::nothrow) Slot[capacity];
+    if (!_slots) {
+        Logger::errorF("SensorRegistry: pas assez de mémoire pour %d capteurs", capacity);
+        return false;
+    }
+    _capacity = capacity;
+
+    // Toutes les cases dans la liste libre
+    for (uint16_t i = 0; i < _capacity; i++) {
+        memset(&_slots[i].data, 0, sizeof(SensorData));
+        _slots[i].prev = NONE;
+        _slots[i].next = (i + 1 < _capacity) ? i + 1 : NONE;
+    }
+    _free = 0;
+
+    Logger::infoF("SensorRegistry: %d capteurs, %u octets", _capacity, (unsigned)memoryUsage());
+    return true;
+}
+
+SensorData* SensorRegistry::find(const uint8_t* mac) {
+    const uint16_t* slot = _index.find(mac);
+    return slot ? &_slots[*slot].data : nullptr;
+}
+
+SensorData* SensorRegistry::acquire(const uint8_t* mac) {
+    if (_capacity == 0) {
+        return nullptr;
+    }
+    // L'appelant va écrire dans l'entrée
+    _generation++;
+
+    const uint16_t* known = _index.find(mac);
+    if (known) {
+        _unlink(*known);
+        _pushNewest(*known);
+        return &_slots[*known].data;
+    }
+
+    // Pool plein : recycler le capteur le moins récemment mis à jour
+    if (_free == NONE) {
+        Logger::warningF("SensorRegistry: pool plein, éviction de %s", _slots[_oldest].data.name);
+        _release(_oldest);
+        _evictions++;
+    }
+
+    uint16_t slot = _free;
+    _free = _slots[slot].next;
+
+    SensorData& sensor = _slots[slot].data;
+    memset(&sensor, 0, sizeof(SensorData));
+    memcpy(sensor.mac, mac, 6);
+    sensor.active = true;
+
+    _index.insert(mac, slot);
+    _pushNewest(slot);
+    _size++;
+    return &sensor;
+}
+
+void SensorRegistry::remove(SensorData* sensor) {
+    if (!sensor || !sensor->active || _capacity == 0) return;
+
+    Slot* slot = reinterpret_cast<Slot*>(sensor);
+    _release((uint16_t)(slot - _slots));
+    _generation++;
+}
+
+uint16_t SensorRegistry::expire(uint32_t now, uint32_t timeoutMs, void (*onExpired)(const SensorData&)) {
+    // La liste LRU est triée du plus récent au plus ancien : on s'arrête au premier capteur à jour
+    uint16_t removed = 0;
+    while (_oldest != NONE && now - _slots[_oldest].data.lastSeen > timeoutMs) {
+        if (onExpired) onExpired(_slots[_oldest].data);
+        _release(_oldest);
+        removed++;
+    }
+    if (removed > 0) _generation++;
+    return removed;
+}
+
+SensorData* SensorRegistry::at(uint16_t index) {
+    for (SensorData& sensor : *this) {
+        if (index-- == 0) return &sensor;
+    }
+    return nullptr;
+}
+
+size_t SensorRegistry::memoryUsage() const {
+    return sizeof(*this) + (size_t)_capacity * sizeof(Slot);
+}
+
+// Retirer une case de la liste LRU
+void SensorRegistry::_unlink(uint16_t slot) {
+    Slot& s = _slots[slot];
+    if (s.prev != NONE) _slots[s.prev].next = s.next; else _newest = s.next;
+    if (s.next != NONE) _slots[s.next].prev = s.prev; else _oldest = s.prev;
+    s.prev = NONE;
+    s.next = NONE;
+}
+
+// Placer une case en tête de la liste LRU
+void SensorRegistry::_pushNewest(uint16_t slot) {
+    Slot& s = _slots[slot];
+    s.prev = NONE;
+    s.next = _newest;
+    if (_newest != NONE) _slots[_newest].prev = slot;
+    _newest = slot;
+    if (_oldest == NONE) _oldest = slot;
+}
+
+// Rendre une case occupée à la liste libre
+void SensorRegistry::_release(uint16_t slot) {
+    _index.erase(_slots[slot].data.mac);
+    _unlink(slot);
+    _slots[slot].data.active = false;
+    _slots[slot].next = _free;
+    _free = slot;
+    _size--;
+}
@@ -0,0 +1,336 @@
+// src/sensors/TimeSeriesStore.cpp
+#include "sensors/TimeSeriesStore.h"
+#include "utils/Logger.h"
+#include <SPIFFS.h>
+#include <new>
+
+// En-tête du fichier de sauvegarde
+#define HISTORY_MAGIC 0x48414C46  // "FLAH"
+#define HISTORY_VERSION 2
+
+struct HistoryFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;          // Séries qui suivent
+    uint32_t clock;          // Horloge de l'historique au moment de la sauvegarde
+    uint32_t seriesSize;     // sizeof(Series), change avec les tailles d'anneaux
+};
+
+TimeSeriesStore::TimeSeriesStore() : _series(nullptr), _capacity(0), _count(0), _clockBase(0), _dirty(false) {
+}
+
+TimeSeriesStore::~TimeSeriesStore() {
+    delete[] _series;
+}
+
+bool TimeSeriesStore::begin(uint16_t maxSeries) {
+    if (_series) {
+        return true;
+    }
+    if (maxSeries > MAX_SERIES) {
+        Logger::warningF("Historique limité à %d capteurs (budget %d octets)", (int)MAX_SERIES, HISTORY_MEMORY_BUDGET);
+        maxSeries = MAX_SERIES;
+    }
+    if (maxSeries == 0) {
+        return true;
+    }
+
+    _series = new (std::nothrow) Series[maxSeries];
+    if (!_series) {
+        Logger::errorF("Historique: pas assez de mémoire pour %d capteurs", maxSeries);
+        return false;
+    }
+    memset(_series, 0, sizeof(Series) * maxSeries);
+    _capacity = maxSeries;
+
+    Logger::infoF("Historique: %d capteurs, %u octets", _capacity, (unsigned)memoryUsage());
+    return true;
+}
+
+uint32_t TimeSeriesStore::now() const {
+    return _clockBase + millis() / 1000;
+}
+
+size_t TimeSeriesStore::memoryUsage() const {
+    return sizeof(*this) + (size_t)_capacity * sizeof(Series);
+}
+
+bool TimeSeriesStore::parseResolution(const String& text, HistoryResolution& res) {
+    if (text.length() == 0 || text == "raw") {
+        res = HISTORY_RAW;
+    } else if (text == "1m") {
+        res = HISTORY_MINUTE;
+    } else if (text == "1h") {
+        res = HISTORY_HOUR;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+void TimeSeriesStore::record(const uint8_t* mac, uint32_t ageMs, float waterLevel, float temperature, uint8_t category) {
+    Series* series = _acquire(mac);
+    if (!series) return;
+
+    uint32_t current = now();
+    uint32_t age = ageMs / 1000;
+    uint32_t time = current > age ? current - age : 0;
+    series->lastUpdate = current;
+    _dirty = true;
+
+    // Valeurs quantifiées comme dans les anneaux agrégés, gardées en floats entiers
+    Sample sample = _makeSample(waterLevel, temperature, category, 1);
+    float values[RAW_COLUMNS] = {(float)sample.waterLevel, (float)sample.temperature, (float)sample.category};
+
+    if (series->rawBlocks == 0) {
+        series->raw[0].clear();
+        series->rawBlocks = 1;
+    }
+    if (!series->raw[series->rawHead].append(time, values, RAW_COLUMNS)) {
+        // Bloc plein : passer au suivant, en écrasant le plus ancien si besoin
+        series->rawHead = (series->rawHead + 1) % HISTORY_RAW_BLOCKS;
+        if (series->rawBlocks < HISTORY_RAW_BLOCKS) series->rawBlocks++;
+        series->raw[series->rawHead].clear();
+        series->raw[series->rawHead].append(time, values, RAW_COLUMNS);
+    }
+
+    _addToTier(series->minutes, time, 60, waterLevel, temperature, category);
+    _addToTier(series->hours, time, 3600, waterLevel, temperature, category);
+}
+
+int TimeSeriesStore::query(const uint8_t* mac, HistoryResolution res, uint32_t from, const HistoryVisitor& visitor) {
+    Series* series = _find(mac);
+    if (!series) return -1;
+
+    switch (res) {
+        case HISTORY_MINUTE:
+            return _visitTier(series->minutes, 60, from, visitor);
+        case HISTORY_HOUR:
+            return _visitTier(series->hours, 3600, from, visitor);
+        case HISTORY_RAW:
+        default:
+            break;
+    }
+
+    // Décompresser les blocs du plus ancien au plus récent, point par point
+    int visited = 0;
+    uint8_t oldest = (series->rawHead + HISTORY_RAW_BLOCKS + 1 - series->rawBlocks) % HISTORY_RAW_BLOCKS;
+    for (uint8_t b = 0; b < series->rawBlocks; b++) {
+        GorillaReader reader = series->raw[(oldest + b) % HISTORY_RAW_BLOCKS].reader(RAW_COLUMNS);
+        uint32_t time;
+        float values[RAW_COLUMNS];
+        while (reader.next(time, values)) {
+            if (time < from) continue;
+            HistoryPoint point;
+            point.time = time;
+            point.waterLevel = values[0] / 10.0f;
+            point.temperature = values[1] / 10.0f;
+            point.category = (uint8_t)values[2];
+            visitor(point);
+            visited++;
+        }
+    }
+    return visited;
+}
+
+// Ajouter une mesure à l'intervalle courant ; un nouvel intervalle ferme le
+// précédent et laisse des cases vides pour les intervalles sans donnée
+template <size_t N>
+void TimeSeriesStore::_addToTier(Tier<N>& tier, uint32_t time, uint32_t period, float waterLevel, float temperature, uint8_t category) {
+    uint32_t index = time / period;
+    Bucket& bucket = tier.current;
+
+    if (bucket.count == 0 && tier.size == 0) {
+        bucket.index = index;
+    } else if (index > bucket.index) {
+        uint32_t gap = index - bucket.index - 1;
+        if (gap > N) gap = N;
+
+        tier.samples[tier.head] = _bucketSample(bucket);
+        tier.head = (tier.head + 1) % N;
+        if (tier.size < N) tier.size++;
+
+        for (uint32_t i = 0; i < gap; i++) {
+            memset(&tier.samples[tier.head], 0, sizeof(Sample));
+            tier.head = (tier.head + 1) % N;
+            if (tier.size < N) tier.size++;
+        }
+
+        memset(&bucket, 0, sizeof(Bucket));
+        bucket.index = index;
+    }
+    // Une mesure en retard (index antérieur) compte dans l'intervalle courant
+
+    bucket.waterSum += waterLevel;
+    bucket.temperatureSum += temperature;
+    if (category > bucket.category) bucket.category = category;
+    bucket.count++;
+}
+
+template <size_t N>
+int TimeSeriesStore::_visitTier(const Tier<N>& tier, uint32_t period, uint32_t from, const HistoryVisitor& visitor) {
+    int visited = 0;
+    uint16_t start = (tier.head + N - tier.size) % N;
+
+    // Les cases de l'anneau précèdent l'intervalle courant, sans trou
+    for (uint16_t i = 0; i < tier.size; i++) {
+        const Sample& sample = tier.samples[(start + i) % N];
+        uint32_t index = tier.current.index - tier.size + i;
+        if (sample.count == 0 || (index + 1) * period <= from) continue;
+        visitor(_toPoint(index * period, sample));
+        visited++;
+    }
+
+    if (tier.current.count > 0 && (tier.current.index + 1) * period > from) {
+        visitor(_toPoint(tier.current.index * period, _bucketSample(tier.current)));
+        visited++;
+    }
+    return visited;
+}
+
+TimeSeriesStore::Sample TimeSeriesStore::_makeSample(float waterLevel, float temperature, uint8_t category, uint8_t count) {
+    Sample sample;
+    float mm = waterLevel * 10.0f;
+    sample.waterLevel = mm <= 0 ? 0 : (mm >= 65535.0f ? 65535 : (uint16_t)(mm + 0.5f));
+    float tenths = temperature * 10.0f;
+    sample.temperature = tenths <= -32768.0f ? -32768 : (tenths >= 32767.0f ? 32767 : (int16_t)lroundf(tenths));
+    sample.category = category;
+    sample.count = count;
+    return sample;
+}
+
+TimeSeriesStore::Sample TimeSeriesStore::_bucketSample(const Bucket& bucket) {
+    if (bucket.count == 0) {
+        Sample empty;
+        memset(&empty, 0, sizeof(Sample));
+        return empty;
+    }
+    uint8_t count = bucket.count > 255 ? 255 : (uint8_t)bucket.count;
+    return _makeSample(bucket.waterSum / bucket.count, bucket.temperatureSum / bucket.count, bucket.category, count);
+}
+
+HistoryPoint TimeSeriesStore::_toPoint(uint32_t time, const Sample& sample) {
+    HistoryPoint point;
+    point.time = time;
+    point.waterLevel = sample.waterLevel / 10.0f;
+    point.temperature = sample.temperature / 10.0f;
+    point.category = sample.category;
+    return point;
+}
+
+TimeSeriesStore::Series* TimeSeriesStore::_find(const uint8_t* mac) {
+    const uint16_t* slot = _index.find(mac);
+    return slot ? &_series[*slot] : nullptr;
+}
+
+// Série de ce capteur, créée au besoin en reprenant la plus ancienne si tout est pris
+TimeSeriesStore::Series* TimeSeriesStore::_acquire(const uint8_t* mac) {
+    Series* series = _find(mac);
+    if (series || _capacity == 0) return series;
+
+    int slot = -1;
+    for (uint16_t i = 0; i < _capacity; i++) {
+        if (!_series[i].inUse) {
+            slot = i;
+            break;
+        }
+        if (slot < 0 || _series[i].lastUpdate < _series[slot].lastUpdate) {
+            slot = i;
+        }
+    }
+
+    series = &_series[slot];
+    if (series->inUse) {
+        _index.erase(series->mac);
+        _count--;
+    }
+
+    memset(series, 0, sizeof(Series));
+    memcpy(series->mac, mac, 6);
+    series->inUse = true;
+    _index.insert(mac, (uint16_t)slot);
+    _count++;
+    return series;
+}
+
+// Écrire dans un fichier temporaire puis le renommer : une coupure pendant
+// la sauvegarde laisse l'ancien fichier intact
+bool TimeSeriesStore::flush() {
+    if (_capacity == 0 || !_dirty) return true;
+
+    String tmpPath = String(HISTORY_FILE) + ".tmp";
+    File file = SPIFFS.open(tmpPath, FILE_WRITE);
+    if (!file) {
+        Logger::error("Historique: impossible d'écrire la sauvegarde");
+        return false;
+    }
+
+    HistoryFileHeader header;
+    header.magic = HISTORY_MAGIC;
+    header.version = HISTORY_VERSION;
+    header.count = _count;
+    header.clock = now();
+    header.seriesSize = sizeof(Series);
+
+    bool ok = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+    for (uint16_t i = 0; ok && i < _capacity; i++) {
+        if (_series[i].inUse) {
+            ok = file.write((const uint8_t*)&_series[i], sizeof(Series)) == sizeof(Series);
+        }
+    }
+    file.close();
+
+    if (!ok) {
+        Logger::error("Historique: sauvegarde incomplète");
+        SPIFFS.remove(tmpPath);
+        return false;
+    }
+
+    SPIFFS.remove(HISTORY_FILE);
+    if (!SPIFFS.rename(tmpPath, HISTORY_FILE)) {
+        Logger::error("Historique: échec du renommage de la sauvegarde");
+        return false;
+    }
+
+    _dirty = false;
+    Logger::infoF("Historique sauvegardé: %d capteurs", _count);
+    return true;
+}
+
+bool TimeSeriesStore::load() {
+    if (_capacity == 0 || !SPIFFS.exists(HISTORY_FILE)) return false;
+
+    File file = SPIFFS.open(HISTORY_FILE, FILE_READ);
+    if (!file) return false;
+
+    HistoryFileHeader header;
+    if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+        header.magic != HISTORY_MAGIC || header.version != HISTORY_VERSION ||
+        header.seriesSize != sizeof(Series)) {
+        Logger::warning("Historique: sauvegarde absente ou d'un autre format, ignorée");
+        file.close();
+        return false;
+    }
+
+    _index.clear();
+    _count = 0;
+    memset(_series, 0, sizeof(Series) * _capacity);
+
+    for (uint16_t i = 0; i < header.count && _count < _capacity; i++) {
+        Series& series = _series[_count];
+        if (file.read((uint8_t*)&series, sizeof(Series)) != sizeof(Series)) {
+            memset(&series, 0, sizeof(Series));
+            break;
+        }
+        _index.insert(series.mac, _count);
+        _count++;
+    }
+    file.close();
+
+    // Reprendre l'horloge où la sauvegarde l'a laissée
+    uint32_t uptime = millis() / 1000;
+    _clockBase = header.clock > uptime ? header.clock - uptime : 0;
+
+    Logger::infoF("Historique relu: %d capteurs", _count);
+    return true;
+}
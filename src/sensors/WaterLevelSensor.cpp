@@ -1,9 +1,20 @@
 #include "sensors/WaterLevelSensor.h"
 #include <Arduino.h>
+#include <algorithm>
 #include "utils/Logger.h"
 
+// Courbe par défaut : relation linéaire sur toute la plage de l'ADC, à
+// remplacer par des points mesurés sur la sonde installée
+static const WaterCalibrationPoint DEFAULT_CALIBRATION[] = {
+    {0.0f, 0.0f},
+    {4095.0f, 100.0f}
+};
 
-WaterLevelSensor::WaterLevelSensor(uint8_t pin) : _pin(pin) {
+WaterLevelSensor::WaterLevelSensor(uint8_t pin)
+    : _pin(pin),
+      _adc(pin),
+      _calibration(DEFAULT_CALIBRATION),
+      _calibrationCount(sizeof(DEFAULT_CALIBRATION) / sizeof(DEFAULT_CALIBRATION[0])) {
 }
 
 WaterLevelSensor::~WaterLevelSensor() {
@@ -11,29 +22,74 @@ WaterLevelSensor::~WaterLevelSensor() {
 }
 
 bool WaterLevelSensor::begin() {
-    // Configurer le pin comme entrée
-    pinMode(_pin, INPUT);
+    if (!_adc.begin()) {
+        return false;
+    }
     _isActive = true;
     Logger::infoF("Capteur de niveau d'eau initialisé sur le pin %d", _pin);
     return true;
 }
 
+void WaterLevelSensor::setCalibration(const WaterCalibrationPoint* points, uint8_t count) {
+    if (points == nullptr || count < 2) {
+        return;
+    }
+    _calibration = points;
+    _calibrationCount = count;
+}
+
 void WaterLevelSensor::update() {
-    // Lire la valeur analogique
-    _rawValue = analogRead(_pin);
-    
+    uint16_t count = _adc.read(_samples, WATER_ADC_BLOCK);
+    if (count == 0) {
+        return;   // Rien de neuf depuis la dernière mesure
+    }
+
+    float raw = _interquartileMean(_samples, count);
+    if (_hasReading) {
+        _filteredRaw += WATER_LEVEL_IIR_ALPHA * (raw - _filteredRaw);
+    } else {
+        _filteredRaw = raw;
+        _hasReading = true;
+    }
+
     // Convertir en niveau d'eau (en cm)
-    // Supposons une relation linéaire entre la lecture ADC et le niveau d'eau
-    _waterLevel = (float)_rawValue / MAX_RAW_VALUE * MAX_WATER_LEVEL;
+    _waterLevel = _toLevel(_filteredRaw);
 
-    
-    
     // Mettre à jour la catégorie
     _calculateCategory();
-    
+
     _lastReadTime = millis();
 }
 
+// Moyenne du deuxième et du troisième quartile du bloc (réordonne `samples`)
+float WaterLevelSensor::_interquartileMean(uint16_t* samples, uint16_t count) {
+    uint16_t quarter = count / 4;
+    uint16_t* low = samples + quarter;
+    uint16_t* high = samples + count - quarter;
+    if (quarter > 0) {
+        std::nth_element(samples, low, samples + count);
+        std::nth_element(low, high, samples + count);
+    }
+
+    uint32_t sum = 0;
+    for (uint16_t* p = low; p < high; p++) {
+        sum += *p;
+    }
+    return (float)sum / (high - low);
+}
+
+float WaterLevelSensor::_toLevel(float raw) const {
+    // Au-delà des points extrêmes, le segment le plus proche est prolongé
+    uint8_t i = 1;
+    while (i < _calibrationCount - 1 && raw > _calibration[i].raw) {
+        i++;
+    }
+    const WaterCalibrationPoint& a = _calibration[i - 1];
+    const WaterCalibrationPoint& b = _calibration[i];
+    float level = a.levelCm + (raw - a.raw) * (b.levelCm - a.levelCm) / (b.raw - a.raw);
+    return level < 0 ? 0 : level;
+}
+
 const char* WaterLevelSensor::getName() {
     return "WaterLevel";
 }
@@ -0,0 +1,159 @@
+// E-ink screen benchmark: pio run -e native && .pio/build/native/program --bench-eink test/golden/eink
+#include "sim/EInkBenchmark.h"
+#include "indicators/EInkDisplay.h"
+#include <sys/stat.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+using std::chrono::steady_clock;
+
+namespace {
+
+struct BenchScreen {
+    const char* name;
+    ScreenType screen;
+    uint8_t alertCategory;     // SCREEN_ALERT only
+};
+
+const BenchScreen SCREENS[] = {
+    {"welcome", SCREEN_WELCOME, 0},
+    {"clock", SCREEN_CLOCK, 0},
+    {"water_level", SCREEN_WATER_LEVEL, 0},
+    {"system_info", SCREEN_SYSTEM_INFO, 0},
+    {"network", SCREEN_NETWORK, 0},
+    {"alert_warning", SCREEN_ALERT, 1},
+    {"alert_critical", SCREEN_ALERT, 2},
+};
+
+void show(EInkDisplay& display, const BenchScreen& screen) {
+    switch (screen.screen) {
+        case SCREEN_CLOCK: display.showClockScreen(); break;
+        case SCREEN_WATER_LEVEL: display.showWaterLevelScreen(); break;
+        case SCREEN_SYSTEM_INFO: display.showSystemInfoScreen(); break;
+        case SCREEN_ALERT: display.showAlertScreen(screen.alertCategory); break;
+        case SCREEN_NETWORK: display.showNetworkScreen(); break;
+        case SCREEN_WELCOME: display.showWelcomeScreen(); break;
+    }
+}
+
+bool readFile(const std::string& path, std::string& out) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (!file) return false;
+    char chunk[4096];
+    size_t n;
+    out.clear();
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) out.append(chunk, n);
+    fclose(file);
+    return true;
+}
+
+bool writeFile(const std::string& path, const std::string& data) {
+    FILE* file = fopen(path.c_str(), "wb");
+    if (!file) return false;
+    bool ok = fwrite(data.data(), 1, data.size(), file) == data.size();
+    return fclose(file) == 0 && ok;
+}
+
+// mkdir -p
+void makeDirectories(const std::string& path) {
+    for (size_t slash = path.find('/', 1); slash != std::string::npos; slash = path.find('/', slash + 1)) {
+        mkdir(path.substr(0, slash).c_str(), 0755);
+    }
+    mkdir(path.c_str(), 0755);
+}
+
+// Pixels that differ between two PBMs of the same size (-1: not comparable)
+long countDifferences(const std::string& a, const std::string& b) {
+    if (a.size() != b.size()) return -1;
+    size_t header = a.find('\n', a.find('\n') + 1) + 1;
+    if (a.compare(0, header, b, 0, header) != 0) return -1;
+    long pixels = 0;
+    for (size_t i = header; i < a.size(); i++) {
+        pixels += __builtin_popcount((uint8_t)(a[i] ^ b[i]));
+    }
+    return pixels;
+}
+
+// Share of black pixels, a quick look at what a frame holds
+double inkCoverage(const std::string& pbm) {
+    size_t header = pbm.find('\n', pbm.find('\n') + 1) + 1;
+    uint64_t black = 0;
+    for (size_t i = header; i < pbm.size(); i++) black += __builtin_popcount((uint8_t)pbm[i]);
+    return pbm.size() > header ? 100.0 * black / ((pbm.size() - header) * 8) : 0.0;
+}
+
+} // namespace
+
+int runEInkBenchmark(const char* goldenDir, uint32_t iterations, bool updateGolden) {
+    if (updateGolden) makeDirectories(goldenDir);
+
+    bool logs = Logger::isLogsEnabled();
+    Logger::enableLogs(false);
+
+    // No FloodAlertSystem: frames depend only on the fixed clock (12:00:00,
+    // uptime 0), so they are the same from one run to the next
+    EInkDisplay display;
+    if (!display.begin()) {
+        Logger::enableLogs(logs);
+        printf("cannot start the e-ink display\n");
+        return 1;
+    }
+    EInkDisplay::Panel* panel = display.getPanel();
+
+    printf("=== E-ink screens: %zu screens, %u full redraws each, golden frames in %s ===\n",
+           sizeof(SCREENS) / sizeof(SCREENS[0]), (unsigned)iterations, goldenDir);
+    printf("%-16s %10s %10s %10s %7s  %s\n", "screen", "avg", "min", "max", "ink", "golden");
+
+    int failures = 0;
+    for (const BenchScreen& screen : SCREENS) {
+        show(display, screen);
+        std::string frame = panel->panelPBM();
+
+        // Golden frame
+        std::string path = std::string(goldenDir) + "/" + screen.name + ".pbm";
+        std::string golden;
+        char verdict[64];
+        bool found = readFile(path, golden);
+        if (found && golden == frame) {
+            snprintf(verdict, sizeof(verdict), "ok");
+        } else if (updateGolden) {
+            bool written = writeFile(path, frame);
+            snprintf(verdict, sizeof(verdict), !written ? "CANNOT WRITE" : (found ? "updated" : "recorded"));
+            if (!written) failures++;
+        } else if (!found) {
+            snprintf(verdict, sizeof(verdict), "MISSING");
+            failures++;
+        } else {
+            long differences = countDifferences(golden, frame);
+            std::string changed = std::string(goldenDir) + "/" + screen.name + ".new.pbm";
+            writeFile(changed, frame);
+            if (differences < 0) snprintf(verdict, sizeof(verdict), "SIZE DIFFERS");
+            else snprintf(verdict, sizeof(verdict), "%ld PIXELS DIFFER", differences);
+            failures++;
+        }
+
+        // Draw path, forced to a full redraw so that every call does the work
+        uint64_t totalUs = 0, minUs = UINT64_MAX, maxUs = 0;
+        for (uint32_t i = 0; i < iterations; i++) {
+            auto start = steady_clock::now();
+            display.refresh(true);
+            uint64_t us = std::chrono::duration_cast<std::chrono::microseconds>(steady_clock::now() - start).count();
+            totalUs += us;
+            if (us < minUs) minUs = us;
+            if (us > maxUs) maxUs = us;
+        }
+
+        printf("%-16s %7llu us %7llu us %7llu us %6.1f%%  %s\n", screen.name,
+               (unsigned long long)(iterations ? totalUs / iterations : 0),
+               (unsigned long long)(iterations ? minUs : 0), (unsigned long long)maxUs,
+               inkCoverage(frame), verdict);
+    }
+
+    Logger::enableLogs(logs);
+    if (failures) {
+        printf("%d screen(s) missing or differing from the golden frames (new frames written as "
+               "<screen>.new.pbm, --update-golden to accept them)\n", failures);
+    }
+    return failures ? 1 : 0;
+}
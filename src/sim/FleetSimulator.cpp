@@ -0,0 +1,598 @@
+#include "sim/FleetSimulator.h"
+#include "FloodAlertSystem.h"
+#include "sim/SimHttpClient.h"
+#include "sensors/DHT11Sensor.h"
+#include "sensors/WaterLevelSensor.h"
+#include <SimHeap.h>
+#include <SimMedium.h>
+#include <SimNode.h>
+#include <sys/resource.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using std::chrono::steady_clock;
+
+void LatencyHistogram::record(uint64_t us) {
+    int bucket = 0;
+    while (bucket < BUCKETS - 1 && (1ULL << bucket) < us) bucket++;
+    buckets[bucket]++;
+    count++;
+    totalUs += us;
+    if (us > maxUs) maxUs = us;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (int i = 0; i < BUCKETS; i++) buckets[i] += other.buckets[i];
+    count += other.count;
+    totalUs += other.totalUs;
+    if (other.maxUs > maxUs) maxUs = other.maxUs;
+}
+
+// Upper bound of the bucket holding the p-th percentile
+uint64_t LatencyHistogram::percentile(double p) const {
+    if (count == 0) return 0;
+    uint64_t target = (uint64_t)(count * p);
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; i++) {
+        seen += buckets[i];
+        if (seen > target) return std::min<uint64_t>(1ULL << i, maxUs);
+    }
+    return maxUs;
+}
+
+namespace {
+
+// What each node thread hands back once it stops
+struct NodeReport {
+    bool isMaster = false;
+    LatencyHistogram loop;
+    uint64_t framesRx = 0;
+    uint64_t framesTx = 0;
+    uint64_t serialBytes = 0;
+    int64_t heapPeak = 0;
+    int sensorsSeen = 0;
+    uint32_t sensorEvictions = 0;
+    int peers = 0;
+    uint32_t wakeups = 0;
+    uint32_t rxDropped = 0;
+    uint32_t rxHighWater = 0;
+    uint32_t maxLatencyUs = 0;     // simulated time
+    uint32_t maxTaskUs = 0;        // simulated time
+    const char* slowestTask = "-";
+    HttpStats http = {};
+    std::vector<HttpRouteStats> routes;   // Master only
+    std::vector<std::string> routeUris;
+    uint32_t sensorsCacheHits = 0;
+    uint32_t sensorsCacheMisses = 0;
+    uint32_t statusCacheHits = 0;
+    uint32_t statusCacheMisses = 0;
+    uint32_t einkFull = 0;
+    uint32_t einkPartial = 0;
+    uint32_t einkSkipped = 0;
+    uint64_t einkPixels = 0;
+};
+
+const int HTTP_ENDPOINTS = 3;
+
+struct HttpReport {
+    LatencyHistogram latency;
+    uint64_t bytes = 0;
+    uint64_t errors = 0;
+    uint64_t requests[HTTP_ENDPOINTS] = {};
+    size_t bytesMax[HTTP_ENDPOINTS] = {};
+    LatencyHistogram alertLatency;   // Simulated ms from a threshold crossing to the client seeing it
+};
+
+// Dashboard subscribed to /api/events
+struct EventReport {
+    uint64_t events = 0;
+    uint64_t bytes = 0;
+    bool connected = false;
+    LatencyHistogram alertLatency;
+};
+
+// Phone on a poor link downloading the stylesheet
+struct SlowReport {
+    uint64_t downloads = 0;
+    uint64_t bytes = 0;
+    uint64_t errors = 0;
+    LatencyHistogram duration;   // Wall ms per download
+};
+
+struct SharedState {
+    std::atomic<bool> stop{false};
+    std::atomic<FloodAlertSystem*> master{nullptr};
+    std::mutex lock;
+    std::vector<NodeReport> reports;
+};
+
+void makeMac(int index, uint8_t mac[6]) {
+    mac[0] = 0x24;
+    mac[1] = 0x6F;
+    mac[2] = 0x28;
+    mac[3] = 0x5A;
+    mac[4] = (uint8_t)(index >> 8);
+    mac[5] = (uint8_t)(index & 0xFF);
+}
+
+// Water level of slave `index`: slow tide with its own phase and amplitude,
+// so a few slaves cross the warning and critical thresholds during a run
+uint16_t simulatedWaterRaw(int index, uint32_t nowMs) {
+    float base = 4.0f + (index % 7) * 2.0f;
+    float amplitude = 3.0f + (index % 5) * 2.5f;
+    float period = 120000.0f + (index % 11) * 15000.0f;
+    float level = base + amplitude * sinf(nowMs / period * 6.2831853f + index);
+    if (level < 0) level = 0;
+    return (uint16_t)std::min(4095.0f, level / 100.0f * 4095.0f);
+}
+
+// What the ADC gives for `raw`: about +/-1 cm of noise, and now and then a
+// spike such as a pump starting nearby
+uint16_t noisyAdcRead(uint16_t raw, uint32_t& seed) {
+    seed = seed * 1664525u + 1013904223u;
+    int noisy = (int)raw + (int)(seed >> 24) % 81 - 40;
+    if ((seed & 0xFF) == 0) noisy += 1500;
+    return (uint16_t)std::max(0, std::min(4095, noisy));
+}
+
+// Alert category the slave's sensor should report at nowMs (WaterLevelSensor thresholds)
+int simulatedCategory(int index, uint32_t nowMs) {
+    float level = (float)simulatedWaterRaw(index, nowMs) / 4095 * 100;
+    return level >= WATER_CRITICAL_THRESHOLD ? 2 : (level >= WATER_WARNING_THRESHOLD ? 1 : 0);
+}
+
+// What a dashboard knows about each slave's category; an alert it sees is
+// timed against the moment the simulated water level actually crossed the threshold
+class CategoryTracker {
+public:
+    explicit CategoryTracker(int slaves) : _last(slaves + 1, -1) {}
+
+    // Scan JSON text (an /api/sensors body or one event) for "mac":"<makeMac(index)>" ... "category":N
+    void scan(const char* text, uint32_t nowMs, LatencyHistogram& latency) {
+        const char* p = text;
+        while ((p = strstr(p, "\"mac\":\"24:6F:28:5A:")) != nullptr) {
+            unsigned int hi = 0, lo = 0;
+            sscanf(p + 19, "%2X:%2X", &hi, &lo);
+            int index = (int)(hi << 8 | lo);
+            const char* category = strstr(p, "\"category\":");
+            if (!category) return;
+            p = category;
+            int value = atoi(category + 11);
+            if (index <= 0 || index >= (int)_last.size()) continue;
+
+            // Only rising categories count: slaves send those at once, the all-clear waits for the next batch
+            if (_last[index] >= 0 && value > _last[index]) {
+                uint32_t crossed = nowMs;
+                while (nowMs - crossed < 120000 && simulatedCategory(index, crossed - 10) == value) crossed -= 10;
+                latency.record(nowMs - crossed);
+            }
+            _last[index] = value;
+        }
+    }
+
+private:
+    std::vector<int> _last;
+};
+
+// Firmware of one board, mirroring setup()/loop() of src/main.cpp
+void runNode(int index, bool isMaster, const FleetOptions& options, SharedState& shared) {
+    uint8_t mac[6];
+    makeMac(index, mac);
+    char name[24];
+    snprintf(name, sizeof(name), isMaster ? "master" : "slave-%03d", index);
+
+    sim::SimNode node(name, mac);
+    node.bindToCurrentThread();
+    node.setEchoSerial(isMaster && options.verbose);
+    uint32_t adcSeed = 0x9E3779B9u * (uint32_t)(index + 1);
+    node.setAnalogSource([index, adcSeed](uint8_t pin, uint32_t nowMs) mutable -> uint16_t {
+        return pin == WATER_LEVEL_SENSOR_PIN ? noisyAdcRead(simulatedWaterRaw(index, nowMs), adcSeed) : 0;
+    });
+
+    // Boards do not power up in the same millisecond
+    if (!isMaster) {
+        delay(random(2000));
+    }
+
+    NodeReport report;
+    report.isMaster = isMaster;
+    {
+        std::unique_ptr<LEDAlertIndicator> led(new LEDAlertIndicator(LED_RED_PIN, LED_YELLOW_PIN, LED_GREEN_PIN));
+        std::unique_ptr<BuzzerAlertIndicator> buzzer(new BuzzerAlertIndicator(BUZZER_PIN));
+        std::unique_ptr<EInkDisplay> eink(new EInkDisplay(5, 17, 16, 4));
+        std::unique_ptr<ToggleSwitchIndicator> toggle(new ToggleSwitchIndicator(TOGGLE_SWITCH_PIN, ADDITIONAL_LED_PIN));
+        std::unique_ptr<FloodAlertSystem> system(new FloodAlertSystem());
+
+        led->begin();
+        buzzer->begin();
+        eink->begin();
+        toggle->begin();
+
+        system->setLEDIndicator(led.get());
+        system->setBuzzerIndicator(buzzer.get());
+        system->setEInkDisplay(eink.get());
+        system->setToggleSwitchIndicator(toggle.get());
+
+        system->setSensorCapacity(options.sensorCapacity > 0 ? options.sensorCapacity : options.slaves + 1);
+        system->begin(isMaster);
+        if (isMaster) {
+            system->addSensor(new DHT11Sensor(DHT11_PIN));
+            eink->setScreen(SCREEN_CLOCK);
+            shared.master = system.get();
+        } else {
+            system->addSensor(new WaterLevelSensor(WATER_LEVEL_SENSOR_PIN));
+            eink->setScreen(SCREEN_WATER_LEVEL);
+        }
+
+        sim::resetThreadHeapPeak();
+        system->getScheduler().resetStats();
+
+        // loop() of the firmware: the scheduler sleeps until the next task is due
+        const SchedulerStats& stats = system->getScheduler().getStats();
+        uint32_t wakeups = stats.wakeups;
+        while (!shared.stop) {
+            system->update();
+            if (stats.wakeups != wakeups) {
+                wakeups = stats.wakeups;
+                report.loop.record((uint64_t)(stats.lastLoopUs / options.speed));
+            }
+        }
+        report.wakeups = stats.wakeups;
+        report.maxLatencyUs = stats.maxLatencyUs;
+        report.slowestTask = stats.slowestTask;
+        report.maxTaskUs = stats.maxRunUs;
+
+        if (isMaster) {
+            shared.master = nullptr;
+            HttpServer& server = system->getWebServer().getServer();
+            report.http = server.getStats();
+            for (size_t i = 0; i < server.routeCount(); i++) {
+                report.routes.push_back(server.routeStats(i));
+                report.routeUris.push_back(server.routeStats(i).uri);
+            }
+            report.sensorsCacheHits = system->getSensorsCache().hits();
+            report.sensorsCacheMisses = system->getSensorsCache().misses();
+            report.statusCacheHits = system->getStatusCache().hits();
+            report.statusCacheMisses = system->getStatusCache().misses();
+            report.sensorsSeen = system->getSensorCount();
+            report.sensorEvictions = system->getSensors().evictions();
+            report.einkFull = eink->getFullRefreshCount();
+            report.einkPartial = eink->getPartialRefreshCount();
+            report.einkSkipped = eink->getSkippedRefreshCount();
+            report.einkPixels = eink->getPartialRefreshPixels();
+        }
+        report.peers = system->getNetwork().getPeerCount();
+        report.rxDropped = system->getNetwork().getDroppedFrames();
+        report.rxHighWater = system->getNetwork().getRxQueueHighWater();
+        report.heapPeak = sim::threadHeapStats().peakBytes;
+    }
+
+    report.framesRx = node.framesReceived();
+    report.framesTx = node.framesTransmitted();
+    report.serialBytes = node.serialBytes();
+
+    std::lock_guard<std::mutex> guard(shared.lock);
+    shared.reports.push_back(report);
+}
+
+const char* const ENDPOINTS[HTTP_ENDPOINTS] = {"/api/sensors", "/api/status", "/api/history"};
+
+// Browser polling the dashboard APIs like data/static/script.js does
+void runHttpClient(int index, const FleetOptions& options, SharedState& shared, HttpReport& out) {
+    uint32_t next = millis() + 3000 + random(options.httpIntervalMs);
+    int request = index;
+    CategoryTracker categories(options.slaves);
+
+    while (!shared.stop) {
+        if ((int32_t)(millis() - next) < 0) {
+            delay(5);
+            continue;
+        }
+        next += options.httpIntervalMs;
+
+        FloodAlertSystem* master = shared.master.load();
+        if (!master) continue;
+
+        // Every third request opens the history chart of the master's own sensor
+        String query;
+        int endpoint = request++ % HTTP_ENDPOINTS;
+        if (endpoint == 2) {
+            uint8_t mac[6];
+            master->getNetwork().getOwnMac(mac);
+            char buf[64];
+            snprintf(buf, sizeof(buf), "sensor=%02X:%02X:%02X:%02X:%02X:%02X&res=1m",
+                     mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+            query = buf;
+        }
+
+        String path = String(ENDPOINTS[endpoint]);
+        if (query.length() > 0) path += "?" + query;
+
+        auto start = steady_clock::now();
+        SimHttpClient::Response response =
+            SimHttpClient::get(master->getWebServer().getServer().port(), path.c_str());
+        auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(steady_clock::now() - start);
+
+        out.latency.record((uint64_t)elapsed.count());
+        out.bytes += response.body.size();
+        if (response.code != 200 || !response.complete) out.errors++;
+
+        if (endpoint == 0) categories.scan(response.body.c_str(), millis(), out.alertLatency);
+
+        out.requests[endpoint]++;
+        if (response.body.size() > out.bytesMax[endpoint]) out.bytesMax[endpoint] = response.body.size();
+    }
+}
+
+// Browser tab holding an EventSource on /api/events
+void runEventClient(const FleetOptions& options, SharedState& shared, EventReport& out) {
+    CategoryTracker categories(options.slaves);
+    SimHttpClient stream;
+    std::string buffer;
+    bool headers = false;
+
+    while (!shared.stop) {
+        FloodAlertSystem* master = shared.master.load();
+        if (!stream.isOpen()) {
+            if (!master || !stream.connect(master->getWebServer().getServer().port()) || !stream.sendGet("/api/events")) {
+                stream.close();
+                delay(100);
+                continue;
+            }
+            buffer.clear();
+            headers = false;
+            out.connected = true;
+        }
+
+        std::string data = stream.read(20);
+        out.bytes += data.size();
+        buffer += data;
+
+        // Response headers first, then the event stream
+        if (!headers) {
+            size_t end = buffer.find("\r\n\r\n");
+            if (end == std::string::npos) continue;
+            buffer.erase(0, end + 4);
+            headers = true;
+        }
+
+        // Events end with a blank line
+        size_t end;
+        while ((end = buffer.find("\n\n")) != std::string::npos) {
+            std::string event = buffer.substr(0, end);
+            buffer.erase(0, end + 2);
+            if (event.compare(0, 13, "event: sensor") == 0 && event.compare(0, 14, "event: sensor-") != 0) {
+                out.events++;
+                categories.scan(event.c_str(), millis(), out.alertLatency);
+            }
+        }
+    }
+}
+
+// Stylesheet read a few hundred bytes at a time: a synchronous server would
+// be stuck writing to this client for the whole download
+void runSlowClient(SharedState& shared, SlowReport& out) {
+    while (!shared.stop) {
+        FloodAlertSystem* master = shared.master.load();
+        if (!master) {
+            delay(100);
+            continue;
+        }
+        auto start = steady_clock::now();
+        SimHttpClient::Response response =
+            SimHttpClient::get(master->getWebServer().getServer().port(), "/static/css/styles.css", 256, 50, 30000);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - start);
+        if (shared.stop) break;   // Cut short by the end of the run
+
+        out.downloads++;
+        out.bytes += response.body.size();
+        if (response.code != 200 || !response.complete) out.errors++;
+        out.duration.record((uint64_t)elapsed.count());
+    }
+}
+
+void printHistogram(const char* label, const LatencyHistogram& h) {
+    printf("  %-22s n=%-9llu avg=%6llu us  p99<=%6llu us  max=%7llu us\n", label,
+           (unsigned long long)h.count, (unsigned long long)h.averageUs(),
+           (unsigned long long)h.percentile(0.99), (unsigned long long)h.maxUs);
+}
+
+// Same, for histograms recorded in simulated milliseconds
+void printSimHistogram(const char* label, const LatencyHistogram& h) {
+    printf("  %-22s n=%-9llu avg=%6llu ms  p99<=%6llu ms  max=%7llu ms (simulated)\n", label,
+           (unsigned long long)h.count, (unsigned long long)h.averageUs(),
+           (unsigned long long)h.percentile(0.99), (unsigned long long)h.maxUs);
+}
+
+} // namespace
+
+FleetSimulator::FleetSimulator(const FleetOptions& options) : _options(options) {
+}
+
+int FleetSimulator::run() {
+    sim::setClockSpeed(_options.speed);
+    sim::SimMedium& medium = sim::SimMedium::instance();
+    medium.setLossRate(_options.lossRate);
+    medium.setRxQueueDepth(_options.rxQueueDepth);
+    medium.resetStats();
+
+    printf("=== Fleet simulation: 1 master + %d slaves, %u s simulated at x%.1f ===\n",
+           _options.slaves, (unsigned)_options.durationSec, _options.speed);
+
+    SharedState shared;
+    std::vector<std::thread> threads;
+    threads.emplace_back(runNode, 0, true, std::cref(_options), std::ref(shared));
+    for (int i = 1; i <= _options.slaves; i++) {
+        threads.emplace_back(runNode, i, false, std::cref(_options), std::ref(shared));
+    }
+
+    std::vector<HttpReport> httpReports(_options.httpClients);
+    std::vector<std::thread> clients;
+    for (int i = 0; i < _options.httpClients; i++) {
+        clients.emplace_back(runHttpClient, i, std::cref(_options), std::ref(shared), std::ref(httpReports[i]));
+    }
+
+    std::vector<EventReport> eventReports(_options.eventClients);
+    for (int i = 0; i < _options.eventClients; i++) {
+        clients.emplace_back(runEventClient, std::cref(_options), std::ref(shared), std::ref(eventReports[i]));
+    }
+
+    std::vector<SlowReport> slowReports(_options.slowClients);
+    for (int i = 0; i < _options.slowClients; i++) {
+        clients.emplace_back(runSlowClient, std::ref(shared), std::ref(slowReports[i]));
+    }
+
+    delay(_options.durationSec * 1000);
+    sim::MediumStats air = medium.stats();
+    shared.stop = true;
+
+    for (auto& t : clients) t.join();
+    for (auto& t : threads) t.join();
+
+    NodeReport master;
+    LatencyHistogram slaveLoops;
+    uint64_t slaveWakeups = 0;
+    uint32_t slaveMaxLatency = 0;
+    uint64_t slaveTx = 0, slaveSerial = 0;
+    int64_t slaveHeapTotal = 0, slaveHeapMax = 0;
+    for (const auto& r : shared.reports) {
+        if (r.isMaster) {
+            master = r;
+            continue;
+        }
+        slaveLoops.merge(r.loop);
+        slaveWakeups += r.wakeups;
+        if (r.maxLatencyUs > slaveMaxLatency) slaveMaxLatency = r.maxLatencyUs;
+        slaveTx += r.framesTx;
+        slaveSerial += r.serialBytes;
+        slaveHeapTotal += r.heapPeak;
+        if (r.heapPeak > slaveHeapMax) slaveHeapMax = r.heapPeak;
+    }
+
+    double seconds = _options.durationSec;
+    printf("\nRadio\n");
+    printf("  frames sent      %10llu  (%.1f/s, %llu bytes)\n", (unsigned long long)air.framesSent,
+           air.framesSent / seconds, (unsigned long long)air.bytesSent);
+    printf("  frames delivered %10llu\n", (unsigned long long)air.framesDelivered);
+    printf("  lost on air      %10llu\n", (unsigned long long)air.framesLost);
+    printf("  RX queue full    %10llu\n", (unsigned long long)air.framesOverflow);
+
+    int slaveCount = _options.slaves > 0 ? _options.slaves : 1;
+    printf("\nScheduler (loop pass in wall time, latency in simulated time)\n");
+    printHistogram("master pass", master.loop);
+    printHistogram("slaves pass (all)", slaveLoops);
+    printf("  master wakeups   %10u  (%.1f/s), worst latency %u us, slowest task %s (%u us)\n",
+           (unsigned)master.wakeups, master.wakeups / seconds, (unsigned)master.maxLatencyUs,
+           master.slowestTask, (unsigned)master.maxTaskUs);
+    printf("  slave wakeups    %10.1f/s per slave, worst latency %u us\n",
+           slaveWakeups / seconds / slaveCount, (unsigned)slaveMaxLatency);
+
+    printf("\nMaster\n");
+    printf("  frames received  %10llu  (%.1f/s)\n", (unsigned long long)master.framesRx,
+           master.framesRx / seconds);
+    printf("  peers            %10d\n", master.peers);
+    printf("  app queue drops  %10u  (deepest backlog %u/%u)\n", (unsigned)master.rxDropped,
+           (unsigned)master.rxHighWater, (unsigned)RX_QUEUE_LENGTH);
+    printf("  remote sensors   %10d  (%u evicted)\n", master.sensorsSeen, (unsigned)master.sensorEvictions);
+    printf("  serial output    %10llu bytes\n", (unsigned long long)master.serialBytes);
+    printf("  e-ink refreshes  %10u full, %u partial (%.1f%% of the panel on average), %u unchanged frames skipped\n",
+           (unsigned)master.einkFull, (unsigned)master.einkPartial,
+           master.einkPartial ? 100.0 * master.einkPixels / master.einkPartial /
+                                    (GxEPD2_579_GDEY0579T93::WIDTH * GxEPD2_579_GDEY0579T93::HEIGHT) : 0.0,
+           (unsigned)master.einkSkipped);
+
+    printf("\nSlaves\n");
+    printf("  frames sent      %10llu\n", (unsigned long long)slaveTx);
+    printf("  serial output    %10llu bytes\n", (unsigned long long)slaveSerial);
+
+    if (_options.httpClients > 0) {
+        HttpReport http;
+        for (const auto& r : httpReports) {
+            http.latency.merge(r.latency);
+            http.bytes += r.bytes;
+            http.errors += r.errors;
+            http.alertLatency.merge(r.alertLatency);
+            for (int e = 0; e < HTTP_ENDPOINTS; e++) {
+                http.requests[e] += r.requests[e];
+                http.bytesMax[e] = std::max(http.bytesMax[e], r.bytesMax[e]);
+            }
+        }
+        printf("\nHTTP (%d clients)\n", _options.httpClients);
+        printHistogram("request latency", http.latency);
+        printf("  response bytes   %10llu  errors %llu\n", (unsigned long long)http.bytes,
+               (unsigned long long)http.errors);
+        for (int e = 0; e < HTTP_ENDPOINTS; e++) {
+            if (http.requests[e] == 0) continue;
+            printf("  %-14s %6llu requests, body max %7zu bytes\n", ENDPOINTS[e],
+                   (unsigned long long)http.requests[e], http.bytesMax[e]);
+        }
+        printSimHistogram("alert latency", http.alertLatency);
+    }
+
+    if (_options.slowClients > 0) {
+        SlowReport slow;
+        for (const auto& r : slowReports) {
+            slow.downloads += r.downloads;
+            slow.bytes += r.bytes;
+            slow.errors += r.errors;
+            slow.duration.merge(r.duration);
+        }
+        printf("\nSlow clients (%d, 256 bytes per 50 ms)\n", _options.slowClients);
+        printf("  downloads        %10llu  (%llu bytes, %llu errors)\n", (unsigned long long)slow.downloads,
+               (unsigned long long)slow.bytes, (unsigned long long)slow.errors);
+        printf("  download time    avg %6llu ms  max %7llu ms (wall)\n",
+               (unsigned long long)slow.duration.averageUs(), (unsigned long long)slow.duration.maxUs);
+    }
+
+    if (master.http.accepted > 0) {
+        printf("\nHTTP server (master)\n");
+        printf("  connections      %10u accepted, peak %u open\n", (unsigned)master.http.accepted,
+               (unsigned)master.http.peakConnections);
+        printf("  requests         %10u  (%u rejected, %u timeouts, %u aborted)\n", (unsigned)master.http.requests,
+               (unsigned)master.http.rejected, (unsigned)master.http.timeouts, (unsigned)master.http.aborted);
+        for (size_t i = 0; i < master.routes.size(); i++) {
+            const HttpRouteStats& route = master.routes[i];
+            if (route.hits == 0) continue;
+            printf("  %-16s %6u hits, handler max %7u us, heap max %7lld bytes\n", master.routeUris[i].c_str(),
+                   (unsigned)route.hits, (unsigned)route.maxUs, (long long)route.heapPeak);
+        }
+        printf("  response cache   /api/sensors %u hits %u misses, /api/status %u hits %u misses\n",
+               (unsigned)master.sensorsCacheHits, (unsigned)master.sensorsCacheMisses,
+               (unsigned)master.statusCacheHits, (unsigned)master.statusCacheMisses);
+    }
+
+    if (_options.eventClients > 0) {
+        EventReport events;
+        int connected = 0;
+        for (const auto& r : eventReports) {
+            events.events += r.events;
+            events.bytes += r.bytes;
+            events.alertLatency.merge(r.alertLatency);
+            if (r.connected) connected++;
+        }
+        printf("\nEvents (%d subscribers, %d connected)\n", _options.eventClients, connected);
+        printf("  sensor events    %10llu  (%.1f/s per subscriber), %llu bytes\n",
+               (unsigned long long)events.events, connected ? events.events / seconds / connected : 0.0,
+               (unsigned long long)events.bytes);
+        printSimHistogram("alert latency", events.alertLatency);
+    }
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    sim::HeapStats heap = sim::heapStats();
+    printf("\nMemory\n");
+    printf("  master heap peak %10lld bytes\n", (long long)master.heapPeak);
+    printf("  slave heap peak  %10lld bytes avg, %lld max\n",
+           (long long)(slaveHeapTotal / slaveCount), (long long)slaveHeapMax);
+    printf("  process heap     %10lld bytes peak, %llu allocations\n", (long long)heap.peakBytes,
+           (unsigned long long)heap.allocations);
+    printf("  max RSS          %10ld KiB\n", usage.ru_maxrss);
+    printf("  sizeof(FloodAlertSystem) = %u\n", (unsigned)sizeof(FloodAlertSystem));
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+// History codec benchmark: pio run -e native && .pio/build/native/program --bench-history
+#include "sim/HistoryBenchmark.h"
+#include "Config.h"
+#include "utils/Gorilla.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using std::chrono::steady_clock;
+
+namespace {
+
+typedef GorillaBlock<HISTORY_RAW_BLOCK_BYTES> Block;
+const uint8_t COLUMNS = 3;
+
+struct Point {
+    uint32_t time;
+    float values[COLUMNS];   // Level (mm), temperature (0.1 °C), category
+};
+
+// Sampled every 500 ms like the slaves, stamped in whole seconds like the store
+typedef void (*Generator)(std::mt19937& rng, uint32_t i, Point& p);
+
+void stableLevel(std::mt19937& rng, uint32_t, Point& p) {
+    std::uniform_int_distribution<int> jitter(0, 20);
+    int j = jitter(rng);
+    p.values[0] = (float)(120 + (j == 0 ? -1 : (j == 1 ? 1 : 0)));
+    p.values[1] = 0;
+    p.values[2] = 0;
+}
+
+// 12-bit ADC reading of a still water surface: a few LSB of noise
+void noisyAdc(std::mt19937& rng, uint32_t, Point& p) {
+    std::normal_distribution<float> noise(0.0f, 2.0f);
+    int raw = 1800 + (int)lroundf(noise(rng));
+    p.values[0] = (float)lroundf(raw / 4095.0f * 1000.0f);   // mm over a 100 cm range
+    p.values[1] = 0;
+    p.values[2] = 0;
+}
+
+// Water rising through the warning and critical thresholds over 6 hours
+void floodRise(std::mt19937& rng, uint32_t i, Point& p) {
+    std::normal_distribution<float> noise(0.0f, 1.5f);
+    float cm = 5.0f + 70.0f * fminf(1.0f, i / 43200.0f) + 3.0f * sinf(i / 600.0f);
+    p.values[0] = (float)lroundf(cm * 10.0f + noise(rng));
+    p.values[1] = 0;
+    p.values[2] = (float)(cm >= 70.0f ? 2 : (cm >= 40.0f ? 1 : 0));
+}
+
+// DHT11 on the master: slow daily cycle, 0.1 °C steps
+void temperature(std::mt19937&, uint32_t i, Point& p) {
+    p.values[0] = 0;
+    p.values[1] = (float)lroundf(230.0f + 30.0f * sinf(i / 86400.0f * 6.2832f));
+    p.values[2] = 0;
+}
+
+struct Profile {
+    const char* name;
+    Generator generate;
+};
+
+const Profile PROFILES[] = {
+    {"stable level", stableLevel},
+    {"noisy ADC", noisyAdc},
+    {"flood rise", floodRise},
+    {"temperature", temperature},
+};
+
+} // namespace
+
+int runHistoryBenchmark(uint32_t points) {
+    printf("=== History codec: %u points per profile, %u-byte blocks (%u bytes with header) ===\n\n",
+           (unsigned)points, (unsigned)HISTORY_RAW_BLOCK_BYTES, (unsigned)sizeof(Block));
+    printf("  %-14s %9s %11s %10s %10s %14s\n", "profile", "bits/pt", "pts/block", "vs 12 B", "vs 16 B", "decode");
+
+    int failures = 0;
+    for (const Profile& profile : PROFILES) {
+        std::mt19937 rng(42);
+        std::vector<Point> input(points);
+        for (uint32_t i = 0; i < points; i++) {
+            input[i].time = 1000 + i / 2;
+            profile.generate(rng, i, input[i]);
+        }
+
+        // Encode
+        std::vector<Block> blocks(1);
+        blocks.back().clear();
+        uint64_t payloadBits = 0;
+        for (const Point& p : input) {
+            if (!blocks.back().append(p.time, p.values, COLUMNS)) {
+                payloadBits += blocks.back().bits;
+                blocks.emplace_back();
+                blocks.back().clear();
+                blocks.back().append(p.time, p.values, COLUMNS);
+            }
+        }
+        payloadBits += blocks.back().bits;
+
+        // Decode (timed) and compare
+        size_t index = 0;
+        bool exact = true;
+        auto start = steady_clock::now();
+        for (const Block& block : blocks) {
+            GorillaReader reader = block.reader(COLUMNS);
+            uint32_t time;
+            float values[COLUMNS];
+            while (reader.next(time, values)) {
+                const Point& p = input[index++];
+                if (time != p.time || memcmp(values, p.values, sizeof(values)) != 0) exact = false;
+            }
+        }
+        double seconds = std::chrono::duration<double>(steady_clock::now() - start).count();
+        if (index != input.size()) exact = false;
+        if (!exact) failures++;
+
+        double storedBytes = (double)blocks.size() * sizeof(Block);
+        printf("  %-14s %9.1f %11.1f %9.1fx %9.1fx %9.1f Mpt/s%s\n", profile.name,
+               (double)payloadBits / points, (double)points / blocks.size(),
+               points * 12.0 / storedBytes, points * 16.0 / storedBytes,
+               seconds > 0 ? points / seconds / 1e6 : 0.0, exact ? "" : "  MISMATCH");
+    }
+
+    printf("\n  vs 12 B: previous raw ring (time + packed sample), vs 16 B: time + 3 floats,\n");
+    printf("  both against whole blocks including their header and unused tail.\n");
+    return failures == 0 ? 0 : 1;
+}
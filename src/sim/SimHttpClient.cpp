@@ -0,0 +1,94 @@
+#include "sim/SimHttpClient.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <thread>
+
+bool SimHttpClient::connect(uint16_t port, int receiveBuffer) {
+    close();
+    _fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (_fd < 0) return false;
+    if (receiveBuffer > 0) {
+        setsockopt(_fd, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+    }
+
+    struct sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = htons(port);
+    if (::connect(_fd, (struct sockaddr*)&address, sizeof(address)) < 0) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool SimHttpClient::sendGet(const char* path) {
+    if (_fd < 0) return false;
+    char request[256];
+    int n = snprintf(request, sizeof(request), "GET %s HTTP/1.1\r\nHost: 192.168.4.1\r\n\r\n", path);
+    if (n <= 0 || n >= (int)sizeof(request)) return false;
+    return send(_fd, request, n, MSG_NOSIGNAL) == n;
+}
+
+std::string SimHttpClient::read(uint32_t timeoutMs, size_t maxBytes) {
+    std::string data;
+    if (_fd < 0) return data;
+
+    struct pollfd readable = {_fd, POLLIN, 0};
+    if (poll(&readable, 1, (int)timeoutMs) <= 0) return data;
+
+    data.resize(maxBytes);
+    ssize_t n = recv(_fd, &data[0], maxBytes, 0);
+    if (n <= 0) {
+        // Closed by the server
+        close();
+        n = 0;
+    }
+    data.resize(n);
+    return data;
+}
+
+void SimHttpClient::close() {
+    if (_fd >= 0) {
+        ::close(_fd);
+        _fd = -1;
+    }
+}
+
+SimHttpClient::Response SimHttpClient::get(uint16_t port, const char* path, size_t readChunk, uint32_t pauseMs,
+                                           uint32_t timeoutMs) {
+    Response response;
+    SimHttpClient client;
+    if (!client.connect(port, readChunk > 0 ? (int)readChunk : 0) || !client.sendGet(path)) return response;
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    std::string raw;
+    while (client.isOpen() && std::chrono::steady_clock::now() < deadline) {
+        raw += client.read(100, readChunk > 0 ? readChunk : 4096);
+        if (readChunk > 0 && pauseMs > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(pauseMs));
+        }
+    }
+
+    // Status line, then the body after the blank line
+    if (raw.compare(0, 9, "HTTP/1.1 ") == 0) response.code = atoi(raw.c_str() + 9);
+    size_t headerEnd = raw.find("\r\n\r\n");
+    if (headerEnd == std::string::npos) return response;
+    response.body = raw.substr(headerEnd + 4);
+
+    // Closed by the server, and with the announced length if there was one
+    response.complete = !client.isOpen();
+    size_t length = raw.find("\r\nContent-Length: ");
+    if (length != std::string::npos && length < headerEnd) {
+        response.complete = response.complete && response.body.size() == strtoul(raw.c_str() + length + 18, nullptr, 10);
+    }
+    return response;
+}
@@ -0,0 +1,162 @@
+// Static file benchmark: pio run -e native && .pio/build/native/program --bench-static
+#include "sim/StaticBenchmark.h"
+#include "network/AssetBundle.h"
+#include "network/HttpServer.h"
+#include "sim/SimHttpClient.h"
+#include <SPIFFS.h>
+#include <SimHeap.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+using std::chrono::steady_clock;
+
+namespace {
+
+struct ClientResult {
+    uint64_t requests = 0;
+    uint64_t bytes = 0;
+    uint64_t errors = 0;
+};
+
+// Same bytes as the bundle, as tools/build_assets.py writes them for SPIFFS
+bool writeSpiffsCopy(std::vector<std::string>& paths) {
+    for (uint16_t i = 0; i < ASSET_BUNDLE_SLOTS; i++) {
+        const BundledAsset& asset = ASSET_BUNDLE[i];
+        if (asset.path == nullptr) continue;
+        paths.push_back(asset.path);
+
+        // Parent directories first
+        String path = String(asset.path) + (asset.gzip ? ".gz" : "");
+        for (int slash = path.indexOf('/', 1); slash > 0; slash = path.indexOf('/', slash + 1)) {
+            SPIFFS.mkdir(path.substring(0, slash));
+        }
+        File file = SPIFFS.open(path, "w");
+        if (!file || file.write(asset.data, asset.length) != asset.length) return false;
+        file.close();
+    }
+    return true;
+}
+
+void runClient(uint16_t port, const char* prefix, const std::vector<std::string>& paths,
+               steady_clock::time_point deadline, int offset, ClientResult& out) {
+    size_t next = offset;
+    while (steady_clock::now() < deadline) {
+        std::string url = std::string(prefix) + paths[next++ % paths.size()];
+        SimHttpClient::Response response = SimHttpClient::get(port, url.c_str());
+        out.requests++;
+        out.bytes += response.body.size();
+        if (response.code != 200 || !response.complete) out.errors++;
+    }
+}
+
+// Both sources behind the same server, one route each
+struct StaticRoutes {
+    HttpServer& server;
+
+    // Before the bundle: file system lookup, open, then the file through the output buffer
+    void handleSpiffs() {
+        String path = server.uri().substring(7);
+        String stored = path + ".gz";
+        if (!SPIFFS.exists(stored)) {
+            server.send(404, "text/plain", "not found");
+            return;
+        }
+        File file = SPIFFS.open(stored, "r");
+        server.sendHeader("Content-Encoding", "gzip");
+        server.streamFile(file, "text/plain");
+    }
+
+    // Bundle: perfect hash lookup, body sent from the constant array
+    void handleFlash() {
+        const BundledAsset* asset = AssetBundle::find(server.uri().c_str() + 6);
+        if (!asset) {
+            server.send(404, "text/plain", "not found");
+            return;
+        }
+        if (asset->gzip) server.sendHeader("Content-Encoding", "gzip");
+        server.send_P(200, asset->contentType, (const char*)asset->data, asset->length);
+    }
+
+    static const HttpRoute ROUTES[];
+};
+
+// Same order as the benchmark rows (routeStats index)
+const HttpRoute StaticRoutes::ROUTES[] = {
+    HTTP_PREFIX_ROUTE("/spiffs/", HTTP_GET, StaticRoutes, handleSpiffs),
+    HTTP_PREFIX_ROUTE("/flash/", HTTP_GET, StaticRoutes, handleFlash),
+};
+
+} // namespace
+
+int runStaticBenchmark(uint32_t seconds, int clients) {
+    char root[] = "/tmp/flood-static-XXXXXX";
+    if (!mkdtemp(root)) {
+        printf("cannot create a temporary directory\n");
+        return 1;
+    }
+    SPIFFS.setRoot(root);
+
+    std::vector<std::string> paths;
+    if (!writeSpiffsCopy(paths) || paths.empty()) {
+        printf("cannot write the SPIFFS copy in %s\n", root);
+        return 1;
+    }
+
+    HttpServer server(0);
+    StaticRoutes handlers{server};
+    if (!server.addRoutes(StaticRoutes::ROUTES, HTTP_ROUTE_COUNT(StaticRoutes::ROUTES), &handlers)) return 1;
+    if (!server.begin()) return 1;
+
+    std::atomic<bool> stop{false};
+    std::thread loop([&]() {
+        while (!stop) server.handleClient();
+    });
+
+    printf("=== Static files: %zu bundled assets, %d clients, %u s per source ===\n", paths.size(), clients,
+           (unsigned)seconds);
+    printf("%-8s %10s %10s %8s %14s %12s\n", "source", "requests", "req/s", "MB/s", "allocs/request",
+           "handler max");
+
+    const char* prefixes[] = {"/spiffs", "/flash"};
+    for (int mode = 0; mode < 2; mode++) {
+        std::vector<ClientResult> results(clients);
+        std::vector<std::thread> threads;
+        uint64_t allocations = sim::heapStats().allocations;
+        auto start = steady_clock::now();
+        auto deadline = start + std::chrono::seconds(seconds);
+        for (int i = 0; i < clients; i++) {
+            threads.emplace_back(runClient, server.port(), prefixes[mode], std::cref(paths), deadline, i,
+                                 std::ref(results[i]));
+        }
+        for (auto& t : threads) t.join();
+        double elapsed = std::chrono::duration<double>(steady_clock::now() - start).count();
+
+        ClientResult total;
+        for (const auto& r : results) {
+            total.requests += r.requests;
+            total.bytes += r.bytes;
+            total.errors += r.errors;
+        }
+        // Clients allocate too (strings of the response): same share in both rows
+        allocations = sim::heapStats().allocations - allocations;
+        HttpRouteStats route = server.routeStats(mode);
+        printf("%-8s %10llu %10.0f %8.2f %14.1f %9u us%s\n", prefixes[mode] + 1, (unsigned long long)total.requests,
+               total.requests / elapsed, total.bytes / elapsed / 1e6,
+               total.requests ? (double)allocations / total.requests : 0.0, (unsigned)route.maxUs,
+               total.errors ? "  ERRORS" : "");
+    }
+
+    stop = true;
+    loop.join();
+    server.stop();
+
+    // Host files sit in the page cache: the chip's SPIFFS is far slower than this
+    printf("(SPIFFS here is the host file system; on the chip each open also scans flash pages)\n");
+    std::string cleanup = std::string("rm -rf ") + root;
+    return system(cleanup.c_str()) == 0 ? 0 : 1;
+}
@@ -0,0 +1,88 @@
+// Entry point of the native simulation build (pio run -e native)
+#include "sim/EInkBenchmark.h"
+#include "sim/FleetSimulator.h"
+#include "sim/HistoryBenchmark.h"
+#include "sim/StaticBenchmark.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Unit tests (pio test -e native) bring their own main()
+#ifndef PIO_UNIT_TESTING
+static void printUsage(const char* program) {
+    printf("Usage: %s [options]\n", program);
+    printf("  --slaves N          slave stations (default 20)\n");
+    printf("  --duration S        simulated seconds (default 60)\n");
+    printf("  --speed X           simulated seconds per wall second (default 10)\n");
+    printf("  --loss P            frame loss rate 0..1 (default 0)\n");
+    printf("  --rx-queue N        frames buffered per receiver (default 32)\n");
+    printf("  --sensors N         master sensor registry size (default slaves + 1)\n");
+    printf("  --http-clients N    dashboard clients polling the master (default 0)\n");
+    printf("  --http-interval MS  poll period per client (default 30000)\n");
+    printf("  --event-clients N   dashboards subscribed to /api/events (default 0)\n");
+    printf("  --slow-clients N    clients downloading the stylesheet slowly (default 0)\n");
+    printf("  --verbose           echo the master's serial console\n");
+    printf("  --bench-history     run the history codec benchmark and exit\n");
+    printf("  --bench-static      compare static files from SPIFFS and from the bundle, then exit\n");
+    printf("  --bench-eink DIR    check the e-ink screens against the golden frames in DIR, time them, then exit\n");
+    printf("  --update-golden     with --bench-eink, (re)write the golden frames instead of failing\n");
+}
+
+int main(int argc, char** argv) {
+    FleetOptions options;
+    const char* einkGoldenDir = nullptr;
+    bool updateGolden = false;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+
+        if (strcmp(arg, "--verbose") == 0) {
+            options.verbose = true;
+            continue;
+        }
+        if (strcmp(arg, "--update-golden") == 0) {
+            updateGolden = true;
+            continue;
+        }
+        if (strcmp(arg, "--bench-history") == 0) {
+            return runHistoryBenchmark(200000);
+        }
+        if (strcmp(arg, "--bench-static") == 0) {
+            return runStaticBenchmark(5, 4);
+        }
+        if (strcmp(arg, "--bench-eink") == 0 && value != nullptr) {
+            einkGoldenDir = value;
+            i++;
+            continue;
+        }
+        if (strcmp(arg, "--help") == 0 || value == nullptr) {
+            printUsage(argv[0]);
+            return strcmp(arg, "--help") == 0 ? 0 : 1;
+        }
+
+        if (strcmp(arg, "--slaves") == 0) options.slaves = atoi(value);
+        else if (strcmp(arg, "--duration") == 0) options.durationSec = (uint32_t)atoi(value);
+        else if (strcmp(arg, "--speed") == 0) options.speed = atof(value);
+        else if (strcmp(arg, "--loss") == 0) options.lossRate = atof(value);
+        else if (strcmp(arg, "--rx-queue") == 0) options.rxQueueDepth = (size_t)atoi(value);
+        else if (strcmp(arg, "--sensors") == 0) options.sensorCapacity = atoi(value);
+        else if (strcmp(arg, "--http-clients") == 0) options.httpClients = atoi(value);
+        else if (strcmp(arg, "--http-interval") == 0) options.httpIntervalMs = (uint32_t)atoi(value);
+        else if (strcmp(arg, "--event-clients") == 0) options.eventClients = atoi(value);
+        else if (strcmp(arg, "--slow-clients") == 0) options.slowClients = atoi(value);
+        else {
+            printUsage(argv[0]);
+            return 1;
+        }
+        i++;
+    }
+
+    if (einkGoldenDir != nullptr) {
+        return runEInkBenchmark(einkGoldenDir, 50, updateGolden);
+    }
+
+    FleetSimulator simulator(options);
+    return simulator.run();
+}
+#endif // PIO_UNIT_TESTING
@@ -0,0 +1,221 @@
+// src/utils/Gorilla.cpp
+#include "utils/Gorilla.h"
+#include <string.h>
+
+namespace {
+
+// Écriture bit à bit (poids fort d'abord) ; overflow si la capacité est dépassée
+class BitWriter {
+public:
+    BitWriter(uint8_t* data, size_t capacity, uint16_t bits)
+        : _data(data), _capacityBits(capacity * 8), _bits(bits), _overflow(false) {}
+
+    void write(uint32_t value, uint8_t n) {
+        if (_overflow || _bits + n > _capacityBits) {
+            _overflow = true;
+            return;
+        }
+        for (int i = n - 1; i >= 0; i--) {
+            uint8_t mask = 0x80 >> (_bits & 7);
+            if ((value >> i) & 1) {
+                _data[_bits >> 3] |= mask;
+            } else {
+                _data[_bits >> 3] &= ~mask;
+            }
+            _bits++;
+        }
+    }
+
+    uint16_t bits() const { return (uint16_t)_bits; }
+    bool overflow() const { return _overflow; }
+
+private:
+    uint8_t* _data;
+    size_t _capacityBits;
+    size_t _bits;
+    bool _overflow;
+};
+
+uint32_t floatBits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsFloat(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint8_t leadingZeros(uint32_t x) {
+    uint8_t n = 0;
+    while (n < 32 && !(x & (0x80000000UL >> n))) n++;
+    return n;
+}
+
+uint8_t trailingZeros(uint32_t x) {
+    uint8_t n = 0;
+    while (n < 32 && !(x & (1UL << n))) n++;
+    return n;
+}
+
+// Étendre le signe d'une valeur sur n bits
+int32_t signExtend(uint32_t value, uint8_t n) {
+    uint32_t sign = 1UL << (n - 1);
+    return (int32_t)((value ^ sign) - sign);
+}
+
+const uint8_t NO_WINDOW = 0xFF;
+
+} // namespace
+
+bool Gorilla::append(uint8_t* data, size_t capacity, uint16_t& bits, uint16_t& count,
+                     GorillaState& state, uint8_t columns, uint32_t time, const float* values) {
+    if (columns > GORILLA_MAX_COLUMNS) return false;
+
+    // Travailler sur une copie de l'état : rien ne change si le point ne tient pas
+    GorillaState next = state;
+    BitWriter out(data, capacity, bits);
+
+    if (count == 0) {
+        out.write(time, 32);
+        next.lastDelta = 0;
+        for (uint8_t c = 0; c < columns; c++) {
+            uint32_t v = floatBits(values[c]);
+            out.write(v, 32);
+            next.lastValue[c] = v;
+            next.leading[c] = NO_WINDOW;
+            next.trailing[c] = 0;
+        }
+    } else {
+        // Temps : delta de delta
+        int32_t delta = (int32_t)(time - state.lastTime);
+        int32_t dod = delta - state.lastDelta;
+        if (dod == 0) {
+            out.write(0, 1);
+        } else if (dod >= -64 && dod <= 63) {
+            out.write(0x2, 2);
+            out.write((uint32_t)dod & 0x7F, 7);
+        } else if (dod >= -256 && dod <= 255) {
+            out.write(0x6, 3);
+            out.write((uint32_t)dod & 0x1FF, 9);
+        } else if (dod >= -2048 && dod <= 2047) {
+            out.write(0xE, 4);
+            out.write((uint32_t)dod & 0xFFF, 12);
+        } else {
+            out.write(0xF, 4);
+            out.write((uint32_t)dod, 32);
+        }
+        next.lastDelta = delta;
+
+        // Valeurs : XOR avec la précédente
+        for (uint8_t c = 0; c < columns; c++) {
+            uint32_t v = floatBits(values[c]);
+            uint32_t x = v ^ state.lastValue[c];
+            next.lastValue[c] = v;
+
+            if (x == 0) {
+                out.write(0, 1);
+                continue;
+            }
+            out.write(1, 1);
+
+            uint8_t lead = leadingZeros(x);   // x != 0 : au plus 31
+            uint8_t trail = trailingZeros(x);
+
+            if (state.leading[c] != NO_WINDOW && lead >= state.leading[c] && trail >= state.trailing[c]) {
+                // Les bits significatifs tiennent dans la fenêtre précédente
+                uint8_t len = 32 - state.leading[c] - state.trailing[c];
+                out.write(0, 1);
+                out.write(x >> state.trailing[c], len);
+            } else {
+                uint8_t len = 32 - lead - trail;
+                out.write(1, 1);
+                out.write(lead, 5);
+                out.write(len - 1, 6);   // 1..32 sur 6 bits
+                out.write(x >> trail, len);
+                next.leading[c] = lead;
+                next.trailing[c] = trail;
+            }
+        }
+    }
+
+    if (out.overflow()) {
+        return false;
+    }
+
+    next.lastTime = time;
+    state = next;
+    bits = out.bits();
+    count++;
+    return true;
+}
+
+GorillaReader::GorillaReader(const uint8_t* data, uint16_t bits, uint16_t count, uint8_t columns)
+    : _data(data), _bits(bits), _count(count),
+      _columns(columns > GORILLA_MAX_COLUMNS ? GORILLA_MAX_COLUMNS : columns), _pos(0), _read(0) {
+    memset(&_state, 0, sizeof(_state));
+}
+
+uint32_t GorillaReader::_readBits(uint8_t n) {
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < n; i++) {
+        uint8_t bit = 0;
+        if (_pos < _bits) {
+            bit = (_data[_pos >> 3] >> (7 - (_pos & 7))) & 1;
+        }
+        value = (value << 1) | bit;
+        _pos++;
+    }
+    return value;
+}
+
+bool GorillaReader::next(uint32_t& time, float* values) {
+    if (_read >= _count || _pos >= _bits) return false;
+
+    if (_read == 0) {
+        _state.lastTime = _readBits(32);
+        _state.lastDelta = 0;
+        for (uint8_t c = 0; c < _columns; c++) {
+            _state.lastValue[c] = _readBits(32);
+            _state.leading[c] = 0;
+            _state.trailing[c] = 0;
+        }
+    } else {
+        int32_t dod;
+        if (_readBits(1) == 0) {
+            dod = 0;
+        } else if (_readBits(1) == 0) {
+            dod = signExtend(_readBits(7), 7);
+        } else if (_readBits(1) == 0) {
+            dod = signExtend(_readBits(9), 9);
+        } else if (_readBits(1) == 0) {
+            dod = signExtend(_readBits(12), 12);
+        } else {
+            dod = (int32_t)_readBits(32);
+        }
+        _state.lastDelta += dod;
+        _state.lastTime += (uint32_t)_state.lastDelta;
+
+        for (uint8_t c = 0; c < _columns; c++) {
+            if (_readBits(1) == 0) continue;   // Valeur inchangée
+
+            if (_readBits(1) == 1) {
+                _state.leading[c] = (uint8_t)_readBits(5);
+                uint8_t len = (uint8_t)_readBits(6) + 1;
+                _state.trailing[c] = 32 - _state.leading[c] - len;
+            }
+            uint8_t len = 32 - _state.leading[c] - _state.trailing[c];
+            uint32_t x = _readBits(len) << _state.trailing[c];
+            _state.lastValue[c] ^= x;
+        }
+    }
+
+    time = _state.lastTime;
+    for (uint8_t c = 0; c < _columns; c++) {
+        values[c] = bitsFloat(_state.lastValue[c]);
+    }
+    _read++;
+    return true;
+}
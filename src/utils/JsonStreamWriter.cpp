@@ -0,0 +1,191 @@
+// src/utils/JsonStreamWriter.cpp
+#include "utils/JsonStreamWriter.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+JsonStreamWriter::JsonStreamWriter(HttpServer& server)
+    : _server(&server), _output(nullptr), _length(0), _total(0), _depth(0), _first(1), _afterKey(false) {
+}
+
+JsonStreamWriter::JsonStreamWriter(String& output)
+    : _server(nullptr), _output(&output), _length(0), _total(0), _depth(0), _first(1), _afterKey(false) {
+}
+
+void JsonStreamWriter::begin(int code, const char* contentType) {
+    if (!_server) return;
+    _server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _server->send(code, contentType, "");
+}
+
+void JsonStreamWriter::end() {
+    // Le serveur ferme la connexion une fois le tampon envoyé
+    _flush();
+}
+
+void JsonStreamWriter::beginObject() {
+    _open('{');
+}
+
+void JsonStreamWriter::endObject() {
+    _close('}');
+}
+
+void JsonStreamWriter::beginArray() {
+    _open('[');
+}
+
+void JsonStreamWriter::endArray() {
+    _close(']');
+}
+
+void JsonStreamWriter::key(const char* name) {
+    _separator();
+    _writeString(name);
+    _write(':');
+    _afterKey = true;
+}
+
+void JsonStreamWriter::value(const char* text) {
+    _separator();
+    if (text) {
+        _writeString(text);
+    } else {
+        _write("null", 4);
+    }
+}
+
+void JsonStreamWriter::value(bool flag) {
+    _separator();
+    if (flag) {
+        _write("true", 4);
+    } else {
+        _write("false", 5);
+    }
+}
+
+void JsonStreamWriter::value(long number) {
+    _separator();
+    char text[24];
+    int n = snprintf(text, sizeof(text), "%ld", number);
+    _write(text, n);
+}
+
+void JsonStreamWriter::value(unsigned long number) {
+    _separator();
+    char text[24];
+    int n = snprintf(text, sizeof(text), "%lu", number);
+    _write(text, n);
+}
+
+void JsonStreamWriter::value(double number) {
+    _separator();
+    if (isnan(number) || isinf(number)) {
+        _write("null", 4);
+        return;
+    }
+    // 7 chiffres significatifs : la précision d'un float
+    char text[32];
+    int n = snprintf(text, sizeof(text), "%.7g", number);
+    _write(text, n);
+}
+
+void JsonStreamWriter::null() {
+    _separator();
+    _write("null", 4);
+}
+
+void JsonStreamWriter::members(const String& object) {
+    if (object.length() <= 2) return;  // "{}" : rien à ajouter
+    _separator();
+    _write(object.c_str() + 1, object.length() - 2);
+}
+
+// Virgule avant chaque élément sauf le premier (et pas entre une clé et sa valeur)
+void JsonStreamWriter::_separator() {
+    if (_afterKey) {
+        _afterKey = false;
+        return;
+    }
+    uint16_t bit = 1 << _depth;
+    if (_first & bit) {
+        _first &= ~bit;
+    } else {
+        _write(',');
+    }
+}
+
+void JsonStreamWriter::_open(char c) {
+    _separator();
+    _write(c);
+    if (_depth + 1 < JSON_STREAM_MAX_DEPTH) {
+        _depth++;
+        _first |= 1 << _depth;
+    }
+}
+
+void JsonStreamWriter::_close(char c) {
+    if (_depth > 0) {
+        _depth--;
+    }
+    _write(c);
+}
+
+void JsonStreamWriter::_write(char c) {
+    if (_length == sizeof(_buffer)) {
+        _flush();
+    }
+    _buffer[_length++] = c;
+}
+
+void JsonStreamWriter::_write(const char* text, size_t length) {
+    while (length > 0) {
+        if (_length == sizeof(_buffer)) {
+            _flush();
+        }
+        size_t n = sizeof(_buffer) - _length;
+        if (n > length) n = length;
+        memcpy(_buffer + _length, text, n);
+        _length += n;
+        text += n;
+        length -= n;
+    }
+}
+
+void JsonStreamWriter::_writeString(const char* text) {
+    _write('"');
+    const char* run = text;
+    for (const char* p = text; *p; p++) {
+        unsigned char c = (unsigned char)*p;
+        if (c != '"' && c != '\\' && c >= 0x20) continue;
+
+        // Copier d'un bloc ce qui précède le caractère à échapper
+        _write(run, p - run);
+        run = p + 1;
+        switch (c) {
+            case '"': _write("\\\"", 2); break;
+            case '\\': _write("\\\\", 2); break;
+            case '\n': _write("\\n", 2); break;
+            case '\r': _write("\\r", 2); break;
+            case '\t': _write("\\t", 2); break;
+            default: {
+                char escaped[7];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                _write(escaped, 6);
+            }
+        }
+    }
+    _write(run, strlen(run));
+    _write('"');
+}
+
+void JsonStreamWriter::_flush() {
+    if (_length == 0) return;
+    if (_server) {
+        _server->sendContent(_buffer, _length);
+    } else {
+        _output->concat(_buffer, _length);
+    }
+    _total += _length;
+    _length = 0;
+}
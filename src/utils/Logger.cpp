@@ -0,0 +1,136 @@
+// src/utils/Logger.cpp
+#include "utils/Logger.h"
+#include <stdarg.h>
+
+#ifndef NATIVE_SIM
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+// Définition des variables statiques
+LogLevel Logger::_currentLogLevel = LOG_LEVEL_INFO;
+bool Logger::_logsEnabled = true;
+NODE_LOCAL Logger::Buffer Logger::_buffer;
+void* Logger::_drainTask = nullptr;
+
+void Logger::begin(LogLevel level) {
+    _currentLogLevel = level;
+    _logsEnabled = true;
+
+#ifndef NATIVE_SIM
+    if (_drainTask == nullptr &&
+        xTaskCreate(_drainLoop, "log", LOG_TASK_STACK_SIZE, nullptr, LOG_TASK_PRIORITY,
+                    (TaskHandle_t*)&_drainTask) != pdPASS) {
+        _drainTask = nullptr;
+        error("Tâche du journal non créée, écriture directe");
+    }
+#endif
+}
+
+void Logger::enableLogs(bool enable) {
+    _logsEnabled = enable;
+}
+
+bool Logger::isLogsEnabled() {
+    return _logsEnabled;
+}
+
+void Logger::setLogLevel(LogLevel level) {
+    _currentLogLevel = level;
+}
+
+LogLevel Logger::getLogLevel() {
+    return _currentLogLevel;
+}
+
+void Logger::flush() {
+    _drain();
+}
+
+uint32_t Logger::getDroppedCount() {
+    return _buffer.dropped.load(std::memory_order_relaxed);
+}
+
+void Logger::error(const String& message) {
+    if (_logsEnabled && _currentLogLevel >= LOG_LEVEL_ERROR) {
+        _write(LOG_LEVEL_ERROR, "%s", message.c_str());
+    }
+}
+
+void Logger::warning(const String& message) {
+    if (_logsEnabled && _currentLogLevel >= LOG_LEVEL_WARNING) {
+        _write(LOG_LEVEL_WARNING, "%s", message.c_str());
+    }
+}
+
+void Logger::info(const String& message) {
+    if (_logsEnabled && _currentLogLevel >= LOG_LEVEL_INFO) {
+        _write(LOG_LEVEL_INFO, "%s", message.c_str());
+    }
+}
+
+void Logger::debug(const String& message) {
+    if (_logsEnabled && _currentLogLevel >= LOG_LEVEL_DEBUG) {
+        _write(LOG_LEVEL_DEBUG, "%s", message.c_str());
+    }
+}
+
+void Logger::ui(const String& message) {
+    _write(LOG_LEVEL_NONE, "%s", message.c_str());
+}
+
+void Logger::_write(LogLevel level, const char* format, ...) {
+    uint32_t ticket;
+    Line* line = _buffer.lines.reserve(ticket);
+    if (line == nullptr) {
+        _buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        va_list args;
+        va_start(args, format);
+        int length = vsnprintf(line->text, sizeof(line->text), format, args);
+        va_end(args);
+        line->level = level;
+        line->length = length < 0 ? 0 : (length < (int)sizeof(line->text) ? length : sizeof(line->text) - 1);
+        _buffer.lines.commit(ticket);
+    }
+
+    // Sans tâche de fond, l'appelant écrit lui-même
+    if (_drainTask == nullptr) {
+        _drain();
+    }
+}
+
+void Logger::_drain() {
+    if (_buffer.draining.exchange(true, std::memory_order_acquire)) {
+        return;  // Un autre écrivain vide déjà le tampon
+    }
+
+    static const char* const PREFIXES[] = {"", "[ERROR] ", "[WARNING] ", "[INFO] ", "[DEBUG] "};
+    const Line* line;
+    while ((line = _buffer.lines.front()) != nullptr) {
+        Serial.print(PREFIXES[line->level]);
+        Serial.write((const uint8_t*)line->text, line->length);
+        Serial.println();
+        _buffer.lines.popFront();
+    }
+
+    uint32_t dropped = _buffer.dropped.load(std::memory_order_relaxed);
+    if (dropped != _buffer.reportedDrops) {
+        Serial.printf("[WARNING] %u lignes du journal perdues (tampon plein)",
+                      (unsigned)(dropped - _buffer.reportedDrops));
+        Serial.println();
+        _buffer.reportedDrops = dropped;
+    }
+
+    _buffer.draining.store(false, std::memory_order_release);
+}
+
+#ifndef NATIVE_SIM
+void Logger::_drainLoop(void* arg) {
+    (void)arg;
+    for (;;) {
+        _drain();
+        vTaskDelay(pdMS_TO_TICKS(LOG_DRAIN_INTERVAL_MS));
+    }
+}
+#endif
@@ -0,0 +1,252 @@
+// src/utils/Scheduler.cpp
+#include "utils/Scheduler.h"
+#include "utils/Logger.h"
+
+#ifdef NATIVE_SIM
+#include <SimNode.h>
+#else
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+Scheduler::Scheduler() : _pending(0), _owner(nullptr) {
+    for (int i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+        _tasks[i].name = nullptr;
+        _tasks[i].callback = nullptr;
+        _tasks[i].periodMs = 0;
+        _tasks[i].nextRunUs = 0;
+        _tasks[i].signalledAtUs = 0;
+        _tasks[i].oneShot = false;
+        _tasks[i].inUse = false;
+    }
+    resetStats();
+}
+
+void Scheduler::begin() {
+#ifdef NATIVE_SIM
+    _owner = sim::SimNode::current();
+#else
+    _owner = xTaskGetCurrentTaskHandle();
+#endif
+}
+
+uint64_t Scheduler::_nowUs() {
+#ifdef NATIVE_SIM
+    return sim::nowMicros();
+#else
+    return (uint64_t)esp_timer_get_time();
+#endif
+}
+
+uint8_t Scheduler::_addTask(const char* name, uint32_t periodMs, uint64_t firstRunUs, bool oneShot, TaskCallback callback) {
+    for (uint8_t i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+        if (!_tasks[i].inUse) {
+            _tasks[i].name = name;
+            _tasks[i].callback = callback;
+            _tasks[i].periodMs = periodMs;
+            _tasks[i].nextRunUs = firstRunUs;
+            _tasks[i].signalledAtUs = 0;
+            _tasks[i].oneShot = oneShot;
+            _tasks[i].inUse = true;
+            return i;
+        }
+    }
+
+    Logger::errorF("Scheduler: plus de place pour la tâche %s", name);
+    return INVALID_TASK;
+}
+
+uint8_t Scheduler::addPeriodic(const char* name, uint32_t periodMs, TaskCallback callback) {
+    // Première exécution au prochain passage de la boucle
+    return _addTask(name, periodMs, _nowUs(), false, callback);
+}
+
+uint8_t Scheduler::addPeriodic(const char* name, uint32_t periodMs, uint32_t firstDelayMs, TaskCallback callback) {
+    return _addTask(name, periodMs, _nowUs() + (uint64_t)firstDelayMs * 1000, false, callback);
+}
+
+uint8_t Scheduler::addEvent(const char* name, TaskCallback callback) {
+    return _addTask(name, 0, 0, false, callback);
+}
+
+uint8_t Scheduler::runAfter(const char* name, uint32_t delayMs, TaskCallback callback) {
+    return _addTask(name, 0, _nowUs() + (uint64_t)delayMs * 1000, true, callback);
+}
+
+void Scheduler::setPeriod(uint8_t id, uint32_t periodMs) {
+    if (id >= SCHEDULER_MAX_TASKS || !_tasks[id].inUse) return;
+    _tasks[id].periodMs = periodMs;
+}
+
+void Scheduler::runIn(uint8_t id, uint32_t delayMs) {
+    if (id >= SCHEDULER_MAX_TASKS || !_tasks[id].inUse) return;
+
+    uint64_t at = _nowUs() + (uint64_t)delayMs * 1000;
+    if (_tasks[id].nextRunUs == 0 || at < _tasks[id].nextRunUs) {
+        _tasks[id].nextRunUs = at;
+    }
+}
+
+// Heure du premier signal seulement : la latence court depuis celui-là
+void Scheduler::_stampSignal(uint8_t id) {
+    uint32_t now = (uint32_t)_nowUs();
+    uint32_t none = 0;
+    _tasks[id].signalledAtUs.compare_exchange_strong(none, now != 0 ? now : 1);
+}
+
+void Scheduler::signal(uint8_t id) {
+    if (id >= SCHEDULER_MAX_TASKS) return;
+
+    _stampSignal(id);
+    _pending.fetch_or(1UL << id);
+    _wake();
+}
+
+void Scheduler::signalFromISR(uint8_t id) {
+    if (id >= SCHEDULER_MAX_TASKS) return;
+
+    _stampSignal(id);
+    _pending.fetch_or(1UL << id);
+
+#ifdef NATIVE_SIM
+    _wake();
+#else
+    if (_owner) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR((TaskHandle_t)_owner, &woken);
+        if (woken == pdTRUE) {
+            portYIELD_FROM_ISR();
+        }
+    }
+#endif
+}
+
+void Scheduler::_wake() {
+    if (!_owner) return;
+#ifdef NATIVE_SIM
+    static_cast<sim::SimNode*>(_owner)->notify();
+#else
+    // Inutile de se notifier soi-même : la boucle regardera _pending avant de dormir
+    if ((TaskHandle_t)_owner != xTaskGetCurrentTaskHandle()) {
+        xTaskNotifyGive((TaskHandle_t)_owner);
+    }
+#endif
+}
+
+// Prochaine échéance parmi les tâches à minuterie (0 si aucune)
+uint64_t Scheduler::_nextDeadlineUs() {
+    uint64_t next = 0;
+    for (int i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+        if (_tasks[i].inUse && _tasks[i].nextRunUs != 0) {
+            if (next == 0 || _tasks[i].nextRunUs < next) {
+                next = _tasks[i].nextRunUs;
+            }
+        }
+    }
+    return next;
+}
+
+void Scheduler::_waitForWork(uint32_t waitMs) {
+#ifdef NATIVE_SIM
+    sim::SimNode* node = static_cast<sim::SimNode*>(_owner);
+    if (node) {
+        // Les callbacks radio du nœud sont délivrés pendant l'attente
+        node->waitForEvents((uint64_t)(waitMs * 1000.0 / sim::clockSpeed()));
+    } else {
+        delay(waitMs);
+    }
+#else
+    if (_owner) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(waitMs));
+    } else {
+        delay(waitMs);
+    }
+#endif
+}
+
+void Scheduler::runOnce(uint32_t maxWaitMs) {
+    // Dormir jusqu'à la prochaine échéance, sauf si une tâche a déjà été signalée
+    if (_pending.load() == 0) {
+        uint64_t now = _nowUs();
+        uint64_t deadline = _nextDeadlineUs();
+        uint32_t waitMs = maxWaitMs;
+
+        if (deadline != 0) {
+            uint64_t untilDeadline = deadline <= now ? 0 : (deadline - now + 999) / 1000;
+            if (untilDeadline < waitMs) waitMs = (uint32_t)untilDeadline;
+        }
+        if (waitMs > 0) {
+            _waitForWork(waitMs);
+        }
+    }
+
+    uint64_t loopStart = _nowUs();
+    uint32_t pending = _pending.exchange(0);
+    bool ranTask = false;
+
+    for (uint8_t i = 0; i < SCHEDULER_MAX_TASKS; i++) {
+        Task& task = _tasks[i];
+        if (!task.inUse) continue;
+
+        bool signalled = (pending & (1UL << i)) != 0;
+        bool due = task.nextRunUs != 0 && task.nextRunUs <= _nowUs();
+        if (!signalled && !due) continue;
+
+        uint32_t signalledAt = signalled ? task.signalledAtUs.exchange(0) : 0;
+        uint64_t start = _nowUs();
+
+        // Retard : depuis le signal ou depuis l'échéance, le plus ancien des
+        // deux (différence sur 32 bits : juste tant qu'elle reste sous 71 minutes)
+        uint32_t latency = signalledAt != 0 ? (uint32_t)start - signalledAt : 0;
+        if (due && start > task.nextRunUs && start - task.nextRunUs > latency) {
+            latency = (uint32_t)(start - task.nextRunUs);
+        }
+        if (latency > _stats.maxLatencyUs) _stats.maxLatencyUs = latency;
+
+        // Replanifier avant l'appel : la tâche peut avancer sa prochaine exécution avec runIn()
+        if (task.periodMs > 0) {
+            task.nextRunUs = start + (uint64_t)task.periodMs * 1000;
+        } else if (due) {
+            task.nextRunUs = 0;
+        }
+
+        TaskCallback callback = task.callback;
+        if (task.oneShot) {
+            task.inUse = false;
+            task.callback = nullptr;
+        }
+        if (callback) callback();
+
+        uint32_t runUs = (uint32_t)(_nowUs() - start);
+        if (runUs > _stats.maxRunUs) {
+            _stats.maxRunUs = runUs;
+            _stats.slowestTask = task.name;
+        }
+        _stats.tasksRun++;
+        ranTask = true;
+    }
+
+    if (ranTask) {
+        _stats.wakeups++;
+        _stats.lastLoopUs = (uint32_t)(_nowUs() - loopStart);
+        if (_stats.lastLoopUs > _stats.maxLoopUs) _stats.maxLoopUs = _stats.lastLoopUs;
+    }
+}
+
+void Scheduler::resetStats() {
+    _stats.wakeups = 0;
+    _stats.tasksRun = 0;
+    _stats.lastLoopUs = 0;
+    _stats.maxLoopUs = 0;
+    _stats.maxLatencyUs = 0;
+    _stats.maxRunUs = 0;
+    _stats.slowestTask = "-";
+}
+
+void Scheduler::printStats() {
+    Logger::infoF("Scheduler: %u réveils, %u tâches, pire latence %u us, pire passage %u us",
+                  (unsigned)_stats.wakeups, (unsigned)_stats.tasksRun,
+                  (unsigned)_stats.maxLatencyUs, (unsigned)_stats.maxLoopUs);
+    Logger::infoF("Scheduler: tâche la plus longue %s (%u us)", _stats.slowestTask, (unsigned)_stats.maxRunUs);
+}
@@ -0,0 +1,21 @@
+// E-ink screens against the golden frames: pio test -e native -f test_eink
+// (run from the project directory, like pio test does)
+#include <unity.h>
+#include "sim/EInkBenchmark.h"
+
+void setUp() {}
+void tearDown() {}
+
+// A missing or different frame fails; after an intended change of a screen:
+// .pio/build/native/program --bench-eink test/golden/eink --update-golden
+void test_screens_match_golden_frames() {
+    TEST_ASSERT_EQUAL_INT(0, runEInkBenchmark("test/golden/eink", 1));
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_screens_match_golden_frames);
+    return UNITY_END();
+}
@@ -0,0 +1,211 @@
+// LedEffects timing against a fake clock: pio test -e native -f test_led_effects
+#include <unity.h>
+#include "indicators/LedEffects.h"
+
+// Fake clock and recorded output: every command with its time
+static uint32_t now;
+
+struct Command {
+    uint32_t time;
+    uint8_t channel;
+    uint8_t level;
+    uint16_t fadeMs;
+};
+static Command commands[32];
+static uint8_t commandCount;
+
+static void record(void* context, uint8_t channel, uint8_t level, uint16_t fadeMs) {
+    (void)context;
+    if (commandCount < sizeof(commands) / sizeof(commands[0])) {
+        commands[commandCount++] = {now, channel, level, fadeMs};
+    }
+}
+
+static LedEffects* effects;
+
+// Advance the clock to `time` and tick
+static uint32_t tickAt(uint32_t time) {
+    now = time;
+    return effects->tick(now);
+}
+
+static void assertCommand(uint8_t index, uint32_t time, uint8_t level, uint16_t fadeMs) {
+    TEST_ASSERT_TRUE_MESSAGE(index < commandCount, "missing output command");
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(time, commands[index].time, "command time");
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(0, commands[index].channel, "command channel");
+    TEST_ASSERT_EQUAL_UINT8_MESSAGE(level, commands[index].level, "command level");
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(fadeMs, commands[index].fadeMs, "command fade");
+}
+
+// Same shapes as the LEDAlertIndicator effects
+static const LedStep BLINK_STEPS[] = {{255, 0, 200}, {0, 0, 200}};
+static const LedPattern BLINK_TWICE = LED_PATTERN(BLINK_STEPS, 2);
+static const LedPattern BLINK = LED_PATTERN(BLINK_STEPS, 0);
+static const LedStep BREATHE_STEPS[] = {{80, 500, 0}, {255, 500, 100}, {80, 500, 0}, {0, 500, 300}};
+static const LedPattern BREATHE = LED_PATTERN(BREATHE_STEPS, 0);
+static const LedStep PULSE_STEPS[] = {{255, 0, 60}, {0, 300, 640}};
+static const LedPattern PULSE = LED_PATTERN(PULSE_STEPS, 0);
+static const LedStep FLASH_STEPS[] = {{100, 0, 150}};
+static const LedPattern FLASH = LED_PATTERN(FLASH_STEPS, 1);
+static const LedStep NOTE_STEPS[] = {{255, 0, 200}};
+static const LedPattern NOTE = LED_PATTERN(NOTE_STEPS, 1);
+static const LedStep LONG_FLASH_STEPS[] = {{255, 0, 600}};
+static const LedPattern LONG_FLASH = LED_PATTERN(LONG_FLASH_STEPS, 1);
+
+void setUp() {
+    now = 0;
+    commandCount = 0;
+    effects = new LedEffects(record, nullptr);
+}
+
+void tearDown() {
+    delete effects;
+}
+
+void test_blink_then_steady_level() {
+    effects->setSteady(0, 40, 0);
+    TEST_ASSERT_TRUE(effects->play(0, BLINK_TWICE, LED_LAYER_STATUS));
+
+    TEST_ASSERT_EQUAL_UINT32(200, tickAt(0));
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(100));   // Early tick: nothing changes
+    TEST_ASSERT_EQUAL_UINT32(200, tickAt(200));
+    TEST_ASSERT_EQUAL_UINT32(200, tickAt(400));
+    TEST_ASSERT_EQUAL_UINT32(200, tickAt(600));
+    TEST_ASSERT_EQUAL_UINT32(0, tickAt(800));
+    TEST_ASSERT_FALSE(effects->isActive(0, LED_LAYER_STATUS));
+
+    TEST_ASSERT_EQUAL(6, commandCount);
+    assertCommand(0, 0, 40, 0);                   // setSteady() with no effect
+    assertCommand(1, 0, 255, 0);
+    assertCommand(2, 200, 0, 0);
+    assertCommand(3, 400, 255, 0);
+    assertCommand(4, 600, 0, 0);
+    assertCommand(5, 800, 40, 0);
+}
+
+// One fade command per segment, the hold folded into the next wakeup
+void test_breathe_emits_fades() {
+    effects->play(0, BREATHE, LED_LAYER_STATUS);
+
+    TEST_ASSERT_EQUAL_UINT32(500, tickAt(0));
+    TEST_ASSERT_EQUAL_UINT32(600, tickAt(500));
+    TEST_ASSERT_EQUAL_UINT32(500, tickAt(1100));
+    TEST_ASSERT_EQUAL_UINT32(800, tickAt(1600));
+    TEST_ASSERT_EQUAL_UINT32(500, tickAt(2400));
+
+    TEST_ASSERT_EQUAL(5, commandCount);
+    assertCommand(0, 0, 80, 500);
+    assertCommand(1, 500, 255, 500);
+    assertCommand(2, 1100, 80, 500);
+    assertCommand(3, 1600, 0, 500);
+    assertCommand(4, 2400, 80, 500);
+}
+
+void test_pulse_flashes_and_fades_out() {
+    effects->play(0, PULSE, LED_LAYER_STATUS);
+
+    TEST_ASSERT_EQUAL_UINT32(60, tickAt(0));
+    TEST_ASSERT_EQUAL_UINT32(940, tickAt(60));
+    TEST_ASSERT_EQUAL_UINT32(60, tickAt(1000));
+
+    TEST_ASSERT_EQUAL(3, commandCount);
+    assertCommand(0, 0, 255, 0);
+    assertCommand(1, 60, 0, 300);
+    assertCommand(2, 1000, 255, 0);
+}
+
+// The notify layer hides the status layer, which keeps its own timing and
+// comes back in phase
+void test_notify_over_status_resumes_in_phase() {
+    effects->play(0, BLINK, LED_LAYER_STATUS);
+    TEST_ASSERT_EQUAL_UINT32(200, tickAt(0));
+
+    effects->play(0, FLASH, LED_LAYER_NOTIFY);
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(100));
+    TEST_ASSERT_EQUAL_UINT32(50, tickAt(200));    // Hidden status segment: no command
+    TEST_ASSERT_EQUAL_UINT32(150, tickAt(250));   // Flash over: status where it would be
+    TEST_ASSERT_EQUAL_UINT32(200, tickAt(400));
+
+    TEST_ASSERT_EQUAL(4, commandCount);
+    assertCommand(0, 0, 255, 0);
+    assertCommand(1, 100, 100, 0);
+    assertCommand(2, 250, 0, 0);
+    assertCommand(3, 400, 255, 0);
+}
+
+// Back in the middle of a fade: only the rest of it, ending on schedule
+void test_status_resumes_mid_fade() {
+    effects->play(0, BREATHE, LED_LAYER_STATUS);
+    tickAt(0);
+    tickAt(500);
+    effects->play(0, NOTE, LED_LAYER_NOTIFY);
+    TEST_ASSERT_EQUAL_UINT32(200, tickAt(1100));
+    TEST_ASSERT_EQUAL_UINT32(300, tickAt(1300));
+    TEST_ASSERT_EQUAL_UINT32(800, tickAt(1600));
+
+    TEST_ASSERT_EQUAL(5, commandCount);
+    assertCommand(2, 1100, 255, 0);
+    assertCommand(3, 1300, 80, 300);
+    assertCommand(4, 1600, 0, 500);
+}
+
+// A fade is never cut short: a notification that comes during one shows
+// when it ends
+void test_change_during_fade_waits_for_its_end() {
+    effects->play(0, BREATHE, LED_LAYER_STATUS);
+    tickAt(0);
+
+    effects->play(0, LONG_FLASH, LED_LAYER_NOTIFY);
+    TEST_ASSERT_EQUAL_UINT32(300, tickAt(200));
+    TEST_ASSERT_EQUAL(1, commandCount);
+    tickAt(500);
+
+    TEST_ASSERT_EQUAL(2, commandCount);
+    assertCommand(1, 500, 255, 0);
+}
+
+void test_cancel_notify_shows_status() {
+    effects->setSteady(0, 10, 0);
+    effects->play(0, LONG_FLASH, LED_LAYER_NOTIFY);
+    tickAt(0);
+    effects->cancel(0, LED_LAYER_NOTIFY);
+    TEST_ASSERT_EQUAL_UINT32(0, tickAt(50));
+
+    TEST_ASSERT_EQUAL(3, commandCount);
+    assertCommand(1, 0, 255, 0);
+    assertCommand(2, 50, 10, 0);
+}
+
+// A delayed pattern leaves the layer under it visible until it starts,
+// then runs on schedule: blinks chained across LEDs
+void test_delayed_start() {
+    effects->setSteady(0, 20, 0);
+    TEST_ASSERT_TRUE(effects->play(0, NOTE, LED_LAYER_NOTIFY, 400));
+    TEST_ASSERT_TRUE(effects->isActive(0, LED_LAYER_NOTIFY));
+
+    TEST_ASSERT_EQUAL_UINT32(400, tickAt(0));
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(300));   // Still waiting: steady level shown
+    TEST_ASSERT_EQUAL(1, commandCount);
+    TEST_ASSERT_EQUAL_UINT32(180, tickAt(420));   // Late tick: ends 200 ms after 400
+    TEST_ASSERT_EQUAL_UINT32(0, tickAt(600));
+
+    TEST_ASSERT_EQUAL(3, commandCount);
+    assertCommand(0, 0, 20, 0);
+    assertCommand(1, 420, 255, 0);
+    assertCommand(2, 600, 20, 0);
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_blink_then_steady_level);
+    RUN_TEST(test_breathe_emits_fades);
+    RUN_TEST(test_pulse_flashes_and_fades_out);
+    RUN_TEST(test_notify_over_status_resumes_in_phase);
+    RUN_TEST(test_status_resumes_mid_fade);
+    RUN_TEST(test_change_during_fade_waits_for_its_end);
+    RUN_TEST(test_cancel_notify_shows_status);
+    RUN_TEST(test_delayed_start);
+    return UNITY_END();
+}
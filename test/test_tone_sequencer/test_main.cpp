@@ -0,0 +1,214 @@
+// ToneSequencer timing against a fake clock: pio test -e native -f test_tone_sequencer
+#include <unity.h>
+#include "indicators/ToneSequencer.h"
+
+// Fake clock and recorded output: every frequency change with its time
+static uint32_t now;
+
+struct Change {
+    uint32_t time;
+    uint16_t frequency;
+};
+static Change changes[32];
+static uint8_t changeCount;
+
+static void record(void* context, uint16_t frequency) {
+    (void)context;
+    if (changeCount < sizeof(changes) / sizeof(changes[0])) {
+        changes[changeCount++] = {now, frequency};
+    }
+}
+
+static ToneSequencer* sequencer;
+
+// Advance the clock to `time` and tick
+static uint32_t tickAt(uint32_t time) {
+    now = time;
+    return sequencer->tick(now);
+}
+
+static void assertChange(uint8_t index, uint32_t time, uint16_t frequency) {
+    TEST_ASSERT_TRUE_MESSAGE(index < changeCount, "missing output change");
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(time, changes[index].time, "change time");
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(frequency, changes[index].frequency, "change frequency");
+}
+
+static const ToneStep BEEP_NOTES[] = {{1000, 100}, {0, 50}, {2000, 100}};
+static const TonePattern BEEP = TONE_PATTERN(BEEP_NOTES, 1);
+static const ToneStep LONG_NOTES[] = {{600, 1000}};
+static const TonePattern LONG_TONE = TONE_PATTERN(LONG_NOTES, 1);
+static const ToneStep SIREN_NOTES[] = {{3000, 100}};
+static const TonePattern SIREN = TONE_PATTERN(SIREN_NOTES, 1);
+static const ToneStep LOOP_NOTES[] = {{500, 100}, {0, 100}};
+static const TonePattern LOOP = TONE_PATTERN(LOOP_NOTES, 0);
+static const ToneStep CHIRP_NOTES[] = {{800, 50}};
+static const TonePattern CHIRP = TONE_PATTERN(CHIRP_NOTES, 1);
+
+void setUp() {
+    now = 0;
+    changeCount = 0;
+    sequencer = new ToneSequencer(record, nullptr);
+}
+
+void tearDown() {
+    delete sequencer;
+}
+
+// Each note starts when the previous one ends, and tick() asks to be called
+// back exactly then
+void test_notes_start_and_stop_on_time() {
+    TEST_ASSERT_TRUE(sequencer->play(BEEP, TONE_PRIORITY_FEEDBACK));
+
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(0));
+    TEST_ASSERT_EQUAL_UINT32(40, tickAt(60));     // Early tick: nothing changes
+    TEST_ASSERT_EQUAL_UINT32(50, tickAt(100));
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(150));
+    TEST_ASSERT_EQUAL_UINT32(0, tickAt(250));
+    TEST_ASSERT_FALSE(sequencer->isPlaying());
+
+    TEST_ASSERT_EQUAL(4, changeCount);
+    assertChange(0, 0, 1000);
+    assertChange(1, 100, 0);
+    assertChange(2, 150, 2000);
+    assertChange(3, 250, 0);
+}
+
+// A late tick does not push the rest of the pattern back
+void test_late_ticks_do_not_accumulate() {
+    sequencer->play(BEEP, TONE_PRIORITY_FEEDBACK);
+
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(0));
+    TEST_ASSERT_EQUAL_UINT32(30, tickAt(120));    // The rest started at 100
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(150));
+    // Too late for the whole note: played in full from now
+    TEST_ASSERT_EQUAL_UINT32(0, tickAt(250));
+    TEST_ASSERT_EQUAL(4, changeCount);
+    assertChange(1, 120, 0);
+}
+
+void test_alert_preempts_feedback() {
+    sequencer->play(LONG_TONE, TONE_PRIORITY_FEEDBACK);
+    TEST_ASSERT_EQUAL_UINT32(1000, tickAt(0));
+
+    TEST_ASSERT_TRUE(sequencer->play(SIREN, TONE_PRIORITY_ALERT));
+    TEST_ASSERT_EQUAL(TONE_PRIORITY_ALERT, sequencer->currentPriority());
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(50));
+    // The interrupted pattern is dropped, not resumed
+    TEST_ASSERT_EQUAL_UINT32(0, tickAt(150));
+    TEST_ASSERT_FALSE(sequencer->isPlaying());
+
+    TEST_ASSERT_EQUAL(3, changeCount);
+    assertChange(0, 0, 600);
+    assertChange(1, 50, 3000);
+    assertChange(2, 150, 0);
+}
+
+void test_feedback_waits_behind_alert() {
+    sequencer->play(SIREN, TONE_PRIORITY_ALERT);
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(0));
+    TEST_ASSERT_TRUE(sequencer->play(CHIRP, TONE_PRIORITY_FEEDBACK));
+    TEST_ASSERT_EQUAL(TONE_PRIORITY_ALERT, sequencer->currentPriority());
+
+    TEST_ASSERT_EQUAL_UINT32(50, tickAt(100));
+    TEST_ASSERT_EQUAL_UINT32(0, tickAt(150));
+    assertChange(0, 0, 3000);
+    assertChange(1, 100, 800);
+    assertChange(2, 150, 0);
+}
+
+// A loop lets a waiting pattern of its priority play at the end of a cycle,
+// then resumes
+void test_loop_gives_way_to_same_priority() {
+    sequencer->play(LOOP, TONE_PRIORITY_WARNING);
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(0));
+    TEST_ASSERT_TRUE(sequencer->play(CHIRP, TONE_PRIORITY_WARNING));
+
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(100));   // The cycle ends first
+    TEST_ASSERT_EQUAL_UINT32(50, tickAt(200));    // Chirp
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(250));   // Loop again
+    TEST_ASSERT_TRUE(sequencer->isPlaying());
+
+    TEST_ASSERT_EQUAL(4, changeCount);
+    assertChange(0, 0, 500);
+    assertChange(1, 100, 0);
+    assertChange(2, 200, 800);
+    assertChange(3, 250, 500);
+}
+
+// ...but a lower one waits until the loop is cancelled
+void test_loop_holds_lower_priority() {
+    sequencer->play(LOOP, TONE_PRIORITY_WARNING);
+    tickAt(0);
+    sequencer->play(CHIRP, TONE_PRIORITY_FEEDBACK);
+    for (uint32_t time = 100; time <= 1000; time += 100) {
+        tickAt(time);
+    }
+    TEST_ASSERT_EQUAL(TONE_PRIORITY_WARNING, sequencer->currentPriority());
+    for (uint8_t i = 0; i < changeCount; i++) {
+        TEST_ASSERT_TRUE(changes[i].frequency != 800);
+    }
+
+    sequencer->cancel(TONE_PRIORITY_WARNING);
+    TEST_ASSERT_EQUAL(TONE_PRIORITY_FEEDBACK, sequencer->currentPriority());
+    TEST_ASSERT_EQUAL_UINT32(50, tickAt(1010));
+    assertChange(changeCount - 1, 1010, 800);
+}
+
+void test_cancel_last_pattern_silences() {
+    sequencer->play(LONG_TONE, TONE_PRIORITY_ALERT);
+    tickAt(0);
+    now = 300;
+    sequencer->cancel(TONE_PRIORITY_ALERT);
+    TEST_ASSERT_FALSE(sequencer->isPlaying());
+    TEST_ASSERT_EQUAL(2, changeCount);
+    assertChange(1, 300, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, tickAt(310));
+    TEST_ASSERT_EQUAL(2, changeCount);
+}
+
+void test_stop_drops_everything() {
+    sequencer->play(LOOP, TONE_PRIORITY_ALERT);
+    sequencer->play(CHIRP, TONE_PRIORITY_FEEDBACK);
+    tickAt(0);
+    now = 40;
+    sequencer->stop();
+    TEST_ASSERT_FALSE(sequencer->isPlaying());
+    TEST_ASSERT_EQUAL_UINT32(0, tickAt(2000));
+    TEST_ASSERT_EQUAL(2, changeCount);
+    assertChange(1, 40, 0);
+}
+
+// A forced tone holds until a pattern takes over, and does not repeat the
+// frequency the output already has
+void test_force_keeps_the_output_in_step() {
+    sequencer->force(1000);
+    TEST_ASSERT_EQUAL_UINT32(0, tickAt(100));     // An idle tick leaves it alone
+    TEST_ASSERT_EQUAL(1, changeCount);
+
+    sequencer->play(BEEP, TONE_PRIORITY_FEEDBACK);
+    TEST_ASSERT_EQUAL_UINT32(100, tickAt(200));   // Already at 1000 Hz
+    TEST_ASSERT_EQUAL(1, changeCount);
+    TEST_ASSERT_EQUAL_UINT32(50, tickAt(300));
+    assertChange(1, 300, 0);
+
+    now = 320;
+    sequencer->force(0);
+    TEST_ASSERT_FALSE(sequencer->isPlaying());
+    TEST_ASSERT_EQUAL(2, changeCount);            // Already silent
+}
+
+int main(int argc, char** argv) {
+    (void)argc;
+    (void)argv;
+    UNITY_BEGIN();
+    RUN_TEST(test_notes_start_and_stop_on_time);
+    RUN_TEST(test_late_ticks_do_not_accumulate);
+    RUN_TEST(test_alert_preempts_feedback);
+    RUN_TEST(test_feedback_waits_behind_alert);
+    RUN_TEST(test_loop_gives_way_to_same_priority);
+    RUN_TEST(test_loop_holds_lower_priority);
+    RUN_TEST(test_cancel_last_pattern_silences);
+    RUN_TEST(test_stop_drops_everything);
+    RUN_TEST(test_force_keeps_the_output_in_step);
+    return UNITY_END();
+}
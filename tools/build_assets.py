@@ -0,0 +1,258 @@
+"""Préparation de l'interface web pour SPIFFS.
+
+Lit les fichiers de data/ et écrit dans .pio/data/ (data_dir de PlatformIO) :
+  - HTML, CSS, JS et SVG minifiés puis compressés en gzip (<fichier>.gz) ;
+  - les autres fichiers copiés tels quels ;
+  - /assets.idx : une ligne par fichier servi
+        <chemin> <etag> <type MIME> <gzip|raw>
+    lue au démarrage par FloodAlertWebServer (ETag, Content-Type, encodage).
+
+Les mêmes octets sont aussi compilés dans le firmware
+(src/generated/AssetBundleData.cpp, voir include/network/AssetBundle.h) :
+tableaux constants lus directement dans la flash, indexés par une table de
+hachage parfaite, sans passer par SPIFFS.
+
+Dans les pages HTML, les liens vers les fichiers CSS/JS/images locaux
+reçoivent ?v=<etag> : ces URL changent à chaque modification du contenu et
+peuvent donc être mises en cache longtemps par le navigateur.
+
+Utilisation :
+    python tools/build_assets.py [source] [destination] [bundle.cpp]
+ou automatiquement avant chaque build (extra_scripts = pre:tools/build_assets.py).
+"""
+
+import gzip
+import hashlib
+import os
+import re
+import shutil
+import sys
+
+MANIFEST = "assets.idx"
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".jpg": "image/jpeg",
+    ".gif": "image/gif",
+    ".ico": "image/x-icon",
+}
+
+# Formats texte : minifiés et compressés
+COMPRESSED = {".html", ".css", ".js", ".json", ".svg"}
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{};,])\s*", r"\1", text)
+    return text.replace(";}", "}").strip()
+
+
+def minify_js(text):
+    # Prudent : indentation, lignes vides et commentaires sur leur propre ligne
+    lines = []
+    in_comment = False
+    for line in text.splitlines():
+        line = line.strip()
+        if in_comment:
+            in_comment = "*/" not in line
+            continue
+        if not line or line.startswith("//"):
+            continue
+        if line.startswith("/*"):
+            in_comment = "*/" not in line
+            continue
+        lines.append(line)
+    return "\n".join(lines)
+
+
+def minify_html(text):
+    text = re.sub(r"<!--(?!\[).*?-->", "", text, flags=re.S)
+    return "\n".join(line.strip() for line in text.splitlines() if line.strip())
+
+
+MINIFIERS = {".css": minify_css, ".js": minify_js, ".html": minify_html}
+
+
+def collect(source):
+    files = []
+    for root, _, names in os.walk(source):
+        for name in sorted(names):
+            path = os.path.join(root, name)
+            files.append("/" + os.path.relpath(path, source).replace(os.sep, "/"))
+    return sorted(files)
+
+
+def encode(path, data):
+    """Contenu stocké sur la flash et indicateur gzip."""
+    ext = os.path.splitext(path)[1].lower()
+    if ext not in COMPRESSED:
+        return data, False
+    minify = MINIFIERS.get(ext)
+    if minify:
+        data = minify(data.decode("utf-8")).encode("utf-8")
+    # mtime=0 : même entrée, mêmes octets, même ETag
+    return gzip.compress(data, compresslevel=9, mtime=0), True
+
+
+def etag_of(data):
+    return '"%s"' % hashlib.sha256(data).hexdigest()[:16]
+
+
+def fnv1a(text, seed):
+    """Même fonction que AssetBundle::hash (src/network/AssetBundle.cpp)."""
+    h = 2166136261 ^ seed
+    for byte in text.encode("utf-8"):
+        h ^= byte
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def perfect_hash(keys):
+    """Hash-and-displace : une graine par groupe place chaque clé dans une case libre.
+
+    case = fnv1a(clé, graines[fnv1a(clé, 0) % groupes]) % cases
+    """
+    buckets_count = max(1, (len(keys) + 1) // 2)
+    slots_count = max(1, len(keys) + len(keys) // 4)
+    buckets = [[] for _ in range(buckets_count)]
+    for key in keys:
+        buckets[fnv1a(key, 0) % buckets_count].append(key)
+
+    seeds = [0] * buckets_count
+    slots = [None] * slots_count
+    # Les groupes les plus remplis d'abord, tant qu'il reste de la place
+    for index in sorted(range(buckets_count), key=lambda i: -len(buckets[i])):
+        bucket = buckets[index]
+        if not bucket:
+            continue
+        for seed in range(1, 65536):
+            placed = [fnv1a(key, seed) % slots_count for key in bucket]
+            if len(set(placed)) == len(placed) and all(slots[p] is None for p in placed):
+                break
+        else:
+            raise RuntimeError("pas de graine pour %s" % bucket)
+        seeds[index] = seed
+        for key, p in zip(bucket, placed):
+            slots[p] = key
+    return seeds, slots
+
+
+def c_string(text):
+    return '"%s"' % text.replace("\\", "\\\\").replace('"', '\\"')
+
+
+def write_bundle(path, entries, contents):
+    keys = sorted(entries)
+    seeds, slots = perfect_hash(keys)
+
+    lines = [
+        "// Généré par tools/build_assets.py à partir de data/ : ne pas modifier",
+        '#include "network/AssetBundle.h"',
+        "",
+    ]
+    for i, key in enumerate(keys):
+        data = contents[key]
+        lines.append("// %s (%d octets)" % (key, len(data)))
+        lines.append("static const uint8_t ASSET_%d[] = {" % i)
+        for start in range(0, len(data), 16):
+            lines.append("    " + ", ".join("0x%02x" % b for b in data[start:start + 16]) + ",")
+        if not data:
+            lines.append("    0,")   # Pas de tableau vide en C++
+        lines.append("};")
+        lines.append("")
+
+    lines.append("const uint16_t ASSET_BUNDLE_COUNT = %d;" % len(keys))
+    lines.append("const uint16_t ASSET_BUNDLE_BUCKETS = %d;" % len(seeds))
+    lines.append("const uint16_t ASSET_BUNDLE_SLOTS = %d;" % len(slots))
+    lines.append("const uint16_t ASSET_BUNDLE_SEEDS[] = {%s};" % ", ".join(str(s) for s in seeds))
+    lines.append("")
+    lines.append("const BundledAsset ASSET_BUNDLE[] = {")
+    for key in slots:
+        if key is None:
+            lines.append("    {nullptr, nullptr, 0, nullptr, nullptr, false},")
+            continue
+        etag, content_type, gzipped = entries[key]
+        lines.append("    {%s, ASSET_%d, %d, %s, %s, %s}," % (
+            c_string(key), keys.index(key), len(contents[key]), c_string(etag), c_string(content_type),
+            "true" if gzipped else "false"))
+    lines.append("};")
+    text = "\n".join(lines) + "\n"
+
+    # Réécrit seulement si le contenu change : pas de recompilation inutile
+    if os.path.exists(path):
+        with open(path, encoding="utf-8") as f:
+            if f.read() == text:
+                return
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(text)
+
+
+def build(source, destination, bundle=None):
+    if os.path.isdir(destination):
+        shutil.rmtree(destination)
+    os.makedirs(destination)
+
+    files = [f for f in collect(source) if os.path.splitext(f)[1].lower() in CONTENT_TYPES]
+    html = [f for f in files if f.endswith(".html")]
+    others = [f for f in files if not f.endswith(".html")]
+
+    # Les pages en dernier : elles référencent les ETag des autres fichiers
+    entries = {}
+    contents = {}
+    raw_total = stored_total = 0
+    for path in others + html:
+        with open(source + path, "rb") as f:
+            data = f.read()
+        raw_total += len(data)
+
+        if path in html:
+            text = data.decode("utf-8")
+            for target, (etag, _, _) in entries.items():
+                text = re.sub(r'((?:href|src)=")%s(")' % re.escape(target),
+                              r"\g<1>%s?v=%s\g<2>" % (target, etag.strip('"')[:8]), text)
+            data = text.encode("utf-8")
+
+        stored, gzipped = encode(path, data)
+        stored_total += len(stored)
+        out = destination + path + (".gz" if gzipped else "")
+        os.makedirs(os.path.dirname(out), exist_ok=True)
+        with open(out, "wb") as f:
+            f.write(stored)
+        entries[path] = (etag_of(stored), CONTENT_TYPES[os.path.splitext(path)[1].lower()], gzipped)
+        contents[path] = stored
+
+    with open(os.path.join(destination, MANIFEST), "w") as f:
+        for path in sorted(entries):
+            etag, content_type, gzipped = entries[path]
+            f.write("%s %s %s %s\n" % (path, etag, content_type, "gzip" if gzipped else "raw"))
+
+    if bundle:
+        write_bundle(bundle, entries, contents)
+
+    print("Assets: %d fichiers, %d -> %d octets" % (len(entries), raw_total, stored_total))
+
+
+def main(argv):
+    here = os.path.dirname(os.path.abspath(__file__))
+    project = os.path.dirname(here)
+    source = argv[1] if len(argv) > 1 else os.path.join(project, "data")
+    destination = argv[2] if len(argv) > 2 else os.path.join(project, ".pio", "data")
+    bundle = argv[3] if len(argv) > 3 else os.path.join(project, "src", "generated", "AssetBundleData.cpp")
+    build(source, destination, bundle)
+
+
+try:
+    # Script PlatformIO (SCons) : data_dir pointe vers le dossier généré
+    Import("env")  # noqa: F821
+    build(os.path.join(env.subst("$PROJECT_DIR"), "data"), env.subst("$PROJECT_DATA_DIR"),  # noqa: F821
+          os.path.join(env.subst("$PROJECT_SRC_DIR"), "generated", "AssetBundleData.cpp"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        main(sys.argv)